@@ -8,10 +8,26 @@
 #include <list>
 #include "MessageLog.h"
 #include "AbortAction.h"
-
-std::list<Trigger*> all_triggers;
+#include "ObjectPool.h"
+#include "Profiler.h"
+#include <typeinfo>
+
+// all triggers are linked through their registry pointers so that
+// they can be removed without searching
+static Trigger *first_trigger = 0;
+static Trigger *last_trigger = 0;
 static boost::recursive_mutex trigger_list_mutex;
 
+static ObjectPool *trigger_pool() {
+	static ObjectPool *pool = new ObjectPool("Trigger");
+	return pool;
+}
+
+static ObjectPool *action_pool() {
+	static ObjectPool *pool = new ObjectPool("Action", 512);
+	return pool;
+}
+
 uint64_t nowMicrosecs();
 
 class TriggerInternals {
@@ -38,12 +54,36 @@ uint64_t Trigger::startTime() { return _internals->start_time; }
 
 void addTrigger(Trigger *t) {
 	boost::recursive_mutex::scoped_lock scoped_lock(trigger_list_mutex);
-	all_triggers.push_back(t);
+	t->registry_next = 0;
+	t->registry_prev = last_trigger;
+	if (last_trigger) last_trigger->registry_next = t; else first_trigger = t;
+	last_trigger = t;
 }
 
 void removeTrigger(Trigger *t) {
 	boost::recursive_mutex::scoped_lock scoped_lock(trigger_list_mutex);
-	all_triggers.remove(t);
+	if (t->registry_prev) t->registry_prev->registry_next = t->registry_next;
+	else if (first_trigger == t) first_trigger = t->registry_next;
+	else return; // not registered
+	if (t->registry_next) t->registry_next->registry_prev = t->registry_prev;
+	else last_trigger = t->registry_prev;
+	t->registry_prev = t->registry_next = 0;
+}
+
+void *Trigger::operator new(size_t size) {
+	return trigger_pool()->allocate(size);
+}
+
+void Trigger::operator delete(void *p, size_t size) {
+	trigger_pool()->release(p, size);
+}
+
+void *Action::operator new(size_t size) {
+	return action_pool()->allocate(size);
+}
+
+void Action::operator delete(void *p, size_t size) {
+	action_pool()->release(p, size);
 }
 
 void Trigger::addHolder(Action *h) {
@@ -58,9 +98,7 @@ char *Trigger::getTriggers() {
 	std::stringstream ss;
 	{
 		boost::recursive_mutex::scoped_lock scoped_lock(trigger_list_mutex);
-		std::list<Trigger*>::iterator iter = all_triggers.begin();
-		while (iter != all_triggers.end()) {
-			Trigger *t = *iter++;
+		for (Trigger *t = first_trigger; t; t = t->registry_next) {
 			ss << t->getName() << " (" << t->refs;
 			if (t->_internals->holders.size()) {
 				ss << ":";
@@ -81,13 +119,13 @@ char *Trigger::getTriggers() {
 }
 
 Trigger::Trigger(const std::string &n) : _internals(0), name(n), seen(false), owner(0),
-		deleted(false), refs(1), is_active(true) {
+		deleted(false), refs(1), is_active(true), registry_prev(0), registry_next(0) {
 	_internals = new TriggerInternals;
 	addTrigger(this);
 }
 
 Trigger::Trigger(TriggerOwner *own, const std::string &n): _internals(0), name(n), seen(false), owner(own),
-		deleted(false), refs(1), is_active(true) {
+		deleted(false), refs(1), is_active(true), registry_prev(0), registry_next(0) {
 	_internals = new TriggerInternals;
 	addTrigger(this);
 }
@@ -277,6 +315,7 @@ void Action::resume() {
 }
 
 Action::Status Action::operator()() {
+	ProfileScope profile(Profiler::Action, typeid(*this).name(), typeid(*this).name());
 	reset();
 	start_time = microsecs();
 	status = Running; // important because run() checks the current state
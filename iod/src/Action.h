@@ -72,6 +72,10 @@ public:
 	void report(const char *message);
 	int getRefs() { return refs; }
 
+	// triggers are allocated from a pool (see ObjectPool.h)
+	static void *operator new(size_t size);
+	static void operator delete(void *p, size_t size);
+
   std::ostream & operator<<(std::ostream &out) const;
 	
 protected:
@@ -83,6 +87,10 @@ protected:
     int refs;
 private:
 	bool is_active;
+	Trigger *registry_prev; // links in the list of all triggers
+	Trigger *registry_next;
+	friend void addTrigger(Trigger *t);
+	friend void removeTrigger(Trigger *t);
 
 	// None of these constructors and assignment operators are
 	// implemented because they are not supported
@@ -102,6 +110,10 @@ public:
 	virtual ~Action();
 
     Action*retain() { ++refs; return this; }
+
+	// actions of all types share a pool (see ObjectPool.h)
+	static void *operator new(size_t size);
+	static void operator delete(void *p, size_t size);
 	int references() { return refs; }
     virtual void release();
     
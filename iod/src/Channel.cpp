@@ -22,6 +22,8 @@
 #include "MachineInterface.h"
 #include "MachineShadowInstance.h"
 #include "WaitAction.h"
+#include "ChannelSendQueue.h"
+#include "PersistenceClient.h"
 
 std::map<std::string, Channel*> *Channel::all = 0;
 std::map< std::string, ChannelDefinition* > *ChannelDefinition::all = 0;
@@ -29,6 +31,27 @@ std::map< std::string, ChannelDefinition* > *ChannelDefinition::all = 0;
 boost::mutex Channel::update_mutex;
 boost::mutex CommandSocketInfo::mutex;
 
+/* handleChannels() only visits channels that have something to do: their filters
+	were modified, a socket monitor or state change means their communications need
+	checking or they are holding throttled updates. Socket monitors call in from
+	their own threads.
+*/
+static boost::mutex housekeeping_mutex;
+static std::set<Channel*> filters_changed;
+static std::set<Channel*> communications_changed;
+static std::set<Channel*> throttled_channels;
+static uint64_t next_throttle_due = 0;
+// publisher channels with a send queue report its metrics once a second
+static std::set<Channel*> queued_channels;
+static uint64_t next_queue_report = 0;
+// the persistence channel while it has changes waiting for the end of the batch window
+static std::set<Channel*> batching_channels;
+static uint64_t next_batch_due = 0;
+
+// the channels that each machine is published to, in name order
+typedef std::map<std::string, Channel*> ChannelsByName;
+static std::map<MachineInstance*, ChannelsByName> machine_channels;
+
 State ChannelImplementation::CONNECTING("CONNECTING");
 State ChannelImplementation::DISCONNECTED("DISCONNECTED");
 State ChannelImplementation::DOWNLOADING("DOWNLOADING");
@@ -134,7 +157,13 @@ public:
 	CommandSocketInfo *cmd_sock_info;
 	MessageRouter router;
 	boost::thread *router_thread;
-	ChannelInternals() :command_sock(0), cmd_sock_info(0), router_thread(0) {}
+	// publisher channels send through a queue, see ChannelSendQueue
+	ChannelSendQueue *send_queue;
+	ChannelSender *sender;
+	boost::thread *sender_thread;
+	PersistenceClient *persistence;
+	ChannelInternals() :command_sock(0), cmd_sock_info(0), router_thread(0),
+		send_queue(0), sender(0), sender_thread(0), persistence(0) {}
 	std::string getCommandSocketName(bool client_endpoint);
 };
 
@@ -193,12 +222,33 @@ Channel::~Channel() {
     while (iter != channel_machines.end()) {
         MachineInstance *machine = *iter++;
         machine->unpublish();
+		std::map<MachineInstance*, ChannelsByName>::iterator found = machine_channels.find(machine);
+		if (found != machine_channels.end()) {
+			(*found).second.erase(name);
+			if ((*found).second.empty()) machine_channels.erase(found);
+		}
     }
 	::machines.erase(_name);
     this->channel_machines.clear();
+	{
+		boost::mutex::scoped_lock lock(housekeeping_mutex);
+		filters_changed.erase(this);
+		communications_changed.erase(this);
+		throttled_channels.erase(this);
+		queued_channels.erase(this);
+		batching_channels.erase(this);
+	}
+	if (internals->send_queue) {
+		internals->send_queue->stop();
+		internals->sender_thread->join();
+		delete internals->sender_thread;
+		delete internals->sender;
+		delete internals->send_queue;
+	}
+	delete internals->persistence;
 	SharedWorkSet::instance()->remove(this);
 	all_machines.remove(this);
-	pending_state_change.erase(this);
+	pending_state_change.remove(this);
     remove(name);
 }
 
@@ -334,6 +384,7 @@ bool Channel::syncRemoteStates(std::list<char *> &messages) {
 
 Action::Status Channel::setState(const State &new_state, uint64_t authority, bool resume) {
 	setNeedsCheck(); // conservative: likely to need attention after a setstate
+	communicationsChanged();
 	if (new_state != ChannelImplementation::DISCONNECTED && connections == 0) {
 		// can only change state if the channel is actually connected
 		if (!communications_manager || (isClient() && !communications_manager->monit_setup) ) {
@@ -455,7 +506,10 @@ void Channel::start() {
 		else
 			startSubscriber();
 	}
+	if (internals->cmd_sock_info && ProcessingThread::instance())
+		ProcessingThread::instance()->addCommandChannel(internals->cmd_sock_info);
 	started_ = true;
+	communicationsChanged();
 }
 
 void Channel::stop() {
@@ -469,6 +523,8 @@ void Channel::stop() {
 		|| definition()->shares_machines() || shares_machines())
 			stopSubscriber();
 	}
+	if (internals->cmd_sock_info && ProcessingThread::instance())
+		ProcessingThread::instance()->removeCommandChannel(internals->cmd_sock_info);
 	started_ = false;
 }
 
@@ -505,6 +561,7 @@ bool Channel::started() { return started_; }
 void Channel::addConnection() {
 	boost::mutex::scoped_lock lock(update_mutex);
 	++connections;
+	communicationsChanged();
 	char buf[100];
 	snprintf(buf, 100, "Channel %s [%s] added connection %d", name.c_str(), current_state.getName().c_str(), connections);
 	MessageLog::instance()->add(buf);
@@ -561,6 +618,7 @@ void Channel::dropConnection() {
 	DBG_CHANNELS << buf << "\n";
 
 	--connections;
+	communicationsChanged();
 
 	if(!connections) {
 		SetStateActionTemplate ssat(CStringHolder("SELF"), "DISCONNECTED" );
@@ -740,7 +798,12 @@ void Channel::startServer(ProtocolType proto) {
 		return;
 	}
 
-	mif = MessagingInterface::create("*", port, proto);
+	if (proto == eZMQ) {
+		createSendQueue();
+		mif = MessagingInterface::createPublisher(port, (int)internals->send_queue->limit());
+	}
+	else
+		mif = MessagingInterface::create("*", port, proto);
 	monit_subs = new SocketMonitor(*mif->getSocket());
 
 	connect_responder = new ChannelConnectMonitor(this);
@@ -749,6 +812,95 @@ void Channel::startServer(ProtocolType proto) {
 	monit_subs->addResponder(ZMQ_EVENT_DISCONNECTED, disconnect_responder);
 	monitor_thread = new boost::thread(boost::ref(*monit_subs));
 	mif->start();
+	if (proto == eZMQ) startSender();
+}
+
+void Channel::createSendQueue() {
+	if (internals->send_queue) return;
+	long limit = 10000;
+	Value limit_val = getValue("queue_limit");
+	if (limit_val != SymbolTable::Null && (!limit_val.asInteger(limit) || limit <= 0)) {
+		std::string msg = MessageLog::instance()->add("Warning: channel ", name.c_str(),
+				" has an invalid queue_limit, using 10000");
+		DBG_CHANNELS << msg << "\n";
+		limit = 10000;
+	}
+	ChannelSendQueue::OverflowPolicy policy = ChannelSendQueue::DropOldest;
+	Value policy_val = getValue("overflow");
+	if (policy_val != SymbolTable::Null && !ChannelSendQueue::policyFromString(policy_val.asString(), policy)) {
+		std::string msg = MessageLog::instance()->add("Warning: channel ", name.c_str(),
+				" has an unknown overflow policy, expected drop_oldest, coalesce or disconnect");
+		DBG_CHANNELS << msg << "\n";
+	}
+	internals->send_queue = new ChannelSendQueue(limit, policy);
+}
+
+void Channel::startSender() {
+	if (!internals->send_queue || internals->sender) return;
+	internals->sender = new ChannelSender(*internals->send_queue, *mif);
+	internals->sender_thread = new boost::thread(boost::ref(*internals->sender));
+	boost::mutex::scoped_lock lock(housekeeping_mutex);
+	queued_channels.insert(this);
+}
+
+void Channel::queueMessage(const std::string &key, const char *text, const MessageHeader *header, bool raw) {
+	if (internals->send_queue)
+		internals->send_queue->push(key, text, header, raw);
+	else if (raw)
+		mif->send_raw(text);
+	else if (header) {
+		MessageHeader mh(*header);
+		safeSend(*mif->getSocket(), text, strlen(text), mh);
+	}
+	else
+		mif->send(text);
+}
+
+void Channel::reportQueueMetrics(uint64_t now) {
+	ChannelSendQueue *queue = internals->send_queue;
+	setValue("subscribers", (long)connections);
+	setValue("queue_depth", (long)queue->depth());
+	setValue("queue_lag", (long)(queue->lag(now) / 1000));
+	setValue("queue_sent", (long)queue->sent_count);
+	setValue("queue_dropped", (long)queue->dropped);
+	setValue("queue_coalesced", (long)queue->coalesced);
+	setValue("queue_disconnects", (long)queue->disconnects);
+	setValue("queue_peer_dropped", (long)queue->peer_dropped);
+	PersistenceClient *persistence = internals->persistence;
+	if (persistence) {
+		setValue("persist_pending", (long)persistence->pendingCount());
+		setValue("persist_sent", (long)persistence->sentSeq());
+		setValue("persist_acked", (long)persistence->ackedSeq());
+		setValue("persist_lag", (long)(persistence->lag(now) / 1000));
+	}
+}
+
+void Channel::startPersistenceBatches() {
+	if (internals->persistence) return;
+	long window = 100;
+	Value window_val = getValue("batch_window");
+	if (window_val != SymbolTable::Null && (!window_val.asInteger(window) || window < 0)) {
+		std::string msg = MessageLog::instance()->add("Warning: channel ", name.c_str(),
+				" has an invalid batch_window, using 100ms");
+		DBG_CHANNELS << msg << "\n";
+		window = 100;
+	}
+	if (window == 0) return; // property changes are sent individually
+	internals->persistence = new PersistenceClient(window * 1000);
+}
+
+PersistenceClient *Channel::persistenceClient() { return internals->persistence; }
+
+void Channel::sendPersistenceBatch(uint64_t now) {
+	PersistenceClient *persistence = internals->persistence;
+	if (!persistence->pending() || now < persistence->dueTime()) return;
+	uint64_t seq;
+	const std::string &batch = persistence->takeBatch(seq);
+	MessageHeader mh(MessageHeader::SOCK_CW, MessageHeader::SOCK_CHAN, false);
+	mh.start_time = now;
+	char key[40];
+	snprintf(key, 40, "PERSIST %lu", (unsigned long)seq); // batches are never coalesced
+	queueMessage(key, batch.c_str(), &mh);
 }
 
 void Channel::startClient() {
@@ -1328,6 +1480,38 @@ void ChannelImplementation::checked() {
     last_checked = microsecs();
 }
 
+void Channel::modified() {
+	ChannelImplementation::modified();
+	boost::mutex::scoped_lock lock(housekeeping_mutex);
+	filters_changed.insert(this);
+}
+
+void Channel::communicationsChanged() {
+	boost::mutex::scoped_lock lock(housekeeping_mutex);
+	communications_changed.insert(this);
+}
+
+const std::map<std::string, Channel*> &Channel::channelsMonitoring(MachineInstance *machine) {
+	static const ChannelsByName none;
+	std::map<MachineInstance*, ChannelsByName>::const_iterator found = machine_channels.find(machine);
+	if (found == machine_channels.end()) return none;
+	return (*found).second;
+}
+
+bool Channel::linkMachine(MachineInstance *machine) {
+	if (!channel_machines.insert(machine).second) return false;
+	machine_channels[machine][name] = this;
+	return true;
+}
+
+void Channel::unlinkMachine(MachineInstance *machine) {
+	if (!channel_machines.erase(machine)) return;
+	std::map<MachineInstance*, ChannelsByName>::iterator found = machine_channels.find(machine);
+	if (found == machine_channels.end()) return;
+	(*found).second.erase(name);
+	if ((*found).second.empty()) machine_channels.erase(found);
+}
+
 static void copyJSONArrayToSet(cJSON *obj, const char *key, std::set<std::string> &res) {
     cJSON *items = cJSON_GetObjectItem(obj, key);
     if (items && items->type == cJSON_Array) {
@@ -1494,6 +1678,17 @@ void Channel::sendPropertyChangeMessage(MachineInstance *m, const std::string &n
 										const Value &val, uint64_t auth) {
 	if (definition()->hasFeature(ChannelDefinition::ReportLocalPropertyChanges)
 		|| (m->getStateMachine() && m->getStateMachine()->local_properties.count(key.asString())) ) return;
+	if (internals->persistence) {
+		bool idle = !internals->persistence->pending();
+		internals->persistence->update(name, key.asString(), val, nowMicrosecs());
+		if (idle) {
+			boost::mutex::scoped_lock lock(housekeeping_mutex);
+			uint64_t due = internals->persistence->dueTime();
+			if (batching_channels.insert(this).second && (batching_channels.size() == 1 || due < next_batch_due))
+				next_batch_due = due;
+		}
+		return;
+	}
 	if (communications_manager) {
 		std::string response;
 		char *cmd = 0;
@@ -1532,8 +1727,7 @@ void Channel::sendPropertyChangeMessage(MachineInstance *m, const std::string &n
 			safeSend(*cmd_client, cmd, strlen(cmd), mh);
 		}
 		else if (mif) {
-			//mif->send(cmd);
-			safeSend(*mif->getSocket(), cmd, strlen(cmd), mh);
+			queueMessage(std::string("PROPERTY ") + name + " " + key.asString(), cmd, &mh);
 		}
 		else {
 			char buf[150];
@@ -1549,8 +1743,7 @@ void Channel::sendPropertyChangeMessage(MachineInstance *m, const std::string &n
 		MessageHeader mh(MessageHeader::SOCK_CW, MessageHeader::SOCK_CHAN, false);
 		mh.start_time = microsecs();
 		char *cmd = MessageEncoding::encodeCommand("PROPERTY", name, key, val); // send command
-		safeSend(*mif->getSocket(), cmd, strlen(cmd), mh);
-		//mif->send(cmd);
+		queueMessage(std::string("PROPERTY ") + name + " " + key.asString(), cmd, &mh);
 		free(cmd);
 	}
 }
@@ -1560,20 +1753,24 @@ void Channel::sendPropertyChange(MachineInstance *machine, const Value &key, con
     if (!all) return;
     std::string name = machine->fullName();
 	if (machine->getStateMachine() && machine->getStateMachine()->propertyIsLocal(key)) return;
-    std::map<std::string, Channel*>::iterator iter = all->begin();
-    while (iter != all->end()) {
+	const ChannelsByName &monitoring = channelsMonitoring(machine);
+	ChannelsByName::const_iterator iter = monitoring.begin();
+    while (iter != monitoring.end()) {
         Channel *chn = (*iter).second; iter++;
 			if (!chn->definition()->hasFeature(ChannelDefinition::ReportPropertyChanges)) continue;
 			if (chn->current_state != ChannelImplementation::ACTIVE) continue;
 		//if (machine->ownerChannel() == chn) continue; // shadows don't forward their properties back on their channel
-        if (!chn->channel_machines.count(machine))
-            continue;
         if (chn->filtersAllow(machine)) {
 			if (chn->throttle_time && machine->needsThrottle()) {
 				DBG_CHANNELS << chn->getName() << " throttling " << machine->getName() << " " << key << "\n";
 				if (!chn->throttled_items[machine])
 					chn->throttled_items[machine] = new MachineRecord(machine);
 				chn->throttled_items[machine]->properties[key.asString()] = val;
+				boost::mutex::scoped_lock lock(housekeeping_mutex);
+				if (throttled_channels.insert(chn).second) {
+					uint64_t due = chn->last_throttled_send + chn->throttle_time;
+					if (throttled_channels.size() == 1 || due < next_throttle_due) next_throttle_due = due;
+				}
 			}
 			else {
 				if ( chn->definition()->hasFeature(ChannelDefinition::ReportLocalPropertyChanges)
@@ -1644,8 +1841,9 @@ void Channel::sendThrottledUpdates() {
 void Channel::sendPropertyChanges(MachineInstance *machine) {
     if (!all) return;
     std::string name = machine->fullName();
-    std::map<std::string, Channel*>::iterator iter = all->begin();
-    while (iter != all->end()) {
+	const ChannelsByName &monitoring = channelsMonitoring(machine);
+	ChannelsByName::const_iterator iter = monitoring.begin();
+    while (iter != monitoring.end()) {
         Channel *chn = (*iter).second; iter++;
 			bool do_modbus = chn->definition()->hasFeature(ChannelDefinition::ReportModbusUpdates);
 			bool do_properties = chn->definition()->hasFeature(ChannelDefinition::ReportPropertyChanges);
@@ -1653,9 +1851,6 @@ void Channel::sendPropertyChanges(MachineInstance *machine) {
 			if (chn->current_state == ChannelImplementation::DISCONNECTED) continue;
 			if (!do_modbus && !do_properties) continue;
 
-        if (!chn->channel_machines.count(machine))
-            continue;
-
 		if (!chn->throttle_time) continue;
 
 		std::map<MachineInstance *, MachineRecord*>::iterator found = chn->throttled_items.find(machine);
@@ -1813,15 +2008,13 @@ void Channel::sendStateChange(MachineInstance *machine, std::string new_state, u
     std::string machine_name = machine->fullName();
 	char *cmdstr = 0;
 
-	std::map<std::string, Channel*>::iterator iter = all->begin();
-    while (iter != all->end()) {
+	const ChannelsByName &monitoring = channelsMonitoring(machine);
+	ChannelsByName::const_iterator iter = monitoring.begin();
+    while (iter != monitoring.end()) {
         Channel *chn = (*iter).second; iter++;
 		if (chn->current_state == ChannelImplementation::DISCONNECTED) continue;
 		if (!chn->definition()->hasFeature(ChannelDefinition::ReportStateChanges)) continue;
 
-		if (!chn->channel_machines.count(machine))
-			continue;
-
 		// shadow machines use the authority provided by the caller to effect the
 		// state change but 'real' devices escalate to the channel's authority to
 		// make sure that shadow listen.
@@ -1856,13 +2049,9 @@ void Channel::sendStateChange(MachineInstance *machine, std::string new_state, u
 				safeSend(*chn->cmd_client, cmdstr, strlen(cmdstr), mh);
 			}
 			else if (chn->mif) {
-#if 0
-				chn->mif->send(cmdstr);
-#else
 				MessageHeader mh(MessageHeader::SOCK_CW, MessageHeader::SOCK_CHAN, false);
 				mh.start_time = microsecs();
-				safeSend(*chn->mif->getSocket(), cmdstr, strlen(cmdstr), mh);
-#endif
+				chn->queueMessage("STATE " + machine_name, cmdstr, &mh);
 			}
 			else {
 				char buf[150];
@@ -1937,7 +2126,7 @@ void Channel::requestStateChange(MachineInstance *machine, std::string new_state
 			}
 		}
 		else if (mif) {
-			mif->send(cmdstr);
+			queueMessage("STATE " + machine_name, cmdstr);
 		}
 		else {
 			char buf[150];
@@ -1990,15 +2179,13 @@ void Channel::sendCommand(MachineInstance *machine, std::string command, std::li
 	else {
 		DBG_CHANNELS << " sending " << command << " to channels that monitor " << machine->getName() << "\n";
 		std::string name = machine->fullName();
-		std::map<std::string, Channel*>::iterator iter = all->begin();
-		while (iter != all->end()) {
+		const ChannelsByName &monitoring = channelsMonitoring(machine);
+		ChannelsByName::const_iterator iter = monitoring.begin();
+		while (iter != monitoring.end()) {
 			Channel *chn = (*iter).second; iter++;
 			if (chn->current_state == ChannelImplementation::DISCONNECTED) continue;
 			if (command == "UPDATE" && !chn->definition()->hasFeature(ChannelDefinition::ReportModbusUpdates))
 				continue;
-
-			if (!chn->channel_machines.count(machine))
-				continue;
 			if (chn->filtersAllow(machine)) {
 				if ( (!chn->isClient() && chn->communications_manager)
 						 || ( chn->isClient() && chn->communications_manager
@@ -2017,8 +2204,7 @@ void Channel::sendCommand(MachineInstance *machine, std::string command, std::li
 					DBG_CHANNELS << "Channel " << chn->name << " sending " << cmd << "\n";
 					MessageHeader mh(MessageHeader::SOCK_CW, MessageHeader::SOCK_CHAN, false);
 					mh.start_time = microsecs();
-					safeSend(*chn->mif->getSocket(), cmd, strlen(cmd), mh);
-					//chn->mif->send(cmd);
+					chn->queueMessage("", cmd, &mh);
 					free(cmd);
 				}
 				else {
@@ -2186,7 +2372,7 @@ void Channel::enableShadows() {
 				|| ( definition()->authority == machine_auth)) {
 				DBG_CHANNELS << "Channel " << name << " enabling shadow machine " << ms->getName() << "\n";
 				if (channel_machines.count(ms) == 0) {
-					channel_machines.insert(ms); // ensure the channel is linked to the shadow machine
+					linkMachine(ms); // ensure the channel is linked to the shadow machine
 					modified();
 				}
 				EnableActionTemplate ea(ms->getName().c_str());
@@ -2205,7 +2391,7 @@ void Channel::enableShadows() {
 			if (authority == machine_auth) {
 				DBG_CHANNELS << "Channel " << name << " enabling shadow machine " << ms->getName() << "\n";
 				if (channel_machines.count(ms) == 0) {
-					channel_machines.insert(ms); // ensure the channel is linked to the shadow machine
+					linkMachine(ms); // ensure the channel is linked to the shadow machine
 					modified();
 				}
 				EnableActionTemplate ea(ms->getName().c_str());
@@ -2265,7 +2451,7 @@ void Channel::setupShadows() {
         if (m && !ms) { // this machine is not a shadow.
             if (!channel_machines.count(m)) {
                 m->publish();
-                channel_machines.insert(m);
+                linkMachine(m);
 				modified();
             }
         }
@@ -2273,7 +2459,7 @@ void Channel::setupShadows() {
 			m->publish();
             // this machine is a shadow
 			DBG_CHANNELS << "Channel " << name << " adding shadow machine " << m->getName() << "\n";
-			channel_machines.insert(m);
+			linkMachine(m);
 			modified();
 			m->owner_channel = this;
         }
@@ -2287,7 +2473,7 @@ void Channel::setupShadows() {
 		if (m && !ms) { // this machine is not a shadow.
 			if (!channel_machines.count(m)) {
 				m->publish();
-				channel_machines.insert(m);
+				linkMachine(m);
 				modified();
 			}
 		}
@@ -2302,6 +2488,14 @@ void Channel::setupShadows() {
 
 
 CommandSocketInfo::CommandSocketInfo(Channel* chn) : sock(0), index(0) {
+	bind(chn->getName());
+}
+
+CommandSocketInfo::CommandSocketInfo(const std::string &owner) : sock(0), index(0) {
+	bind(owner);
+}
+
+void CommandSocketInfo::bind(const std::string &owner) {
 	chn_scoped_lock lock("construct CommandSocketInfo", mutex);
 	index = ++last_idx;
 	char buf[50];
@@ -2314,11 +2508,11 @@ CommandSocketInfo::CommandSocketInfo(Channel* chn) : sock(0), index(0) {
 	}
 	catch (zmq::error_t zex) {
 		char errmsg[150];
-		snprintf(errmsg, 150, "Exception binding a command socket for %s: %s", chn->getName().c_str(), buf);
+		snprintf(errmsg, 150, "Exception binding a command socket for %s: %s", owner.c_str(), buf);
 		MessageLog::instance()->add(errmsg);
 		NB_MSG << errmsg << "\n";
 	}
-	DBG_CHANNELS << "Bound command channel socket (processing side) of " << chn->getName() << " to " << buf << " at index " << index << "\n";
+	DBG_CHANNELS << "Bound command channel socket (processing side) of " << owner << " to " << buf << " at index " << index << "\n";
 }
 
 CommandSocketInfo::~CommandSocketInfo() { delete sock; }
@@ -2361,54 +2555,76 @@ void Channel::setupCommandSockets() {
 void Channel::handleChannels() {
 	if (!all) return;
 	uint64_t now = nowMicrosecs();
-	std::map<std::string, Channel*>::iterator iter = all->begin();
-    while (iter != all->end()) {
-        const std::pair<std::string, Channel *> &item = *iter++;
-        Channel *chn = item.second;
-		    chn->setupFilters();
-        chn->checkCommunications();
-		if (chn->throttledItemsReady(now)) {
-			chn->sendThrottledUpdates();
-		}
-		/*
-		IODCommand *command = chn->getCommand();
-		if (command) {
-			{FileLogger fl(program_name);
-			fl.f() << "Processing: received command: " << *command << " on channel " << chn->name << "\n";}
-			//hack?
-			if (command->param(0) == "STATE"
-				&& command->numParams() == 4) {
-				MachineInstance *m = MachineInstance::find(command->param(1).asString().c_str());
-				if ( !m->isShadow()){
-					if (command->param(3) == (long)chn->getAuthority()) {
-						// do nothing, this is an echo of a command we sent
-						{FileLogger fl(program_name); fl.f() << "skipping echoed command\n"; }
-					}
-					else {
-						(*command)();
-					}
-				}
-				else {
-					if (command->param(3) != 0) {
-						{FileLogger fl(program_name);
-							fl.f() << chn->name
-							<< "(client) processing command for shadow  with auth: "
-							<< command->param(3) << "\n";
-						}
-						(*command)();
-					}
-				}
+	std::set<Channel*> filters;
+	std::set<Channel*> checks;
+	std::vector<Channel*> throttled;
+	std::vector<Channel*> reporting;
+	std::vector<Channel*> batching;
+	{
+		boost::mutex::scoped_lock lock(housekeeping_mutex);
+		bool throttle_due = !throttled_channels.empty() && now >= next_throttle_due;
+		bool report_due = !queued_channels.empty() && now >= next_queue_report;
+		bool batch_due = !batching_channels.empty() && now >= next_batch_due;
+		if (filters_changed.empty() && communications_changed.empty() && !throttle_due && !report_due && !batch_due)
+			return;
+		filters.swap(filters_changed);
+		checks.swap(communications_changed);
+		if (throttle_due) throttled.assign(throttled_channels.begin(), throttled_channels.end());
+		if (batch_due) batching.assign(batching_channels.begin(), batching_channels.end());
+		if (report_due) {
+			next_queue_report = now + 1000000;
+			reporting.assign(queued_channels.begin(), queued_channels.end());
+		}
+	}
+	// setting the metric properties may throttle updates, so this is done without the lock
+	std::vector<Channel*>::iterator r_iter = reporting.begin();
+	while (r_iter != reporting.end()) (*r_iter++)->reportQueueMetrics(now);
+	std::set<Channel*>::iterator iter = filters.begin();
+	while (iter != filters.end()) (*iter++)->setupFilters();
+
+	iter = checks.begin();
+	while (iter != checks.end()) {
+		Channel *chn = *iter++;
+		if (chn->checkCommunications()) chn->communicationsChanged();
+	}
+
+	if (!batching.empty()) {
+		std::vector<Channel*>::iterator b_iter = batching.begin();
+		while (b_iter != batching.end()) (*b_iter++)->sendPersistenceBatch(now);
+		boost::mutex::scoped_lock lock(housekeeping_mutex);
+		next_batch_due = 0;
+		iter = batching_channels.begin();
+		while (iter != batching_channels.end()) {
+			Channel *chn = *iter;
+			if (!chn->internals->persistence->pending()) {
+				batching_channels.erase(iter++);
+				continue;
 			}
-			else
-				(*command)();
-
-			{FileLogger fl(program_name);
-			fl.f() << chn->name << "posting completed command: " << *command << " on channel " << chn->name << "\n";}
-
-			chn->putCompletedCommand(command);
+			uint64_t due = chn->internals->persistence->dueTime();
+			if (!next_batch_due || due < next_batch_due) next_batch_due = due;
+			++iter;
+		}
+	}
 
+	if (throttled.empty()) return;
+	std::vector<Channel*>::iterator t_iter = throttled.begin();
+	while (t_iter != throttled.end()) {
+		Channel *chn = *t_iter++;
+		if (chn->throttledItemsReady(now)) chn->sendThrottledUpdates();
+	}
+	boost::mutex::scoped_lock lock(housekeeping_mutex);
+	next_throttle_due = 0;
+	iter = throttled_channels.begin();
+	while (iter != throttled_channels.end()) {
+		Channel *chn = *iter;
+		if (chn->throttled_items.empty()) {
+			throttled_channels.erase(iter++);
+			continue;
 		}
-		 */
+		uint64_t due = chn->last_throttled_send + chn->throttle_time;
+		if (due <= now) due = now + chn->throttle_time; // not sent, the channel is not active
+		if (!next_throttle_due || due < next_throttle_due) next_throttle_due = due;
+		++iter;
 	}
 }
 
@@ -2425,15 +2641,15 @@ void Channel::disable() {
 }
 
 // This method is executed on the main thread
-void Channel::checkCommunications() {
+bool Channel::checkCommunications() {
 #if 0
 	char tnam[100];
 	int pgn_rc = pthread_getname_np(pthread_self(),tnam, 100);
 	assert(pgn_rc == 0);
 	DBG_CHANNELS << "Channel " << name << " checkCommunications on thread "<< tnam << "\n";
 #endif
-	if (!communications_manager) return;
-	if (!communications_manager->ready()) return;
+	if (!communications_manager) return false;
+	if (!communications_manager->ready()) return true;
     //bool ok = communications_manager->checkConnections();
     if (communications_manager->monit_setup->disconnected()
 		|| communications_manager->monit_subs.disconnected() )
@@ -2448,8 +2664,9 @@ void Channel::checkCommunications() {
 						setState(ChannelImplementation::CONNECTING);
 				}
 			}
+			return true; // the setup connection is not monitored, keep checking until it connects
 		}
-        return;
+        return false;
 	}
 	if ( current_state == ChannelImplementation::DISCONNECTED) {
 		setState(ChannelImplementation::CONNECTED);
@@ -2461,7 +2678,7 @@ void Channel::checkCommunications() {
 		else
 			setState(ChannelImplementation::UPLOADING);
 	}
-
+	return false;
 }
 
 void Channel::setupAllShadows() {
@@ -2478,82 +2695,83 @@ void Channel::setupAllShadows() {
 void Channel::setupFilters() {
 	if (last_modified < last_checked) return;
 	DBG_CHANNELS << name << " setting up filters\n";
-    // check if this channel monitors exports and if so, add machines that have exports
-    if (definition()->monitors_exports || monitors_exports) {
-        std::list<MachineInstance*>::iterator m_iter = MachineInstance::begin();
-        while (m_iter != MachineInstance::end()) {
-            MachineInstance *machine = *m_iter++;
-            if (! machine->modbus_exports.empty() ) {
-                this->channel_machines.insert(machine);
-                machine->publish();
-            }
-        }
-    }
 
-	if (definition()->monitor_linked.size()) {
-		std::set<std::string>::const_iterator iter = definition()->monitor_linked.begin();
-		while (iter != definition()->monitor_linked.end()) {
-			const std::string &machine_name = *iter++;
-			MachineInstance *master = MachineInstance::find(machine_name.c_str());
-			if (!master) {
-				char buf[150];
-				snprintf(buf, 150, "Channel %s cannot find master machine %s", name.c_str(), machine_name.c_str());
-				MessageLog::instance()->add(buf);
-				DBG_CHANNELS << buf << "\n";
+	/* gather the masters and patterns first so the machines are only scanned once,
+		however many of them there are.
+	*/
+	bool match_exports = definition()->monitors_exports || monitors_exports;
+	std::set<Transmitter*> masters;
+	std::set<std::string>::const_iterator iter = definition()->monitor_linked.begin();
+	while (iter != definition()->monitor_linked.end()) {
+		const std::string &machine_name = *iter++;
+		MachineInstance *master = MachineInstance::find(machine_name.c_str());
+		if (!master) {
+			char buf[150];
+			snprintf(buf, 150, "Channel %s cannot find master machine %s", name.c_str(), machine_name.c_str());
+			MessageLog::instance()->add(buf);
+			DBG_CHANNELS << buf << "\n";
+		}
+		else masters.insert(master);
+	}
+	std::vector<rexp_info *> patterns;
+	iter = definition()->monitors_patterns.begin();
+	while (iter != definition()->monitors_patterns.end()) {
+		const std::string &pattern = *iter++;
+		rexp_info *rexp = create_pattern(pattern.c_str());
+		if (!rexp->compilation_error)
+			patterns.push_back(rexp);
+		else {
+			MessageLog::instance()->add(rexp->compilation_error);
+			DBG_CHANNELS << "Channel error: " << definition()->name << " " << rexp->compilation_error << "\n";
+		}
+	}
+	const std::map<std::string, Value> &properties = definition()->monitors_properties;
+
+	if (match_exports || !masters.empty() || !patterns.empty() || !properties.empty()) {
+		std::list<MachineInstance*>::iterator m_iter = MachineInstance::begin();
+		while (m_iter != MachineInstance::end()) {
+			MachineInstance *machine = *m_iter++;
+			if (!machine) continue;
+			// check if this channel monitors exports and if so, add machines that have exports
+			if (match_exports && ! machine->modbus_exports.empty() ) {
+				linkMachine(machine);
+				machine->publish();
+			}
+			if (!masters.empty() && !channel_machines.count(machine)) {
+				std::set<Transmitter*>::iterator master = masters.begin();
+				while (master != masters.end()) {
+					if (machine->listens.count(*master++)) {
+						machine->publish();
+						linkMachine(machine);
+						break;
+					}
+				}
 			}
-			std::list<MachineInstance*>::iterator m_iter = MachineInstance::begin();
-			while (m_iter != MachineInstance::end()) {
-				MachineInstance *machine = *m_iter++;
-				if (machine && machine->listens.count(master) && !this->channel_machines.count(machine)) {
+			if (!patterns.empty() && !channel_machines.count(machine)) {
+				std::vector<rexp_info *>::iterator rexp = patterns.begin();
+				while (rexp != patterns.end()) {
+					if (execute_pattern(*rexp++, machine->getName().c_str()) == 0) {
+						machine->publish();
+						linkMachine(machine);
+						break;
+					}
+				}
+			}
+			std::map<std::string, Value>::const_iterator prop_iter = properties.begin();
+			while (prop_iter != properties.end() && !channel_machines.count(machine)) {
+				const std::pair<std::string, Value> &item = *prop_iter++;
+				const Value &val = machine->getValue(item.first);
+				// match if the machine has the property and Null was given as the match value
+				//  or if the machine has the property and it matches the provided value
+				if ( val != SymbolTable::Null &&
+						(item.second == SymbolTable::Null || val == item.second) ) {
+					linkMachine(machine);
 					machine->publish();
-					this->channel_machines.insert(machine);
 				}
 			}
 		}
 	}
 
-    std::set<std::string>::iterator iter = definition()->monitors_patterns.begin();
-    while (iter != definition()->monitors_patterns.end()) {
-        const std::string &pattern = *iter++;
-        rexp_info *rexp = create_pattern(pattern.c_str());
-        if (!rexp->compilation_error) {
-            std::list<MachineInstance*>::iterator m_iter = MachineInstance::begin();
-            while (m_iter != MachineInstance::end()) {
-                MachineInstance *machine = *m_iter++;
-                if (machine && execute_pattern(rexp, machine->getName().c_str()) == 0) {
-                    if (!this->channel_machines.count(machine)) {
-                        machine->publish();
-                        this->channel_machines.insert(machine);
-                    }
-                }
-            }
-        }
-        else {
-            MessageLog::instance()->add(rexp->compilation_error);
-            DBG_CHANNELS << "Channel error: " << definition()->name << " " << rexp->compilation_error << "\n";
-        }
-    }
-    std::map<std::string, Value>::const_iterator prop_iter = definition()->monitors_properties.begin();
-    while (prop_iter != definition()->monitors_properties.end()) {
-        const std::pair<std::string, Value> &item = *prop_iter++;
-        std::list<MachineInstance*>::iterator m_iter = MachineInstance::begin();
-        //DBG_CHANNELS << "setting up channel: searching for machines where " <<item.first << " == " << item.second << "\n";
-        while (m_iter != MachineInstance::end()) {
-            MachineInstance *machine = *m_iter++;
-            if (machine && !this->channel_machines.count(machine)) {
-                const Value &val = machine->getValue(item.first);
-                // match if the machine has the property and Null was given as the match value
-                //  or if the machine has the property and it matches the provided value
-                if ( val != SymbolTable::Null &&
-                        (item.second == SymbolTable::Null || val == item.second) ) {
-                    //DBG_CHANNELS << "found match " << machine->getName() <<"\n";
-                    this->channel_machines.insert(machine);
-                    machine->publish();
-                }
-            }
-        }
-    }
-
 	// ignore machines based on patterns in the channel definition
 	definition()->processIgnoresPatternList(definition()->ignores_patterns.begin(),
 											definition()->ignores_patterns.end(), this);
@@ -2563,10 +2781,8 @@ void Channel::setupFilters() {
 	while (iter != definition()->monitors_names.end()) {
 		const std::string &name = *iter++;
 		MachineInstance *machine = MachineInstance::find(name.c_str());
-		if (machine && !this->channel_machines.count(machine)) {
+		if (machine && linkMachine(machine))
 			machine->publish();
-			this->channel_machines.insert(machine);
-		}
 	}
 
 	//ignore machines added to the channel instance
@@ -2577,10 +2793,8 @@ void Channel::setupFilters() {
 	while (iter != monitors_names.end()) {
 		const std::string &name = *iter++;
 		MachineInstance *machine = MachineInstance::find(name.c_str());
-		if (machine && !this->channel_machines.count(machine)) {
+		if (machine && linkMachine(machine))
 			machine->publish();
-			this->channel_machines.insert(machine);
-		}
 	}
 
 	does_monitor = monitors_exports || definition()->monitors_exports
@@ -2602,21 +2816,14 @@ void ChannelDefinition::processIgnoresPatternList(std::set<std::string>::const_i
 		DBG_CHANNELS << "setupFilters() processing pattern " << pattern << "\n";
 		rexp_info *rexp = create_pattern(pattern.c_str());
 		if (!rexp->compilation_error) {
-			std::list<MachineInstance*>::iterator machines = MachineInstance::begin();
-			while (machines != MachineInstance::end()) {
+			// only machines already on the channel can be ignored
+			std::set<MachineInstance*>::iterator machines = chn->channel_machines.begin();
+			while (machines != chn->channel_machines.end()) {
 				MachineInstance *machine = *machines++;
-				if (machine && execute_pattern(rexp, machine->getName().c_str()) == 0) {
-					if (chn->channel_machines.count(machine)) {
-						DBG_CHANNELS << "unpublished " << machine->getName() << "\n";
-						machine->unpublish();
-						chn->channel_machines.erase(machine);
-					}
-					else {
-						DBG_CHANNELS << "ignore pattern " << pattern << " matches " << machine->fullName() << " but it is not monitored\n";
-					}
-				}
-				else {
-					DBG_CHANNELS << machine->getName() << " does not match " << pattern << "\n";
+				if (execute_pattern(rexp, machine->getName().c_str()) == 0) {
+					DBG_CHANNELS << "unpublished " << machine->getName() << "\n";
+					machine->unpublish();
+					chn->unlinkMachine(machine);
 				}
 			}
 		}
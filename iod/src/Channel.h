@@ -37,6 +37,7 @@
 class Channel;
 class MachineInterface;
 class SubscriptionManager;
+class PersistenceClient;
 
 struct MachineRef {
 public:
@@ -78,7 +79,7 @@ public:
 
 	void processChannelIgnoresList();
 
-    void modified();
+    virtual void modified();
     void checked();
 
 	bool monitors() const; // does this channel monitor anything?
@@ -213,9 +214,11 @@ public:
 	unsigned int index;
 	static unsigned int lastIndex() { return last_idx; }
 	CommandSocketInfo(Channel *chn);
+	CommandSocketInfo(const std::string &owner); // a command socket that is not attached to a channel
 	~CommandSocketInfo();
 	const std::string &commandSocketName() { return cmd_socket_name; }
 protected:
+	void bind(const std::string &owner);
 	std::string cmd_socket_name;
 	static unsigned int last_idx;
 	static boost::mutex mutex;
@@ -271,6 +274,11 @@ public:
     void enableShadows();
     void disableShadows();
 	void startServer(ProtocolType proto = eZMQ);// used by shared (publish/subscribe) and one-to-one channels
+	// publisher channels queue their messages for a sender thread, other channels send directly
+	void queueMessage(const std::string &key, const char *text, const MessageHeader *header = 0, bool raw = false);
+	// the persistence channel sends property changes to persistd in batches
+	void startPersistenceBatches();
+	PersistenceClient *persistenceClient();
 	void startClient();	// used by shared (publish/subscribe) channels
     void startSubscriber();
 	void stopSubscriber();
@@ -314,6 +322,10 @@ public:
 	void addConnection();
 	void dropConnection();
 
+	void modified(); // also schedules setupFilters() on the next handleChannels()
+	void communicationsChanged(); // schedules checkCommunications() on the next handleChannels()
+	static const std::map<std::string, Channel*> &channelsMonitoring(MachineInstance *machine);
+
 	void sendPropertyChangeMessage(MachineInstance *m, const std::string &name, const Value &key,
 								   const Value &val, uint64_t authority = 0);
 /*
@@ -327,9 +339,18 @@ protected:
 
 	std::map<MachineInstance *, MachineRecord *> throttled_items;
 
-	void checkCommunications();
+	bool checkCommunications(); // returns true if the channel needs checking again
     void setPollItemBase(zmq::pollitem_t *);
 
+	// channel_machines is also indexed by machine, these keep the index up to date
+	bool linkMachine(MachineInstance *machine);
+	void unlinkMachine(MachineInstance *machine);
+
+	void createSendQueue();
+	void startSender();
+	void reportQueueMetrics(uint64_t now_usecs);
+	void sendPersistenceBatch(uint64_t now_usecs);
+
 	bool throttledItemsReady(uint64_t now_usecs) const;
 	void sendThrottledUpdates();
 
@@ -0,0 +1,231 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include "ChannelSendQueue.h"
+#include "MessageLog.h"
+#include "MessagingInterface.h"
+#include "value.h"
+
+ChannelSendQueue::ChannelSendQueue(size_t limit, OverflowPolicy policy)
+	: sent_count(0), dropped(0), coalesced(0), disconnects(0), peer_dropped(0),
+		limit_(limit ? limit : 1), policy_(policy), next_seq(0), reset_requested(false), stopped_(false) {
+}
+
+bool ChannelSendQueue::policyFromString(const std::string &name, OverflowPolicy &policy) {
+	if (name == "drop_oldest") policy = DropOldest;
+	else if (name == "coalesce") policy = Coalesce;
+	else if (name == "disconnect") policy = Disconnect;
+	else return false;
+	return true;
+}
+
+void ChannelSendQueue::remove(std::list<Entry>::iterator pos) {
+	if (!pos->key.empty()) {
+		std::map<std::string, std::list<Entry>::iterator>::iterator found = keyed.find(pos->key);
+		if (found != keyed.end() && (*found).second == pos) keyed.erase(found);
+	}
+	entries.erase(pos);
+}
+
+void ChannelSendQueue::push(const std::string &key, const char *text, const MessageHeader *header, bool raw) {
+	boost::mutex::scoped_lock lock(mutex);
+	if (stopped_) return;
+	if (entries.size() >= limit_ && policy_ == Coalesce && !key.empty()) {
+		// the queued message is superseded; the newer one goes to the end so the order is kept
+		std::map<std::string, std::list<Entry>::iterator>::iterator found = keyed.find(key);
+		if (found != keyed.end()) {
+			remove((*found).second);
+			++coalesced;
+		}
+	}
+	if (entries.size() >= limit_) {
+		if (policy_ == Disconnect) {
+			dropped += entries.size();
+			entries.clear();
+			keyed.clear();
+			++disconnects;
+			reset_requested = true;
+			char buf[150];
+			snprintf(buf, 150, "Channel send queue overflowed (%ld messages), disconnecting subscribers", (long)limit_);
+			MessageLog::instance()->add(buf);
+		}
+		else {
+			remove(entries.begin());
+			++dropped;
+		}
+	}
+	Entry entry;
+	entry.seq = ++next_seq;
+	entry.key = key;
+	entry.text = text;
+	entry.raw = raw;
+	entry.has_header = header != 0;
+	if (header) entry.header = *header;
+	entry.queued_at = microsecs();
+	entries.push_back(entry);
+	if (policy_ == Coalesce && !key.empty()) keyed[key] = --entries.end();
+	not_empty.notify_one();
+}
+
+bool ChannelSendQueue::waitFront(Entry &entry, long timeout_ms) {
+	boost::mutex::scoped_lock lock(mutex);
+	if (entries.empty() && !stopped_) {
+		boost::system_time limit = boost::get_system_time() + boost::posix_time::milliseconds(timeout_ms);
+		not_empty.timed_wait(lock, limit);
+	}
+	if (entries.empty()) return false;
+	entry = entries.front();
+	return true;
+}
+
+void ChannelSendQueue::sent(uint64_t seq) {
+	boost::mutex::scoped_lock lock(mutex);
+	++sent_count;
+	if (entries.empty() || entries.front().seq != seq) return; // dropped while being sent
+	remove(entries.begin());
+}
+
+void ChannelSendQueue::requestReset() {
+	boost::mutex::scoped_lock lock(mutex);
+	if (!reset_requested) ++disconnects;
+	reset_requested = true;
+}
+
+bool ChannelSendQueue::takeResetRequest() {
+	boost::mutex::scoped_lock lock(mutex);
+	bool res = reset_requested;
+	reset_requested = false;
+	return res;
+}
+
+void ChannelSendQueue::stop() {
+	boost::mutex::scoped_lock lock(mutex);
+	stopped_ = true;
+	not_empty.notify_all();
+}
+
+size_t ChannelSendQueue::depth() {
+	boost::mutex::scoped_lock lock(mutex);
+	return entries.size();
+}
+
+uint64_t ChannelSendQueue::lag(uint64_t now) {
+	boost::mutex::scoped_lock lock(mutex);
+	if (entries.empty() || now < entries.front().queued_at) return 0;
+	return now - entries.front().queued_at;
+}
+
+ChannelSender::ChannelSender(ChannelSendQueue &q, MessagingInterface &interface)
+	: queue(q), mif(interface), socket(*interface.getSocket()), url(interface.getURL()) {
+}
+
+void ChannelSender::operator()() {
+	// a send fails with EAGAIN when a subscriber's pipe is full, so the sender knows it will miss the message
+	setNoDrop(true);
+	while (!queue.stopped()) {
+		discardSubscriptions();
+		if (queue.takeResetRequest()) disconnectSubscribers();
+		ChannelSendQueue::Entry entry;
+		if (!queue.waitFront(entry, 100)) continue;
+		if (entry.raw) {
+			mif.send_raw(entry.text.c_str());
+			queue.sent(entry.seq);
+			continue;
+		}
+		if (send(entry, ZMQ_DONTWAIT)) {
+			queue.sent(entry.seq);
+			continue;
+		}
+		if (zmq_errno() != EAGAIN) continue; // interrupted, try again
+		if (queue.policy() == ChannelSendQueue::Disconnect) {
+			// the message stays queued and is sent once the subscribers have been disconnected
+			queue.requestReset();
+			continue;
+		}
+		// only the subscribers that are not keeping up miss this message
+		sendToAvailable(entry);
+		++queue.peer_dropped;
+		queue.sent(entry.seq);
+	}
+}
+
+void ChannelSender::setNoDrop(bool no_drop) {
+	int val = (no_drop) ? 1 : 0;
+	try {
+		socket.setsockopt(ZMQ_XPUB_NODROP, &val, sizeof(val));
+	}
+	catch (zmq::error_t &) { }
+}
+
+bool ChannelSender::send(const ChannelSendQueue::Entry &entry, int flags) {
+	try {
+		if (entry.has_header) {
+			zmq::message_t header(sizeof(MessageHeader));
+			memcpy(header.data(), &entry.header, sizeof(MessageHeader));
+			if (!socket.send(header, ZMQ_SNDMORE | flags)) return false;
+		}
+		zmq::message_t msg(entry.text.length());
+		memcpy(msg.data(), entry.text.data(), entry.text.length());
+		// once the first part of a message is accepted the remaining parts are too
+		return socket.send(msg, entry.has_header ? 0 : flags);
+	}
+	catch (zmq::error_t &err) {
+		if (zmq_errno() == EINTR) return false;
+		char buf[150];
+		snprintf(buf, 150, "Channel sender on %s dropped a message: %s", url.c_str(), zmq_strerror(zmq_errno()));
+		MessageLog::instance()->add(buf);
+		return true; // not retried
+	}
+}
+
+// send to every subscriber that has room; the socket discards the message for the others
+bool ChannelSender::sendToAvailable(const ChannelSendQueue::Entry &entry) {
+	setNoDrop(false);
+	bool res = send(entry, ZMQ_DONTWAIT);
+	setNoDrop(true);
+	return res;
+}
+
+// subscribers announce their subscriptions to the publisher, nothing uses them here
+void ChannelSender::discardSubscriptions() {
+	zmq::message_t msg;
+	try {
+		while (socket.recv(&msg, ZMQ_DONTWAIT)) { }
+	}
+	catch (zmq::error_t &) { }
+}
+
+void ChannelSender::disconnectSubscribers() {
+	char endpoint[256];
+	size_t len = sizeof(endpoint);
+	try {
+		socket.getsockopt(ZMQ_LAST_ENDPOINT, endpoint, &len);
+		socket.unbind(endpoint);
+		socket.bind(url.c_str());
+	}
+	catch (zmq::error_t &) {
+		char buf[150];
+		snprintf(buf, 150, "Channel sender could not rebind %s: %s", url.c_str(), zmq_strerror(zmq_errno()));
+		MessageLog::instance()->add(buf);
+	}
+}
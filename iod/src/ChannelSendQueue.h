@@ -0,0 +1,132 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __ChannelSendQueue_h__
+#define __ChannelSendQueue_h__
+
+#include <stdint.h>
+#include <atomic>
+#include <string>
+#include <list>
+#include <map>
+#include <zmq.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition.hpp>
+#include "MessageHeader.h"
+
+/*
+	Messages waiting to be sent to the subscribers of a publisher channel.
+	The processing and dispatcher threads add messages and the channel's
+	sender thread removes them once the socket has accepted them, so
+	sending never delays the threads that produce the messages.
+
+	Each subscriber also has its own pipe in the publisher socket, limited
+	to the same number of messages. A subscriber that stops reading fills
+	only its own pipe and then misses messages until it catches up; the
+	other subscribers are not affected. The sender counts those messages
+	in peer_dropped.
+
+	When this queue is full because the sender cannot keep up, the
+	overflow policy decides what happens:
+		drop_oldest  the oldest message is discarded (the default)
+		coalesce     a queued message with the same key is removed and the
+		             new message is added at the end, otherwise the oldest
+		             message is discarded
+		disconnect   the queue is emptied and the subscribers are disconnected;
+		             they reconnect and resynchronise. Under this policy a
+		             subscriber whose pipe is full also causes a disconnect
+		             rather than missing messages
+	Messages are always sent in the order they were queued.
+*/
+class ChannelSendQueue {
+public:
+	enum OverflowPolicy { DropOldest, Coalesce, Disconnect };
+
+	struct Entry {
+		uint64_t seq;
+		std::string key;
+		std::string text;
+		bool raw; // sent as is on the channel's raw connection
+		bool has_header;
+		MessageHeader header;
+		uint64_t queued_at;
+	};
+
+	ChannelSendQueue(size_t limit, OverflowPolicy policy);
+
+	void push(const std::string &key, const char *text, const MessageHeader *header, bool raw = false);
+	bool waitFront(Entry &entry, long timeout_ms); // copies the oldest message
+	void sent(uint64_t seq); // removes the oldest message unless it has been dropped
+	void requestReset(); // ask the sender to disconnect the subscribers
+	bool takeResetRequest(); // true once after a reset has been requested
+	void stop();
+	bool stopped() const { return stopped_; }
+
+	size_t depth();
+	uint64_t lag(uint64_t now); // age of the oldest message
+	size_t limit() const { return limit_; }
+	OverflowPolicy policy() const { return policy_; }
+
+	static bool policyFromString(const std::string &name, OverflowPolicy &policy);
+
+	std::atomic<uint64_t> sent_count;
+	std::atomic<uint64_t> dropped;
+	std::atomic<uint64_t> coalesced;
+	std::atomic<uint64_t> disconnects;
+	std::atomic<uint64_t> peer_dropped; // messages that a subscriber with a full pipe missed
+
+private:
+	boost::mutex mutex;
+	boost::condition not_empty;
+	std::list<Entry> entries;
+	std::map<std::string, std::list<Entry>::iterator> keyed;
+	size_t limit_;
+	OverflowPolicy policy_;
+	uint64_t next_seq;
+	bool reset_requested;
+	bool stopped_;
+
+	void remove(std::list<Entry>::iterator pos);
+};
+
+class MessagingInterface;
+
+/*
+	Runs on its own thread, sending the messages in a channel's queue on
+	the channel's messaging interface. Neither the interface nor its
+	socket is used by any other thread once the sender is running.
+*/
+class ChannelSender {
+public:
+	ChannelSender(ChannelSendQueue &q, MessagingInterface &mif);
+	void operator()();
+private:
+	ChannelSendQueue &queue;
+	MessagingInterface &mif;
+	zmq::socket_t &socket;
+	std::string url;
+	bool send(const ChannelSendQueue::Entry &entry, int flags);
+	bool sendToAvailable(const ChannelSendQueue::Entry &entry);
+	void setNoDrop(bool no_drop);
+	void discardSubscriptions();
+	void disconnectSubscribers();
+};
+
+#endif
@@ -20,6 +20,7 @@
 
 #include "ClearListAction.h"
 #include "MachineInstance.h"
+#include "ListAggregates.h"
 #include "Logger.h"
 
 ClearListActionTemplate::ClearListActionTemplate(Value destination) : dest_name(destination.asString()) {
@@ -58,6 +59,7 @@ Action::Status ClearListAction::run() {
         }
 #endif
         dest_machine->parameters.clear();
+        if (dest_machine->existingListAggregates()) dest_machine->existingListAggregates()->cleared();
         dest_machine->setNeedsCheck();
         status = Complete;
 	}
@@ -24,6 +24,9 @@
 #include <sstream>
 #include <list>
 #include <map>
+#include <unordered_map>
+#include <vector>
+#include <ctype.h>
 #include <zmq.hpp>
 #include <boost/thread/mutex.hpp>
 #include <Channel.h>
@@ -54,86 +57,37 @@ IODCommandThread *IODCommandThread::instance() {
 	return instance_;
 }
 
-class IODCommandFactory {
-public:
-	virtual ~IODCommandFactory() {}
-	virtual IODCommand *create();
-};
+IODCommandFactory::~IODCommandFactory() {
+	std::vector<IODCommand*>::iterator iter = free_list.begin();
+	while (iter != free_list.end()) delete *iter++;
+}
 
 IODCommand *IODCommandFactory::create() { return new IODCommandUnknown(); }
 
-struct IODCommandChannelFactory: public IODCommandFactory {
-	IODCommandChannel *create() { return new IODCommandChannel(); } };
-struct IODCommandChannelsFactory: public IODCommandFactory {
-	IODCommandChannels *create() { return new IODCommandChannels(); } };
-struct IODCommandInfoFactory: public IODCommandFactory {
-	IODCommandInfo *create() { return new IODCommandInfo(); } };
-struct IODCommandGetStatusFactory: public IODCommandFactory {
-	IODCommandGetStatus *create() { return new IODCommandGetStatus(); } };
-struct IODCommandGetPropertyFactory: public IODCommandFactory {
-	IODCommandGetProperty *create() { return new IODCommandGetProperty(); } };
-struct IODCommandSetStatusFactory: public IODCommandFactory {
-	IODCommandSetStatus *create() { return new IODCommandSetStatus(); } };
-struct IODCommandEnableFactory: public IODCommandFactory {
-	IODCommandEnable *create() { return new IODCommandEnable(); } };
-struct IODCommandResumeFactory: public IODCommandFactory {
-	IODCommandResume *create() { return new IODCommandResume(); } };
-struct IODCommandDisableFactory: public IODCommandFactory {
-	IODCommandDisable *create() { return new IODCommandDisable(); } };
-struct IODCommandToggleFactory: public IODCommandFactory {
-	IODCommandToggle *create() { return new IODCommandToggle(); } };
-struct IODCommandPropertyFactory: public IODCommandFactory {
-	IODCommandProperty *create() { return 0; }
-	IODCommandProperty *createPropertyCommand(const char *raw) {
-		return new IODCommandProperty(raw);
+bool IODCommandFactory::matches(std::vector<Value> &params) {
+	if (params.size() < min_params) return false;
+	if (keyword && (keyword_pos >= params.size() || params[keyword_pos] != keyword) ) return false;
+	return true;
+}
+
+IODCommand *IODCommandFactory::acquire() {
+	IODCommand *cmd = 0;
+	if (free_list.empty())
+		cmd = create();
+	else {
+		cmd = free_list.back();
+		free_list.pop_back();
 	}
-};
-struct IODCommandDescribeFactory: public IODCommandFactory {
-	IODCommandDescribe *create() { return new IODCommandDescribe(); } };
-struct IODCommandListFactory: public IODCommandFactory {
-	IODCommandList *create() { return new IODCommandList(); } };
-struct IODCommandListJSONFactory: public IODCommandFactory {
-	IODCommandListJSON *create() { return new IODCommandListJSON(); } };
-struct IODCommandSendFactory: public IODCommandFactory {
-	IODCommandSend *create() { return new IODCommandSend(); } };
-struct IODCommandQuitFactory: public IODCommandFactory {
-	IODCommandQuit *create() { return new IODCommandQuit(); } };
-struct IODCommandHelpFactory: public IODCommandFactory {
-	IODCommandHelp *create() { return new IODCommandHelp(); } };
-struct IODCommandDebugShowFactory: public IODCommandFactory {
-	IODCommandDebugShow *create() { return new IODCommandDebugShow(); } };
-struct IODCommandDebugFactory: public IODCommandFactory {
-	IODCommandDebug *create() { return new IODCommandDebug(); } };
-struct IODCommandModbusFactory: public IODCommandFactory {
-	IODCommandModbus *create() { return new IODCommandModbus(); } };
-struct IODCommandTracingFactory: public IODCommandFactory {
-	IODCommandTracing *create() { return new IODCommandTracing(); } };
-struct IODCommandModbusExportFactory: public IODCommandFactory {
-	IODCommandModbusExport *create() { return new IODCommandModbusExport(); } };
-struct IODCommandModbusRefreshFactory: public IODCommandFactory {
-	IODCommandModbusRefresh *create() { return new IODCommandModbusRefresh(); } };
-struct IODCommandPerformanceFactory: public IODCommandFactory {
-	IODCommandPerformance *create() { return new IODCommandPerformance(); } };
-struct IODCommandPersistentStateFactory: public IODCommandFactory {
-	IODCommandPersistentState *create() { return new IODCommandPersistentState(); } };
-struct IODCommandChannelRefreshFactory: public IODCommandFactory {
-	IODCommandChannelRefresh *create() { return new IODCommandChannelRefresh(); } };
-struct IODCommandSchedulerStateFactory: public IODCommandFactory {
-	IODCommandSchedulerState *create() { return new IODCommandSchedulerState(); } };
-struct IODCommandStateFactory: public IODCommandFactory {
-	IODCommandState *create() { return new IODCommandState(); } };
-struct IODCommandUnknownFactory: public IODCommandFactory {
-	IODCommandUnknown *create() { return new IODCommandUnknown(); } };
-struct IODCommandDataFactory: public IODCommandFactory {
-	IODCommandData *create() { return new IODCommandData(); } };
-struct IODCommandShowMessagesFactory: public IODCommandFactory {
-	IODCommandShowMessages *create() { return new IODCommandShowMessages(); } };
-struct IODCommandNoticeFactory: public IODCommandFactory {
-	IODCommandNotice *create() { return new IODCommandNotice(); } };
-struct IODCommandFindFactory: public IODCommandFactory {
-	IODCommandFind *create() { return new IODCommandFind(); } };
-struct IODCommandFreezeFactory: public IODCommandFactory {
-	IODCommandFreeze *create() { return new IODCommandFreeze(); } };
+	if (cmd) cmd->factory = this;
+	return cmd;
+}
+
+void IODCommandFactory::release(IODCommand *cmd) {
+	const size_t max_pool_size = 8;
+	if (free_list.size() >= max_pool_size) { delete cmd; return; }
+	cmd->reset();
+	free_list.push_back(cmd);
+}
 
 struct ListenerThreadInternals : public ClientInterfaceInternals {
     
@@ -149,76 +103,135 @@ void IODCommandListenerThread::operator()() {
 IODCommandListenerThread::IODCommandListenerThread() : done(false){ }
 void IODCommandListenerThread::stop() { done = true; }
 
-template<class T> class CommandTable {
+/* Commands are found by hashing the command verb together with the number
+	of parameters. Factories that accept a variable number of parameters are
+	registered with IODCommandThread::any_count and are searched after any
+	factories registered for the exact parameter count.
+*/
+struct CommandKey {
+	std::string verb;
+	int num_params;
+	CommandKey(const std::string &v, int n) : verb(v), num_params(n) {}
+	bool operator==(const CommandKey &other) const {
+		return num_params == other.num_params && verb == other.verb;
+	}
+};
+
+struct CommandKeyHash {
+	size_t operator()(const CommandKey &key) const {
+		return std::hash<std::string>()(key.verb) ^ ( (size_t)(key.num_params + 1) * 0x9e3779b9UL);
+	}
+};
+
+class CommandTable {
 public:
-	typedef typename std::multimap<std::string, T> Table;
-	typedef typename Table::value_type Node;
-	typedef std::pair<typename Table::iterator, typename Table::iterator> Range;
-	typedef typename Table::iterator Iterator;
+	typedef std::vector<IODCommandFactory*> Factories;
+	typedef std::unordered_map<CommandKey, Factories, CommandKeyHash> Table;
 
 	Table table;
 
-	void add(const char *name, T cmd) { table.insert( std::make_pair(name, cmd) ); }
-	Range find(const std::string &name) { return table.equal_range(name); }
+	void add(const char *name, int num_params, IODCommandFactory *cmd) {
+		table[CommandKey(name, num_params)].push_back(cmd);
+	}
+	IODCommandFactory *find(std::vector<Value> &params);
+private:
+	IODCommandFactory *search(const CommandKey &key, std::vector<Value> &params);
 };
 
+IODCommandFactory *CommandTable::search(const CommandKey &key, std::vector<Value> &params) {
+	Table::iterator found = table.find(key);
+	if (found == table.end()) return 0;
+	Factories::iterator iter = (*found).second.begin();
+	while (iter != (*found).second.end()) {
+		IODCommandFactory *factory = *iter++;
+		if (factory->matches(params)) return factory;
+	}
+	return 0;
+}
 
+IODCommandFactory *CommandTable::find(std::vector<Value> &params) {
+	if (params.empty()) return 0;
+	CommandKey key(params[0].asString(), (int)params.size());
+	IODCommandFactory *factory = search(key, params);
+	if (factory) return factory;
+	key.num_params = IODCommandThread::any_count;
+	return search(key, params);
+}
 
 struct CommandThreadInternals : public ClientInterfaceInternals {
 public:
     zmq::socket_t socket;
     //pthread_t monitor_thread;
-	CommandTable<IODCommandFactory*> commands;
+	CommandTable commands;
+	IODCommandFactory *unknown_command;
 	boost::mutex data_mutex;
 
 	//std::list<IODCommand *>pending_commands;
 	//std::list<IODCommand *>completed_commands;
 
 
-    CommandThreadInternals() : socket(*MessagingInterface::getContext(), ZMQ_REP) {
-		commands.add("CHANNEL", new IODCommandChannelFactory());
-		commands.add("CHANNEL", new IODCommandChannelRefreshFactory());
-		commands.add("CHANNEL", new IODCommandChannelsFactory());
-		commands.add("DATA", new IODCommandDataFactory());
-		commands.add("DEBUG", new IODCommandDebugFactory());
-		commands.add("DEBUG", new IODCommandDebugShowFactory());
-		commands.add("DESCRIBE", new IODCommandDescribeFactory());
-		commands.add("DISABLE", new IODCommandDisableFactory());
-		commands.add("ENABLE", new IODCommandEnableFactory());
-		commands.add("FIND", new IODCommandFindFactory());
-		commands.add("FREEZE", new IODCommandFreezeFactory());
-		commands.add("GET", new IODCommandGetPropertyFactory());
-		commands.add("GET", new IODCommandGetStatusFactory());
-		commands.add("HELPINFO", new IODCommandHelpFactory());
-		commands.add("INFO", new IODCommandInfoFactory());
-		commands.add("LIST", new IODCommandListFactory());
-		commands.add("LIST", new IODCommandListJSONFactory());
-		commands.add("MODBUS", new IODCommandModbusExportFactory());
-		commands.add("MODBUS", new IODCommandModbusFactory());
-		commands.add("MODBUS", new IODCommandModbusRefreshFactory());
-		commands.add("NOTICE", new IODCommandNoticeFactory());
-		commands.add("STATS", new IODCommandPerformanceFactory());
-		commands.add("PERSISTENT", new IODCommandPersistentStateFactory());
-		commands.add("PROPERTY", new IODCommandPropertyFactory());
-		commands.add("QUIT", new IODCommandQuitFactory());
-		commands.add("RESUME", new IODCommandResumeFactory());
-		commands.add("RESUME", new IODCommandResumeFactory());
-		commands.add("SCHEDULER", new IODCommandSchedulerStateFactory());
-		commands.add("SEND", new IODCommandSendFactory());
-		commands.add("SET", new IODCommandSetStatusFactory());
-		commands.add("STATE", new IODCommandSetStatusFactory());
-		commands.add("MESSAGES", new IODCommandShowMessagesFactory());
-		//commands.add("", new IODCommandStateFactory());
-		commands.add("TOGGLE", new IODCommandToggleFactory());
-		commands.add("TRACING", new IODCommandTracingFactory());
-		//commands.add("", new IODCommandUnknownFactory());
+    CommandThreadInternals() : socket(*MessagingInterface::getContext(), ZMQ_REP),
+			unknown_command(new CommandFactory<IODCommandUnknown>()) {
+		const int any = IODCommandThread::any_count;
+		commands.add("BATCH", any, new CommandFactory<IODCommandBatch>());
+		commands.add("CHANNEL", any, new CommandFactory<IODCommandChannel>(2));
+		commands.add("CHANNELS", any, new CommandFactory<IODCommandChannels>());
+		commands.add("CLEAR", 2, new CommandFactory<IODCommandShowMessages>(0, 1, "MESSAGES"));
+		commands.add("DATA", any, new CommandFactory<IODCommandData>(3));
+		commands.add("DEBUG", 2, new CommandFactory<IODCommandDebugShow>(0, 1, "SHOW"));
+		commands.add("DEBUG", 3, new CommandFactory<IODCommandDebug>());
+		commands.add("DESCRIBE", 2, new CommandFactory<IODCommandDescribe>());
+		commands.add("DESCRIBE", 3, new CommandFactory<IODCommandDescribe>());
+		commands.add("DISABLE", 2, new CommandFactory<IODCommandDisable>());
+		commands.add("ENABLE", 2, new CommandFactory<IODCommandEnable>());
+		commands.add("FIND", 1, new CommandFactory<IODCommandFind>());
+		commands.add("FIND", 2, new CommandFactory<IODCommandFind>());
+		commands.add("FREEZE", any, new CommandFactory<IODCommandFreeze>());
+		commands.add("GET", 2, new CommandFactory<IODCommandGetStatus>());
+		commands.add("GET", 3, new CommandFactory<IODCommandGetProperty>());
+		commands.add("HELP", any, new CommandFactory<IODCommandHelp>());
+		commands.add("INFO", any, new CommandFactory<IODCommandInfo>());
+		commands.add("LIST", 1, new CommandFactory<IODCommandList>());
+		commands.add("LIST", any, new CommandFactory<IODCommandListJSON>(2, 1, "JSON"));
+		commands.add("MESSAGES", any, new CommandFactory<IODCommandShowMessages>());
+		commands.add("MODBUS", 2, new CommandFactory<IODCommandModbusExport>(0, 1, "EXPORT"));
+		commands.add("MODBUS", 3, new CommandFactory<IODCommandModbusExport>(0, 1, "EXPORT"));
+		commands.add("MODBUS", 2, new CommandFactory<IODCommandModbusRefresh>(0, 1, "REFRESH"));
+		commands.add("MODBUS", any, new CommandFactory<IODCommandModbus>());
+		commands.add("NOTICE", any, new CommandFactory<IODCommandNotice>());
+		commands.add("PERSISTENT", any, new CommandFactory<IODCommandPersistentState>());
+		commands.add("PROFILE", any, new CommandFactory<IODCommandProfile>());
+		commands.add("PROPERTY", any, new CommandFactory<IODCommandProperty>());
+		commands.add("QUIT", 1, new CommandFactory<IODCommandQuit>());
+		commands.add("REFRESH", 2, new CommandFactory<IODCommandChannelRefresh>());
+		commands.add("RESUME", 2, new CommandFactory<IODCommandResume>());
+		commands.add("RESUME", 4, new CommandFactory<IODCommandResume>(0, 2, "AT"));
+		commands.add("SCHEDULER", any, new CommandFactory<IODCommandSchedulerState>());
+#ifdef USE_SDO
+		commands.add("SDO", any, new CommandFactory<IODCommandSDO>());
+#endif //USE_SDO
+		commands.add("SEND", any, new CommandFactory<IODCommandSend>());
+		commands.add("SET", any, new CommandFactory<IODCommandSetStatus>(4, 2, "TO"));
+		commands.add("SHOW", 2, new CommandFactory<IODCommandBusy>(0, 1, "BUSY"));
+		commands.add("SHOW", 2, new CommandFactory<IODCommandTriggers>(0, 1, "TRIGGERS"));
+		commands.add("SHOW", 2, new CommandFactory<IODCommandShow>());
+		commands.add("SHUTDOWN", any, new CommandFactory<IODCommandShutdown>());
+		commands.add("STATE", any, new CommandFactory<IODCommandSetStatus>(3));
+		commands.add("STATS", any, new CommandFactory<IODCommandPerformance>());
+		commands.add("TOGGLE", 2, new CommandFactory<IODCommandToggleEtherCAT>(0, 1, "ETHERCAT"));
+		commands.add("TOGGLE", 2, new CommandFactory<IODCommandToggle>());
+		commands.add("TRACING", 2, new CommandFactory<IODCommandTracing>());
 	}
 };
 
 void IODCommandThread::registerCommand(std::string name, IODCommandFactory *cmd) {
+	registerCommand(name, any_count, cmd);
+}
+
+void IODCommandThread::registerCommand(std::string name, int num_params, IODCommandFactory *cmd) {
 	CommandThreadInternals *cti
 		= dynamic_cast<CommandThreadInternals*>(IODCommandThread::instance()->internals);
-	cti->commands.add(name.c_str(), cmd);
+	cti->commands.add(name.c_str(), num_params, cmd);
 }
 
 
@@ -280,174 +293,93 @@ void IODCommand::setParameters(std::vector<Value> &params) {
 	std::copy(params.begin(), params.end(), back_inserter(parameters));
 }
 
-IODCommand *parseCommandString(const char *data) {
-	std::list<Value> parts;
-	size_t count = 0;
-	std::string ds;
-	std::vector<Value> params;
-	std::list<Value> *param_list = 0;
-	if (MessageEncoding::getCommand(data, ds, &param_list)) {
-		params.push_back(ds);
-		if (param_list) {
-			std::list<Value>::const_iterator iter = param_list->begin();
-			while (iter != param_list->end()) {
-				const Value &v  = *iter++;
-				params.push_back(v);
+/* split a plain text command on whitespace. The parameters of a BATCH
+	are the text of each command, separated by ';' parameters.
+*/
+static void tokenise(const char *data, std::vector<Value> &params) {
+	const char *p = data;
+	while (*p) {
+		while (*p && isspace(*p)) ++p;
+		if (!*p) break;
+		const char *start = p;
+		while (*p && !isspace(*p)) ++p;
+		params.push_back(Value(std::string(start, p - start)));
+		if (params.size() == 1 && params[0] == "BATCH") {
+			while (*p) {
+				while (*p && (isspace(*p) || *p == ';')) ++p;
+				if (!*p) break;
+				start = p;
+				while (*p && *p != ';') ++p;
+				const char *end = p;
+				while (end > start && isspace(end[-1])) --end;
+				if (params.size() > 1) params.push_back(Value(";"));
+				params.push_back(Value(std::string(start, end - start), Value::t_string));
 			}
-			param_list->clear();
-			delete param_list;
 		}
-		count = params.size();
 	}
-	else {
-		std::istringstream iss(data);
-		std::string tmp;
-		iss >> ds;
-		parts.push_back(ds.c_str());
-		++count;
-		while (iss >> tmp) {
-			parts.push_back(tmp.c_str());
-			++count;
+}
+
+static bool splitCommand(const char *data, std::vector<Value> &params) {
+	const char *p = data;
+	while (*p && isspace(*p)) ++p;
+	if (*p == '{') {
+		std::string ds;
+		size_t first = params.size();
+		params.push_back(SymbolTable::Null);
+		if (MessageEncoding::readCommand(data, ds, params)) {
+			params[first] = ds;
+			return !params.empty();
 		}
-		std::copy(parts.begin(), parts.end(), std::back_inserter(params));
+		params.pop_back();
 	}
+	tokenise(data, params);
+	return !params.empty();
+}
 
-	if (params.empty()) {
-		return 0;
-	}
-	IODCommand *command = 0;
-	ds = params[0].asString();
-	if (count == 1 && ds == "LIST") {
-		command = new IODCommandList;
-	}
-	else if (ds == "GET" && count==2) {
-		command = new IODCommandGetStatus;
-	}
-	else if (ds == "GET" && count==3) {
-		command = new IODCommandGetProperty;
-	}
-	else if (ds == "MODBUS" && (count == 2 || count == 3) && params[1] == "EXPORT") {
-		command = new IODCommandModbusExport;
-	}
-	else if (ds == "MODBUS" && count == 2 && params[1] == "REFRESH") {
-		command = new IODCommandModbusRefresh;
-	}
-	else if (ds == "MODBUS") {
-		command = new IODCommandModbus;
-	}
-	else if (count >= 4 && ds == "SET" && params[2] == "TO") {
-		command =  new IODCommandSetStatus;
-	}
-	else if (count >= 3 && ds == "STATE") {
-		command =  new IODCommandSetStatus;
-	}
-	else if (count == 2 && ds == "DEBUG" && params[1] == "SHOW") {
-		command = new IODCommandDebugShow;
-	}
-	else if (count == 3 && ds == "DEBUG") {
-		command = new IODCommandDebug;
-	}
-	else if (count == 2 && ds == "TRACING") {
-		command = new IODCommandTracing;
-	}
-	else if (count == 2 && ds == "TOGGLE") {
-		if (params[1] == "ETHERCAT")
-			command = new IODCommandToggleEtherCAT;
-		else
-			command = new IODCommandToggle;
-	}
-	else if ( ds == "SEND") {
-		command = new IODCommandSend;
-	}
-	else if (count == 1 && ds == "QUIT") {
-		command = new IODCommandQuit;
-	}
-	else if (count >= 2 && ds == "LIST" && params[1] == "JSON") {
-		command = new IODCommandListJSON;
-	}
-	else if (count == 2 && ds == "ENABLE") {
-		command = new IODCommandEnable;
-	}
-	else if (count == 2 && ds == "RESUME") {
-		command = new IODCommandResume;
-	}
-	else if (count == 4 && ds == "RESUME" && params[2] == "AT") {
-		command = new IODCommandResume;
-	}
-	else if (count == 2 && ds == "DISABLE") {
-		command = new IODCommandDisable;
-	}
-	else if ( (count == 2 || count == 3) && ds == "DESCRIBE") {
-		command = new IODCommandDescribe;
-	}
-	else if (count == 2 && ds == "SHOW" && params[1] == "BUSY") {
-		command = new IODCommandBusy;
-	}
-	else if (count == 2 && ds == "SHOW" && params[1] == "TRIGGERS") {
-		command = new IODCommandTriggers;
-	}
-	else if (count == 2 && ds == "SHOW" ) {
-		command = new IODCommandShow;
-	}
-	else if ( ds == "STATS" ) {
-		command = new IODCommandPerformance;
-	}
-	else if (count >= 2 && ds == "CHANNEL") {
-		command = new IODCommandChannel;
-	}
-	else if (ds == "CHANNELS") {
-		command = new IODCommandChannels();
-	}
-	else if (ds == "REFRESH" && count == 2) {
-		command = new IODCommandChannelRefresh();
-	}
-	else if (count > 2 && ds == "DATA") {
-		command = new IODCommandData;
-	}
-	else if (ds == "PROPERTY") {
-		command = new IODCommandProperty(data);
-	}
-	else if (ds == "PERSISTENT") {
-		command = new IODCommandPersistentState;
-	}
-#ifdef USE_SDO
-	else if (ds == "SDO") {
-		command = new IODCommandSDO;
-	}
-#endif //USE_SDO
-	else if (ds == "HELP") {
-		command = new IODCommandHelp;
-	}
-	else if (ds == "MESSAGES" || (ds == "CLEAR" && count == 2 && params[1] == "MESSAGES") ) {
-		command = new IODCommandShowMessages;
-	}
-	else if (ds == "SCHEDULER") {
-		command = new IODCommandSchedulerState;
-	}
-	else if ( (count == 1 || count == 2) && ds == "FIND") {
-		command = new IODCommandFind;
-	}
-	else if (ds == "NOTICE") {
-		command = new IODCommandNotice;
-	}
-	else if (ds == "INFO") {
-		command = new IODCommandInfo;
-	}
-	else if (ds == "FREEZE") {
-		command = new IODCommandFreeze;
-	}
-	else if (ds == "SHUTDOWN") {
-		command = new IODCommandShutdown;
-	}
-	else {
+IODCommandFactory *findCommandFactory(std::vector<Value> &params) {
+	CommandThreadInternals *cti
+		= dynamic_cast<CommandThreadInternals*>(IODCommandThread::instance()->internals);
+	IODCommandFactory *factory = cti->commands.find(params);
+	if (!factory) {
 		FileLogger fl(program_name);
-		fl.f() << "Warning: no command found for " << data << "\n";
-		command = new IODCommandUnknown;
+		fl.f() << "Warning: no command found for ";
+		const char *delim = "";
+		for (unsigned int i=0; i<params.size(); ++i) { fl.f() << delim << params[i]; delim = " "; }
+		fl.f() << "\n";
+		factory = cti->unknown_command;
 	}
+	return factory;
+}
+
+IODCommand *parseCommandString(const char *data) {
+	std::vector<Value> params;
+	if (!splitCommand(data, params)) return 0;
+	IODCommand *command = findCommandFactory(params)->create();
+	if (command) command->setParameters(params);
+	return command;
+}
+
+IODCommand *acquireCommand(std::vector<Value> &params) {
+	if (params.empty()) return 0;
+	IODCommand *command = findCommandFactory(params)->acquire();
 	if (command) command->setParameters(params);
 	return command;
 }
 
+IODCommand *acquireCommand(const char *data) {
+	std::vector<Value> params;
+	if (!splitCommand(data, params)) return 0;
+	return acquireCommand(params);
+}
+
+void releaseCommand(IODCommand *cmd) {
+	if (!cmd) return;
+	if (cmd->factory)
+		cmd->factory->release(cmd);
+	else
+		delete cmd;
+}
+
 
 void IODCommandThread::operator()() {
 #ifdef __APPLE__
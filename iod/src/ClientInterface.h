@@ -21,7 +21,11 @@
 #ifndef __ClientInterface_h__
 #define __ClientInterface_h__
 
+#include <string>
+#include <vector>
+
 class IODCommand;
+class Value;
 
 struct ClientInterfaceInternals { virtual ~ClientInterfaceInternals(); };
     
@@ -36,6 +40,12 @@ struct IODCommandListenerThread {
 
 IODCommand *parseCommandString(const char *data);
 
+// Pooled versions of parseCommandString. Commands obtained this way
+// must be given back with releaseCommand() instead of being deleted.
+IODCommand *acquireCommand(const char *data);
+IODCommand *acquireCommand(std::vector<Value> &params);
+void releaseCommand(IODCommand *cmd);
+
 class IODCommand;
 class IODCommandFactory;
 class IODCommandThread {
@@ -44,7 +54,9 @@ public:
     void operator()();
     void stop();
     bool done;
+	static const int any_count = -1;
 	static void registerCommand(std::string name, IODCommandFactory *cmd);
+	static void registerCommand(std::string name, int num_params, IODCommandFactory *cmd);
 /*
 	void newPendingCommand(IODCommand *cmd);
 	IODCommand *getCommand();
@@ -54,6 +66,8 @@ public:
 protected:
 	ClientInterfaceInternals *internals;
 	friend IODCommand *parseCommandString(const char *data);
+	friend IODCommandFactory *findCommandFactory(std::vector<Value> &params);
+
 private:
 	IODCommandThread();
 	~IODCommandThread();
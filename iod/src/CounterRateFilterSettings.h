@@ -20,7 +20,7 @@ public:
   long zero_count;
   CounterRateFilterSettings(unsigned int sz) : position(0), velocity(0), property_changed(false),
     noise_tolerance(20),last_sent(0), last_pos(0), start_t(0), update_t(0), last_update_t(0),
-    readings(sz), zero_count(0) {
+    readings(sz, true), zero_count(0) {
 	struct timeval now;
 	gettimeofday(&now, 0);
 	update_t = start_t;
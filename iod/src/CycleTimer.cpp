@@ -0,0 +1,154 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <sys/mman.h>
+#include <iostream>
+#include "CycleTimer.h"
+#include "LatencyHistogram.h"
+#include "MachineInstance.h"
+#include "MessageLog.h"
+
+CycleTimer *CycleTimer::all_timers = 0;
+boost::mutex CycleTimer::list_mutex;
+
+static const long NSEC_PER_SEC = 1000000000L;
+
+static void addNanoseconds(struct timespec &ts, uint64_t ns) {
+	ts.tv_sec += ns / NSEC_PER_SEC;
+	ts.tv_nsec += ns % NSEC_PER_SEC;
+	if (ts.tv_nsec >= NSEC_PER_SEC) {
+		ts.tv_nsec -= NSEC_PER_SEC;
+		++ts.tv_sec;
+	}
+}
+
+// nanoseconds from a to b, zero if b is not after a
+static uint64_t nanosecondsBetween(const struct timespec &a, const struct timespec &b) {
+	if (b.tv_sec < a.tv_sec || (b.tv_sec == a.tv_sec && b.tv_nsec <= a.tv_nsec)) return 0;
+	return (uint64_t)(b.tv_sec - a.tv_sec) * NSEC_PER_SEC + b.tv_nsec - a.tv_nsec;
+}
+
+CycleTimer::CycleTimer(const char *timer_name, uint64_t period_usec)
+		: name(timer_name), period_ns(period_usec * 1000), started(false),
+			num_cycles(0), num_missed(0), last_jitter(0), max_jitter(0), jitter(0), next_timer(0) {
+	if (!period_ns) period_ns = 1000000;
+	std::string histogram_name(timer_name);
+	for (size_t i = 0; i < histogram_name.length(); ++i) histogram_name[i] = tolower(histogram_name[i]);
+	histogram_name += "_wakeup_jitter";
+	jitter = new LatencyHistogram(histogram_name.c_str(), "Time from a cycle deadline to the thread waking");
+	boost::mutex::scoped_lock lock(list_mutex);
+	next_timer = all_timers;
+	all_timers = this;
+}
+
+void CycleTimer::setPeriod(uint64_t period_usec) {
+	if (period_usec) period_ns = period_usec * 1000;
+}
+
+unsigned int CycleTimer::wait() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	if (!started) {
+		deadline = now;
+		started = true;
+	}
+	addNanoseconds(deadline, period_ns);
+
+	// if the deadline has already passed, the last cycle overran; skip to the next deadline to come
+	unsigned int missed = 0;
+	if (nanosecondsBetween(now, deadline) == 0) {
+		uint64_t skipped = nanosecondsBetween(deadline, now) / period_ns + 1;
+		addNanoseconds(deadline, skipped * period_ns);
+		missed = (unsigned int)skipped;
+		num_missed.fetch_add(skipped, std::memory_order_relaxed);
+	}
+
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, 0) == EINTR) ;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	uint64_t wake_delay = nanosecondsBetween(deadline, now) / 1000;
+	last_jitter.store(wake_delay, std::memory_order_relaxed);
+	if (wake_delay > max_jitter.load(std::memory_order_relaxed))
+		max_jitter.store(wake_delay, std::memory_order_relaxed);
+	jitter->record(wake_delay);
+	num_cycles.fetch_add(1, std::memory_order_relaxed);
+	return missed;
+}
+
+void CycleTimer::publishAll(MachineInstance *system) {
+	if (!system) return;
+	boost::mutex::scoped_lock lock(list_mutex);
+	for (CycleTimer *timer = all_timers; timer; timer = timer->next_timer) {
+		std::string prefix(timer->name);
+		system->setValue(prefix + "_CYCLES", (long)timer->cycles());
+		system->setValue(prefix + "_MISSED_DEADLINES", (long)timer->missedDeadlines());
+		system->setValue(prefix + "_JITTER", (long)timer->lastJitter());
+		system->setValue(prefix + "_MAX_JITTER", (long)timer->maxJitter());
+	}
+}
+
+bool setThreadRealtime(const char *thread_name, int priority, int cpu) {
+	bool ok = true;
+	char buf[150];
+	if (priority > 0) {
+		struct sched_param param;
+		memset(&param, 0, sizeof(param));
+		param.sched_priority = priority;
+		int err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+		if (err) {
+			snprintf(buf, 150, "Warning: could not set %s thread to SCHED_FIFO priority %d: %s",
+				thread_name, priority, strerror(err));
+			MessageLog::instance()->add(buf);
+			std::cerr << buf << "\n";
+			ok = false;
+		}
+	}
+	if (cpu >= 0) {
+		cpu_set_t cpus;
+		CPU_ZERO(&cpus);
+		CPU_SET(cpu, &cpus);
+		int err = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+		if (err) {
+			snprintf(buf, 150, "Warning: could not bind %s thread to cpu %d: %s",
+				thread_name, cpu, strerror(err));
+			MessageLog::instance()->add(buf);
+			std::cerr << buf << "\n";
+			ok = false;
+		}
+	}
+	return ok;
+}
+
+bool lockProcessMemory() {
+	if (mlockall(MCL_CURRENT | MCL_FUTURE) == -1) {
+		char buf[150];
+		snprintf(buf, 150, "Warning: could not lock memory: %s", strerror(errno));
+		MessageLog::instance()->add(buf);
+		std::cerr << buf << "\n";
+		return false;
+	}
+	return true;
+}
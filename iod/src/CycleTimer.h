@@ -0,0 +1,97 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __CYCLETIMER_H__
+#define __CYCLETIMER_H__
+
+#include <stdint.h>
+#include <time.h>
+#include <atomic>
+#include <string>
+#include <boost/thread/mutex.hpp>
+
+class LatencyHistogram;
+class MachineInstance;
+
+/*
+	Paces a thread to a fixed period using absolute deadlines on
+	CLOCK_MONOTONIC, so time spent working in one cycle does not delay
+	the next and no RTC device is needed.
+
+	A deadline that has already passed when wait() is called is counted as
+	missed and the timer moves on to the next deadline in the future rather
+	than running a burst of catch-up cycles. The lateness of each wakeup
+	is kept as jitter and recorded in a histogram named <name>_wakeup_jitter.
+
+	Counters may be read from any thread. Timers are created with new and
+	never deleted; publishAll() copies the counters of every timer to
+	properties of the SYSTEM machine.
+*/
+class CycleTimer {
+public:
+	CycleTimer(const char *timer_name, uint64_t period_usec);
+
+	void setPeriod(uint64_t period_usec);
+	uint64_t getPeriod() const { return period_ns / 1000; }
+
+	// sleep until the next deadline, returns the number of deadlines missed since the last call
+	unsigned int wait();
+
+	const std::string &getName() const { return name; }
+	uint64_t cycles() const { return num_cycles.load(std::memory_order_relaxed); }
+	uint64_t missedDeadlines() const { return num_missed.load(std::memory_order_relaxed); }
+	uint64_t lastJitter() const { return last_jitter.load(std::memory_order_relaxed); } // microseconds
+	uint64_t maxJitter() const { return max_jitter.load(std::memory_order_relaxed); } // microseconds
+
+	// <NAME>_CYCLES, <NAME>_MISSED_DEADLINES, <NAME>_JITTER and <NAME>_MAX_JITTER
+	static void publishAll(MachineInstance *system);
+
+private:
+	std::string name;
+	uint64_t period_ns;
+	struct timespec deadline;
+	bool started;
+	std::atomic<uint64_t> num_cycles;
+	std::atomic<uint64_t> num_missed;
+	std::atomic<uint64_t> last_jitter;
+	std::atomic<uint64_t> max_jitter;
+	LatencyHistogram *jitter;
+	CycleTimer *next_timer;
+
+	static CycleTimer *all_timers;
+	static boost::mutex list_mutex;
+
+	CycleTimer(const CycleTimer &);
+	CycleTimer &operator=(const CycleTimer &);
+};
+
+/*
+	Realtime settings for the calling thread. A priority of zero leaves the
+	scheduling policy alone, otherwise the thread is moved to SCHED_FIFO at
+	that priority. A negative cpu leaves the affinity alone. Failures, for
+	example from a lack of CAP_SYS_NICE, are logged and the thread carries
+	on with its existing settings.
+*/
+bool setThreadRealtime(const char *thread_name, int priority, int cpu);
+
+// lock current and future pages of the process into memory
+bool lockProcessMemory();
+
+#endif
@@ -28,6 +28,7 @@
 #include "DebugExtra.h"
 #include "Logger.h"
 #include "MessagingInterface.h"
+#include "MessageEncoding.h"
 #include "symboltable.h"
 #include <assert.h>
 #include <zmq.hpp>
@@ -35,6 +36,7 @@
 #include <pthread.h>
 #include "ProcessingThread.h"
 #include "SharedWorkSet.h"
+#include "LatencyHistogram.h"
 
 Dispatcher *Dispatcher::instance_ = NULL;
 //boost::mutex Dispatcher::delivery_mutex;
@@ -52,7 +54,7 @@ void DispatchThread::operator()()
 
 Dispatcher::Dispatcher() : socket(0), started(false), dispatch_thread(0), thread_ref(0),
     sync(*MessagingInterface::getContext(), ZMQ_REP), status(e_waiting_cw),
-	dispatch_socket(0), owner_thread(0)
+	dispatch_socket(0), owner_thread(0), num_delivered(0)
 {
     dispatch_thread = new DispatchThread;
     thread_ref = new boost::thread(boost::ref(*dispatch_thread));
@@ -131,6 +133,7 @@ void Dispatcher::deliver(Package *p)
 		std::cerr << buf << "\n";
 	}
 #endif
+    p->queued_at = microsecs();
     sock.send(&p, sizeof(Package*));
 }
 
@@ -144,6 +147,8 @@ void Dispatcher::deliverZ(Package *p)
 
 void Dispatcher::idle()
 {
+    LatencyHistogram *dispatch_latency = new LatencyHistogram("dispatch_latency",
+        "Time a message waits in the dispatcher queue before delivery");
     socket = new zmq::socket_t(*MessagingInterface::getContext(), ZMQ_PULL);
 
 	try {
@@ -228,6 +233,8 @@ void Dispatcher::idle()
                 size_t len = socket->recv(&p, sizeof(Package*), ZMQ_DONTWAIT);
                 if (len)
                 {
+                    ++num_delivered;
+                    if (p->queued_at) dispatch_latency->record(microsecs() - p->queued_at);
                     //MachineInstance::forceStableStateCheck();
                     //MachineInstance::forceIdleCheck();
 
@@ -299,17 +306,19 @@ void Dispatcher::idle()
                                 Value protocol = mi->properties.lookup("PROTOCOL");
                                 if (protocol == "RAW")
                                 {
-                                    mif->send_raw(m.getText().c_str());
+                                    chn->queueMessage("", m.getText().c_str(), 0, true);
                                 }
                                 else
                                 {
                                     if (protocol == "CLOCKWORK")
                                     {
-                                        mif->send(m);
+                                        char *text = MessageEncoding::encodeCommand(m.getText(), m.getParams());
+                                        chn->queueMessage("", text);
+                                        free(text);
                                     }
                                     else
                                     {
-                                        mif->send(m.getText().c_str());
+                                        chn->queueMessage("", m.getText().c_str());
                                     }
                                 }
                             }
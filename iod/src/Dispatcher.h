@@ -50,6 +50,7 @@ public:
     static void start();
     void idle();
     void stop();
+    uint64_t deliveries() const { return num_delivered; } // packages taken from the queue so far
     
 private:
     Dispatcher();
@@ -73,6 +74,7 @@ private:
 	} status;
 	zmq::socket_t *dispatch_socket;
 	pthread_t owner_thread;
+	uint64_t num_delivered;
 };
 
 std::ostream &operator<<(std::ostream &out, const Dispatcher &m);
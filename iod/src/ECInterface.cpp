@@ -47,6 +47,8 @@ struct list_head {
 };
 
 #include "domain.h"
+#else
+#include "ECSimulator.h"
 #endif
 
 #define VERBOSE_DEBUG 0
@@ -80,6 +82,8 @@ static uint64_t last_receive = 0;
 static uint64_t last_update = 0;
 
 long ECInterface::default_tolerance = 1;
+Statistic recv_to_update("Receive to update");
+Statistic update_to_recv("Update to receive");
 #ifndef EC_SIMULATOR
 
 static boost::recursive_mutex modules_mutex;
@@ -93,8 +97,6 @@ static std::list<SDOEntry *>prepared_sdo_entries;
 static std::list<SDOEntry *>new_sdo_entries;
 #endif //USE_SDO
 
-Statistic recv_to_update("Receive to update");
-Statistic update_to_recv("Update to receive");
 
 ECModule::ECModule() : pdo_entries(0), pdos(0), syncs(0), num_entries(0), entry_details(0) {
 	offsets = new unsigned int[64];
@@ -278,8 +280,6 @@ void ECInterface::setup(void *data) {
 	instance()->init();
 }
 
-#ifndef EC_SIMULATOR
-
 void ECInterface::setReferenceTime(uint32_t now) {
 	reference_time = now;
 }
@@ -288,6 +288,8 @@ uint32_t ECInterface::getReferenceTime() {
 	return reference_time;
 }
 
+#ifndef EC_SIMULATOR
+
 bool ECModule::ecrtMasterSlaveConfig(ec_master_t *master) {
 	//std::cout << name << ": " << alias <<", " << position 
 	//	<< std::hex<< vendor_id << ", " << product_code << std::dec <<"\n";
@@ -1020,6 +1022,32 @@ bool ECInterface::operational() {
 	return true;
 }
 
+#else
+
+/* the simulated bus is always online; activation makes the simulated domain available */
+bool ECInterface::activate() {
+	if (!ECSimulator::instance()->domainData()) {
+		ECSimulator::instance()->configureModules();
+	}
+	domain1_pd = ECSimulator::instance()->domainData();
+	active = true;
+	char buf[200];
+	snprintf(buf, 200, "Activated simulated master with domain size %ld", 
+		(long)ECSimulator::instance()->domainSize());
+	MessageLog::instance()->add(buf);
+	std::cout << buf << "\n";
+	return true;
+}
+
+bool ECInterface::deactivate() {
+	active = false;
+	setProcessData(0);
+	return true;
+}
+
+bool ECInterface::online() { return true; }
+bool ECInterface::operational() { return active; }
+
 #endif
 
 
@@ -1028,6 +1056,8 @@ void ECInterface::init() {
 	if(initialised) return;
 #ifdef EC_SIMULATOR
 	master = new ec_master_t;
+	domain1 = new ec_domain_t;
+	all_ok = true;
 	initialised = true;
 	return;
 #else
@@ -1136,8 +1166,6 @@ ECInterface *ECInterface::instance() {
 	return instance_;
 }
 
-#ifndef EC_SIMULATOR
-
 void ECInterface::setMinIOIndex(unsigned int new_val) {
 	assert(min_io_index == 0); // other values untested
 	min_io_index = new_val;
@@ -1147,6 +1175,12 @@ void ECInterface::setMaxIOIndex(unsigned int new_val) {
 	max_io_index = new_val;
 }
 
+uint8_t *ECInterface::getDomainData(size_t &size) {
+	if (!active || !domain1) { size = 0; return 0; }
+	size = ecrt_domain_size(domain1);
+	return ecrt_domain_data(domain1);
+}
+
 uint32_t ECInterface::getProcessDataSize() {
 	return max_io_index - min_io_index +1;
 }
@@ -1269,8 +1303,12 @@ void ECInterface::receiveState() {
 			update_to_recv.report(std::cout);
 			update_to_recv.reset();
 		}
+#ifdef EC_SIMULATOR
+		ECSimulator::instance()->receive(now);
+#else
 		ecrt_master_receive(master);
 		ecrt_domain_process(domain1);
+#endif
 #ifdef USE_DC
 		int err = ecrt_master_reference_clock_time(master, &reference_time);
 		if (err == -ENXIO) { reference_time = -1; } // no reference clocks
@@ -1293,7 +1331,6 @@ int ECInterface::collectState() {
 		std::cerr << "master not ready to collect state\n" << std::flush;
 		return 0;
 	}
-#ifndef EC_SIMULATOR
 
 	size_t domain_size = ecrt_domain_size(domain1);
 	uint8_t *domain1_pd = ecrt_domain_data(domain1) ;
@@ -1416,7 +1453,6 @@ int ECInterface::collectState() {
   std::cout << "copied new domain data: "; display(pd, domain_size); std::cout << "\n";
 #endif
 	memcpy(update_data, domain1_pd, domain_size);
-#endif //EC_SIMULATOR
 
 	return affected_bits;
 }
@@ -1441,9 +1477,10 @@ void ECInterface::sendUpdates() {
 	ecrt_master_sync_slave_clocks(master);
 #endif
     ecrt_domain_queue(domain1);
+#endif
 
-	{
 	uint64_t t = microsecs();
+	{
 	int64_t dt = t - last_receive;
 	if (last_receive != 0) recv_to_update.add(dt);
 	last_update = t;
@@ -1453,10 +1490,12 @@ void ECInterface::sendUpdates() {
 	}
 	}
 
+#ifdef EC_SIMULATOR
+	ECSimulator::instance()->send(t);
+#else
     ecrt_master_send(master);
 #endif
 }
-#endif
 
 /*****************************************************************************/
 
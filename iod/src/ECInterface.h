@@ -140,21 +140,23 @@ public:
 	void add_io_entry(const char *name, unsigned int io_offset, unsigned int bit_offset);
 	const ec_master_t *getMaster() { return master; }
 	const ec_master_state_t *getMasterState() { return &master_state; }
+	bool activate(); // attempt to activate the master
+	bool deactivate(); // deactivate the master
+	bool online();
+	bool operational();
 #ifndef EC_SIMULATOR
 	void listSlaves( std::list<ec_slave_info_t> &slaves );
 	bool prepare();
-	bool activate(); // attempt to activate the master
-	bool deactivate(); // deactivate the master
 	void configureModules();
 	void registerModules();
 	bool addModule(ECModule *m, bool reset_io);
-	bool online();
-	bool operational();
 	//bool configurePDOs();
 	static ECModule *findModule(unsigned int position);
+#endif
 
 	void setProcessData (uint8_t *pd);
 	uint8_t *getProcessData() { return process_data; }
+	uint8_t *getDomainData(size_t &size); // the whole process image as last received, or 0 if inactive
 
 	void setProcessMask( uint8_t *new_mask );
 	uint8_t *getProcessMask();
@@ -172,6 +174,7 @@ public:
 	uint8_t *getUpdateData();
 	uint8_t *getUpdateMask();
 
+#ifndef EC_SIMULATOR
 #ifdef USE_SDO
 	void beginModulePreparation(); // load the first SDO initialisation entry
 	bool finishedModulePreparation(); // are all the SDO init entries completed
@@ -0,0 +1,364 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include "ECSimulator.h"
+#include "MachineInstance.h"
+#include "IOComponent.h"
+#include "MessageLog.h"
+#include "Statistic.h"
+#include "options.h"
+#include "value.h"
+
+ECSimulator *ECSimulator::instance_ = 0;
+
+/* process data layouts for some common terminals */
+static const struct { const char *product; const char *layout; } catalogue[] = {
+	{ "EL1002", "DI:2" }, { "EL1004", "DI:4" }, { "EL1008", "DI:8" }, { "EL1018", "DI:8" },
+	{ "EL1809", "DI:16" }, { "EL1889", "DI:16" },
+	{ "EL2002", "DO:2" }, { "EL2004", "DO:4" }, { "EL2008", "DO:8" }, { "EL2809", "DO:16" },
+	{ "EK1814", "DO:4 DI:4" }, { "EL1814", "DO:4 DI:4" },
+	{ "EL2535", "AO16:2" },
+	{ "EL3054", "AI16:4" }, { "EL3062", "AI16:2" }, { "EL3102", "AI16:2" }, { "EL3151", "AI16:1" },
+	{ "EL3164", "AI16:4" },
+	{ "EL4002", "AO16:2" }, { "EL4102", "AO16:2" }, { "EL4132", "AO16:2" },
+	{ "EL5101", "CNT32:1" }, { "EL5152", "CNT32:2" },
+	{ 0, 0 }
+};
+
+ECSimulator *ECSimulator::instance() {
+	if (!instance_) instance_ = new ECSimulator;
+	return instance_;
+}
+
+ECSimulator::ECSimulator() : domain(0), domain_size(0), start_time(0), last_receive(0), num_cycles(0),
+		cycle_stat(0) {
+	cycle_stat = new Statistic("Simulated bus period");
+	Statistic::add(cycle_stat);
+}
+
+const std::string *ECSimulator::lookupProduct(const std::string &name) {
+	static std::string result;
+	std::string upper(name);
+	std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+	for (int i = 0; catalogue[i].product; ++i) {
+		if (upper.find(catalogue[i].product) != std::string::npos) {
+			result = catalogue[i].layout;
+			return &result;
+		}
+	}
+	return 0;
+}
+
+bool ECSimulator::loadConfig(const char *file_name) {
+	std::ifstream in(file_name);
+	if (!in) {
+		std::cerr << "simulator: could not open " << file_name << "\n";
+		return false;
+	}
+	std::string line;
+	int line_no = 0;
+	while (std::getline(in, line)) {
+		++line_no;
+		if (line.find('#') != std::string::npos) line.erase(line.find('#'));
+		std::istringstream iss(line);
+		std::string directive;
+		if (!(iss >> directive)) continue;
+		bool ok = true;
+		if (directive == "module") {
+			unsigned int position;
+			std::string layout, item;
+			if ( (ok = !!(iss >> position)) ) {
+				while (iss >> item) { if (layout.length()) layout += " "; layout += item; }
+				const std::string *product_layout = lookupProduct(layout);
+				configured_layouts.push_back(std::make_pair(position, product_layout ? *product_layout : layout));
+			}
+		}
+		else if (directive == "loop_module") {
+			unsigned int from, to;
+			if ( (ok = !!(iss >> from >> to)) ) module_loops.push_back(std::make_pair(from, to));
+		}
+		else if (directive == "loop") {
+			Stimulus s(Stimulus::Loop);
+			if ( (ok = !!(iss >> s.source >> s.target)) ) stimuli.push_back(s);
+		}
+		else if (directive == "toggle") {
+			Stimulus s(Stimulus::Toggle);
+			if ( (ok = (iss >> s.target >> s.a) && s.a > 0) ) stimuli.push_back(s);
+		}
+		else if (directive == "random") {
+			Stimulus s(Stimulus::Random);
+			if ( (ok = !!(iss >> s.target >> s.a)) ) stimuli.push_back(s);
+		}
+		else if (directive == "sine") {
+			Stimulus s(Stimulus::Sine);
+			if ( (ok = (iss >> s.target >> s.a >> s.b >> s.c) && s.c > 0) ) stimuli.push_back(s);
+		}
+		else if (directive == "ramp") {
+			Stimulus s(Stimulus::Ramp);
+			if ( (ok = (iss >> s.target >> s.a >> s.b >> s.c) && s.c > 0) ) stimuli.push_back(s);
+		}
+		else
+			ok = false;
+		if (!ok) {
+			char buf[150];
+			snprintf(buf, 150, "simulator: %s line %d: could not understand '%s'", file_name, line_no, line.c_str());
+			MessageLog::instance()->add(buf);
+			std::cerr << buf << "\n";
+		}
+	}
+	return true;
+}
+
+bool ECSimulator::addModule(unsigned int position, const std::string &name, const std::string &layout) {
+	SimulatedModule module;
+	module.name = name;
+	module.position = position;
+	module.layout = layout;
+	std::istringstream iss(layout);
+	std::string item;
+	while (iss >> item) {
+		size_t colon = item.find(':');
+		int count = (colon == std::string::npos) ? 1 : atoi(item.substr(colon+1).c_str());
+		std::string kind = item.substr(0, colon);
+		bool output;
+		unsigned int bitlen;
+		if (kind == "DI") { output = false; bitlen = 1; }
+		else if (kind == "DO") { output = true; bitlen = 1; }
+		else if (kind == "AI16") { output = false; bitlen = 16; }
+		else if (kind == "AO16") { output = true; bitlen = 16; }
+		else if (kind == "CNT32") { output = false; bitlen = 32; }
+		else {
+			std::cerr << "simulator: unknown layout item " << item << " for module " << name << "\n";
+			return false;
+		}
+		for (int i = 0; i < count; ++i) {
+			std::stringstream ss;
+			ss << kind << " " << (i+1);
+			module.entries.push_back(SimulatedEntry(ss.str(), output, bitlen));
+		}
+	}
+	std::list<SimulatedModule>::iterator iter = modules.begin();
+	while (iter != modules.end() && (*iter).position < position) ++iter;
+	if (iter != modules.end() && (*iter).position == position) {
+		std::cerr << "simulator: module " << name << " duplicates position " << position << "\n";
+		return false;
+	}
+	modules.insert(iter, module);
+	return true;
+}
+
+bool ECSimulator::configureModules() {
+	if (domain) return true; // already laid out
+	if (simulator_config()) loadConfig(simulator_config());
+
+	std::list<MachineInstance*>::iterator m_iter = MachineInstance::begin();
+	while (m_iter != MachineInstance::end()) {
+		MachineInstance *m = *m_iter++;
+		if (m->_type != "MODULE") continue;
+		const Value &pos = m->getValue("position");
+		long position = -1;
+		if (!pos.asInteger(position) || position < 0) continue;
+
+		std::string layout;
+		std::list<std::pair<unsigned int, std::string> >::iterator cfg = configured_layouts.begin();
+		while (cfg != configured_layouts.end()) {
+			if ((*cfg).first == position) { layout = (*cfg).second; break; }
+			++cfg;
+		}
+		if (layout.empty()) {
+			const Value &product = m->getValue("product");
+			const std::string *product_layout = 0;
+			if (product != SymbolTable::Null) product_layout = lookupProduct(product.asString());
+			if (!product_layout) product_layout = lookupProduct(m->getName());
+			if (product_layout) layout = *product_layout;
+		}
+		if (layout.empty()) {
+			char buf[150];
+			snprintf(buf, 150, "simulator: no layout known for module %s, use a 'module' line in the simulator config",
+				m->getName().c_str());
+			MessageLog::instance()->add(buf);
+			std::cerr << buf << "\n";
+			continue;
+		}
+		addModule(position, m->getName(), layout);
+	}
+
+	// allocate the process data in position order. Bits of the same direction
+	// are packed within a module, other entries and each module start on a
+	// byte boundary, as separate sync managers would on a real module
+	unsigned int offset = 0;
+	std::list<SimulatedModule>::iterator iter = modules.begin();
+	while (iter != modules.end()) {
+		SimulatedModule &module = *iter++;
+		unsigned int bit = 0;
+		bool last_output = false;
+		std::vector<SimulatedEntry>::iterator e_iter = module.entries.begin();
+		while (e_iter != module.entries.end()) {
+			SimulatedEntry &entry = *e_iter++;
+			if (bit && entry.output != last_output) {
+				offset += (bit + 7) / 8;
+				bit = 0;
+			}
+			last_output = entry.output;
+			if (entry.bitlen == 1) {
+				entry.offset = offset + bit / 8;
+				entry.bit_pos = bit % 8;
+				++bit;
+			}
+			else {
+				offset += (bit + 7) / 8;
+				bit = 0;
+				entry.offset = offset;
+				entry.bit_pos = 0;
+				offset += entry.bitlen / 8;
+			}
+		}
+		offset += (bit + 7) / 8;
+		std::cout << "simulator: module " << module.name << " at position " << module.position
+			<< " (" << module.layout << ")\n";
+	}
+	delete[] domain;
+	domain_size = offset ? offset : 1;
+	domain = new uint8_t[domain_size];
+	memset(domain, 0, domain_size);
+	std::cout << "simulator: domain size " << domain_size << " bytes for " << modules.size() << " modules\n";
+	return true;
+}
+
+SimulatedModule *ECSimulator::findModule(unsigned int position) {
+	std::list<SimulatedModule>::iterator iter = modules.begin();
+	while (iter != modules.end()) {
+		if ((*iter).position == position) return &(*iter);
+		++iter;
+	}
+	return 0;
+}
+
+const SimulatedEntry *ECSimulator::findEntry(unsigned int position, unsigned int entry) {
+	SimulatedModule *module = findModule(position);
+	if (!module || entry >= module->entries.size()) return 0;
+	return &module->entries[entry];
+}
+
+const SimulatedEntry *ECSimulator::entryForPoint(const std::string &point_name) {
+	MachineInstance *m = MachineInstance::find(point_name.c_str());
+	if (!m || !m->io_interface) {
+		std::cerr << "simulator: " << point_name << " is not an io point\n";
+		return 0;
+	}
+	return findEntry(m->io_interface->address.module_position, m->io_interface->address.entry_position);
+}
+
+void ECSimulator::resolveStimuli() {
+	std::list<Stimulus>::iterator iter = stimuli.begin();
+	while (iter != stimuli.end()) {
+		Stimulus &s = *iter;
+		s.to = entryForPoint(s.target);
+		if (s.kind == Stimulus::Loop) s.from = entryForPoint(s.source);
+		if (!s.to || (s.kind == Stimulus::Loop && !s.from)) {
+			iter = stimuli.erase(iter);
+			continue;
+		}
+		++iter;
+	}
+	std::list<std::pair<unsigned int, unsigned int> >::iterator loops = module_loops.begin();
+	while (loops != module_loops.end()) {
+		SimulatedModule *from = findModule((*loops).first);
+		SimulatedModule *to = findModule((*loops).second);
+		++loops;
+		if (!from || !to) continue;
+		std::vector<SimulatedEntry>::iterator out = from->entries.begin();
+		std::vector<SimulatedEntry>::iterator in = to->entries.begin();
+		while (out != from->entries.end() && in != to->entries.end()) {
+			if (!(*out).output) { ++out; continue; }
+			if ((*in).output) { ++in; continue; }
+			Stimulus s(Stimulus::Loop);
+			s.from = &(*out++);
+			s.to = &(*in++);
+			stimuli.push_back(s);
+		}
+	}
+	std::cout << "simulator: " << stimuli.size() << " stimuli and loopbacks\n";
+}
+
+uint32_t ECSimulator::read(const SimulatedEntry *e) {
+	uint8_t *p = domain + e->offset;
+	switch (e->bitlen) {
+		case 1: return EC_READ_BIT(p, e->bit_pos);
+		case 8: return EC_READ_U8(p);
+		case 16: return EC_READ_U16(p);
+		default: return EC_READ_U32(p);
+	}
+}
+
+void ECSimulator::write(const SimulatedEntry *e, uint32_t val) {
+	uint8_t *p = domain + e->offset;
+	switch (e->bitlen) {
+		case 1: EC_WRITE_BIT(p, e->bit_pos, val ? 1 : 0); break;
+		case 8: EC_WRITE_U8(p, val); break;
+		case 16: EC_WRITE_U16(p, val); break;
+		default: EC_WRITE_U32(p, val);
+	}
+}
+
+void ECSimulator::receive(uint64_t now) {
+	if (!domain) return;
+	if (!start_time) start_time = now;
+	uint64_t dt = (last_receive) ? now - last_receive : 0;
+	if (last_receive) cycle_stat->add(dt);
+	last_receive = now;
+	double t = (double)(now - start_time) / 1000000.0;
+
+	std::list<Stimulus>::iterator iter = stimuli.begin();
+	while (iter != stimuli.end()) {
+		Stimulus &s = *iter++;
+		switch (s.kind) {
+			case Stimulus::Loop:
+				write(s.to, read(s.from));
+				break;
+			case Stimulus::Toggle:
+				if (now >= s.next_change) {
+					if (s.next_change) write(s.to, !read(s.to));
+					s.next_change = now + (uint64_t)(s.a * 500.0); // half the period, in usec
+				}
+				break;
+			case Stimulus::Random:
+				if (drand48() < s.a * (double)dt / 1000000.0) write(s.to, !read(s.to));
+				break;
+			case Stimulus::Sine:
+				write(s.to, (uint32_t)(int32_t)(s.b + s.a * sin(2.0 * M_PI * t * 1000.0 / s.c)));
+				break;
+			case Stimulus::Ramp:
+				write(s.to, (uint32_t)(int64_t)(s.a + (s.b - s.a) * fmod(t * 1000.0, s.c) / s.c));
+				break;
+		}
+	}
+}
+
+void ECSimulator::send(uint64_t now) {
+	++num_cycles;
+}
@@ -0,0 +1,165 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __ECSimulator_h__
+#define __ECSimulator_h__
+
+/*
+	A simulated EtherCAT master and domain for the EC_SIMULATOR build.
+
+	Each MODULE in the program is given a simulated process data layout,
+	taken from a small catalogue of Beckhoff terminals (matched against the
+	module's "product" property or its name) or from a 'module' line in the
+	simulator configuration file. The simulated domain is exchanged through
+	the same ECInterface and EtherCATThread path as a real bus, so IOComponents
+	and the machines that use them see ordinary process data.
+
+	The configuration file (--simulator_config) contains one directive per line:
+
+		module <position> <product | layout>   eg. module 3 DI:8 or module 4 AI16:2 DO:2
+		loop <output> <input>                  copy an output point to an input point
+		loop_module <out position> <in position>  copy every output of a module to the inputs of another
+		toggle <input> <period ms>             square wave on a digital input
+		random <input> <toggles per second>    random toggles on a digital input
+		sine <input> <amplitude> <offset> <period ms>
+		ramp <input> <min> <max> <period ms>   sawtooth, useful for counters
+
+	Layout items are DI:n, DO:n (single bits), AI16:n, AO16:n and CNT32:n.
+	Loopbacks take effect on the following cycle, as they would through real wiring.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+#include <list>
+
+class Statistic;
+
+struct SimulatedEntry {
+	std::string name;
+	bool output;
+	unsigned int offset; // byte offset in the domain
+	unsigned int bit_pos;
+	unsigned int bitlen;
+	SimulatedEntry(const std::string &n, bool out, unsigned int len)
+		: name(n), output(out), offset(0), bit_pos(0), bitlen(len) {}
+};
+
+struct SimulatedModule {
+	std::string name;
+	unsigned int position;
+	std::string layout;
+	std::vector<SimulatedEntry> entries;
+};
+
+class ECSimulator {
+public:
+	static ECSimulator *instance();
+
+	bool loadConfig(const char *file_name);
+
+	// build the simulated modules for the MODULE machines and allocate the domain
+	bool configureModules();
+	SimulatedModule *findModule(unsigned int position);
+	const SimulatedEntry *findEntry(unsigned int position, unsigned int entry);
+
+	// bind the configured stimuli to the addresses of the io points, once they exist
+	void resolveStimuli();
+
+	uint8_t *domainData() { return domain; }
+	size_t domainSize() const { return domain_size; }
+
+	void receive(uint64_t now); // apply stimuli and loopbacks, as if reading the bus
+	void send(uint64_t now); // outputs are already in the domain, count the cycle
+
+	uint64_t cycles() const { return num_cycles; }
+
+private:
+	ECSimulator();
+	ECSimulator(const ECSimulator &);
+	ECSimulator &operator=(const ECSimulator &);
+
+	struct Stimulus {
+		enum Kind { Loop, Toggle, Random, Sine, Ramp };
+		Kind kind;
+		std::string target;
+		std::string source; // loopbacks only
+		double a, b, c; // kind specific parameters
+		const SimulatedEntry *to;
+		const SimulatedEntry *from;
+		uint64_t next_change;
+		Stimulus(Kind k) : kind(k), a(0), b(0), c(0), to(0), from(0), next_change(0) {}
+	};
+
+	bool addModule(unsigned int position, const std::string &name, const std::string &layout);
+	const std::string *lookupProduct(const std::string &name);
+	const SimulatedEntry *entryForPoint(const std::string &point_name);
+	uint32_t read(const SimulatedEntry *e);
+	void write(const SimulatedEntry *e, uint32_t val);
+
+	static ECSimulator *instance_;
+	std::list<SimulatedModule> modules; // ordered by position
+	std::list<std::pair<unsigned int, std::string> > configured_layouts;
+	std::list<std::pair<unsigned int, unsigned int> > module_loops;
+	std::list<Stimulus> stimuli;
+	uint8_t *domain;
+	size_t domain_size;
+	uint64_t start_time;
+	uint64_t last_receive;
+	uint64_t num_cycles;
+	Statistic *cycle_stat;
+};
+
+// the parts of the ecrt domain interface used on the process data path
+inline uint8_t *ecrt_domain_data(void *) { return ECSimulator::instance()->domainData(); }
+inline size_t ecrt_domain_size(void *) { return ECSimulator::instance()->domainSize(); }
+
+// ecrt-compatible accessors for process data in the simulated domain (little endian)
+#define EC_READ_BIT(DATA, POS) ((*((uint8_t *)(DATA)) >> (POS)) & 0x01)
+#define EC_WRITE_BIT(DATA, POS, VAL) \
+	do { \
+		if (VAL) *((uint8_t *)(DATA)) |= (1 << (POS)); \
+		else *((uint8_t *)(DATA)) &= ~(1 << (POS)); \
+	} while (0)
+#define EC_READ_U8(DATA) ((uint8_t) *((uint8_t *)(DATA)))
+#define EC_READ_S8(DATA) ((int8_t) *((uint8_t *)(DATA)))
+#define EC_READ_U16(DATA) \
+	((uint16_t) (((uint8_t *)(DATA))[0] | (((uint8_t *)(DATA))[1] << 8)))
+#define EC_READ_S16(DATA) ((int16_t) EC_READ_U16(DATA))
+#define EC_READ_U32(DATA) \
+	((uint32_t) (EC_READ_U16(DATA) | ((uint32_t)EC_READ_U16((uint8_t *)(DATA) + 2) << 16)))
+#define EC_READ_S32(DATA) ((int32_t) EC_READ_U32(DATA))
+#define EC_WRITE_U8(DATA, VAL) do { *((uint8_t *)(DATA)) = ((uint8_t) (VAL)); } while (0)
+#define EC_WRITE_S8(DATA, VAL) EC_WRITE_U8(DATA, VAL)
+#define EC_WRITE_U16(DATA, VAL) \
+	do { \
+		((uint8_t *)(DATA))[0] = (uint8_t)((VAL) & 0xff); \
+		((uint8_t *)(DATA))[1] = (uint8_t)(((VAL) >> 8) & 0xff); \
+	} while (0)
+#define EC_WRITE_S16(DATA, VAL) EC_WRITE_U16(DATA, VAL)
+#define EC_WRITE_U32(DATA, VAL) \
+	do { \
+		EC_WRITE_U16(DATA, (VAL) & 0xffff); \
+		EC_WRITE_U16((uint8_t *)(DATA) + 2, ((VAL) >> 16) & 0xffff); \
+	} while (0)
+#define EC_WRITE_S32(DATA, VAL) EC_WRITE_U32(DATA, VAL)
+
+#endif
@@ -64,9 +64,12 @@
 #include "MessagingInterface.h"
 #include "ecat_thread.h"
 #include "ProcessingThread.h"
+#include "EtherCATSetup.h"
 #ifndef EC_SIMULATOR
 #include <ecrt.h>
 #include "ethercat_xml_parser.h"
+#else
+#include "ECSimulator.h"
 #endif
 
 extern boost::mutex thread_protection_mutex;
@@ -222,25 +225,46 @@ void generateIOComponentModules( std::map<unsigned int, DeviceInfo*> slave_confi
 					continue; // could not find this device
 				}
 				EntryDetails *ed = &module->entry_details[entry_position];
-				unsigned int direction = module->syncs[ed->sm_index].dir;
 				unsigned int offset_idx = entry_position;
+				bool is_output = module->syncs[ed->sm_index].dir == EC_DIR_OUTPUT;
+				const char *entry_name = ed->name.c_str();
+				unsigned int offset = module->offsets[offset_idx];
+				unsigned int bit_pos = module->bit_positions[offset_idx];
 				unsigned int bitlen = module->pdo_entries[entry_position].bit_length;
+#else
+				// the simulated bus lays out its entries when modules are configured
+				const SimulatedEntry *entry = ECSimulator::instance()->findEntry(module_position, entry_position);
+				if (!entry)
+				{
+					snprintf(error_buf, error_buf_size, "No simulated entry %d on module %d (%s)", 
+							entry_position, module_position, name.c_str());
+					MessageLog::instance()->add(error_buf);
+					std::cerr << error_buf << "\n";
+					error_messages.push_back(error_buf);
+					++num_errors;
+					continue;
+				}
+				unsigned int offset_idx = entry_position;
+				bool is_output = entry->output;
+				const char *entry_name = entry->name.c_str();
+				unsigned int offset = entry->offset;
+				unsigned int bit_pos = entry->bit_pos;
+				unsigned int bitlen = entry->bitlen;
+#endif
 
-				if (direction == EC_DIR_OUTPUT)
+				if (is_output)
 				{
 #if 1
 					std::cerr << "Adding new output device " << m->getName()
 						<< " position: " << entry_position
-						<< " name: " << module->entry_details[offset_idx].name
-						<< " bit_pos: " << module->bit_positions[offset_idx]
-						<< " offset: " << module->offsets[offset_idx]
+						<< " name: " << entry_name
+						<< " bit_pos: " << bit_pos
+						<< " offset: " << offset
 						<< " bitlen: " << bitlen <<  "\n";
 #endif
 					IOAddress addr (
-							IOComponent::add_io_entry(ed->name.c_str(),
-								module_position,
-								module->offsets[offset_idx],
-								module->bit_positions[offset_idx], offset_idx, bitlen));
+							IOComponent::add_io_entry(entry_name,
+								module_position, offset, bit_pos, offset_idx, bitlen));
 
 					if (bitlen == 1)
 					{
@@ -269,16 +293,13 @@ void generateIOComponentModules( std::map<unsigned int, DeviceInfo*> slave_confi
 #if 1
 					std::cerr << "Adding new input device " << m->getName()
 						<< " position: " << entry_position
-						<< " name: " << module->entry_details[offset_idx].name
-						<< " sm_idx: " << std::hex << ed->sm_index << std::dec
-						<< " bit_pos: " << module->bit_positions[offset_idx]
-						<< " offset: " << module->offsets[offset_idx]
+						<< " name: " << entry_name
+						<< " bit_pos: " << bit_pos
+						<< " offset: " << offset
 						<<  " bitlen: " << bitlen << "\n";
 #endif
-					IOAddress addr( IOComponent::add_io_entry(ed->name.c_str(),
-								module_position,
-								module->offsets[offset_idx],
-								module->bit_positions[offset_idx], offset_idx, bitlen));
+					IOAddress addr( IOComponent::add_io_entry(entry_name,
+								module_position, offset, bit_pos, offset_idx, bitlen));
 
 					if (bitlen == 1)
 					{
@@ -332,7 +353,6 @@ void generateIOComponentModules( std::map<unsigned int, DeviceInfo*> slave_confi
 						}
 					}
 				}
-#endif
 			}
 			else
 			{
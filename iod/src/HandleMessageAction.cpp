@@ -24,6 +24,7 @@
 #include "Logger.h"
 #include "IOComponent.h"
 #include "MachineInstance.h"
+#include "Profiler.h"
 
 Action *HandleMessageActionTemplate::factory(MachineInstance *mi) {
 	return new HandleMessageAction(mi, *this);
@@ -59,7 +60,11 @@ Action::Status HandleMessageAction::run() {
 	handler = owner->findHandler(*package.message, package.transmitter, package.needs_receipt);
 	if (handler) {
 		suspend();
-		Status stat = (*handler)();
+		Status stat;
+		{
+			ProfileScope profile(Profiler::Message, package.message->getText());
+			stat = (*handler)();
+		}
 		if ( stat == Failed ) {
 			std::stringstream ss;
 			ss << "handler " << *handler << " failed to start\n" << std::flush;
@@ -31,6 +31,8 @@
 #include <algorithm>
 #ifndef EC_SIMULATOR
 #include <ecrt.h>
+#else
+#include "ECSimulator.h"
 #endif
 #include "buffering.c"
 #include "ProcessingThread.h"
@@ -489,21 +491,6 @@ std::ostream &operator<<(std::ostream&out, const IOComponent &ioc) {
 	return ioc.operator<<(out);
 }
 
-#ifdef EC_SIMULATOR
-unsigned char mem[1000];
-#define EC_READ_BIT(offset, bitpos) ( (*offset) & (1 << (bitpos)) )
-#define EC_WRITE_BIT(offset, bitpos, val) *(offset) |=  ( 1<< (bitpos))
-#define EC_READ_S8(offset) 0
-#define EC_READ_S16(offset) 0
-#define EC_READ_S32(offset) 0
-#define EC_READ_U8(offset) 0
-#define EC_READ_U16(offset) 0
-#define EC_READ_U32(offset) 0
-#define EC_WRITE_U8(offset, val) 0
-#define EC_WRITE_U16(offset, val) 0
-#define EC_WRITE_U32(offset, val) 0
-#endif
-
 int32_t IOComponent::filter(int32_t val) {
     return val;
 }
@@ -530,7 +517,7 @@ public:
 	static long default_speed_filter_len;	// a default value for speed_filter_len
 	static long default_position_history;	// a default value for position_history
 	static long default_speed_tolerance;	// a default value for speed_tolerance
-	FloatBuffer speeds;
+	FloatBuffer speeds;			// only used by the processing thread so it is not locked
 	int rate_len;
     
     InputFilterSettings() :property_changed(true), positions(0), 
@@ -538,7 +525,7 @@ public:
 			buffer_len(200), tolerance(&default_tolerance), filter_coeff(0),filter_len(&default_filter_len), 
 			filter_type(0),
 			position_history(&default_position_history), speed_tolerance(&default_speed_tolerance),
-			speed(0), speeds(4), rate_len(4) {
+			speed(0), speeds(4, true), rate_len(4) {
 
 		double c[] = {0.081,0.215,0.541,0.865,1,0.865,0.541,0.215,0.081};
 		butterworth_len = sizeof(c) / sizeof(double);
@@ -667,6 +654,7 @@ int32_t AnalogueInput::filter(int32_t raw) {
 		double v = config->speeds.average(config->speeds.length());
 		if (fabs(v)<1.0) v = 0.0;
 		o->properties.add("Velocity", (long)v, SymbolTable::ST_REPLACE);
+		o->notifyAggregates();
 	}
 #endif
 	return config->last_sent;
@@ -694,7 +682,7 @@ public:
 	static long default_input_scale;
 	long speed;
 	uint16_t buffer_len;
-	FloatBuffer speeds;
+	FloatBuffer speeds; // only used by the processing thread so it is not locked
 	int rate_len;
 
 	CounterInternals() : positions(0), 
@@ -703,7 +691,7 @@ public:
 	speed_tolerance(&default_speed_tolerance),
 	input_scale(&default_input_scale),
 	last_sent(0), 
-	prev_sent(0), last_time(0), speed(0), buffer_len(200),speeds(4), rate_len(4) {
+	prev_sent(0), last_time(0), speed(0), buffer_len(200),speeds(4, true), rate_len(4) {
 		positions = createBuffer(buffer_len);
 	}
 
@@ -836,6 +824,7 @@ int32_t Counter::filter(int32_t val) {
 		o->properties.add("VALUE", (long)scaled_val, SymbolTable::ST_REPLACE);
 		o->properties.add("Position", (long)internals->last_sent, SymbolTable::ST_REPLACE);
 		o->properties.add("Velocity", (long)internals->speeds.average(internals->speeds.length()), SymbolTable::ST_REPLACE);
+		o->notifyAggregates();
 	}
 #endif
 	return internals->last_sent;
@@ -855,6 +844,7 @@ int32_t CounterRate::filter(int32_t val) {
 		MachineInstance *o = *owners_iter++;
 		o->properties.add("IOTIME", (long)read_time, SymbolTable::ST_REPLACE);
 		o->properties.add("IOVALUE", (long)val, SymbolTable::ST_REPLACE);
+		o->notifyAggregates();
 	}
 #endif
 	return IOComponent::filter(val);
@@ -97,6 +97,7 @@ public:
 	static int getMinIOOffset();
 	static int getMaxIOOffset();
 	static uint8_t *getProcessData();
+	static size_t processDataSize() { return process_data_size; }
 	static uint8_t *getProcessMask();
 	static uint8_t *getUpdateData();
 	static uint8_t *getDefaultData();
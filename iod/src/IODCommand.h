@@ -57,10 +57,11 @@ private:
 	int val;
 };
 
+class IODCommandFactory;
 class IODCommand {
 public:
     IODCommand( int minp = 0, int maxp = 100)
-	: done(Unassigned), seqno(sequences.next()),
+	: done(Unassigned), seqno(sequences.next()), factory(0),
 		error_str(""), result_str(""), min_params(minp), max_params(maxp) {}
     virtual ~IODCommand(){ }
     const char *error() { return error_str.c_str(); }
@@ -71,6 +72,7 @@ public:
 
 	CommandResult done;
 	int seqno;
+	IODCommandFactory *factory; // the pool this command is returned to after use, if any
 
 	CommandResult operator()(std::vector<Value> &params) {
 		done = (run(params)) ? Success : Failure;
@@ -81,6 +83,10 @@ public:
 		return done;
 	}
 	void setParameters(std::vector<Value> &);
+	virtual void reset() {
+		done = Unassigned; seqno = sequences.next();
+		parameters.clear(); error_str.clear(); result_str.clear();
+	}
 	const Value &name() { if (parameters.empty()) return SymbolTable::Null; else return parameters[0]; }
 	size_t numParams() { return parameters.size(); }
 	const Value &param(size_t which) { if (which < parameters.size()) return parameters[which]; else return SymbolTable::Null; }
@@ -98,4 +104,35 @@ protected:
 
 std::ostream & operator<<(std::ostream &, const IODCommand &);
 
+/* Command factories are registered with the command interface against a
+	(verb, number of parameters) key. A factory may further restrict the commands
+	it handles by requiring a minimum parameter count or a keyword at a given
+	position (eg MODBUS EXPORT). Factories keep a small pool of commands that
+	have been returned so that the objects can be reused for later requests.
+*/
+class IODCommandFactory {
+public:
+	IODCommandFactory(size_t min_count = 0, size_t word_pos = 0, const char *word = 0)
+		: min_params(min_count), keyword_pos(word_pos), keyword(word) {}
+	virtual ~IODCommandFactory();
+	virtual IODCommand *create();
+	virtual bool matches(std::vector<Value> &params);
+	IODCommand *acquire();
+	void release(IODCommand *cmd);
+private:
+	size_t min_params;
+	size_t keyword_pos;
+	const char *keyword;
+	std::vector<IODCommand *> free_list;
+	IODCommandFactory(const IODCommandFactory &);
+	IODCommandFactory &operator=(const IODCommandFactory &);
+};
+
+template<class T> class CommandFactory : public IODCommandFactory {
+public:
+	CommandFactory(size_t min_count = 0, size_t word_pos = 0, const char *word = 0)
+		: IODCommandFactory(min_count, word_pos, word) {}
+	IODCommand *create() { return new T; }
+};
+
 #endif
@@ -19,6 +19,8 @@
 */
 
 #include <stdlib.h>
+#include <string.h>
+#include <errno.h>
 #include "IODCommands.h"
 #include "MachineInstance.h"
 #include "IOComponent.h"
@@ -33,9 +35,15 @@
 #include "MessageLog.h"
 #include "MessageEncoding.h"
 #include "Channel.h"
+#include "PersistenceClient.h"
 #include "MessagingInterface.h"
 #include "Scheduler.h"
 #include "SharedWorkSet.h"
+#include "ClientInterface.h"
+#include "JSONWriter.h"
+#include "ObjectPool.h"
+#include "LatencyHistogram.h"
+#include "Profiler.h"
 #ifndef EC_SIMULATOR
 #include "ECInterface.h"
 #ifdef USE_SDO
@@ -233,31 +241,25 @@ bool IODCommandResume::run(std::vector<Value> &params) {
 
     bool IODCommandDescribe::run(std::vector<Value> &params) {
         std::cout << "received iod command Describe " << params[1] << "\n";
-        bool use_json = false;
         if (params.size() == 3 && params[2] != "JSON") {
             error_str = "Usage: DESCRIBE machine [JSON]";
             return false;
         }
+        bool use_json = params.size() == 3;
         if (params.size() == 2 || params.size() == 3) {
             MachineInstance *m = MachineInstance::find(params[1].asString().c_str());
-            cJSON *root;
-            if (use_json)
-                root = cJSON_CreateArray();
             std::stringstream ss;
             if (m)
                     m->describe(ss);
             else
                 ss << "Failed to describe unknown machine " << params[1];
             if (use_json) {
-                std::istringstream iss(ss.str());
-                char buf[500];
-                while (iss.getline(buf, 500, '\n')) {
-                    cJSON_AddItemToArray(root, cJSON_CreateString(buf));
-                }
-                char *res = cJSON_Print(root);
-                cJSON_Delete(root);
-                result_str = res;
-                free(res);
+                result_str.clear();
+                JSONWriter out(result_str);
+                out.beginArray();
+                std::string line;
+                while (std::getline(ss, line)) out.string(line);
+                out.endArray();
             }
             else
                 result_str = ss.str();
@@ -519,11 +521,12 @@ bool IODCommandBusy::run(std::vector<Value> &params) {
 	std::ostringstream ss;
 	if (!SharedWorkSet::instance()->empty()) {
 		ss << "Busy machines: ";
-		std::set<MachineInstance*>::iterator iter = SharedWorkSet::instance()->begin();
+		boost::recursive_mutex::scoped_lock lock(SharedWorkSet::instance()->getMutex());
 		const char *delim = "";
-		while (iter != SharedWorkSet::instance()->end()) {
-			MachineInstance *m = *iter++;
+		MachineInstance *m = SharedWorkSet::instance()->front();
+		while (m) {
 			ss << delim << m->getName(); delim = ",";
+			m = SharedWorkSet::instance()->next(m);
 		}
 		ss << "\n\n";
 	}
@@ -548,63 +551,55 @@ bool IODCommandBusy::run(std::vector<Value> &params) {
 
 std::set<std::string> IODCommandListJSON::no_display;
 
-cJSON *printMachineInstanceToJSON(MachineInstance *m, std::string prefix = "") {
-    cJSON *node = cJSON_CreateObject();
-    std::string name_str = m->getName();
-    if (prefix.length()!=0) {
-        std::stringstream ss;
-        ss << prefix << '-' << m->getName()<< std::flush;
-        name_str = ss.str();
-    }
-    cJSON_AddStringToObject(node, "name", name_str.c_str());
-    cJSON_AddStringToObject(node, "class", m->_type.c_str());
+static void writeMachineInstanceJSON(JSONWriter &out, MachineInstance *m,
+		const std::string &prefix, const std::set<std::string> *fields) {
+#define WANT(field) (!fields || fields->count(field))
+	out.beginObject();
+	if (WANT("name")) {
+		if (prefix.length()!=0)
+			out.field("name", prefix + '-' + m->getName());
+		else
+			out.field("name", m->getName());
+	}
+	if (WANT("class")) out.field("class", m->_type);
  #ifndef EC_SIMULATOR
-    if (m->io_interface) {
+	if (m->io_interface && WANT("module")) {
 		IOComponent *ioc = m->io_interface;
-		cJSON_AddNumberToObject(node, "module", ioc->address.module_position);
+		out.field("module", (long)ioc->address.module_position);
 		ECModule *mod = ECInterface::findModule(ioc->address.module_position);
-		if (mod) {
-			cJSON_AddStringToObject(node, "module_name", mod->name.c_str());
-		}
+		if (mod) out.field("module_name", mod->name);
 	}
  #endif
 
-    SymbolTableConstIterator st_iter = m->properties.begin();
-    while (st_iter != m->properties.end()) {
-	    std::pair<std::string, Value> item(*st_iter++);
-	    if (item.second.kind == Value::t_integer)
-	        cJSON_AddNumberToObject(node, item.first.c_str(), item.second.iValue);
+	SymbolTableConstIterator st_iter = m->properties.begin();
+	while (st_iter != m->properties.end()) {
+		const std::pair<std::string, Value> &item(*st_iter++);
+		if (!WANT(item.first)) continue;
+		out.key(item.first);
+		if (item.second.kind == Value::t_integer)
+			out.number(item.second.iValue);
 		else if (item.second.kind == Value::t_float)
-			cJSON_AddItemToObject(node, item.first.c_str(), cJSON_CreateDouble(item.second.fValue));
-	    else
-	        cJSON_AddStringToObject(node, item.first.c_str(), item.second.asString().c_str());
-    }
-	Action *action;
-	if ( (action = m->executingCommand()))  {
+			out.number(item.second.fValue);
+		else
+			out.string(item.second.asString());
+	}
+	Action *action = m->executingCommand();
+	if (action && WANT("executing")) {
 		std::stringstream ss;
 		ss << *action;
-        cJSON_AddStringToObject(node, "executing", ss.str().c_str());
+		out.field("executing", ss.str());
 	}
 
-	if (m->enabled())
-		cJSON_AddTrueToObject(node, "enabled");
-	else
-		cJSON_AddFalseToObject(node, "enabled");
-    if (!m->io_interface) {
-			size_t len = m->getCurrent().getName().length()+1;
-			char *cs = (char*)malloc(len);
-			memcpy(cs, m->getCurrentStateString(), len);
-			cJSON_AddStringToObject(node, "state", cs);
-			free(cs);
-    }
-    else {
-           IOComponent *device = IOComponent::lookup_device(m->getName().c_str());
-           if (device) {
-               const char *state = device->getStateString();
-               cJSON_AddStringToObject(node, "state", state);
-           }
-    }
-    if (m->commands.size()) {
+	if (WANT("enabled")) out.key("enabled").boolean(m->enabled());
+	if (WANT("state")) {
+		if (!m->io_interface)
+			out.field("state", m->getCurrentStateString());
+		else {
+			IOComponent *device = IOComponent::lookup_device(m->getName().c_str());
+			if (device) out.field("state", device->getStateString());
+		}
+	}
+	if (m->commands.size() && WANT("commands")) {
 		std::stringstream cmds;
 		std::pair<std::string, MachineCommand*> cmd;
 		const char *delim = "";
@@ -612,78 +607,123 @@ cJSON *printMachineInstanceToJSON(MachineInstance *m, std::string prefix = "") {
 			cmds << delim << cmd.first;
 			delim = ",";
 		}
-		cmds << std::flush;
-		cJSON_AddStringToObject(node, "commands", cmds.str().c_str());
-    }
-/*
-    if (m->receives_functions.size()) {
-		std::stringstream cmds;
-		std::pair<Message, MachineCommand*> rcv;
-		const char *delim = "";
-		BOOST_FOREACH(rcv, m->receives_functions) {
-			cmds << delim << rcv.first;
-			delim = ",";
-		}
-		cmds << std::flush;
-		cJSON_AddStringToObject(node, "receives", cmds.str().c_str());
-    }
-*/
-	if (m->properties.size()) {
+		out.field("commands", cmds.str());
+	}
+	if (m->properties.size() && WANT("display")) {
 		std::stringstream props;
 		SymbolTableConstIterator st_iter = m->properties.begin();
 		int count = 0;
 		const char *delim="";
 		while (st_iter != m->properties.end()) {
-			std::pair<std::string, Value> prop = *st_iter++;
+			const std::pair<std::string, Value> &prop = *st_iter++;
 			if (IODCommandListJSON::no_display.count(prop.first)) continue;
 			props << delim << prop.first;
 			delim = ",";
 			++count;
 		}
-		if ( (action = m->executingCommand()))  {
-			props << delim << "executing";
-		}
-		props << std::flush;
-		if (count) cJSON_AddStringToObject(node, "display", props.str().c_str());
+		if (action) props << delim << "executing";
+		if (count) out.field("display", props.str());
 	}
-    return node;
+	out.endObject();
+#undef WANT
 }
 
+static bool changedSince(MachineInstance *m, uint64_t since) {
+	if (m->lastChange() > since) return true;
+	for (unsigned int idx = 0; idx < m->locals.size(); ++idx) {
+		MachineInstance *local = m->locals[idx].machine;
+		if (local && local->lastChange() > since) return true;
+	}
+	return false;
+}
 
-    bool IODCommandListJSON::run(std::vector<Value> &params) {
-        cJSON *root = cJSON_CreateArray();
-		Value tab("");
-		bool limited = false;
-		if (params.size() > 2) {
-			tab = params[2];
-			limited = true;
+/*
+	LIST JSON [tab] [OFFSET n] [LIMIT n] [FIELDS name,name,...] [SINCE sequence]
+
+	Without OFFSET, LIMIT or SINCE the result is an array of machines. When any of
+	those are given the array is returned as the "machines" member of an object that
+	also reports the current change sequence and the total number of matching
+	machines so that clients can page through the list or poll for changes.
+*/
+bool IODCommandListJSON::run(std::vector<Value> &params) {
+	Value tab("");
+	bool limited = false;
+	bool paged = false;
+	long offset = 0;
+	long limit = -1;
+	long since = 0;
+	std::set<std::string> field_set;
+	std::set<std::string> *fields = 0;
+	for (size_t i = 2; i < params.size(); ++i) {
+		std::string opt = params[i].asString();
+		bool has_arg = i+1 < params.size();
+		if (has_arg && strcasecmp(opt.c_str(), "OFFSET") == 0) {
+			if (!params[++i].asInteger(offset) || offset < 0) { error_str = "LIST JSON: invalid OFFSET"; return false; }
+			paged = true;
+		}
+		else if (has_arg && strcasecmp(opt.c_str(), "LIMIT") == 0) {
+			if (!params[++i].asInteger(limit) || limit < 0) { error_str = "LIST JSON: invalid LIMIT"; return false; }
+			paged = true;
 		}
-        std::map<std::string, MachineInstance*>::const_iterator iter = machines.begin();
-        while (iter != machines.end()) {
-            MachineInstance *m = (*iter++).second;
-			if (!limited || (limited && m->properties.lookup("tab") == tab) ) {
-   		        cJSON_AddItemToArray(root, printMachineInstanceToJSON(m));
-                for (unsigned int idx = 0; idx < m->locals.size(); ++idx) {
-                    const Parameter &p = m->locals[idx];
-    	       		cJSON_AddItemToArray(root, printMachineInstanceToJSON(p.machine, m->getName()));
-	        	}
+		else if (has_arg && strcasecmp(opt.c_str(), "SINCE") == 0) {
+			if (!params[++i].asInteger(since) || since < 0) { error_str = "LIST JSON: invalid SINCE"; return false; }
+			paged = true;
+		}
+		else if (has_arg && strcasecmp(opt.c_str(), "FIELDS") == 0) {
+			std::string names = params[++i].asString();
+			size_t pos = 0;
+			while (pos <= names.length()) {
+				size_t end = names.find(',', pos);
+				if (end == std::string::npos) end = names.length();
+				if (end > pos) field_set.insert(names.substr(pos, end-pos));
+				pos = end + 1;
 			}
-        }
-        char *res = cJSON_Print(root);
-        cJSON_Delete(root);
-        bool done;
-		char *p = res; while (*p) { *p &= 0x7f; ++p; }
-        if (res) {
-            result_str = res;
-            free(res);
-            done = true;
-        }
-        else {
-            error_str = "JSON error";
-            done = false;
-        }
-        return done;
-    }
+			fields = &field_set;
+		}
+		else if (!limited) {
+			tab = params[i];
+			limited = true;
+		}
+		else {
+			error_str = "Usage: LIST JSON [tab] [OFFSET n] [LIMIT n] [FIELDS a,b,..] [SINCE sequence]";
+			return false;
+		}
+	}
+
+	result_str.clear();
+	JSONWriter out(result_str);
+	out.setSevenBit(true);
+	uint64_t sequence = MachineInstance::changeSequence();
+	if (paged) {
+		out.beginObject();
+		out.field("sequence", (long)sequence);
+		out.field("offset", offset);
+		out.key("machines");
+	}
+	out.beginArray();
+	long total = 0;
+	std::map<std::string, MachineInstance*>::const_iterator iter = machines.begin();
+	while (iter != machines.end()) {
+		MachineInstance *m = (*iter++).second;
+		if (limited && m->properties.lookup("tab") != tab) continue;
+		if (since && !changedSince(m, since)) continue;
+		long position = total++;
+		if (position < offset || (limit >= 0 && position >= offset + limit)) continue;
+		if (!since || m->lastChange() > (uint64_t)since)
+			writeMachineInstanceJSON(out, m, "", fields);
+		for (unsigned int idx = 0; idx < m->locals.size(); ++idx) {
+			const Parameter &p = m->locals[idx];
+			if (!p.machine || (since && p.machine->lastChange() <= (uint64_t)since)) continue;
+			writeMachineInstanceJSON(out, p.machine, m->getName(), fields);
+		}
+	}
+	out.endArray();
+	if (paged) {
+		out.field("total", total);
+		out.endObject();
+	}
+	return true;
+}
 
 
 /*
@@ -884,6 +924,7 @@ cJSON *printMachineInstanceToJSON(MachineInstance *m, std::string prefix = "") {
         std::stringstream ss;
         ss
 		 << "Commands: \n"
+		 << "BATCH command [; command ...]\n"
 		 << "DEBUG machine on|off\n"
 		 << "DEBUG debug_group on|off\n"
          << "DESCRIBE machine_name [JSON]\n"
@@ -891,7 +932,7 @@ cJSON *printMachineInstanceToJSON(MachineInstance *m, std::string prefix = "") {
 		 << "EC command\n"
 		 << "ENABLE machine_name\n"
 		 << "GET machine_name\n"
-		 << "LIST JSON\n"
+		 << "LIST JSON [tab] [OFFSET n] [LIMIT n] [FIELDS a,b,..] [SINCE sequence]\n"
 		 << "LIST\n"
 		 << "MASTER\n"
 		 << "MODBUS EXPORT\n"
@@ -1094,7 +1135,76 @@ cJSON *printMachineInstanceToJSON(MachineInstance *m, std::string prefix = "") {
 		return true;
 	}
 
+    bool IODCommandProfile::run(std::vector<Value> &params) {
+		// PROFILE ON|OFF|RESET, PROFILE TOP [n], PROFILE FOLDED [filename]
+		if (params.size() >= 2 && params.size() <= 3) {
+			std::string op(params[1].asString());
+			if (params.size() == 2 && op == "ON") {
+				Profiler::enable(true);
+				result_str = "OK";
+				return true;
+			}
+			if (params.size() == 2 && op == "OFF") {
+				Profiler::enable(false);
+				result_str = "OK";
+				return true;
+			}
+			if (params.size() == 2 && op == "RESET") {
+				Profiler::reset();
+				result_str = "OK";
+				return true;
+			}
+			if (op == "TOP") {
+				long n = 20;
+				if (params.size() == 3 && (!params[2].asInteger(n) || n <= 0)) {
+					error_str = "usage: PROFILE TOP [count]";
+					return false;
+				}
+				cJSON *result = cJSON_CreateArray();
+				Profiler::reportTop(result, (unsigned int)n);
+				char *r_str = cJSON_Print(result);
+				result_str = r_str;
+				free(r_str);
+				cJSON_Delete(result);
+				return true;
+			}
+			if (op == "FOLDED") {
+				if (params.size() == 3) {
+					std::string filename(params[2].asString());
+					if (!Profiler::writeFolded(filename.c_str())) {
+						std::stringstream ss;
+						ss << "failed to write profile to " << filename << ": " << strerror(errno);
+						error_str = ss.str();
+						return false;
+					}
+					result_str = "OK";
+					return true;
+				}
+				std::stringstream ss;
+				Profiler::writeFolded(ss);
+				result_str = ss.str();
+				return true;
+			}
+		}
+		error_str = "usage: PROFILE ON|OFF|RESET|TOP [count]|FOLDED [filename]";
+		return false;
+	}
+
     bool IODCommandPersistentState::run(std::vector<Value> &params) {
+		Channel *chn = Channel::findByType("PERSISTENCE_CHANNEL");
+		PersistenceClient *persistence = (chn) ? chn->persistenceClient() : 0;
+		if (params.size() == 3 && params[1] == "ACK") {
+			long seq;
+			if (!params[2].asInteger(seq) || seq <= 0) {
+				error_str = "usage: PERSISTENT ACK sequence";
+				return false;
+			}
+			if (persistence) persistence->acknowledge(seq);
+			result_str = "OK";
+			return true;
+		}
+		// the state collected here includes every batch sent so far
+		if (persistence) persistence->resynchronised();
         cJSON *result = cJSON_CreateArray();
         std::list<MachineInstance *>::iterator m_iter;
         m_iter = MachineInstance::begin();
@@ -1151,6 +1261,16 @@ cJSON *printMachineInstanceToJSON(MachineInstance *m, std::string prefix = "") {
 	}
 
     bool IODCommandPerformance::run(std::vector<Value> &params) {
+		if (params.size() == 2 && params[1] == "HISTOGRAMS") {
+			// the populated buckets of each histogram, as [upper bound, count] pairs
+			cJSON *buckets = cJSON_CreateObject();
+			LatencyHistogram::reportAllBuckets(buckets);
+			char *r_str = cJSON_Print(buckets);
+			result_str = r_str;
+			free(r_str);
+			cJSON_Delete(buckets);
+			return true;
+		}
         std::list<MachineInstance*>::iterator m_iter = MachineInstance::begin();
         cJSON *result = cJSON_CreateArray();
         while (m_iter != MachineInstance::end()) {
@@ -1170,6 +1290,18 @@ cJSON *printMachineInstanceToJSON(MachineInstance *m, std::string prefix = "") {
                 cJSON_AddItemToArray(result, stat);
             }
         }
+		{
+			// property writes that were journaled and those absorbed by a later write in the same cycle
+			cJSON *stat = cJSON_CreateArray();
+			cJSON_AddItemToArray(stat, cJSON_CreateString("SYSTEM"));
+			cJSON_AddItemToArray(stat, cJSON_CreateString("Property changes"));
+			cJSON_AddItemToArray(stat, cJSON_CreateNumber(MachineInstance::journaledWrites()));
+			cJSON_AddItemToArray(stat, cJSON_CreateNumber(MachineInstance::absorbedWrites()));
+			cJSON_AddItemToArray(stat, cJSON_CreateNumber(MachineInstance::pendingChanges()));
+			cJSON_AddItemToArray(result, stat);
+		}
+		ObjectPool::reportAll(result);
+		LatencyHistogram::reportAll(result);
 		{
             cJSON *stats = cJSON_CreateArray();
 			Statistic::reportAll(stats);
@@ -1334,6 +1466,7 @@ bool IODCommandChannelRefresh::run(std::vector<Value> &params) {
 							assert(chn);
 							if (ch_name == "PERSISTENCE_CHANNEL") {
 								chn->setValue("PersistentStore", persistent_store(), Value::t_string);
+								chn->startPersistenceBatches();
 							}
 							chn->start();
 							chn->enable();
@@ -1430,6 +1563,76 @@ bool IODCommandShutdown::run(std::vector<Value> &params) {
 	return true;
 }
 
+/* BATCH runs several commands and returns all of the results in a single reply.
+	Each parameter that contains whitespace or is a JSON object is treated as a
+	complete command, other parameters are collected into a command up to the
+	next ';'. The result is a JSON array with one {status, result} object
+	per command.
+*/
+static void runBatchItem(cJSON *results, IODCommand *command) {
+	cJSON *item = cJSON_CreateObject();
+	if (!command) {
+		cJSON_AddStringToObject(item, "status", "ERROR");
+		cJSON_AddStringToObject(item, "result", "Unrecognised command");
+	}
+	else if (command->name() == "BATCH") {
+		cJSON_AddStringToObject(item, "status", "ERROR");
+		cJSON_AddStringToObject(item, "result", "BATCH commands cannot be nested");
+	}
+	else {
+		bool ok = false;
+		try {
+			ok = (*command)() == IODCommand::Success;
+		}
+		catch (std::exception e) {
+			FileLogger fl(program_name);
+			fl.f() << "batched command threw an exception " << e.what() << "\n";
+		}
+		cJSON_AddStringToObject(item, "status", (ok) ? "OK" : "ERROR");
+		cJSON_AddStringToObject(item, "result", (ok) ? command->result() : command->error());
+	}
+	releaseCommand(command);
+	cJSON_AddItemToArray(results, item);
+}
+
+bool IODCommandBatch::run(std::vector<Value> &params) {
+	if (params.size() < 2) {
+		error_str = "Usage: BATCH command [; command ...]";
+		return false;
+	}
+	cJSON *results = cJSON_CreateArray();
+	std::vector<Value> current;
+	for (size_t i = 1; i < params.size(); ++i) {
+		const Value &p = params[i];
+		if (p.kind == Value::t_string || p.kind == Value::t_symbol) {
+			const std::string &text = p.sValue;
+			if (text == ";") {
+				if (!current.empty()) { runBatchItem(results, acquireCommand(current)); current.clear(); }
+				continue;
+			}
+			if (text.find_first_of(" \t\n{") != std::string::npos) {
+				if (!current.empty()) { runBatchItem(results, acquireCommand(current)); current.clear(); }
+				runBatchItem(results, acquireCommand(text.c_str()));
+				continue;
+			}
+			if (text.length() > 1 && text[text.length()-1] == ';') {
+				current.push_back(Value(text.substr(0, text.length()-1), p.kind));
+				runBatchItem(results, acquireCommand(current));
+				current.clear();
+				continue;
+			}
+		}
+		current.push_back(p);
+	}
+	if (!current.empty()) runBatchItem(results, acquireCommand(current));
+
+	char *r_str = cJSON_PrintUnformatted(results);
+	result_str = r_str;
+	free(r_str);
+	cJSON_Delete(results);
+	return true;
+}
+
 bool IODCommandSDO::run(std::vector<Value> &params) {
 #ifndef EC_SIMULATOR
 #ifdef USE_SDO
@@ -74,6 +74,7 @@ struct IODCommandToggle : public IODCommand {
 };
 
 struct IODCommandProperty : public IODCommand {
+    IODCommandProperty() {}
     IODCommandProperty(const char *raw_message) : raw_message_(raw_message) {}
 	bool run(std::vector<Value> &params);
     std::string raw_message_;
@@ -132,6 +133,10 @@ struct IODCommandPerformance : public IODCommand {
 	bool run(std::vector<Value> &params);
 };
 
+struct IODCommandProfile : public IODCommand {
+	bool run(std::vector<Value> &params);
+};
+
 struct IODCommandPersistentState : public IODCommand {
     bool run(std::vector<Value> &params);
 };
@@ -197,5 +202,9 @@ struct IODCommandToggleEtherCAT : public IODCommand {
 	bool run(std::vector<Value> &params);
 };
 
+struct IODCommandBatch : public IODCommand {
+	bool run(std::vector<Value> &params);
+};
+
 
 #endif
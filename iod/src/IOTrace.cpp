@@ -0,0 +1,293 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <errno.h>
+#include <string.h>
+#include <iostream>
+#include "IOTrace.h"
+#include "IOComponent.h"
+#include "MachineInstance.h"
+#include "MQTTInterface.h"
+#include "ClientInterface.h"
+#include "IODCommand.h"
+#include "MessageLog.h"
+#include "ProcessImageStream.h"
+#include "value.h"
+
+extern bool machine_is_ready;
+
+static const char trace_magic[8] = { 'C', 'W', 'I', 'O', 'T', 'R', 'C', '1' };
+
+static void putVarint(std::vector<uint8_t> &out, uint64_t val) {
+	do {
+		uint8_t b = val & 0x7f;
+		val >>= 7;
+		out.push_back(val ? (b | 0x80) : b);
+	} while (val);
+}
+
+static void putString(std::vector<uint8_t> &out, const char *s, size_t len) {
+	putVarint(out, len);
+	out.insert(out.end(), s, s + len);
+}
+
+static bool readVarint(FILE *f, uint64_t &val) {
+	val = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		int c = getc(f);
+		if (c == EOF) return false;
+		val |= (uint64_t)(c & 0x7f) << shift;
+		if (!(c & 0x80)) return true;
+	}
+	return false;
+}
+
+static bool getVarint(const uint8_t *&p, const uint8_t *end, uint64_t &val) {
+	val = 0;
+	for (int shift = 0; shift < 64 && p < end; shift += 7) {
+		uint8_t b = *p++;
+		val |= (uint64_t)(b & 0x7f) << shift;
+		if (!(b & 0x80)) return true;
+	}
+	return false;
+}
+
+static bool getString(const uint8_t *&p, const uint8_t *end, std::string &s) {
+	uint64_t len;
+	if (!getVarint(p, end, len) || len > (uint64_t)(end - p)) return false;
+	s.assign((const char *)p, len);
+	p += len;
+	return true;
+}
+
+IOTraceRecorder *IOTraceRecorder::instance_ = 0;
+
+IOTraceRecorder::IOTraceRecorder(FILE *f)
+	: file(f), last_time(microsecs()), last_flush(last_time), num_records(0), cycle_active(false) {
+	fwrite(trace_magic, 1, sizeof(trace_magic), file);
+	fwrite(&last_time, sizeof(last_time), 1, file);
+}
+
+IOTraceRecorder::~IOTraceRecorder() {
+	fclose(file);
+}
+
+IOTraceRecorder *IOTraceRecorder::start(const char *file_name) {
+	if (instance_) return instance_;
+	FILE *f = fopen(file_name, "wb");
+	if (!f) {
+		MessageLog::instance()->add("Could not open I/O trace file ", file_name, ": ", strerror(errno));
+		return 0;
+	}
+	setvbuf(f, 0, _IOFBF, 1 << 16);
+	instance_ = new IOTraceRecorder(f);
+	return instance_;
+}
+
+void IOTraceRecorder::stop() {
+	delete instance_;
+	instance_ = 0;
+}
+
+void IOTraceRecorder::write(IOTrace::RecordType type) {
+	uint64_t now = microsecs();
+	std::vector<uint8_t> head;
+	head.push_back((uint8_t)type);
+	putVarint(head, now - last_time);
+	putVarint(head, body.size());
+	fwrite(&head[0], 1, head.size(), file);
+	if (!body.empty()) fwrite(&body[0], 1, body.size(), file);
+	last_time = now;
+	++num_records;
+	if (type != IOTrace::CycleEnd) cycle_active = true;
+}
+
+void IOTraceRecorder::processData(uint64_t clock, size_t size, const uint8_t *mask, const uint8_t *data) {
+	body.clear();
+	putVarint(body, clock);
+	putVarint(body, size);
+	masked.resize(size);
+	for (size_t i = 0; i < size; ++i) masked[i] = data[i] & mask[i];
+	std::vector<uint8_t> encoded_mask;
+	ProcessImageFrame::compress(mask, size, encoded_mask);
+	putVarint(body, encoded_mask.size());
+	body.insert(body.end(), encoded_mask.begin(), encoded_mask.end());
+	ProcessImageFrame::compress(size ? &masked[0] : 0, size, body);
+	write(IOTrace::ProcessData);
+}
+
+void IOTraceRecorder::command(const char *source, const char *text, size_t len) {
+	body.clear();
+	putString(body, source, strlen(source));
+	body.insert(body.end(), text, text + len);
+	write(IOTrace::Command);
+}
+
+void IOTraceRecorder::mqtt(const std::string &module, const std::string &topic, const std::string &payload) {
+	body.clear();
+	putString(body, module.c_str(), module.length());
+	putString(body, topic.c_str(), topic.length());
+	putString(body, payload.c_str(), payload.length());
+	write(IOTrace::MQTT);
+}
+
+void IOTraceRecorder::endCycle() {
+	if (cycle_active) {
+		body.clear();
+		write(IOTrace::CycleEnd);
+		cycle_active = false;
+	}
+	if (last_time - last_flush >= 1000000) {
+		fflush(file);
+		last_flush = last_time;
+	}
+}
+
+IOTraceReader::IOTraceReader() : file(0), start_time(0), time(0), damaged_(false) {
+}
+
+IOTraceReader::~IOTraceReader() {
+	if (file) fclose(file);
+}
+
+bool IOTraceReader::open(const char *file_name) {
+	file = fopen(file_name, "rb");
+	if (!file) return false;
+	char magic[sizeof(trace_magic)];
+	if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) || memcmp(magic, trace_magic, sizeof(magic)) != 0
+			|| fread(&start_time, sizeof(start_time), 1, file) != 1) {
+		fclose(file);
+		file = 0;
+		return false;
+	}
+	return true;
+}
+
+bool IOTraceReader::next(IOTraceRecord &record) {
+	if (!file || damaged_) return false;
+	int type = getc(file);
+	if (type == EOF) return false;
+	uint64_t delta, len;
+	if (!readVarint(file, delta) || !readVarint(file, len) || len > (1 << 26)) {
+		damaged_ = true;
+		return false;
+	}
+	body.resize(len);
+	if (len && fread(&body[0], 1, len, file) != len) {
+		damaged_ = true;
+		return false;
+	}
+	time += delta;
+	record.type = (IOTrace::RecordType)type;
+	record.time = time;
+	const uint8_t *p = body.empty() ? 0 : &body[0];
+	const uint8_t *end = p + len;
+	bool ok = true;
+	switch (type) {
+		case IOTrace::ProcessData: {
+			uint64_t size, mask_len;
+			ok = getVarint(p, end, record.clock) && getVarint(p, end, size) && getVarint(p, end, mask_len)
+				&& mask_len <= (uint64_t)(end - p) && size < (1 << 24);
+			if (!ok) break;
+			record.mask.resize(size);
+			record.data.resize(size);
+			ok = ProcessImageFrame::expand(p, mask_len, size ? &record.mask[0] : 0, size, false)
+				&& ProcessImageFrame::expand(p + mask_len, end - p - mask_len, size ? &record.data[0] : 0, size, false);
+			break;
+		}
+		case IOTrace::Command:
+			ok = getString(p, end, record.source);
+			if (ok) record.text.assign((const char *)p, end - p);
+			break;
+		case IOTrace::MQTT:
+			ok = getString(p, end, record.source) && getString(p, end, record.text) && getString(p, end, record.payload);
+			break;
+		case IOTrace::CycleEnd:
+			break;
+		default:
+			ok = false;
+	}
+	if (!ok) damaged_ = true;
+	return ok;
+}
+
+IOTraceReplay::IOTraceReplay(bool fast_replay)
+	: applied(0), skipped(0), have_pending(false), fast(fast_replay), finished_(false), start(0) {
+}
+
+void IOTraceReplay::apply(uint64_t now) {
+	if (finished_) return;
+	if (!start) start = now;
+	while (true) {
+		if (!have_pending) {
+			if (!reader.next(pending)) {
+				if (reader.damaged())
+					MessageLog::instance()->add("I/O trace replay stopped at a damaged record");
+				finished_ = true;
+				return;
+			}
+			have_pending = true;
+		}
+		if (!fast && pending.time > now - start) return;
+		have_pending = false;
+		if (pending.type == IOTrace::CycleEnd) {
+			if (fast) return;
+			continue;
+		}
+		apply(pending);
+	}
+}
+
+void IOTraceReplay::apply(const IOTraceRecord &record) {
+	switch (record.type) {
+		case IOTrace::ProcessData:
+			if (!machine_is_ready || record.data.empty() || record.data.size() != IOComponent::processDataSize()
+					|| IOComponent::getHardwareState() == IOComponent::s_hardware_preinit) {
+				++skipped;
+				return;
+			}
+			IOComponent::lock();
+			IOComponent::processAll(record.clock, record.data.size(), (uint8_t *)&record.mask[0],
+					(uint8_t *)&record.data[0], updated);
+			IOComponent::unlock();
+			{
+				std::set<IOComponent *>::iterator iter = updated.begin();
+				while (iter != updated.end()) (*iter++)->handleChange(MachineInstance::pendingEvents());
+				updated.clear();
+			}
+			break;
+		case IOTrace::Command: {
+			IODCommand *command = acquireCommand(record.text.c_str());
+			if (!command) { ++skipped; return; }
+			(*command)();
+			releaseCommand(command);
+			break;
+		}
+		case IOTrace::MQTT: {
+			MQTTModule *module = MQTTInterface::findModule(record.source);
+			if (!module) { ++skipped; return; }
+			module->dispatch(record.text, record.payload);
+			break;
+		}
+		default:
+			return;
+	}
+	++applied;
+}
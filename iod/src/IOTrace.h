@@ -0,0 +1,143 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __IOTRACE_H__
+#define __IOTRACE_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <list>
+#include <set>
+#include <string>
+#include <vector>
+
+/*
+	A compact binary log of the inputs the processing thread receives, for
+	replaying plant traffic against another build (see cw-bench --replay).
+
+	The file starts with the eight bytes "CWIOTRC1" and the time recording
+	started, as eight bytes of microsecs(). Each record is then
+		type              one byte
+		time              LEB128 microseconds since the previous record
+		length            LEB128 length of the body
+		body
+	where the body of each type is
+		ProcessData       LEB128 clock, LEB128 image size, LEB128 length of
+		                  the mask then the mask and the masked data, both
+		                  run-length encoded as in ProcessImageFrame
+		Command           LEB128 length of the source then the source and the
+		                  command text
+		MQTT              module, topic and payload, each LEB128 length prefixed
+		CycleEnd          empty, written at the end of a processing cycle that
+		                  recorded something
+	Modbus writes arrive as commands from modbusd and are recorded as commands.
+*/
+struct IOTrace {
+	enum RecordType { ProcessData = 1, Command = 2, MQTT = 3, CycleEnd = 4 };
+};
+
+/* records on the processing thread; all methods must be called from that thread */
+class IOTraceRecorder {
+public:
+	static IOTraceRecorder *instance() { return instance_; } // zero unless recording
+	static IOTraceRecorder *start(const char *file_name);
+	static void stop();
+
+	void processData(uint64_t clock, size_t size, const uint8_t *mask, const uint8_t *data);
+	void command(const char *source, const char *text, size_t len);
+	void mqtt(const std::string &module, const std::string &topic, const std::string &payload);
+	void endCycle();
+
+	uint64_t records() const { return num_records; }
+
+private:
+	IOTraceRecorder(FILE *f);
+	~IOTraceRecorder();
+	void write(IOTrace::RecordType type);
+
+	static IOTraceRecorder *instance_;
+	FILE *file;
+	std::vector<uint8_t> body;
+	std::vector<uint8_t> masked;
+	uint64_t last_time;
+	uint64_t last_flush;
+	uint64_t num_records;
+	bool cycle_active;
+};
+
+struct IOTraceRecord {
+	IOTrace::RecordType type;
+	uint64_t time; // microseconds since recording started
+	uint64_t clock;
+	std::vector<uint8_t> mask;
+	std::vector<uint8_t> data;
+	std::string source; // the command source or MQTT module
+	std::string text; // the command text or MQTT topic
+	std::string payload;
+};
+
+class IOTraceReader {
+public:
+	IOTraceReader();
+	~IOTraceReader();
+	bool open(const char *file_name);
+	bool next(IOTraceRecord &record); // false at the end of the trace or if it is damaged
+	bool damaged() const { return damaged_; }
+	uint64_t startTime() const { return start_time; }
+
+private:
+	FILE *file;
+	std::vector<uint8_t> body;
+	uint64_t start_time;
+	uint64_t time;
+	bool damaged_;
+};
+
+class IOComponent;
+
+/*
+	Feeds a trace back to the processing thread. Call apply() from the
+	processing thread, for example from a ProcessingCycleMonitor; it applies
+	either the records that are due at the current time, measured from the
+	first call, or when fast is set, the records of the next recorded cycle.
+*/
+class IOTraceReplay {
+public:
+	IOTraceReplay(bool fast);
+	bool open(const char *file_name) { return reader.open(file_name); }
+	void apply(uint64_t now);
+	bool finished() const { return finished_; }
+
+	uint64_t applied;
+	uint64_t skipped; // process data that did not match the loaded program's process image
+
+private:
+	void apply(const IOTraceRecord &record);
+
+	IOTraceReader reader;
+	IOTraceRecord pending;
+	bool have_pending;
+	bool fast;
+	bool finished_;
+	uint64_t start;
+	std::set<IOComponent*> updated;
+};
+
+#endif
@@ -0,0 +1,146 @@
+/*
+ Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+ 
+ This file is part of Latproc
+ 
+ Latproc is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License
+ as published by the Free Software Foundation; either version 2
+ of the License, or (at your option) any later version.
+ 
+ Latproc is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with Latproc; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "JSONWriter.h"
+#include "dynamic_value.h"
+
+JSONWriter::JSONWriter(std::string &output) : out(output), after_key(false), seven_bit(false) {}
+
+void JSONWriter::separate() {
+	if (after_key) { after_key = false; return; }
+	if (first.empty()) return;
+	if (first.back())
+		first.back() = false;
+	else
+		out += ',';
+}
+
+JSONWriter &JSONWriter::beginArray() {
+	separate();
+	out += '[';
+	first.push_back(true);
+	return *this;
+}
+
+JSONWriter &JSONWriter::endArray() {
+	out += ']';
+	if (!first.empty()) first.pop_back();
+	return *this;
+}
+
+JSONWriter &JSONWriter::beginObject() {
+	separate();
+	out += '{';
+	first.push_back(true);
+	return *this;
+}
+
+JSONWriter &JSONWriter::endObject() {
+	out += '}';
+	if (!first.empty()) first.pop_back();
+	return *this;
+}
+
+JSONWriter &JSONWriter::key(const char *name) {
+	string(name);
+	out += ':';
+	after_key = true;
+	return *this;
+}
+
+JSONWriter &JSONWriter::string(const char *str) {
+	separate();
+	out += '"';
+	if (str) {
+		const char *p = str;
+		while (*p) {
+			unsigned char ch = (unsigned char)*p++;
+			if (seven_bit) ch &= 0x7f;
+			if (ch > 31 && ch != '"' && ch != '\\') { out += (char)ch; continue; }
+			switch (ch) {
+				case '\\': out += "\\\\"; break;
+				case '"': out += "\\\""; break;
+				case '\b': out += "\\b"; break;
+				case '\f': out += "\\f"; break;
+				case '\n': out += "\\n"; break;
+				case '\r': out += "\\r"; break;
+				case '\t': out += "\\t"; break;
+				default: break; // other control characters are dropped, as cJSON does
+			}
+		}
+	}
+	out += '"';
+	return *this;
+}
+
+JSONWriter &JSONWriter::number(long val) {
+	separate();
+	char buf[24];
+	snprintf(buf, 24, "%ld", val);
+	out += buf;
+	return *this;
+}
+
+JSONWriter &JSONWriter::number(double d) {
+	separate();
+	char buf[64];
+	if (d != 0.0 && (fabs(d)<1.0e-6 || fabs(d)>1.0e9))
+		snprintf(buf, 64, "%1.20e", d);
+	else
+		snprintf(buf, 64, "%lf", d);
+	out += buf;
+	return *this;
+}
+
+JSONWriter &JSONWriter::boolean(bool val) {
+	separate();
+	out += (val) ? "true" : "false";
+	return *this;
+}
+
+JSONWriter &JSONWriter::null() {
+	separate();
+	out += "null";
+	return *this;
+}
+
+JSONWriter &JSONWriter::value(const Value &val) {
+	switch (val.kind) {
+		case Value::t_symbol:
+		case Value::t_string:
+			return string(val.sValue);
+		case Value::t_integer:
+			return number(val.iValue);
+		case Value::t_float:
+			return number(val.fValue);
+		case Value::t_bool:
+			return boolean(val.bValue);
+		case Value::t_dynamic: {
+			DynamicValue *dv = val.dynamicValue();
+			if (dv && dv->lastResult()) return value(*dv->lastResult());
+			return null();
+		}
+		default:
+			break;
+	}
+	return null();
+}
@@ -0,0 +1,71 @@
+/*
+ Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+ 
+ This file is part of Latproc
+ 
+ Latproc is free software; you can redistribute it and/or
+ modify it under the terms of the GNU General Public License
+ as published by the Free Software Foundation; either version 2
+ of the License, or (at your option) any later version.
+ 
+ Latproc is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+ 
+ You should have received a copy of the GNU General Public License
+ along with Latproc; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef __clockwork__JSONWriter__
+#define __clockwork__JSONWriter__
+
+#include <string>
+#include <vector>
+#include "value.h"
+
+/* JSONWriter serialises directly into a caller supplied string, avoiding
+	the construction of a cJSON tree for large replies. Separators are
+	managed by the writer so callers only need to nest begin/end calls.
+	Numbers are formatted in the same way as cJSON_Print.
+*/
+class JSONWriter {
+public:
+	JSONWriter(std::string &output);
+
+	JSONWriter &beginArray();
+	JSONWriter &endArray();
+	JSONWriter &beginObject();
+	JSONWriter &endObject();
+	JSONWriter &key(const char *name);
+	JSONWriter &key(const std::string &name) { return key(name.c_str()); }
+
+	JSONWriter &string(const char *str);
+	JSONWriter &string(const std::string &str) { return string(str.c_str()); }
+	JSONWriter &number(long val);
+	JSONWriter &number(double val);
+	JSONWriter &boolean(bool val);
+	JSONWriter &null();
+	JSONWriter &value(const Value &val);
+
+	// convenience methods to add an object member
+	JSONWriter &field(const char *name, const char *str) { return key(name).string(str); }
+	JSONWriter &field(const char *name, const std::string &str) { return key(name).string(str); }
+	JSONWriter &field(const char *name, long val) { return key(name).number(val); }
+	JSONWriter &field(const char *name, const Value &val) { return key(name).value(val); }
+
+	// mask the high bit of characters in strings (compatible with LIST JSON)
+	void setSevenBit(bool which) { seven_bit = which; }
+
+private:
+	void separate();
+	std::string &out;
+	std::vector<bool> first; // one entry per nesting level; true until the first item is written
+	bool after_key;
+	bool seven_bit;
+	JSONWriter(const JSONWriter &);
+	JSONWriter &operator=(const JSONWriter &);
+};
+
+#endif
@@ -0,0 +1,173 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include <fstream>
+#include <sstream>
+#include "LatencyHistogram.h"
+
+LatencyHistogram *LatencyHistogram::all_histograms = 0;
+boost::mutex LatencyHistogram::list_mutex;
+
+LatencyHistogram::LatencyHistogram(const char *metric_name, const char *description)
+		: name(metric_name), help(description), total(0), sum(0), max_value(0), next_histogram(0) {
+	for (int i = 0; i < NumBuckets; ++i) counts[i] = 0;
+	boost::mutex::scoped_lock lock(list_mutex);
+	next_histogram = all_histograms;
+	all_histograms = this;
+}
+
+int LatencyHistogram::bucketIndex(uint64_t value) {
+	if (value < SubCount) return (int)value;
+	if (value >> MaxBits) value = ((uint64_t)1 << MaxBits) - 1;
+	int msb = 63 - __builtin_clzll(value);
+	int exponent = msb - SubBits;
+	return SubCount + exponent * SubCount + (int)((value >> exponent) - SubCount);
+}
+
+uint64_t LatencyHistogram::bucketUpper(int index) {
+	if (index < SubCount) return index;
+	int exponent = (index - SubCount) / SubCount;
+	uint64_t sub = (index - SubCount) % SubCount;
+	return ((SubCount + sub + 1) << exponent) - 1;
+}
+
+void LatencyHistogram::record(uint64_t value) {
+	counts[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+	total.fetch_add(1, std::memory_order_relaxed);
+	sum.fetch_add(value, std::memory_order_relaxed);
+	uint64_t prev = max_value.load(std::memory_order_relaxed);
+	while (value > prev && !max_value.compare_exchange_weak(prev, value, std::memory_order_relaxed)) ;
+}
+
+void LatencyHistogram::reset() {
+	for (int i = 0; i < NumBuckets; ++i) counts[i].store(0, std::memory_order_relaxed);
+	total = 0;
+	sum = 0;
+	max_value = 0;
+}
+
+double LatencyHistogram::mean() const {
+	uint64_t n = count();
+	return (n) ? (double)sum.load(std::memory_order_relaxed) / n : 0.0;
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+	uint64_t n = count();
+	if (n == 0) return 0;
+	uint64_t target = (uint64_t)ceil(p / 100.0 * n);
+	if (target < 1) target = 1;
+	uint64_t seen = 0;
+	for (int i = 0; i < NumBuckets; ++i) {
+		seen += counts[i].load(std::memory_order_relaxed);
+		if (seen >= target) {
+			uint64_t upper = bucketUpper(i);
+			uint64_t max = maximum();
+			return (upper < max) ? upper : max;
+		}
+	}
+	return maximum(); // samples were recorded while we were scanning
+}
+
+void LatencyHistogram::reportArray(cJSON *result) const {
+	cJSON *stat = cJSON_CreateArray();
+	cJSON_AddItemToArray(stat, cJSON_CreateString("HISTOGRAM"));
+	cJSON_AddItemToArray(stat, cJSON_CreateString(name.c_str()));
+	cJSON_AddItemToArray(stat, cJSON_CreateNumber(count()));
+	cJSON_AddItemToArray(stat, cJSON_CreateNumber(percentile(50.0)));
+	cJSON_AddItemToArray(stat, cJSON_CreateNumber(percentile(90.0)));
+	cJSON_AddItemToArray(stat, cJSON_CreateNumber(percentile(99.0)));
+	cJSON_AddItemToArray(stat, cJSON_CreateNumber(percentile(99.9)));
+	cJSON_AddItemToArray(stat, cJSON_CreateNumber(maximum()));
+	cJSON_AddItemToArray(stat, cJSON_CreateDouble(mean()));
+	cJSON_AddItemToArray(result, stat);
+}
+
+void LatencyHistogram::reportBuckets(cJSON *result) const {
+	cJSON *buckets = cJSON_CreateArray();
+	for (int i = 0; i < NumBuckets; ++i) {
+		uint64_t n = counts[i].load(std::memory_order_relaxed);
+		if (!n) continue;
+		cJSON *bucket = cJSON_CreateArray();
+		cJSON_AddItemToArray(bucket, cJSON_CreateNumber(bucketUpper(i)));
+		cJSON_AddItemToArray(bucket, cJSON_CreateNumber(n));
+		cJSON_AddItemToArray(buckets, bucket);
+	}
+	cJSON_AddItemToObject(result, name.c_str(), buckets);
+}
+
+/* the exported buckets are the power of two boundaries of the histogram,
+	labelled with their inclusive upper bound */
+void LatencyHistogram::writePrometheus(std::ostream &out) const {
+	std::string metric("clockwork_" + name + "_microseconds");
+	out << "# HELP " << metric << " " << help << "\n"
+		<< "# TYPE " << metric << " histogram\n";
+	uint64_t n = count();
+	uint64_t cumulative = 0;
+	uint64_t max = maximum();
+	for (int i = 0; i < NumBuckets; ++i) {
+		cumulative += counts[i].load(std::memory_order_relaxed);
+		uint64_t upper = bucketUpper(i);
+		if ( (upper & (upper + 1)) != 0) continue; // not the end of a power of two
+		out << metric << "_bucket{le=\"" << upper << "\"} " << cumulative << "\n";
+		if (upper >= max) break;
+	}
+	out << metric << "_bucket{le=\"+Inf\"} " << n << "\n"
+		<< metric << "_sum " << sum.load(std::memory_order_relaxed) << "\n"
+		<< metric << "_count " << n << "\n";
+	out << "# TYPE " << metric << "_quantile gauge\n";
+	const double quantiles[] = { 50.0, 90.0, 99.0, 99.9 };
+	for (unsigned int i = 0; i < sizeof(quantiles) / sizeof(double); ++i)
+		out << metric << "_quantile{quantile=\"" << quantiles[i] / 100.0 << "\"} " << percentile(quantiles[i]) << "\n";
+}
+
+void LatencyHistogram::reportAll(cJSON *result) {
+	boost::mutex::scoped_lock lock(list_mutex);
+	for (LatencyHistogram *h = all_histograms; h; h = h->next_histogram)
+		h->reportArray(result);
+}
+
+void LatencyHistogram::reportAllBuckets(cJSON *result) {
+	boost::mutex::scoped_lock lock(list_mutex);
+	for (LatencyHistogram *h = all_histograms; h; h = h->next_histogram)
+		h->reportBuckets(result);
+}
+
+bool LatencyHistogram::writeAll(const char *file_name) {
+	std::string tmp_name(file_name);
+	tmp_name += ".tmp";
+	{
+		std::ofstream out(tmp_name.c_str());
+		if (!out) return false;
+		boost::mutex::scoped_lock lock(list_mutex);
+		for (LatencyHistogram *h = all_histograms; h; h = h->next_histogram)
+			h->writePrometheus(out);
+		if (!out) return false;
+	}
+	return rename(tmp_name.c_str(), file_name) == 0;
+}
+
+LatencyHistogram *LatencyHistogram::find(const char *metric_name) {
+	boost::mutex::scoped_lock lock(list_mutex);
+	for (LatencyHistogram *h = all_histograms; h; h = h->next_histogram)
+		if (h->name == metric_name) return h;
+	return 0;
+}
@@ -0,0 +1,89 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __LATENCYHISTOGRAM_H__
+#define __LATENCYHISTOGRAM_H__
+
+#include <stdint.h>
+#include <atomic>
+#include <ostream>
+#include <string>
+#include <boost/thread/mutex.hpp>
+#include "cJSON.h"
+
+/*
+	A log-linear histogram of durations in microseconds, in the style of
+	HdrHistogram. Values below 16 are counted exactly; above that each power
+	of two is split into 16 linear sub-buckets so that any reported
+	percentile is within 1/16 of the true value. record() only performs
+	relaxed atomic increments and may be called from any thread without
+	locking.
+
+	Histograms are intended to be created with new at startup and never
+	deleted; each one is added to a list that is reported by the STATS
+	command and written in Prometheus text format to the --metrics_file.
+*/
+class LatencyHistogram {
+public:
+	LatencyHistogram(const char *metric_name, const char *description);
+
+	void record(uint64_t value);
+	void reset();
+
+	const std::string &getName() const { return name; }
+	uint64_t count() const { return total.load(std::memory_order_relaxed); }
+	uint64_t maximum() const { return max_value.load(std::memory_order_relaxed); }
+	double mean() const;
+	uint64_t percentile(double p) const; // p percent of the samples are no larger than this
+
+	// [ "HISTOGRAM", name, count, p50, p90, p99, p99.9, max, mean ]
+	void reportArray(cJSON *result) const;
+	// { name: [ [upper bound, count], ... ] } for the buckets that have samples
+	void reportBuckets(cJSON *result) const;
+	void writePrometheus(std::ostream &out) const;
+
+	static void reportAll(cJSON *result);
+	static void reportAllBuckets(cJSON *result);
+	static bool writeAll(const char *file_name); // replaces the file atomically
+	static LatencyHistogram *find(const char *metric_name);
+
+private:
+	enum { SubBits = 4, SubCount = 1 << SubBits, MaxBits = 40,
+		NumBuckets = SubCount + (MaxBits - SubBits) * SubCount };
+
+	static int bucketIndex(uint64_t value);
+	static uint64_t bucketUpper(int index);
+
+	std::string name;
+	std::string help;
+	std::atomic<uint64_t> counts[NumBuckets];
+	std::atomic<uint64_t> total;
+	std::atomic<uint64_t> sum;
+	std::atomic<uint64_t> max_value;
+	LatencyHistogram *next_histogram;
+
+	static LatencyHistogram *all_histograms;
+	static boost::mutex list_mutex;
+
+	LatencyHistogram(const LatencyHistogram &);
+	LatencyHistogram &operator=(const LatencyHistogram &);
+};
+
+#endif
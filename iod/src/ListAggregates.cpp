@@ -0,0 +1,284 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <limits.h>
+#include "ListAggregates.h"
+#include "MachineInstance.h"
+
+bool ListAggregates::NumericLess::operator()(const Value &a, const Value &b) const {
+	if (a.kind == Value::t_integer && b.kind == Value::t_integer) return a.iValue < b.iValue;
+	double x = 0.0, y = 0.0;
+	a.asFloat(x);
+	b.asFloat(y);
+	return x < y;
+}
+
+// the value of a member's property if the member is notified when it changes, ie, if it is one of
+// the member's own properties. Anything else is treated as non numeric so that queries scan the list
+static const Value &notifiedValue(MachineInstance *m, const std::string &property) {
+	const char *name = property.c_str();
+	if (!m->properties.exists(name) || SymbolTable::isKeyword(name)) return SymbolTable::Null;
+	const Value &v = m->getValue(property);
+	if (&v != &m->properties.lookup(name)) return SymbolTable::Null; // TIMER, a global or a parameter
+	return v;
+}
+
+ListAggregates::ListAggregates(MachineInstance *list_machine)
+	: list(list_machine), entries(0), resolved(0), stale(true) {
+}
+
+ListAggregates::~ListAggregates() {
+	std::map<MachineInstance*, Member>::iterator iter = members.begin();
+	while (iter != members.end()) {
+		(*iter).first->ignoreAggregates(this);
+		++iter;
+	}
+}
+
+void ListAggregates::include(Totals &t, const Value &v, unsigned int n) {
+	if (v.kind == Value::t_integer)
+		t.isum += v.iValue * (long)n;
+	else if (v.kind == Value::t_float) {
+		t.fsum.add(v.fValue * n);
+		t.floats += n;
+	}
+	else {
+		t.others += n;
+		return;
+	}
+	for (unsigned int i = 0; i < n; ++i) t.values.insert(v);
+}
+
+void ListAggregates::exclude(Totals &t, const Value &v, unsigned int n) {
+	if (v.kind == Value::t_integer)
+		t.isum -= v.iValue * (long)n;
+	else if (v.kind == Value::t_float) {
+		t.fsum.subtract(v.fValue * n);
+		t.floats -= n;
+		if (t.floats == 0) t.fsum.clear(); // discard rounding errors
+	}
+	else {
+		t.others -= n;
+		return;
+	}
+	for (unsigned int i = 0; i < n; ++i) {
+		// equal values may differ in kind, prefer to remove one of the same kind
+		std::pair<std::multiset<Value, NumericLess>::iterator, std::multiset<Value, NumericLess>::iterator> range
+			= t.values.equal_range(v);
+		if (range.first == range.second) break;
+		std::multiset<Value, NumericLess>::iterator found = range.first;
+		while (found != range.second && (*found).kind != v.kind) ++found;
+		if (found == range.second) found = range.first;
+		t.values.erase(found);
+	}
+}
+
+void ListAggregates::added(Parameter &entry) {
+	if (stale) return;
+	++entries;
+	values.add(entry.val);
+	++names[entry.real_name];
+	MachineInstance *m = list->lookup(entry);
+	if (!m) return;
+	++resolved;
+	Member &member = members[m];
+	if (member.refs == 0) {
+		member.state = m->getCurrent().getName();
+		std::map<std::string, Totals>::iterator iter = totals.begin();
+		while (iter != totals.end()) {
+			const std::string &property = (*iter++).first;
+			member.values[property] = notifiedValue(m, property);
+		}
+		m->watchAggregates(this);
+	}
+	++member.refs;
+	++states[member.state];
+	std::map<std::string, Value>::iterator iter = member.values.begin();
+	while (iter != member.values.end()) {
+		include(totals[(*iter).first], (*iter).second, 1);
+		++iter;
+	}
+}
+
+void ListAggregates::removed(Parameter &entry) {
+	if (stale) return;
+	if (entries == 0) { stale = true; return; }
+	--entries;
+	std::unordered_map<std::string, unsigned int>::iterator name = names.find(entry.real_name);
+	if (!values.remove(entry.val) || name == names.end()) { stale = true; return; }
+	if (--(*name).second == 0) names.erase(name);
+	MachineInstance *m = list->lookup(entry);
+	if (!m) return;
+	std::map<MachineInstance*, Member>::iterator found = members.find(m);
+	if (found == members.end()) { stale = true; return; }
+	Member &member = (*found).second;
+	--resolved;
+	--states[member.state];
+	std::map<std::string, Value>::iterator iter = member.values.begin();
+	while (iter != member.values.end()) {
+		exclude(totals[(*iter).first], (*iter).second, 1);
+		++iter;
+	}
+	if (--member.refs == 0) {
+		m->ignoreAggregates(this);
+		members.erase(found);
+	}
+}
+
+void ListAggregates::cleared() {
+	std::map<MachineInstance*, Member>::iterator iter = members.begin();
+	while (iter != members.end()) {
+		(*iter).first->ignoreAggregates(this);
+		++iter;
+	}
+	members.clear();
+	states.clear();
+	values.clear();
+	names.clear();
+	std::map<std::string, Totals>::iterator t = totals.begin();
+	while (t != totals.end()) {
+		(*t).second = Totals();
+		++t;
+	}
+	entries = 0;
+	resolved = 0;
+	stale = false;
+}
+
+void ListAggregates::memberChanged(MachineInstance *m) {
+	std::map<MachineInstance*, Member>::iterator found = members.find(m);
+	if (found == members.end()) return;
+	Member &member = (*found).second;
+	const std::string &state = m->getCurrent().getName();
+	if (state != member.state) {
+		states[member.state] -= member.refs;
+		states[state] += member.refs;
+		member.state = state;
+	}
+	std::map<std::string, Value>::iterator iter = member.values.begin();
+	while (iter != member.values.end()) {
+		const std::string &property = (*iter).first;
+		Value &previous = (*iter).second;
+		++iter;
+		const Value &current = notifiedValue(m, property);
+		if (current.kind == previous.kind && current == previous) continue;
+		Totals &t = totals[property];
+		exclude(t, previous, member.refs);
+		include(t, current, member.refs);
+		previous = current;
+	}
+}
+
+void ListAggregates::forget(MachineInstance *m) {
+	members.erase(m);
+	stale = true;
+}
+
+void ListAggregates::rebuild() {
+	cleared();
+	for (unsigned int i = 0; i < list->parameters.size(); ++i)
+		added(list->parameters[i]);
+}
+
+void ListAggregates::refresh() {
+	if (stale || entries != list->parameters.size()) rebuild();
+}
+
+ListAggregates::Totals *ListAggregates::track(const std::string &property) {
+	refresh();
+	std::map<std::string, Totals>::iterator found = totals.find(property);
+	if (found != totals.end()) return &(*found).second;
+	Totals &t = totals[property];
+	std::map<MachineInstance*, Member>::iterator iter = members.begin();
+	while (iter != members.end()) {
+		MachineInstance *m = (*iter).first;
+		Member &member = (*iter).second;
+		++iter;
+		const Value &v = notifiedValue(m, property);
+		member.values[property] = v;
+		include(t, v, member.refs);
+	}
+	return &t;
+}
+
+long ListAggregates::count(const std::string &state) {
+	refresh();
+	std::map<std::string, long>::iterator found = states.find(state);
+	return (found != states.end()) ? (*found).second : 0;
+}
+
+bool ListAggregates::any(const std::string &state) {
+	return count(state) > 0;
+}
+
+bool ListAggregates::all(const std::string &state) {
+	long n = count(state);
+	return entries > 0 && n == (long)resolved;
+}
+
+bool ListAggregates::sum(const std::string &property, Value &result) {
+	Totals *t = track(property);
+	if (t->others) return false;
+	if (t->floats)
+		result = (double)t->isum + t->fsum.value();
+	else
+		result = t->isum;
+	return true;
+}
+
+bool ListAggregates::mean(const std::string &property, Value &result) {
+	Totals *t = track(property);
+	if (t->others) return false;
+	if (resolved == 0)
+		result = 0;
+	else
+		result = ((double)t->isum + t->fsum.value()) / resolved;
+	return true;
+}
+
+bool ListAggregates::min(const std::string &property, Value &result) {
+	Totals *t = track(property);
+	if (t->others) return false;
+	if (t->values.empty())
+		result = LONG_MAX;
+	else
+		result = *t->values.begin();
+	return true;
+}
+
+bool ListAggregates::max(const std::string &property, Value &result) {
+	Totals *t = track(property);
+	if (t->others) return false;
+	if (t->values.empty())
+		result = LONG_MIN;
+	else
+		result = *t->values.rbegin();
+	return true;
+}
+
+bool ListAggregates::includes(const Value &v) {
+	refresh();
+	return values.contains(v);
+}
+
+bool ListAggregates::includesName(const std::string &name) {
+	refresh();
+	return names.find(name) != names.end();
+}
@@ -0,0 +1,119 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __ListAggregates_h__
+#define __ListAggregates_h__
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include "value.h"
+#include "ValueIndex.h"
+#include "filtering.h"
+
+class MachineInstance;
+class Parameter;
+
+/*
+	State counts and property totals for the members of a LIST, kept up to
+	date as entries are added and removed and as members change state or
+	property values, so that COUNT, ANY, ALL, SUM, MIN, MAX and MEAN do not
+	scan the list on every evaluation. The entries are also indexed by value
+	and by name for INCLUDES and the set operations.
+
+	A property is tracked from the first time it is aggregated. Property
+	results are only available while every member has a numeric value for
+	the property held in its own properties, since only changes to those
+	are notified; otherwise (TIMER, keywords, globals, class properties or
+	non numeric values) the query returns false and the caller falls back
+	to scanning the list.
+
+	The list's parameters may also be changed directly; if the number of
+	entries no longer matches the totals are rebuilt on the next query.
+*/
+class ListAggregates {
+public:
+	ListAggregates(MachineInstance *list_machine);
+	~ListAggregates();
+
+	// changes to the list
+	void added(Parameter &entry);
+	void removed(Parameter &entry);
+	void cleared();
+
+	// a member changed state or property values
+	void memberChanged(MachineInstance *member);
+	// a member is being deleted
+	void forget(MachineInstance *member);
+
+	long count(const std::string &state);
+	bool any(const std::string &state);
+	bool all(const std::string &state);
+
+	bool sum(const std::string &property, Value &result);
+	bool mean(const std::string &property, Value &result);
+	bool min(const std::string &property, Value &result);
+	bool max(const std::string &property, Value &result);
+
+	// true if an entry is equal to v or has the given name
+	bool includes(const Value &v);
+	bool includesName(const std::string &name);
+
+private:
+	struct NumericLess {
+		bool operator()(const Value &a, const Value &b) const;
+	};
+	struct Totals {
+		long isum;
+		KahanSum fsum;
+		unsigned int floats;
+		unsigned int others; // members with a non numeric value
+		std::multiset<Value, NumericLess> values;
+		Totals() : isum(0), floats(0), others(0) {}
+	};
+	struct Member {
+		unsigned int refs; // the number of times the machine appears in the list
+		std::string state;
+		std::map<std::string, Value> values;
+		Member() : refs(0) {}
+	};
+
+	void refresh();
+	void rebuild();
+	Totals *track(const std::string &property);
+	void include(Totals &totals, const Value &v, unsigned int n);
+	void exclude(Totals &totals, const Value &v, unsigned int n);
+
+	MachineInstance *list;
+	size_t entries; // all entries in the list, including those that are not machines
+	size_t resolved; // entries that refer to a machine
+	bool stale;
+	std::map<MachineInstance*, Member> members;
+	std::map<std::string, long> states;
+	std::map<std::string, Totals> totals;
+	ValueIndex values;
+	std::unordered_map<std::string, unsigned int> names;
+
+	ListAggregates(const ListAggregates &);
+	ListAggregates &operator=(const ListAggregates &);
+};
+
+#endif
@@ -30,9 +30,11 @@
 #include <string.h>
 #include <mosquitto.h>
 #include "MQTTInterface.h"
+#include "MQTTNetwork.h"
 #include "IOComponent.h"
 #include <boost/thread/condition.hpp>
 #include "MachineInstance.h"
+#include "IOTrace.h"
 
 void mqttif_signal_handler(int signum);
 
@@ -40,92 +42,11 @@ std::list<MQTTModule *> MQTTInterface::modules;
 
 int MQTTInterface::FREQUENCY = 100;
 
-void my_message_callback(struct mosquitto *mosq, void *obj, const struct mosquitto_message *message)
-{
-    MQTTModule *device = (MQTTModule *)obj;
-    
-    if(message->payloadlen){
-        char *payload = new char[message->payloadlen + 1];
-        memcpy(payload, message->payload, message->payloadlen);
-        payload[message->payloadlen] = 0;
-        std::cout << message->topic << ": " << payload << "\n";
-        std::map<std::string, MachineInstance*>::iterator pos = device->handlers.find(message->topic);
-	if (pos != device->handlers.end()) {
-		MachineInstance *m = (*pos).second;
-		m->setValue("topic", message->topic);
-		char *tmp = 0;
-		long val = strtol(payload, &tmp, 10);
-		if (tmp && *tmp == 0)
-			m->setValue("message", val);
-		else
-			m->setValue("message", payload);
-		const char *evt = payload;
-		std::string event("");
-		event += evt;
-		bool is_enter = false;
-		if (strcmp(evt,"on") == 0 || strcmp(evt, "off") == 0) {
-			event += "_enter";
-			is_enter = true;
-		}
-		else
-			event = "property_change";
-		if (m->_type == "POINT" && (event ==  "on_enter" || event == "off_enter")) {
-			Message msg(event.c_str(), Message::ENTERMSG);
-			m->execute(msg, device);
-		}
-		else {
-			std::set<MachineInstance*>::iterator iter = m->depends.begin();
-			while (iter != m->depends.end()) {
-				MachineInstance *mi = *iter++;
-				Message msg(event.c_str(), (is_enter)?Message::ENTERMSG : Message::SIMPLEMSG);
-				mi->execute(msg, m);
-			}
-		}
-        }
-	delete[] payload;
-    }
-}
-
-void my_connect_callback(struct mosquitto *mosq, void *obj, int result)
-{
-    MQTTModule *device = (MQTTModule *)obj;
-    
-	if(result){
-        device->last_error_str = mosquitto_connack_string(result);
-        device->last_error = result;
-    }
-}
-
-void my_disconnect_callback(struct mosquitto *mosq, void *obj, int rc)
-{
-    MQTTModule *device = (MQTTModule *)obj;
-	device->connected = false;
-}
-
-void my_publish_callback(struct mosquitto *mosq, void *obj, int mid)
-{
-    MQTTModule *device = (MQTTModule *)obj;
-}
-
-
-void my_subscribe_callback(struct mosquitto *mosq, void *obj, int mid, int qos_count, const int *granted_qos)
-{
-    MQTTModule *device = (MQTTModule *)obj;
-    
-    std::cout << "Subscribed (mid: " << mid << "): "<< granted_qos[0];
-	for(int i=1; i<qos_count; i++){
-        std::cout << ", " << granted_qos[i];
-	}
-    std::cout << "\n";
-}
-
-
-void my_subscribe_callback(struct mosquitto *mosq, void *obj, int mid)
-{
-    
-}
-
 MQTTModule::MQTTModule(const char *name) : Transmitter(name) {
+    status = STATUS_CONNECTING;
+    link = 0;
+    port = 0;
+    qos = 0;
     mid_sent = 0;
     last_mid = -1;
     connected = true;
@@ -133,66 +54,41 @@ MQTTModule::MQTTModule(const char *name) : Transmitter(name) {
     password = NULL;
     disconnect_sent = false;
     quiet = false;
-
-    mosq = mosquitto_new(NULL, true, this);
-	if(!mosq){
-		switch(errno){
-			case ENOMEM:
-				if(!quiet) fprintf(stderr, "Error: Out of memory.\n");
-				break;
-			case EINVAL:
-				if(!quiet) fprintf(stderr, "Error: Invalid id.\n");
-				break;
-		}
-	}
-    else {
-        mosquitto_connect_callback_set(mosq, my_connect_callback);
-        mosquitto_subscribe_callback_set(mosq, my_subscribe_callback);
-        mosquitto_disconnect_callback_set(mosq, my_disconnect_callback);
-        mosquitto_publish_callback_set(mosq, my_publish_callback);
-        mosquitto_message_callback_set(mosq, my_message_callback);
-    }
+    last_stats_time = 0;
+    last_published = 0;
+    last_received = 0;
 }
 
 bool MQTTModule::online() {
 	return true; //tbd
 }
 
+// the network thread makes the connection and reconnects as necessary
 bool MQTTModule::connect() {
-    mosquitto_connect(mosq, host.c_str(), port, 10);
+    if (!link) link = MQTTNetwork::instance()->addBroker(_name, host, port, this);
     connected = true;
     return connected;
 }
 
 void MQTTModule::disconnect() {
-    mosquitto_disconnect(mosq);
+    MQTTNetwork::instance()->disconnect(link);
     disconnect_sent = true;
 }
 
+static int qosFor(MachineInstance *m, int default_qos) {
+    long qos = default_qos;
+    if (m && m->properties.exists("qos") && m->properties.lookup("qos").asInteger(qos) && qos >= 0 && qos <= 2)
+        return (int)qos;
+    return default_qos;
+}
+
 bool MQTTModule::publish(const std::string &topic, const std::string &message, MachineInstance *m) {
     pubs.add(topic.c_str(), message.c_str());
     const Value &msg_val = pubs.lookup(topic.c_str());
-    int rc = mosquitto_publish(mosq, &mid_sent, topic.c_str(), (int)msg_val.asString().length(), msg_val.asString().c_str(), 0, true);
-    if(rc){
-        last_error = rc;
-        switch(rc){
-            case MOSQ_ERR_INVAL:
-                last_error_str = "Error: Invalid input. Does your topic contain '+' or '#'?\n";
-                status = STATUS_ERROR;
-                break;
-            case MOSQ_ERR_NOMEM:
-                last_error_str =  "Error: Out of memory when trying to publish message.\n";
-                break;
-            case MOSQ_ERR_NO_CONN:
-                last_error_str = "Error: Client not connected when trying to publish.\n";
-                break;
-            case MOSQ_ERR_PROTOCOL:
-                last_error_str = "Error: Protocol error when communicating with broker.\n";
-                break;
-            case MOSQ_ERR_PAYLOAD_SIZE:
-                last_error_str = "Error: Message payload is too large.\n";
-                break;
-        }
+    // queued for the network thread, a newer value for the topic replaces this one if it has not been sent
+    if (!MQTTNetwork::instance()->publish(link, topic, msg_val.asString(), qosFor(m, qos), true)) {
+        last_error_str = "Error: Client not connected when trying to publish.\n";
+        status = STATUS_ERROR;
         return false;
     }
     m->setValue("topic", topic.c_str());
@@ -206,24 +102,9 @@ bool MQTTModule::publish(const std::string &topic, const std::string &message, M
 
 bool MQTTModule::subscribe(const std::string &topic, MachineInstance *m) {
     subs.add(topic.c_str(), "");
-    int rc = mosquitto_subscribe(mosq, NULL, topic.c_str(), 0);
-    if(rc){
-        last_error = rc;
-        switch(rc){
-            case MOSQ_ERR_INVAL:
-                last_error_str = "Error: Invalid input. Does your topic contain '+' or '#'?\n";
-                status = STATUS_ERROR;
-                break;
-            case MOSQ_ERR_NOMEM:
-                last_error_str =  "Error: Out of memory when trying to publish message.\n";
-                break;
-            case MOSQ_ERR_NO_CONN:
-                last_error_str = "Error: Client not connected when trying to publish.\n";
-                break;
-            case MOSQ_ERR_PROTOCOL:
-                last_error_str = "Error: Protocol error when communicating with broker.\n";
-                break;
-        }
+    if (!MQTTNetwork::instance()->subscribe(link, topic, qosFor(m, qos))) {
+        last_error_str = "Error: Client not connected when trying to subscribe.\n";
+        status = STATUS_ERROR;
         return false;
     }
     handlers[topic] = m;
@@ -231,6 +112,64 @@ bool MQTTModule::subscribe(const std::string &topic, MachineInstance *m) {
     return true;
 }
 
+void MQTTModule::dispatch(const std::string &topic, const std::string &payload) {
+    if (payload.empty()) return;
+    std::map<std::string, MachineInstance*>::iterator pos = handlers.find(topic);
+    if (pos == handlers.end()) return;
+    MachineInstance *m = (*pos).second;
+    m->setValue("topic", topic.c_str());
+    char *tmp = 0;
+    long val = strtol(payload.c_str(), &tmp, 10);
+    if (tmp && *tmp == 0)
+        m->setValue("message", val);
+    else
+        m->setValue("message", payload.c_str());
+    std::string event(payload);
+    bool is_enter = false;
+    if (payload == "on" || payload == "off") {
+        event += "_enter";
+        is_enter = true;
+    }
+    else
+        event = "property_change";
+    if (m->_type == "POINT" && is_enter) {
+        Message msg(event.c_str(), Message::ENTERMSG);
+        m->execute(msg, this);
+    }
+    else {
+        std::set<MachineInstance*>::iterator iter = m->depends.begin();
+        while (iter != m->depends.end()) {
+            MachineInstance *mi = *iter++;
+            Message msg(event.c_str(), (is_enter)?Message::ENTERMSG : Message::SIMPLEMSG);
+            mi->execute(msg, m);
+        }
+    }
+}
+
+// copies the link counters and message rates to properties of the broker machine
+void MQTTModule::updateStatistics(uint64_t now) {
+    if (!link) return;
+    MachineInstance *broker = MachineInstance::find(_name.c_str());
+    if (!broker) return;
+    uint64_t published = link->published;
+    uint64_t received = link->received;
+    if (last_stats_time && now > last_stats_time) {
+        uint64_t elapsed = now - last_stats_time;
+        broker->setValue("publish_rate", (long)((published - last_published) * 1000000 / elapsed));
+        broker->setValue("receive_rate", (long)((received - last_received) * 1000000 / elapsed));
+    }
+    broker->setValue("published", (long)published);
+    broker->setValue("received", (long)received);
+    broker->setValue("coalesced", (long)link->coalesced.load());
+    broker->setValue("dropped", (long)link->dropped.load());
+    broker->setValue("errors", (long)link->errors.load());
+    broker->setValue("reconnects", (long)link->reconnects.load());
+    broker->setValue("connected", (long)(link->connected ? 1 : 0));
+    last_stats_time = now;
+    last_published = published;
+    last_received = received;
+}
+
 
 std::string MQTTModule::getStateString(const std::string &topic)
 {
@@ -260,6 +199,7 @@ std::ostream &MQTTModule::describe(std::ostream &out) const {
 }
 
 MQTTInterface::~MQTTInterface() {
+    MQTTNetwork::instance()->stop();
     mosquitto_lib_cleanup();
 }
 
@@ -284,6 +224,15 @@ MQTTModule *MQTTInterface::findModule(std::string name) {
 
 void MQTTInterface::processAll()
 {
+	if (!instance_ || modules.empty()) return;
+	instance_->collectState();
+	instance_->sendUpdates();
+}
+
+int MQTTInterface::notifyFd()
+{
+	if (modules.empty()) return -1;
+	return MQTTNetwork::instance()->notifyFd();
 }
 
 bool MQTTInterface::addModule(MQTTModule *module, bool reset_io) {
@@ -348,25 +297,37 @@ MQTTInterface *MQTTInterface::instance() {
 	return instance_;
 }
 
+// deliver messages received by the network thread, a limited number per call
+// so that a flood of messages does not hold up the processing thread
 void MQTTInterface::collectState() {
 	if (!initialised || !active) {
 		return;
 	}
-    std::list<MQTTModule *>::iterator iter = modules.begin();
-    while (iter != modules.end()) {
-        MQTTModule *module = *iter++;
-        int rc = mosquitto_loop(module->mosq, -1, 1);
-        if (rc != MOSQ_ERR_SUCCESS) {
-            std::cout << "Error: " << rc << " polling mosquitto\n";
-            module->connect();
-        }
-    }
+	MQTTNetwork *network = MQTTNetwork::instance();
+	MQTTInbound msg;
+	int count = 0;
+	while (count++ < 1000 && network->receive(msg)) {
+		MQTTModule *module = (MQTTModule *)msg.link->owner;
+		if (IOTraceRecorder::instance())
+			IOTraceRecorder::instance()->mqtt(module->getName(), msg.topic, msg.payload);
+		module->dispatch(msg.topic, msg.payload);
+	}
 }
 
 void MQTTInterface::sendUpdates() {
 	if (!initialised || !active) {
 		return;
 	}
+	MQTTNetwork::instance()->flush();
+	uint64_t now = microsecs();
+	static uint64_t last_stats = 0;
+	if (now - last_stats < 1000000) return;
+	last_stats = now;
+	std::list<MQTTModule *>::iterator iter = modules.begin();
+	while (iter != modules.end()) {
+		MQTTModule *module = *iter++;
+		module->updateStatistics(now);
+	}
 }
 
 
@@ -397,12 +358,7 @@ bool MQTTInterface::start() {
         return false;
     }
 #endif
-    std::list<MQTTModule *>::iterator iter = modules.begin();
-    while (iter != modules.end()) {
-        MQTTModule *module = *iter++;
-        mosquitto_loop_start(module->mosq);
-    }
-	return true;
+	return MQTTNetwork::instance()->start();
 }
 
 bool MQTTInterface::stop() {
@@ -417,10 +373,6 @@ bool MQTTInterface::stop() {
         return false;
     }
 #endif
-    std::list<MQTTModule *>::iterator iter = modules.begin();
-    while (iter != modules.end()) {
-        MQTTModule *module = *iter++;
-        mosquitto_loop_stop(module->mosq, false);
-    }
+	MQTTNetwork::instance()->stop();
 	return true;
 }
@@ -23,11 +23,12 @@
 
 #include <iostream>
 #include <sys/types.h>
-#include <mosquitto.h>
+#include <stdint.h>
 #include "symboltable.h"
 #include "Message.h"
 
 class MachineInstance;
+class MQTTBrokerLink;
 
 class MQTTModule : public Transmitter {
 public:
@@ -39,9 +40,10 @@ public:
 	std::ostream &operator <<(std::ostream &)const;
 public:
     Status status;
-    struct mosquitto *mosq;
+    MQTTBrokerLink *link; // broker I/O is handled by the MQTT network thread
     std::string host;
     int port;
+    int qos; // default quality of service, a machine may override this with a qos property
     SymbolTable pubs;
     SymbolTable subs;
     std::map<std::string, MachineInstance*>handlers;
@@ -57,6 +59,8 @@ public:
     bool subscribes(const std::string &topic);
     std::string getStateString(const std::string &topic);
     std::ostream& describe(std::ostream&out) const;
+    void dispatch(const std::string &topic, const std::string &payload); // deliver a received message
+    void updateStatistics(uint64_t now);
     
     int mid_sent;
     int last_mid;
@@ -65,6 +69,10 @@ public:
     char *password;
     bool disconnect_sent;
     bool quiet;
+
+    uint64_t last_stats_time;
+    uint64_t last_published;
+    uint64_t last_received;
     
 protected:
     MQTTModule(const MQTTModule &other);
@@ -100,7 +108,8 @@ public:
 	bool operational();
 	static std::list<MQTTModule *>modules;
 	static MQTTModule *findModule(std::string module_name);
-    static void processAll();
+    static void processAll(); // deliver received messages, called from the processing thread
+    static int notifyFd(); // readable when messages are waiting to be delivered, -1 if there are no brokers
 
 private:
 	MQTTInterface();
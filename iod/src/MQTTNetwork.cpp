@@ -0,0 +1,423 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <iostream>
+#include <vector>
+#include <errno.h>
+#include <string.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <mosquitto.h>
+#include "MQTTNetwork.h"
+
+static const uint64_t reconnect_interval = 1000000; // microseconds between connection attempts
+static const int keepalive = 10; // seconds
+
+static uint64_t monotonicMicrosecs() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+MQTTBrokerLink::MQTTBrokerLink(const std::string &link_name, const std::string &broker_host, int broker_port, void *link_owner)
+	: name(link_name), host(broker_host), port(broker_port), owner(link_owner),
+	connected(false), published(0), coalesced(0), received(0), dropped(0), errors(0), reconnects(0), last_error(0),
+	mosq(0), session_open(false), enabled(true), ever_opened(false), last_attempt(0) {
+}
+
+MQTTNetwork *MQTTNetwork::instance_ = 0;
+
+MQTTNetwork *MQTTNetwork::instance() {
+	if (!instance_) instance_ = new MQTTNetwork();
+	return instance_;
+}
+
+MQTTNetwork::MQTTNetwork()
+	: outbound_signalled(false), inbound_signalled(false), done(false), thread(0) {
+	outbound_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	inbound_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (outbound_fd == -1 || inbound_fd == -1)
+		std::cerr << "MQTT: failed to create event descriptors: " << strerror(errno) << "\n";
+}
+
+MQTTNetwork::~MQTTNetwork() {
+	stop();
+	if (outbound_fd != -1) close(outbound_fd);
+	if (inbound_fd != -1) close(inbound_fd);
+}
+
+MQTTBrokerLink *MQTTNetwork::addBroker(const std::string &name, const std::string &host, int port, void *owner) {
+	MQTTBrokerLink *link = new MQTTBrokerLink(name, host, port, owner);
+	boost::mutex::scoped_lock lock(links_mutex);
+	links.push_back(link);
+	return link;
+}
+
+void MQTTNetwork::wake(int fd, std::atomic<bool> &flag) {
+	// only the first request after the reader clears the flag needs to write
+	if (flag.exchange(true)) return;
+	uint64_t one = 1;
+	ssize_t n = write(fd, &one, sizeof(one));
+	(void)n;
+}
+
+static void clearEvent(int fd) {
+	uint64_t count;
+	ssize_t n = read(fd, &count, sizeof(count));
+	(void)n;
+}
+
+bool MQTTNetwork::enqueue(MQTTOutbound *item) {
+	if (!overflow.empty()) flush();
+	if (overflow.empty() && outbound.push(item)) {
+		wake(outbound_fd, outbound_signalled);
+		return true;
+	}
+	// the network thread is behind, keep only the newest value for a topic
+	if (item->op == MQTTOutbound::Publish) {
+		std::pair<MQTTBrokerLink*, std::string> key(item->link, item->topic);
+		std::map<std::pair<MQTTBrokerLink*, std::string>, std::list<MQTTOutbound*>::iterator>::iterator found
+			= overflow_index.find(key);
+		if (found != overflow_index.end()) {
+			++item->link->coalesced;
+			delete *(*found).second;
+			*(*found).second = item;
+			return true;
+		}
+		overflow_index[key] = overflow.insert(overflow.end(), item);
+		return true;
+	}
+	overflow.push_back(item);
+	return true;
+}
+
+bool MQTTNetwork::flush() {
+	bool sent = false;
+	while (!overflow.empty() && outbound.push(overflow.front())) {
+		MQTTOutbound *item = overflow.front();
+		if (item->op == MQTTOutbound::Publish)
+			overflow_index.erase(std::make_pair(item->link, item->topic));
+		overflow.pop_front();
+		sent = true;
+	}
+	if (sent) wake(outbound_fd, outbound_signalled);
+	return overflow.empty();
+}
+
+bool MQTTNetwork::publish(MQTTBrokerLink *link, const std::string &topic, const std::string &payload, int qos, bool retain) {
+	if (!link) return false;
+	MQTTOutbound *item = new MQTTOutbound;
+	item->op = MQTTOutbound::Publish;
+	item->link = link;
+	item->topic = topic;
+	item->payload = payload;
+	item->qos = qos;
+	item->retain = retain;
+	return enqueue(item);
+}
+
+bool MQTTNetwork::subscribe(MQTTBrokerLink *link, const std::string &topic, int qos) {
+	if (!link) return false;
+	MQTTOutbound *item = new MQTTOutbound;
+	item->op = MQTTOutbound::Subscribe;
+	item->link = link;
+	item->topic = topic;
+	item->qos = qos;
+	item->retain = false;
+	return enqueue(item);
+}
+
+bool MQTTNetwork::disconnect(MQTTBrokerLink *link) {
+	if (!link) return false;
+	MQTTOutbound *item = new MQTTOutbound;
+	item->op = MQTTOutbound::Disconnect;
+	item->link = link;
+	item->qos = 0;
+	item->retain = false;
+	return enqueue(item);
+}
+
+bool MQTTNetwork::receive(MQTTInbound &msg) {
+	MQTTInbound *item = 0;
+	if (!inbound.pop(item)) {
+		// clear the notification before looking again so that a message
+		// pushed in between is either seen now or signalled again
+		clearEvent(inbound_fd);
+		inbound_signalled = false;
+		if (!inbound.pop(item)) return false;
+	}
+	msg.link = item->link;
+	msg.topic.swap(item->topic);
+	msg.payload.swap(item->payload);
+	delete item;
+	return true;
+}
+
+bool MQTTNetwork::start() {
+	if (thread) return true;
+	done = false;
+	thread = new boost::thread(boost::ref(*this));
+	return true;
+}
+
+void MQTTNetwork::stop() {
+	if (!thread) return;
+	done = true;
+	uint64_t one = 1;
+	ssize_t n = write(outbound_fd, &one, sizeof(one));
+	(void)n;
+	thread->join();
+	delete thread;
+	thread = 0;
+}
+
+void MQTTNetwork::connectCallback(struct mosquitto *mosq, void *obj, int result) {
+	MQTTBrokerLink *link = (MQTTBrokerLink *)obj;
+	if (result) {
+		std::cerr << "MQTT " << link->name << ": " << mosquitto_connack_string(result) << "\n";
+		link->last_error = result;
+		++link->errors;
+		return;
+	}
+	link->connected = true;
+	// the session is clean so subscriptions are sent again on each connection
+	std::map<std::string, int>::iterator iter = link->subscriptions.begin();
+	while (iter != link->subscriptions.end()) {
+		const std::pair<const std::string, int> &sub = *iter++;
+		int rc = mosquitto_subscribe(mosq, NULL, sub.first.c_str(), sub.second);
+		if (rc != MOSQ_ERR_SUCCESS) {
+			link->last_error = rc;
+			++link->errors;
+		}
+	}
+}
+
+void MQTTNetwork::disconnectCallback(struct mosquitto *mosq, void *obj, int rc) {
+	MQTTBrokerLink *link = (MQTTBrokerLink *)obj;
+	link->connected = false;
+}
+
+void MQTTNetwork::messageCallback(struct mosquitto *mosq, void *obj, const struct mosquitto_message *message) {
+	MQTTBrokerLink *link = (MQTTBrokerLink *)obj;
+	++link->received;
+	MQTTInbound *msg = new MQTTInbound;
+	msg->link = link;
+	msg->topic = message->topic;
+	if (message->payloadlen)
+		msg->payload.assign((const char *)message->payload, message->payloadlen);
+	instance()->deliver(msg);
+}
+
+void MQTTNetwork::deliver(MQTTInbound *msg) {
+	if (backlog.empty() && inbound.push(msg)) {
+		wake(inbound_fd, inbound_signalled);
+		return;
+	}
+	// the model is behind, keep only the newest value for a topic
+	std::pair<MQTTBrokerLink*, std::string> key(msg->link, msg->topic);
+	std::map<std::pair<MQTTBrokerLink*, std::string>, MQTTInbound*>::iterator found = backlog.find(key);
+	if (found != backlog.end()) {
+		++msg->link->dropped;
+		delete (*found).second;
+		(*found).second = msg;
+	}
+	else
+		backlog[key] = msg;
+}
+
+void MQTTNetwork::flushInbound() {
+	bool sent = false;
+	std::map<std::pair<MQTTBrokerLink*, std::string>, MQTTInbound*>::iterator iter = backlog.begin();
+	while (iter != backlog.end() && inbound.push((*iter).second)) {
+		backlog.erase(iter++);
+		sent = true;
+	}
+	if (sent) wake(inbound_fd, inbound_signalled);
+}
+
+void MQTTNetwork::drainOutbound() {
+	MQTTOutbound *item = 0;
+	while (outbound.pop(item)) {
+		MQTTBrokerLink *link = item->link;
+		switch (item->op) {
+			case MQTTOutbound::Publish: {
+				link->enabled = true;
+				std::map<std::string, MQTTOutbound*>::iterator found = link->pending.find(item->topic);
+				if (found != link->pending.end()) {
+					++link->coalesced;
+					delete (*found).second;
+					(*found).second = item;
+				}
+				else
+					link->pending[item->topic] = item;
+				item = 0;
+				break;
+			}
+			case MQTTOutbound::Subscribe:
+				link->enabled = true;
+				link->subscriptions[item->topic] = item->qos;
+				if (link->connected) {
+					int rc = mosquitto_subscribe(link->mosq, NULL, item->topic.c_str(), item->qos);
+					if (rc != MOSQ_ERR_SUCCESS) {
+						link->last_error = rc;
+						++link->errors;
+					}
+				}
+				break;
+			case MQTTOutbound::Disconnect:
+				link->enabled = false;
+				closeSession(link);
+				break;
+		}
+		delete item;
+	}
+}
+
+bool MQTTNetwork::openSession(MQTTBrokerLink *link, uint64_t now) {
+	link->last_attempt = now;
+	if (!link->mosq) {
+		link->mosq = mosquitto_new(NULL, true, link);
+		if (!link->mosq) {
+			std::cerr << "MQTT " << link->name << ": " << strerror(errno) << "\n";
+			++link->errors;
+			return false;
+		}
+		mosquitto_connect_callback_set(link->mosq, connectCallback);
+		mosquitto_disconnect_callback_set(link->mosq, disconnectCallback);
+		mosquitto_message_callback_set(link->mosq, messageCallback);
+	}
+	int rc = mosquitto_connect(link->mosq, link->host.c_str(), link->port, keepalive);
+	if (rc != MOSQ_ERR_SUCCESS) {
+		link->last_error = rc;
+		++link->errors;
+		return false;
+	}
+	if (link->ever_opened) ++link->reconnects;
+	link->ever_opened = true;
+	link->session_open = true;
+	return true;
+}
+
+void MQTTNetwork::closeSession(MQTTBrokerLink *link) {
+	if (link->session_open) mosquitto_disconnect(link->mosq);
+	link->session_open = false;
+	link->connected = false;
+}
+
+void MQTTNetwork::sendPending(MQTTBrokerLink *link) {
+	std::map<std::string, MQTTOutbound*>::iterator iter = link->pending.begin();
+	while (iter != link->pending.end()) {
+		MQTTOutbound *item = (*iter).second;
+		int rc = mosquitto_publish(link->mosq, NULL, item->topic.c_str(), (int)item->payload.length(),
+				item->payload.c_str(), item->qos, item->retain);
+		if (rc == MOSQ_ERR_NO_CONN) return; // keep the value for the next connection
+		if (rc == MOSQ_ERR_SUCCESS)
+			++link->published;
+		else {
+			std::cerr << "MQTT " << link->name << ": failed to publish " << item->topic << ": " << mosquitto_strerror(rc) << "\n";
+			link->last_error = rc;
+			++link->errors;
+		}
+		delete item;
+		link->pending.erase(iter++);
+	}
+}
+
+void MQTTNetwork::service(MQTTBrokerLink *link, short revents, uint64_t now) {
+	if (!link->session_open) {
+		if (!link->enabled || now - link->last_attempt < reconnect_interval) return;
+		if (!openSession(link, now)) return;
+	}
+	int rc = MOSQ_ERR_SUCCESS;
+	if (revents & (POLLIN | POLLERR | POLLHUP))
+		rc = mosquitto_loop_read(link->mosq, 1);
+	if (rc == MOSQ_ERR_SUCCESS && mosquitto_want_write(link->mosq))
+		rc = mosquitto_loop_write(link->mosq, 1);
+	// new values are only handed over once earlier ones have been written,
+	// until then they are coalesced in the pending table
+	if (rc == MOSQ_ERR_SUCCESS && link->connected && !link->pending.empty() && !mosquitto_want_write(link->mosq)) {
+		sendPending(link);
+		if (mosquitto_want_write(link->mosq))
+			rc = mosquitto_loop_write(link->mosq, 1);
+	}
+	if (rc == MOSQ_ERR_SUCCESS)
+		rc = mosquitto_loop_misc(link->mosq);
+	if (rc != MOSQ_ERR_SUCCESS) {
+		std::cerr << "MQTT " << link->name << ": " << mosquitto_strerror(rc) << ", reconnecting\n";
+		link->last_error = rc;
+		++link->errors;
+		closeSession(link);
+	}
+}
+
+void MQTTNetwork::operator()() {
+	std::vector<struct pollfd> fds;
+	std::vector<MQTTBrokerLink*> current;
+	std::vector<short> revents;
+	while (!done) {
+		{
+			boost::mutex::scoped_lock lock(links_mutex);
+			current.assign(links.begin(), links.end());
+		}
+		fds.clear();
+		revents.assign(current.size(), 0);
+		struct pollfd wakeup = { outbound_fd, POLLIN, 0 };
+		fds.push_back(wakeup);
+		std::vector<size_t> polled; // index into current for each entry in fds after the first
+		for (size_t i = 0; i < current.size(); ++i) {
+			MQTTBrokerLink *link = current[i];
+			if (!link->session_open) continue;
+			int sock = mosquitto_socket(link->mosq);
+			if (sock < 0) continue;
+			struct pollfd item = { sock, POLLIN, 0 };
+			if (mosquitto_want_write(link->mosq)) item.events |= POLLOUT;
+			fds.push_back(item);
+			polled.push_back(i);
+		}
+		// retry the inbound backlog sooner if the model is behind
+		int rc = poll(&fds[0], fds.size(), backlog.empty() ? 100 : 10);
+		if (rc < 0 && errno != EINTR) {
+			std::cerr << "MQTT: poll failed: " << strerror(errno) << "\n";
+			usleep(10000);
+		}
+		if (done) break;
+		if (fds[0].revents & POLLIN) clearEvent(outbound_fd);
+		outbound_signalled = false;
+		drainOutbound();
+
+		for (size_t i = 1; i < fds.size(); ++i)
+			if (rc > 0) revents[polled[i-1]] = fds[i].revents;
+		uint64_t now = monotonicMicrosecs();
+		for (size_t i = 0; i < current.size(); ++i)
+			service(current[i], revents[i], now);
+		flushInbound();
+	}
+	std::vector<MQTTBrokerLink*>::iterator iter = current.begin();
+	while (iter != current.end()) {
+		MQTTBrokerLink *link = *iter++;
+		if (link->session_open) {
+			sendPending(link);
+			mosquitto_loop_write(link->mosq, 1);
+		}
+		closeSession(link);
+	}
+}
@@ -0,0 +1,176 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __MQTTNetwork_h__
+#define __MQTTNetwork_h__
+
+#include <stdint.h>
+#include <atomic>
+#include <string>
+#include <list>
+#include <map>
+#include <boost/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/lockfree/spsc_queue.hpp>
+
+struct mosquitto;
+struct mosquitto_message;
+class MQTTBrokerLink;
+
+// a request from the model to the network thread
+struct MQTTOutbound {
+	enum Operation { Publish, Subscribe, Disconnect };
+	Operation op;
+	MQTTBrokerLink *link;
+	std::string topic;
+	std::string payload;
+	int qos;
+	bool retain;
+};
+
+// a message received from a broker, waiting for the model
+struct MQTTInbound {
+	MQTTBrokerLink *link;
+	std::string topic;
+	std::string payload;
+};
+
+/*
+	The connection to one broker. The counters may be read from any
+	thread, everything else belongs to the network thread.
+*/
+class MQTTBrokerLink {
+public:
+	MQTTBrokerLink(const std::string &link_name, const std::string &broker_host, int broker_port, void *link_owner);
+
+	const std::string name;
+	const std::string host;
+	const int port;
+	void *owner;
+
+	std::atomic<bool> connected;
+	std::atomic<uint64_t> published;	// messages handed to the broker
+	std::atomic<uint64_t> coalesced;	// outbound values replaced by a newer value before being sent
+	std::atomic<uint64_t> received;		// messages received from the broker
+	std::atomic<uint64_t> dropped;		// inbound values replaced by a newer value before the model read them
+	std::atomic<uint64_t> errors;
+	std::atomic<uint64_t> reconnects;
+	std::atomic<int> last_error;
+
+private:
+	friend class MQTTNetwork;
+	struct mosquitto *mosq;
+	bool session_open;
+	bool enabled;		// false after a disconnect request, until the next publish or subscribe
+	bool ever_opened;
+	uint64_t last_attempt;
+	std::map<std::string, MQTTOutbound*> pending; // newest value for each topic
+	std::map<std::string, int> subscriptions;
+
+	MQTTBrokerLink(const MQTTBrokerLink &);
+	MQTTBrokerLink &operator=(const MQTTBrokerLink &);
+};
+
+/*
+	All broker I/O runs on one network thread. The model thread queues
+	requests on a lock-free single producer queue and never waits for the
+	network; received messages come back on a second queue and an eventfd
+	becomes readable when there is something to collect.
+
+	When a broker is slow or disconnected, publishes to a topic are
+	coalesced so that only the newest value is sent. Inbound messages are
+	coalesced the same way if the model falls behind.
+
+	publish(), subscribe(), disconnect(), flush() and receive() are for
+	the model thread only.
+*/
+class MQTTNetwork {
+public:
+	static MQTTNetwork *instance();
+
+	MQTTBrokerLink *addBroker(const std::string &name, const std::string &host, int port, void *owner);
+	// links are only added by the model thread, so it may read this without locking
+	const std::list<MQTTBrokerLink*> &brokers() const { return links; }
+
+	bool publish(MQTTBrokerLink *link, const std::string &topic, const std::string &payload, int qos, bool retain);
+	bool subscribe(MQTTBrokerLink *link, const std::string &topic, int qos);
+	bool disconnect(MQTTBrokerLink *link);
+
+	// retry requests that did not fit on the queue, returns true if none remain
+	bool flush();
+
+	// collect the next received message, returns false when there are none
+	bool receive(MQTTInbound &msg);
+
+	// readable while received messages are waiting
+	int notifyFd() const { return inbound_fd; }
+
+	bool start();
+	void stop();
+	bool running() const { return thread != 0; }
+
+	void operator()();
+
+	// callbacks from libmosquitto on the network thread
+	static void connectCallback(struct mosquitto *mosq, void *obj, int result);
+	static void disconnectCallback(struct mosquitto *mosq, void *obj, int rc);
+	static void messageCallback(struct mosquitto *mosq, void *obj, const struct mosquitto_message *message);
+
+private:
+	MQTTNetwork();
+	~MQTTNetwork();
+	MQTTNetwork(const MQTTNetwork &);
+	MQTTNetwork &operator=(const MQTTNetwork &);
+
+	bool enqueue(MQTTOutbound *item);
+	void wake(int fd, std::atomic<bool> &flag);
+	void drainOutbound();
+	void service(MQTTBrokerLink *link, short revents, uint64_t now);
+	bool openSession(MQTTBrokerLink *link, uint64_t now);
+	void closeSession(MQTTBrokerLink *link);
+	void sendPending(MQTTBrokerLink *link);
+	void deliver(MQTTInbound *msg);
+	void flushInbound();
+
+	static const size_t queue_size = 4096;
+	boost::lockfree::spsc_queue<MQTTOutbound*, boost::lockfree::capacity<queue_size> > outbound;
+	boost::lockfree::spsc_queue<MQTTInbound*, boost::lockfree::capacity<queue_size> > inbound;
+
+	// model thread: requests that did not fit on the outbound queue and the
+	// position of the publish for each topic among them
+	std::list<MQTTOutbound*> overflow;
+	std::map<std::pair<MQTTBrokerLink*, std::string>, std::list<MQTTOutbound*>::iterator> overflow_index;
+	// network thread: received messages that did not fit on the inbound queue
+	std::map<std::pair<MQTTBrokerLink*, std::string>, MQTTInbound*> backlog;
+
+	int outbound_fd;
+	int inbound_fd;
+	std::atomic<bool> outbound_signalled;
+	std::atomic<bool> inbound_signalled;
+	std::atomic<bool> done;
+
+	boost::mutex links_mutex;
+	std::list<MQTTBrokerLink*> links;
+	boost::thread *thread;
+
+	static MQTTNetwork *instance_;
+};
+
+#endif
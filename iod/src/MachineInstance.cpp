@@ -66,6 +66,9 @@
 #include "CounterRateInstance.h"
 #include "RateEstimatorInstance.h"
 #include "AbortAction.h"
+#include "LatencyHistogram.h"
+#include "Profiler.h"
+#include "ListAggregates.h"
 
 extern int num_errors;
 extern std::list<std::string>error_messages;
@@ -124,7 +127,12 @@ std::list<MachineInstance*> MachineInstance::active_machines;
 std::list<MachineInstance*> MachineInstance::shadow_machines;
 std::set<MachineInstance*> MachineInstance::plugin_machines;
 std::list<Package*> MachineInstance::pending_events;
-std::set<MachineInstance*> MachineInstance::pending_state_change;
+WorkQueue MachineInstance::pending_state_change(&MachineInstance::state_check_node);
+WorkQueue MachineInstance::change_journal(&MachineInstance::journal_node);
+bool MachineInstance::journal_changes = false;
+uint64_t MachineInstance::journaled_writes = 0;
+uint64_t MachineInstance::absorbed_writes = 0;
+uint64_t MachineInstance::change_sequence = 0;
 std::map<std::string, HardwareAddress> MachineInstance::hw_names;
 
 
@@ -170,7 +178,7 @@ void MachineInstance::setNeedsCheck() {
 	}
 	else if (getStateMachine()->allow_auto_states) {
 		DBG_M_MESSAGING << _name << " queued for stable state checks\n";
-		pending_state_change.insert(this);
+		pending_state_change.push(this);
 		ProcessingThread::activate(this);
 	}
 	else {
@@ -598,6 +606,8 @@ MachineInstance::MachineInstance(InstanceType instance_type)
 	is_active(false),
 	current_value_holder(0),
 	last_state_evaluation_time(0),
+	last_change(0),
+	list_aggregates(0),
 	stable_states_stats("StableState processing"),
 	message_handling_stats("Message handling"),
 	data(0),
@@ -643,6 +653,8 @@ MachineInstance::MachineInstance(CStringHolder name, const char * type, Instance
 	is_active(false),
 	current_value_holder(0),
 	last_state_evaluation_time(0),
+	last_change(0),
+	list_aggregates(0),
 	stable_states_stats("StableState processing"),
 	message_handling_stats("Message handling"),
 	data(0),
@@ -670,7 +682,14 @@ MachineInstance::~MachineInstance() {
 	all_machines.remove(this);
 	automatic_machines.remove(this);
 	active_machines.remove(this);
+	pending_state_change.remove(this);
+	change_journal.remove(this);
+	SharedWorkSet::instance()->remove(this);
+	if (ProcessingThread::instance()) ProcessingThread::suspend(this);
 	Dispatcher::instance()->removeReceiver(this);
+	delete list_aggregates;
+	std::set<ListAggregates*>::iterator watcher = aggregate_watchers.begin();
+	while (watcher != aggregate_watchers.end()) (*watcher++)->forget(this);
 }
 
 void MachineInstance::describe(std::ostream &out) {
@@ -901,7 +920,7 @@ void MachineInstance::resetNeedsCheck() {
 }
 
 bool MachineInstance::queuedForStableStateTest() {
-	return pending_state_change.count(this);
+	return pending_state_change.contains(this);
 }
 
 
@@ -940,6 +959,7 @@ void MachineInstance::idle() {
 		return;
 	}
 	CaptureDuration cd(message_handling_stats);
+	ProfileScope profile(Profiler::Machine, this, _name.c_str());
 
 	Action *curr = executingCommand();
 	while (curr) {
@@ -1033,7 +1053,7 @@ long total_process_calls = 0;
 uint64_t total_processing_time = 0;
 long total_aborts = 0;
 
-bool MachineInstance::processAll(std::set<MachineInstance *> &to_process, uint32_t max_time, PollType which) {
+bool MachineInstance::processAll(std::vector<MachineInstance *> &to_process, uint32_t max_time, PollType which) {
 
 	uint64_t start_processing = nowMicrosecs();
 	rate_calc_process_time = start_processing;
@@ -1058,9 +1078,9 @@ bool MachineInstance::processAll(std::set<MachineInstance *> &to_process, uint32
 		//std::set<MachineInstance*>::iterator busy_it = SharedWorkSet::instance()->begin();
 		//while (busy_it != SharedWorkSet::instance()->end() ) {
 
-		std::set<MachineInstance*>::iterator busy_it = to_process.begin();
+		std::vector<MachineInstance*>::iterator busy_it = to_process.begin();
 		while (busy_it != to_process.end() ) {
-			MachineInstance *mi = *busy_it;
+			MachineInstance *mi = *busy_it++;
 			// is it possible for a non active machine to be executing a command?
 			if (mi->isActive() || mi->executingCommand() || !mi->mail_queue.empty()) {
 				mi->idle();
@@ -1074,21 +1094,15 @@ bool MachineInstance::processAll(std::set<MachineInstance *> &to_process, uint32
 			{
 					if (!mi->has_work && !mi->executingCommand())  {
 						SharedWorkSet::instance()->remove(mi);
-						busy_it = to_process.erase(busy_it);
 						if (mi->is_active) {
-							pending_state_change.insert(mi);
+							pending_state_change.push(mi);
 							ProcessingThread::activate(mi);
 						}
 					}
-					else
-						busy_it++;
 			}
 			else if (mi->executingCommand() && !mi->executingCommand()->getTrigger()) {
-				Action *a = mi->executingCommand();
 				ProcessingThread::activate(mi);
-				busy_it++;
 			}
-			else busy_it++;
 		}
 	}
 
@@ -1137,18 +1151,23 @@ void MachineInstance::checkPluginStates() {
 }
 
 // Warning: max_time is ignored in this method
-bool MachineInstance::checkStableStates(std::set<MachineInstance *> &to_process, uint32_t max_time) {
+bool MachineInstance::checkStableStates(std::vector<MachineInstance *> &to_process, uint32_t max_time) {
+	static LatencyHistogram *evaluation_time = new LatencyHistogram("machine_evaluation",
+		"Time taken to evaluate the stable states of a machine (with --stats)");
+	bool timing = keep_statistics();
 	total_machines_needing_check = 0;
-	std::set<MachineInstance *>::iterator iter = to_process.begin();
+	std::vector<MachineInstance *>::iterator iter = to_process.begin();
 	while (iter != to_process.end() ) {
 		MachineInstance *mi = *iter++;
 		if (!mi->executingCommand() && mi->mail_queue.empty()) {
+			uint64_t start = (timing) ? microsecs() : 0;
 			// unless the machine is disabled leave the state check on the queue until it is stable
-			if (!mi->enabled() || !mi->getStateMachine()->allow_auto_states || !mi->setStableState()) pending_state_change.erase(mi);
+			if (!mi->enabled() || !mi->getStateMachine()->allow_auto_states || !mi->setStableState()) pending_state_change.remove(mi);
+			if (timing) evaluation_time->record(microsecs() - start);
 		}
 		else if (mi->enabled()) {
 			SharedWorkSet::instance()->add(mi);
-			pending_state_change.erase(mi); // this machine has other work, it should no longer be on the pending state change queue
+			pending_state_change.remove(mi); // this machine has other work, it should no longer be on the pending state change queue
 			ProcessingThread::activate(mi);
 		}
 	}
@@ -1219,18 +1238,26 @@ void MachineInstance::addParameter(const Parameter &p, MachineInstance *mi, int
 
 	//std::cout << _name << " " << ((mi) ?  mi->getName() : "") << " " << position << " " << before << "\n";
 
+	size_t idx;
 	if (position < 0) {
-		if (!before) parameters.push_back(p);
-		else
+		if (!before) { idx = parameters.size(); parameters.push_back(p); }
+		else {
+			idx = parameters.size()-1;
 			parameters.insert(parameters.begin()+(parameters.size()-1), p);
+		}
 	}
 	else {
 		if (!before) position++;
-		if ((unsigned int)position < parameters.size())
+		if ((unsigned int)position < parameters.size()) {
+			idx = position;
 			parameters.insert(parameters.begin()+position, p);
-		else
+		}
+		else {
+			idx = parameters.size();
 			parameters.push_back(p);
+		}
 	}
+	if (list_aggregates) list_aggregates->added(parameters[idx]);
 
 	if (mi) {
 		addDependancy(mi);
@@ -1273,6 +1300,7 @@ void MachineInstance::removeParameter(int which) {
 		removeDependancy(m);
 		stopListening(m);
 	}
+	if (list_aggregates) list_aggregates->removed(parameters[which]);
 	parameters.erase(parameters.begin()+which);
 	if (_type == "LIST") {
 		if (parameters.size() == 0 && current_state.getName() != "empty")
@@ -1704,6 +1732,8 @@ Action::Status MachineInstance::setState(const State &new_state, uint64_t author
 		std::string last = current_state.getName();
 		current_state = new_state;
 		current_state_val = new_state.getName();
+		recordChange();
+		notifyAggregates();
 
 		// call the internal enter function for the machine if available
 		if (machine_class_state) machine_class_state->enter(0);
@@ -2188,6 +2218,7 @@ Action::Status MachineInstance::execute(const Message&m, Transmitter *from, Acti
 	}
 
 	setNeedsCheck();
+	ProfileScope profile(Profiler::Machine, this, _name.c_str());
 
 	std::string event_name(m.getText());
 	if (from && event_name.find('.') == std::string::npos)
@@ -2501,6 +2532,17 @@ void MachineInstance::resume() {
 	}
 }
 
+ListAggregates *MachineInstance::listAggregates() {
+	if (!list_aggregates) list_aggregates = new ListAggregates(this);
+	return list_aggregates;
+}
+
+void MachineInstance::notifyAggregates() {
+	if (aggregate_watchers.empty()) return;
+	std::set<ListAggregates*>::iterator iter = aggregate_watchers.begin();
+	while (iter != aggregate_watchers.end()) (*iter++)->memberChanged(this);
+}
+
 void fixListState(MachineInstance &list) {
 	const State *s = 0;
 	if (list.parameters.empty())
@@ -2588,6 +2630,7 @@ void MachineInstance::enable() {
 	}
 	is_enabled = true;
 	error_state = 0;
+	recordChange();
 	clearAllActions();
 	if (io_interface) {
 		io_interface->setupProperties(this);
@@ -2653,6 +2696,7 @@ void MachineInstance::disable() {
 	}
 	if (isShadow()) setInitialState();
 	is_enabled = false;
+	recordChange();
 
 	const Value &val = properties.lookup("default");
 	if (val != SymbolTable::Null) {
@@ -2761,6 +2805,7 @@ bool MachineInstance::setStableState() {
 	ProcessingThread::suspend(this); // assume this machine will not have anything else to do after checking states
 
 	CaptureDuration cd(stable_states_stats);
+	ProfileScope profile(Profiler::Machine, this, _name.c_str());
 	DBG_M_AUTOSTATES << _name << " checking stable states (currently " << current_state.getName()  <<")\n";
 	if (!state_machine || !state_machine->allow_auto_states) {
 		//DBG_M_AUTOSTATES << _name << " aborting stable states check due to configuration\n";
@@ -2816,7 +2861,11 @@ bool MachineInstance::setStableState() {
 			//		if ( (s.trigger && s.trigger->enabled() && s.trigger->fired() && s.condition(this) )
 			//			|| (!s.trigger && s.condition(this)) ) {
 			if (!found_match) {
-				bool ss_condition_true = s.condition(this);
+				bool ss_condition_true;
+				{
+					ProfileScope condition_profile(Profiler::StableState, &s, s.state_name.c_str());
+					ss_condition_true = s.condition(this);
+				}
 				if (ss_condition_true) {
 					DBG_M_PREDICATES << _name << "." << s.state_name <<" condition " << *s.condition.predicate << " returned true\n";
 					active_state = &s;
@@ -3590,30 +3639,79 @@ bool MachineInstance::hasState(const std::string &state_name) const {
 
 // change batching
 bool MachineInstance::changing() {
-	return is_changing;
+	return journal_node.queued;
 }
 
 bool MachineInstance::prepare() {
-	is_changing = true;
-	return is_changing;
+	change_journal.push(this);
+	return true;
 }
 
 void MachineInstance::commit() {
-	setNeedsCheck();
-	notifyDependents();
-	std::map<std::string, Value>::iterator iter = changes.begin();
-	while (iter != changes.end()) {
-		setValue((*iter).first, (*iter).second);
-		iter = changes.erase(iter);
+	change_journal.remove(this);
+	// the fan-out may cause further changes to this machine; these
+	// are journaled again rather than disturbing the iteration
+	std::map<std::string, PendingChange> pending;
+	pending.swap(changes);
+	std::map<std::string, PendingChange>::iterator iter = pending.begin();
+	while (iter != pending.end()) {
+		const std::string &property = (*iter).first;
+		Value property_val(property);
+		propertyChanged(property, property_val, (*iter).second.value, (*iter).second.authority);
+		++iter;
 	}
-	is_changing = false;
 }
 
 void MachineInstance::discard() {
+	change_journal.remove(this);
 	changes.clear();
-	is_changing = false;
 }
 
+void MachineInstance::commitChanges() {
+	MachineInstance *m = change_journal.pop();
+	while (m) {
+		m->commit();
+		m = change_journal.pop();
+	}
+}
+
+void MachineInstance::journalChange(const std::string &property, const Value &new_value, uint64_t authority) {
+	++journaled_writes;
+	std::pair<std::map<std::string, PendingChange>::iterator, bool> res
+		= changes.insert(std::make_pair(property, PendingChange(new_value, authority)));
+	if (!res.second) {
+		// an earlier write this cycle has not been announced yet; it is superseded
+		++absorbed_writes;
+		(*res.first).second.value = new_value;
+		(*res.first).second.authority = authority;
+	}
+	prepare();
+}
+
+// notify channels, modbus and dependent machines that a property has changed
+void MachineInstance::propertyChanged(const std::string &property, const Value &property_val,
+		const Value &new_value, uint64_t authority) {
+	if (published) {
+		Channel::sendPropertyChange(this, property.c_str(), new_value, authority);
+
+		// update modbus with the new value
+		std::string property_name(modbusName(property, property_val));
+		if (modbus_exports.count(property_name)){
+			Channel::sendModbusUpdate(this, property_name, new_value);
+		}
+	}
+	{
+		Message changed_msg("PROPERTY_CHANGE");
+		if (receives_functions.count(changed_msg) && !hasPending(changed_msg))
+			enqueue(Package(this, this, changed_msg));
+	}
+	// only tell dependent machines to recheck predicates if the property
+	// actually changes value
+	if (property_val.token_id != ClockworkToken::TRACE && property_val.token_id != ClockworkToken::DEBUG) {
+		setNeedsCheck();
+		notifyDependents();
+	}
+}
 
 void MachineInstance::sendModbusUpdate(const std::string &property_name, const Value &new_value) {
 if (false){FileLogger fl(program_name);
@@ -3796,6 +3894,7 @@ bool MachineInstance::setValue(const std::string &property, const Value &new_val
 			if (was_changed) properties.add(property, new_value, SymbolTable::ST_REPLACE);
 		}
 		if (!was_changed) return true; // value was ok but was already the same
+		recordChange();
 #ifndef EC_SIMULATOR
 #ifdef USE_SDO
 		if ( property_val.token_id == ClockworkToken::tokVALUE && _type == "SDOENTRY") {
@@ -3836,26 +3935,11 @@ bool MachineInstance::setValue(const std::string &property, const Value &new_val
 			mq_interface->publish(properties.lookup("topic").asString(), new_value.asString(), this);
 		}
 
-		std::string property_name(modbusName(property, property_val));
-		if (published) {
-			Channel::sendPropertyChange(this, property.c_str(), new_value, authority);
-
-			// update modbus with the new value
-			if (modbus_exports.count(property_name)){
-				Channel::sendModbusUpdate(this, property_name, new_value);
-			}
-		}
-		{
-			Message changed_msg("PROPERTY_CHANGE");
-			if (receives_functions.count(changed_msg) && !hasPending(changed_msg))
-				enqueue(Package(this, this, changed_msg));
-		}
-		// only tell dependent machines to recheck predicates if the property
-		// actually changes value
-		if (property_val.token_id != ClockworkToken::TRACE && property_val.token_id != ClockworkToken::DEBUG) {
-			setNeedsCheck();
-			notifyDependents();
-		}
+		notifyAggregates();
+		if (journal_changes)
+			journalChange(property, new_value, authority);
+		else
+			propertyChanged(property, property_val, new_value, authority);
 		return true;
 	}
 }
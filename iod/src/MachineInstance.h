@@ -47,6 +47,7 @@
 #include "Parameter.h"
 #include "MachineClass.h"
 #include "ActionList.h"
+#include "WorkQueue.h"
 
 extern SymbolTable globals;
 
@@ -55,6 +56,7 @@ class MachineClass;
 struct MoveStateAction;
 class IOComponent;
 class MQTTModule;
+class ListAggregates;
 struct cJSON;
 class Channel;
 
@@ -181,10 +183,10 @@ public:
 	void resetNeedsCheck();
 	void resetTemporaryStringStream();
 
-  static bool processAll(std::set<MachineInstance *> &to_process, uint32_t max_time, PollType which);
+  static bool processAll(std::vector<MachineInstance *> &to_process, uint32_t max_time, PollType which);
 	//static void updateAllTimers(PollType which);
 	//void updateTimer(long dt);
-	static bool checkStableStates(std::set<MachineInstance *> &to_process, uint32_t max_time);
+	static bool checkStableStates(std::vector<MachineInstance *> &to_process, uint32_t max_time);
 	static void checkPluginStates();
 	static size_t countAutomaticMachines() { return automatic_machines.size(); }
 	static void displayAutomaticMachines();
@@ -193,6 +195,13 @@ public:
 	static MachineInstance *find(const char *name);
 	static std::list<MachineInstance*>::iterator begin() { return all_machines.begin(); }
 	static std::list<MachineInstance*>::iterator end()  { return all_machines.end(); }
+	static size_t machineCount() { return all_machines.size(); }
+
+	// links for the work queues this machine can be placed on
+	WorkQueueNode runnable_node; // ProcessingThread runnable machines
+	WorkQueueNode state_check_node; // pending_state_change
+	WorkQueueNode busy_node; // SharedWorkSet
+	WorkQueueNode journal_node; // change_journal
 
 	static std::list<MachineInstance*>::iterator io_modules_begin() { return io_modules.begin(); }
 	static std::list<MachineInstance*>::iterator io_modules_end()  { return io_modules.end(); }
@@ -229,11 +238,20 @@ public:
 	bool unlock(MachineInstance *requester) { if (locked != requester) return false; else { locked = 0; return true; } }
   MachineInstance *locker() const { return locked; }
 
-	// change batching
+	// change batching. While journalling is enabled, setValue stores the new
+	// value immediately but defers the fan-out (channels, modbus, PROPERTY_CHANGE
+	// and dependent checks) until commit(), so that a property written several
+	// times during a processing cycle is only announced once, with its final value.
 	bool changing();
 	bool prepare();
 	void commit();
 	void discard();
+	static void setChangeJournalling(bool which) { journal_changes = which; }
+	static bool changeJournalling() { return journal_changes; }
+	static void commitChanges(); // commit every machine with journaled changes
+	static size_t pendingChanges() { return change_journal.size(); }
+	static uint64_t journaledWrites() { return journaled_writes; }
+	static uint64_t absorbedWrites() { return absorbed_writes; }
 
 	// basic modbus interface
 	void sendModbusUpdate(const std::string &property_name, const Value &new_value);
@@ -284,8 +302,23 @@ public:
   uint64_t lastStateEvaluationTime() { return last_state_evaluation_time; }
   void updateLastEvaluationTime();
 
+  // every state or property change is given a sequence number so that clients can
+  // ask for the machines that have changed since a previous request
+  static uint64_t changeSequence() { return change_sequence; }
+  uint64_t lastChange() const { return last_change; }
+  void recordChange() { last_change = ++change_sequence; }
+
 	bool queuedForStableStateTest();
 
+  // state counts and property totals of a LIST, created the first time an aggregate is evaluated
+  ListAggregates *listAggregates();
+  ListAggregates *existingListAggregates() { return list_aggregates; }
+  // lists with aggregates that include this machine
+  void watchAggregates(ListAggregates *agg) { aggregate_watchers.insert(agg); }
+  void ignoreAggregates(ListAggregates *agg) { aggregate_watchers.erase(agg); }
+  // update the aggregates of lists that include this machine after a state or property change
+  void notifyAggregates();
+
   virtual long filter(long val) { return val; }
 
   void publish();
@@ -326,6 +359,10 @@ protected:
   Value current_value_holder;
   std::stringstream ss; // saves recreating string stream for temporary use
   uint64_t last_state_evaluation_time; // dynamic value check against this before recalculating
+  uint64_t last_change; // change sequence number of the most recent change to this machine
+  static uint64_t change_sequence;
+  ListAggregates *list_aggregates;
+  std::set<ListAggregates*> aggregate_watchers;
 public:
 	Statistic stable_states_stats;
 	Statistic message_handling_stats;
@@ -339,7 +376,6 @@ public:
 	static SharedCache *shared;
 	Cache *cache;
 	unsigned int action_errors;
-	bool is_changing;
 	Channel* owner_channel;
 
 private:
@@ -351,7 +387,7 @@ protected:
   static std::list<MachineInstance*> automatic_machines; // machines with auto state changes enabled
   static std::list<MachineInstance*> active_machines; // machines that require idle() processing
   static std::list<MachineInstance*> shadow_machines; // machines that shadow remote machines
-  static std::set<MachineInstance*> pending_state_change; // machines that need to check their stable states
+  static WorkQueue pending_state_change; // machines that need to check their stable states
   static std::set<MachineInstance*> plugin_machines; // machines that have plugins
   static std::list<MachineInstance*> io_modules; // machines of type MODULE
   static std::list<Package*> pending_events; // machines that shadow remote machines
@@ -359,7 +395,20 @@ protected:
   static unsigned int total_machines_needing_check;
   uint64_t expected_authority;
 
-  std::map<std::string, Value> changes;
+  struct PendingChange {
+    Value value;
+    uint64_t authority;
+    PendingChange() : authority(0) { }
+    PendingChange(const Value &v, uint64_t auth) : value(v), authority(auth) { }
+  };
+  std::map<std::string, PendingChange> changes; // properties awaiting fan-out
+  void journalChange(const std::string &property, const Value &new_value, uint64_t authority);
+  void propertyChanged(const std::string &property, const Value &property_val,
+      const Value &new_value, uint64_t authority);
+  static WorkQueue change_journal; // machines with journaled property changes
+  static bool journal_changes;
+  static uint64_t journaled_writes;
+  static uint64_t absorbed_writes; // writes superseded before their fan-out
 
   friend struct SetStateAction;
   friend struct MoveStateAction;
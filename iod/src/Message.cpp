@@ -23,6 +23,7 @@
 #include <iostream>
 #include <list>
 #include "Message.h"
+#include "ObjectPool.h"
 #include <boost/thread.hpp>
 #include <boost/thread/condition.hpp>
 #include <boost/thread/mutex.hpp>
@@ -67,6 +68,32 @@ Message &Message::operator=(const Message &other){
     return *this;
 }
 
+static ObjectPool *message_pool() {
+	static ObjectPool *pool = new ObjectPool("Message");
+	return pool;
+}
+
+static ObjectPool *package_pool() {
+	static ObjectPool *pool = new ObjectPool("Package");
+	return pool;
+}
+
+void *Message::operator new(size_t size) {
+	return message_pool()->allocate(size);
+}
+
+void Message::operator delete(void *p, size_t size) {
+	message_pool()->release(p, size);
+}
+
+void *Package::operator new(size_t size) {
+	return package_pool()->allocate(size);
+}
+
+void Package::operator delete(void *p, size_t size) {
+	package_pool()->release(p, size);
+}
+
 Message::~Message() {
     if (params) {
         params->clear();
@@ -112,7 +139,8 @@ Package::Package(const Package &other)
 	:transmitter(other.transmitter), 
 	receiver(other.receiver), 
 	message(new Message(other.message)),
-	needs_receipt(other.needs_receipt) {	
+	needs_receipt(other.needs_receipt),
+	queued_at(other.queued_at) {	
 }
 
 Package::~Package() {
@@ -124,6 +152,7 @@ Package &Package::operator=(const Package &other) {
 	receiver = other.receiver;
 	message = new Message(other.message);
 	needs_receipt = other.needs_receipt;
+	queued_at = other.queued_at;
 	return *this;
 }
 
@@ -69,7 +69,7 @@ public:
     bool operator==(const char *msg) const;
     bool operator<(const Message &other) const { return text < other.text; }
     bool operator>(const Message &other) const { return text > other.text; }
-    const std::string getText() const { return text; }
+    const std::string &getText() const { return text; }
     const std::list<Value> *getParams() const { return params; }
 
 	bool isEnter() const { return kind == ENTERMSG; }
@@ -79,6 +79,10 @@ public:
 	bool isDisable() const { return kind == DISABLEMSG; }
 
     static std::list<Value> *makeParams(Value p1, Value p2 = SymbolTable::Null, Value p3 = SymbolTable::Null, Value p4 = SymbolTable::Null);
+
+	// messages and packages are allocated from pools (see ObjectPool.h)
+	static void *operator new(size_t size);
+	static void operator delete(void *p, size_t size);
 private:
 	static unsigned long sequence;
 	MessageType kind;
@@ -116,14 +120,17 @@ struct Package {
     Receiver *receiver;
     Message *message;
 	bool needs_receipt;
+	uint64_t queued_at; // when the package was given to the dispatcher
     Package(Transmitter *t, Receiver *r, Message *m, bool need_receipt = false) 
-		: transmitter(t), receiver(r), message(m), needs_receipt(need_receipt) {}
+		: transmitter(t), receiver(r), message(m), needs_receipt(need_receipt), queued_at(0) {}
     Package(Transmitter *t, Receiver *r, const Message &m, bool need_receipt = false) 
-		: transmitter(t), receiver(r), message(new Message(m)), needs_receipt(need_receipt) {}
+		: transmitter(t), receiver(r), message(new Message(m)), needs_receipt(need_receipt), queued_at(0) {}
 	Package(const Package &);
     ~Package();
 	Package &operator=(const Package &);
 	std::ostream &operator<<(std::ostream &out) const;
+	static void *operator new(size_t size);
+	static void operator delete(void *p, size_t size);
 };
 std::ostream &operator<<(std::ostream &out, const Package &package);
 
@@ -20,6 +20,7 @@
 
 #include <string>
 #include <string.h>
+#include <strings.h>
 #include "cJSON.h"
 #include "MessageEncoding.h"
 #include "value.h"
@@ -122,7 +123,7 @@ void MessageEncoding::addValueToJSONArray(cJSON *obj, const Value &val) {
     }
 }
 
-char *MessageEncoding::encodeCommand(std::string cmd, std::list<Value> *params) {
+char *MessageEncoding::encodeCommandWithCJSON(std::string cmd, std::list<Value> *params) {
     cJSON *msg = cJSON_CreateObject();
     cJSON_AddStringToObject(msg, "command", cmd.c_str());
     cJSON *cjParams = cJSON_CreateArray();
@@ -142,13 +143,128 @@ char *MessageEncoding::encodeCommand(std::string cmd, std::list<Value> *params)
     return res;
 }
 
+static void writeString(std::string &out, const char *str) {
+	out += '"';
+	const char *run = str;
+	for ( ; *str; ++str) {
+		unsigned char c = *str;
+		if (c > 31 && c != '"' && c != '\\') continue;
+		out.append(run, str - run);
+		run = str + 1;
+		switch (c) {
+			case '\\': out += "\\\\"; break;
+			case '"': out += "\\\""; break;
+			case '\b': out += "\\b"; break;
+			case '\f': out += "\\f"; break;
+			case '\n': out += "\\n"; break;
+			case '\r': out += "\\r"; break;
+			case '\t': out += "\\t"; break;
+			default: break; // other control characters are dropped, as cJSON does
+		}
+	}
+	out.append(run, str - run);
+	out += '"';
+}
+
+static void writeInteger(std::string &out, long val) {
+	char buf[24];
+	char *p = buf + sizeof(buf);
+	unsigned long u = (val < 0) ? 0UL - (unsigned long)val : (unsigned long)val;
+	do { *--p = '0' + u % 10; u /= 10; } while (u);
+	if (val < 0) *--p = '-';
+	out.append(p, buf + sizeof(buf) - p);
+}
+
+static void writeDouble(std::string &out, double d) {
+	char buf[64];
+	int n;
+	if (d != 0.0 && (fabs(d)<1.0e-6 || fabs(d)>1.0e9)) n = snprintf(buf, sizeof(buf), "%1.20e", d);
+	else n = snprintf(buf, sizeof(buf), "%lf", d);
+	out.append(buf, n);
+}
+
+// writes the value the way cJSON prints it, returns false for kinds that have no JSON form
+static bool writeValue(std::string &out, const Value &val) {
+	switch (val.kind) {
+		case Value::t_symbol:
+		case Value::t_string:
+			writeString(out, val.sValue.c_str());
+			return true;
+		case Value::t_integer:
+			writeInteger(out, val.iValue);
+			return true;
+		case Value::t_float:
+			writeDouble(out, val.fValue);
+			return true;
+		case Value::t_bool:
+			out += (val.bValue) ? "true" : "false";
+			return true;
+#ifdef DYNAMIC_VALUES
+		case Value::t_dynamic: {
+			DynamicValue *dv = val.dynamicValue();
+			if (dv) {
+				Value v = dv->operator()();
+				return writeValue(out, v);
+			}
+			out += "null";
+			return true;
+		}
+#endif
+		default:
+			break;
+	}
+	return false;
+}
+
+static void writeParam(std::string &out, const Value &val, bool &first) {
+	if (val == SymbolTable::Null) return;
+	if (!first) out += ',';
+	first = false;
+	out += "{\"type\":";
+	writeString(out, MessageEncoding::valueType(val).c_str());
+	size_t mark = out.length();
+	out += ",\"value\":";
+	if (!writeValue(out, val)) out.resize(mark);
+	out += '}';
+}
+
+static char *copyMessage(const std::string &msg) {
+	char *res = (char *)malloc(msg.length() + 1);
+	memcpy(res, msg.c_str(), msg.length() + 1);
+	return res;
+}
+
+void MessageEncoding::writeCommand(std::string &out, const std::string &cmd, const std::list<Value> *params) {
+	out += "{\"command\":";
+	writeString(out, cmd.c_str());
+	out += ",\"params\":[";
+	bool first = true;
+	if (params)
+		for (std::list<Value>::const_iterator iter = params->begin(); iter != params->end(); ++iter)
+			writeParam(out, *iter, first);
+	out += "]}";
+}
+
+char *MessageEncoding::encodeCommand(std::string cmd, std::list<Value> *params) {
+	std::string msg;
+	msg.reserve(128);
+	writeCommand(msg, cmd, params);
+	return copyMessage(msg);
+}
+
 char *MessageEncoding::encodeCommand(std::string cmd, Value p1, Value p2, Value p3, Value p4) {
-    std::list<Value>params;
-	if (p1 != SymbolTable::Null) params.push_back(p1);
-    if (p2 != SymbolTable::Null) params.push_back(p2);
-    if (p3 != SymbolTable::Null) params.push_back(p3);
-	if (p4 != SymbolTable::Null) params.push_back(p4);
-    return encodeCommand(cmd, &params);
+	std::string msg;
+	msg.reserve(128);
+	msg += "{\"command\":";
+	writeString(msg, cmd.c_str());
+	msg += ",\"params\":[";
+	bool first = true;
+	writeParam(msg, p1, first);
+	writeParam(msg, p2, first);
+	writeParam(msg, p3, first);
+	writeParam(msg, p4, first);
+	msg += "]}";
+	return copyMessage(msg);
 }
 
 char *MessageEncoding::encodeState(const std::string &machine, const std::string &state, uint64_t authority) {
@@ -233,7 +349,7 @@ Value MessageEncoding::valueFromJSONObject(cJSON *obj, cJSON *cjType) {
     return res;
 }
 
-bool MessageEncoding::getCommand(const char *msg, std::string &cmd, std::vector<Value> **params)
+static bool getCommandVectorWithCJSON(const char *msg, std::string &cmd, std::vector<Value> **params)
 {
     cJSON *obj = cJSON_Parse(msg);
     if (!obj) return false;
@@ -249,7 +365,7 @@ bool MessageEncoding::getCommand(const char *msg, std::string &cmd, std::vector<
                 *params = new std::vector<Value>;
                 for (int i=0; i<num_params; ++i) {
                     cJSON *item = cJSON_GetArrayItem(cjParams, i);
-                    Value item_val = valueFromJSONObject(item, 0);
+                    Value item_val = MessageEncoding::valueFromJSONObject(item, 0);
                     (*params)->push_back(item_val);
                 }
             }
@@ -265,7 +381,7 @@ bool MessageEncoding::getCommand(const char *msg, std::string &cmd, std::vector<
                     cJSON *item = cJSON_GetArrayItem(cjParams, i);
                     cJSON *type = cJSON_GetObjectItem(item, "type");
                     cJSON *value = cJSON_GetObjectItem(item, "value");
-                    Value item_val = valueFromJSONObject(value, type);
+                    Value item_val = MessageEncoding::valueFromJSONObject(value, type);
                     if (item_val != SymbolTable::Null) (*params)->push_back(item_val);
                 }
             }
@@ -280,7 +396,7 @@ failed_getCommandVector:
     return false;
 }
 
-bool MessageEncoding::getCommand(const char *msg, std::string &cmd, std::list<Value> **params)
+bool MessageEncoding::getCommandWithCJSON(const char *msg, std::string &cmd, std::list<Value> **params)
 {
     cJSON *obj = cJSON_Parse(msg);
     if (!obj) return false;
@@ -296,7 +412,7 @@ bool MessageEncoding::getCommand(const char *msg, std::string &cmd, std::list<Va
                 *params = new std::list<Value>;
                 for (int i=0; i<num_params; ++i) {
                     cJSON *item = cJSON_GetArrayItem(cjParams, i);
-                    Value item_val = valueFromJSONObject(item, 0);
+                    Value item_val = MessageEncoding::valueFromJSONObject(item, 0);
                     if (item_val != SymbolTable::Null) (*params)->push_back(item_val);
                 }
             }
@@ -312,7 +428,7 @@ bool MessageEncoding::getCommand(const char *msg, std::string &cmd, std::list<Va
                     cJSON *item = cJSON_GetArrayItem(cjParams, i);
                     cJSON *type = cJSON_GetObjectItem(item, "type");
                     cJSON *value = cJSON_GetObjectItem(item, "value");
-                    Value item_val = valueFromJSONObject(value, type);
+                    Value item_val = MessageEncoding::valueFromJSONObject(value, type);
                     if (item_val != SymbolTable::Null) (*params)->push_back(item_val);
                 }
             }
@@ -327,7 +443,7 @@ failed_getCommand:
     return false;
 }
 
-bool MessageEncoding::getState(const char *msg, std::string &cmd, std::list<Value> **params)
+static bool getStateWithCJSON(const char *msg, std::string &cmd, std::list<Value> **params)
 {
     cJSON *obj = cJSON_Parse(msg);
     if (!obj) return false;
@@ -342,7 +458,7 @@ bool MessageEncoding::getState(const char *msg, std::string &cmd, std::list<Valu
             *params = new std::list<Value>;
             for (int i=0; i<num_params; ++i) {
                 cJSON *item = cJSON_GetArrayItem(cjParams, i);
-                Value item_val = valueFromJSONObject(item, 0);
+                Value item_val = MessageEncoding::valueFromJSONObject(item, 0);
                 if (item_val != SymbolTable::Null) (*params)->push_back(item_val);
             }
         }
@@ -356,3 +472,325 @@ failed_getCommand:
     return false;
 }
 
+
+/*
+	CommandReader walks a message in place, accepting what cJSON_Parse accepts,
+	and only creates Values for the command parameters. Messages it cannot decode
+	exactly the way cJSON would (\u escapes, control characters in strings, params
+	given as an object) are left for the cJSON parser.
+*/
+class CommandReader {
+public:
+	enum Result { Failed, Done, UseCJSON };
+	CommandReader(bool state, bool keep) : num_items(0), state_params(state), keep_nulls(keep), fallback(false) {}
+	Result read(const char *msg, std::string &cmd, std::vector<Value> &out);
+	int num_items;
+
+private:
+	bool state_params;
+	bool keep_nulls;
+	bool fallback;
+	std::string command;
+	std::string text;
+
+	Result failed() const { return (fallback) ? UseCJSON : Failed; }
+	static const char *skip(const char *s) { while (*s && (unsigned char)*s <= 32) ++s; return s; }
+	const char *string(const char *s, std::string *out);
+	const char *name(const char *s, const char *name1, const char *name2, int &which);
+	const char *number(const char *s, std::vector<Value> *out);
+	const char *value(const char *s, std::vector<Value> *out, Value::Kind string_kind, bool keep_null);
+	const char *array(const char *s);
+	const char *object(const char *s);
+	const char *param(const char *s, std::vector<Value> &out);
+	const char *params(const char *s, std::vector<Value> &out);
+};
+
+const char *CommandReader::string(const char *s, std::string *out) {
+	if (*s != '"') return 0;
+	if (out) out->clear();
+	const char *run = ++s;
+	while (*s != '"') {
+		unsigned char c = *s;
+		if (c <= 31) { fallback = true; return 0; }
+		if (c != '\\') { ++s; continue; }
+		if (out) out->append(run, s - run);
+		char e = *++s;
+		switch (e) {
+			case 'b': e = '\b'; break;
+			case 'f': e = '\f'; break;
+			case 'n': e = '\n'; break;
+			case 'r': e = '\r'; break;
+			case 't': e = '\t'; break;
+			case 'u': fallback = true; return 0;
+			default:
+				if ((unsigned char)e <= 31) { fallback = true; return 0; }
+		}
+		if (out) *out += e;
+		run = ++s;
+	}
+	if (out) out->append(run, s - run);
+	return s + 1;
+}
+
+// a member name; which is 1 or 2 if it matches name1 or name2 (ignoring case, as cJSON_GetObjectItem does)
+const char *CommandReader::name(const char *s, const char *name1, const char *name2, int &which) {
+	which = 0;
+	if (*s != '"') return 0;
+	const char *start = s + 1;
+	const char *p = start;
+	while (*p != '"' && *p != '\\' && (unsigned char)*p > 31) ++p;
+	size_t len;
+	if (*p == '"') {
+		len = p - start;
+		s = p + 1;
+	}
+	else {
+		s = string(s, &text);
+		if (!s) return 0;
+		start = text.c_str();
+		len = text.length();
+	}
+	if (len == strlen(name1) && strncasecmp(start, name1, len) == 0) which = 1;
+	else if (len == strlen(name2) && strncasecmp(start, name2, len) == 0) which = 2;
+	return s;
+}
+
+// the same arithmetic as cJSON's parse_number so that values compare equal
+const char *CommandReader::number(const char *s, std::vector<Value> *out) {
+	double sign = 1, scale = 0;
+	int subscale = 0, signsubscale = 1;
+	bool is_double = false;
+	long i = 0;
+	double d = 0;
+	if (*s == '-') sign = -1, s++;
+	if (*s == '0') s++;
+	if (*s >= '1' && *s <= '9')
+		do i = (i * 10L) + (*s++ - '0'); while (*s >= '0' && *s <= '9');
+	if (*s == '.') {
+		s++;
+		if (*s < '0' || *s > '9') { fallback = true; return 0; }
+		is_double = true;
+		d = i;
+		do d = (d * 10.0) + (*s++ - '0'), scale--; while (*s >= '0' && *s <= '9');
+	}
+	if (*s == 'e' || *s == 'E') {
+		s++;
+		if (!is_double) { is_double = true; d = i; }
+		if (*s == '+') s++; else if (*s == '-') signsubscale = -1, s++;
+		while (*s >= '0' && *s <= '9') subscale = (subscale * 10) + (*s++ - '0');
+	}
+	if (out) {
+		if (is_double) {
+			double val = sign * d * pow(10.0, (scale + subscale * signsubscale));
+			out->emplace_back(val);
+		}
+		else {
+			long val = sign * i;
+			out->emplace_back(val);
+		}
+	}
+	return s;
+}
+
+// appends the value to out; null, arrays and objects have no Value, as in valueFromJSONObject
+const char *CommandReader::value(const char *s, std::vector<Value> *out, Value::Kind string_kind, bool keep_null) {
+	if (*s == '"') {
+		s = string(s, (out) ? &text : 0);
+		if (s && out) out->emplace_back(text, string_kind);
+		return s;
+	}
+	if (*s == '-' || (*s >= '0' && *s <= '9')) return number(s, out);
+	if (!strncmp(s, "false", 5)) { if (out) out->emplace_back(false); return s + 5; }
+	if (!strncmp(s, "true", 4)) { if (out) out->emplace_back(true); return s + 4; }
+	if (out && keep_null) out->push_back(SymbolTable::Null);
+	if (!strncmp(s, "null", 4)) return s + 4;
+	if (*s == '[') return array(s);
+	if (*s == '{') return object(s);
+	return 0;
+}
+
+const char *CommandReader::array(const char *s) {
+	s = skip(s + 1);
+	if (*s == ']') return s + 1;
+	while (true) {
+		s = value(s, 0, Value::t_string, false);
+		if (!s) return 0;
+		s = skip(s);
+		if (*s != ',') break;
+		s = skip(s + 1);
+	}
+	return (*s == ']') ? s + 1 : 0;
+}
+
+const char *CommandReader::object(const char *s) {
+	s = skip(s + 1);
+	if (*s == '}') return s + 1;
+	while (true) {
+		s = string(s, 0);
+		if (!s) return 0;
+		s = skip(s);
+		if (*s != ':') return 0;
+		s = value(skip(s + 1), 0, Value::t_string, false);
+		if (!s) return 0;
+		s = skip(s);
+		if (*s != ',') break;
+		s = skip(s + 1);
+	}
+	return (*s == '}') ? s + 1 : 0;
+}
+
+// a {"type":..., "value":...} parameter; anything else has no value and is skipped
+const char *CommandReader::param(const char *s, std::vector<Value> &out) {
+	if (*s != '{') return value(s, 0, Value::t_string, false);
+	bool have_type = false;
+	bool have_value = false;
+	const char *deferred = 0;
+	Value::Kind kind = Value::t_string;
+	s = skip(s + 1);
+	if (*s == '}') return s + 1;
+	while (true) {
+		int which;
+		s = name(s, "type", "value", which);
+		if (!s) return 0;
+		s = skip(s);
+		if (*s != ':') return 0;
+		s = skip(s + 1);
+		if (which == 1 && !have_type) {
+			have_type = true;
+			if (*s != '"') { fallback = true; return 0; }
+			s = string(s, &text);
+			if (s && text != "STRING") kind = Value::t_symbol;
+		}
+		else if (which == 2 && !have_value) {
+			have_value = true;
+			if (have_type)
+				s = value(s, &out, kind, false);
+			else {
+				deferred = s; // decoded once the type is known
+				s = value(s, 0, kind, false);
+			}
+		}
+		else
+			s = value(s, 0, Value::t_string, false);
+		if (!s) return 0;
+		s = skip(s);
+		if (*s != ',') break;
+		s = skip(s + 1);
+	}
+	if (*s != '}') return 0;
+	if (deferred) value(deferred, &out, kind, false);
+	return s + 1;
+}
+
+const char *CommandReader::params(const char *s, std::vector<Value> &out) {
+	bool raw = state_params || command == "STATE";
+	s = skip(s + 1);
+	if (*s == ']') return s + 1;
+	while (true) {
+		++num_items;
+		s = (raw) ? value(s, &out, Value::t_string, keep_nulls) : param(s, out);
+		if (!s) return 0;
+		s = skip(s);
+		if (*s != ',') break;
+		s = skip(s + 1);
+	}
+	return (*s == ']') ? s + 1 : 0;
+}
+
+CommandReader::Result CommandReader::read(const char *msg, std::string &cmd, std::vector<Value> &out) {
+	const char *s = skip(msg);
+	if (*s != '{') return Failed;
+	bool have_command = false;
+	bool have_params = false;
+	bool command_is_string = false;
+	const char *deferred = 0; // params that arrived before the command
+	s = skip(s + 1);
+	if (*s != '}') {
+		while (true) {
+			int which;
+			s = name(s, "command", "params", which);
+			if (!s) return failed();
+			s = skip(s);
+			if (*s != ':') return Failed;
+			s = skip(s + 1);
+			if (which == 1 && !have_command) {
+				have_command = true;
+				command_is_string = *s == '"';
+				s = (command_is_string) ? string(s, &command) : value(s, 0, Value::t_string, false);
+			}
+			else if (which == 2 && !have_params) {
+				have_params = true;
+				if (*s == '{') return UseCJSON;
+				if (*s == '[' && command_is_string)
+					s = params(s, out);
+				else {
+					if (*s == '[') deferred = s;
+					s = value(s, 0, Value::t_string, false);
+				}
+			}
+			else
+				s = value(s, 0, Value::t_string, false);
+			if (!s) return failed();
+			s = skip(s);
+			if (*s != ',') break;
+			s = skip(s + 1);
+		}
+		if (*s != '}') return Failed;
+	}
+	if (!command_is_string) return Failed;
+	if (deferred && !params(deferred, out)) return failed();
+	cmd = command;
+	return Done;
+}
+
+bool MessageEncoding::readCommand(const char *msg, std::string &cmd, std::vector<Value> &params) {
+	size_t mark = params.size();
+	CommandReader reader(false, false);
+	CommandReader::Result result = reader.read(msg, cmd, params);
+	if (result == CommandReader::Done) return true;
+	params.erase(params.begin() + mark, params.end());
+	if (result == CommandReader::Failed) return false;
+	std::list<Value> *param_list = 0;
+	if (!getCommandWithCJSON(msg, cmd, &param_list)) return false;
+	if (param_list) {
+		params.insert(params.end(), param_list->begin(), param_list->end());
+		delete param_list;
+	}
+	return true;
+}
+
+bool MessageEncoding::getCommand(const char *msg, std::string &cmd, std::list<Value> **params) {
+	std::vector<Value> values;
+	CommandReader reader(false, false);
+	switch (reader.read(msg, cmd, values)) {
+		case CommandReader::Done: break;
+		case CommandReader::Failed: return false;
+		case CommandReader::UseCJSON: return getCommandWithCJSON(msg, cmd, params);
+	}
+	*params = (reader.num_items) ? new std::list<Value>(values.begin(), values.end()) : NULL;
+	return true;
+}
+
+bool MessageEncoding::getCommand(const char *msg, std::string &cmd, std::vector<Value> **params) {
+	std::vector<Value> values;
+	CommandReader reader(false, true);
+	switch (reader.read(msg, cmd, values)) {
+		case CommandReader::Done: break;
+		case CommandReader::Failed: return false;
+		case CommandReader::UseCJSON: return getCommandVectorWithCJSON(msg, cmd, params);
+	}
+	*params = (reader.num_items) ? new std::vector<Value>(values) : NULL;
+	return true;
+}
+
+bool MessageEncoding::getState(const char *msg, std::string &cmd, std::list<Value> **params) {
+	std::vector<Value> values;
+	CommandReader reader(true, false);
+	switch (reader.read(msg, cmd, values)) {
+		case CommandReader::Done: break;
+		case CommandReader::Failed: return false;
+		case CommandReader::UseCJSON: return getStateWithCJSON(msg, cmd, params);
+	}
+	*params = (reader.num_items) ? new std::list<Value>(values.begin(), values.end()) : NULL;
+	return true;
+}
@@ -42,6 +42,16 @@ struct MessageEncoding {
     static bool getCommand(const char *msg, std::string &cmd, std::vector<Value> **params);
     static bool getState(const char *msg, std::string &cmd, std::list<Value> **params);
 
+	// Direct writer and reader for the command format, producing the same text as
+	// the cJSON versions below without building a tree. writeCommand appends to out
+	// so a caller can reuse the buffer; readCommand appends the parameters to params.
+	static void writeCommand(std::string &out, const std::string &cmd, const std::list<Value> *params);
+	static bool readCommand(const char *msg, std::string &cmd, std::vector<Value> &params);
+
+	// the cJSON based versions, used for messages the reader does not handle and for comparison
+	static char *encodeCommandWithCJSON(std::string cmd, std::list<Value> *params);
+	static bool getCommandWithCJSON(const char *msg, std::string &cmd, std::list<Value> **params);
+
     static std::string valueType(const Value &v);
     static void addValueToJSONObject(cJSON *obj, const char *name, const Value &val);
     static void addValueToJSONArray(cJSON *arr, const Value &val);
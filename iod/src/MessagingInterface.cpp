@@ -410,6 +410,23 @@ MessagingInterface *MessagingInterface::create(std::string host, int port, Proto
 		}
 }
 
+// a publisher whose socket will only be used by a ChannelSender. It is an XPUB socket rather than
+// PUB so that the sender can tell when a subscriber is missing messages, and each subscriber's
+// pipe holds up to send_limit messages. The sender discards the subscription messages.
+MessagingInterface *MessagingInterface::createPublisher(int port, int send_limit) {
+    std::stringstream ss;
+    ss << "*:" << port;
+    std::string id = ss.str();
+    if (interfaces.count(id)) return interfaces[id];
+    MessagingInterface *res = new MessagingInterface("*", port, MessagingInterface::DEFERRED_START, eZMQ);
+    delete res->socket;
+    res->socket = new zmq::socket_t(*MessagingInterface::getContext(), ZMQ_XPUB);
+    res->socket->setsockopt(ZMQ_SNDHWM, &send_limit, sizeof(send_limit));
+    res->start();
+    interfaces[id] = res;
+    return res;
+}
+
 MessagingInterface::MessagingInterface(int num_threads, int port_, bool deferred_start, ProtocolType proto)
 		: Receiver("messaging_interface"), protocol(proto), socket(0),is_publisher(false),
 			connection(-1), port(port_), owner_thread(0), started_(false) {
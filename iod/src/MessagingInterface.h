@@ -75,6 +75,7 @@ public:
 	void setCurrent(MessagingInterface *mi) { current = mi; }
 	static MessagingInterface *getCurrent();
 	static MessagingInterface *create(std::string host, int port, ProtocolType proto = eZMQ);
+	static MessagingInterface *createPublisher(int port, int send_limit);
 	char *sendCommand(std::string cmd, std::list<Value> *params);
 	char *sendCommand(std::string cmd, Value p1 = SymbolTable::Null,
 					  Value p2 = SymbolTable::Null,
@@ -0,0 +1,87 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <new>
+#include "ObjectPool.h"
+
+ObjectPool *ObjectPool::all_pools = 0;
+boost::mutex ObjectPool::pools_mutex;
+
+ObjectPool::ObjectPool(const char *pool_name, size_t max_object_size)
+	: name(pool_name), max_size(max_object_size),
+		free_lists(max_object_size / Granularity + 1, (FreeBlock*)0),
+		in_use(0), high_water(0), total_allocations(0), total_reused(0), total_oversize(0),
+		next_pool(0) {
+	boost::mutex::scoped_lock lock(pools_mutex);
+	next_pool = all_pools;
+	all_pools = this;
+}
+
+void *ObjectPool::allocate(size_t size) {
+	size_t size_class = (size + Granularity - 1) / Granularity;
+	{
+		boost::mutex::scoped_lock lock(mutex);
+		++total_allocations;
+		if (++in_use > high_water) high_water = in_use;
+		if (size > max_size) {
+			++total_oversize;
+		}
+		else if (free_lists[size_class]) {
+			FreeBlock *block = free_lists[size_class];
+			free_lists[size_class] = block->next;
+			++total_reused;
+			return block;
+		}
+	}
+	if (size > max_size) return ::operator new(size);
+	return ::operator new(size_class * Granularity);
+}
+
+void ObjectPool::release(void *p, size_t size) {
+	if (!p) return;
+	boost::mutex::scoped_lock lock(mutex);
+	--in_use;
+	if (size > max_size) {
+		::operator delete(p);
+		return;
+	}
+	size_t size_class = (size + Granularity - 1) / Granularity;
+	FreeBlock *block = static_cast<FreeBlock*>(p);
+	block->next = free_lists[size_class];
+	free_lists[size_class] = block;
+}
+
+void ObjectPool::reportAll(cJSON *result) {
+	boost::mutex::scoped_lock lock(pools_mutex);
+	ObjectPool *pool = all_pools;
+	while (pool) {
+		boost::mutex::scoped_lock pool_lock(pool->mutex);
+		cJSON *stat = cJSON_CreateArray();
+		cJSON_AddItemToArray(stat, cJSON_CreateString("POOL"));
+		cJSON_AddItemToArray(stat, cJSON_CreateString(pool->name));
+		cJSON_AddItemToArray(stat, cJSON_CreateNumber(pool->in_use));
+		cJSON_AddItemToArray(stat, cJSON_CreateNumber(pool->high_water));
+		cJSON_AddItemToArray(stat, cJSON_CreateNumber(pool->total_allocations));
+		cJSON_AddItemToArray(stat, cJSON_CreateNumber(pool->total_reused));
+		cJSON_AddItemToArray(stat, cJSON_CreateNumber(pool->total_oversize));
+		cJSON_AddItemToArray(result, stat);
+		pool = pool->next_pool;
+	}
+}
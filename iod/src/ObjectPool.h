@@ -0,0 +1,85 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __OBJECTPOOL_H__
+#define __OBJECTPOOL_H__
+
+#include <stddef.h>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include "cJSON.h"
+
+/*
+	A free-list allocator for objects that are constantly created and
+	destroyed (triggers, actions, packages, messages, scheduled items).
+	Blocks are grouped into 16 byte size classes so that a single pool can
+	serve a class and all its subclasses; requests larger than the pool's
+	maximum object size go to the global heap. Released blocks are kept
+	on the free list for reuse and are never returned to the heap.
+
+	A class uses a pool by declaring
+
+		static void *operator new(size_t size);
+		static void operator delete(void *p, size_t size);
+
+	and forwarding these to allocate() and release(). Pools are intended
+	to be created with new and never deleted so that objects released
+	during program shutdown still have somewhere to go.
+*/
+class ObjectPool {
+public:
+	ObjectPool(const char *pool_name, size_t max_object_size = 256);
+
+	void *allocate(size_t size);
+	void release(void *p, size_t size);
+
+	const char *getName() const { return name; }
+	size_t inUse() const { return in_use; }
+	size_t highWater() const { return high_water; }
+	size_t allocations() const { return total_allocations; }
+	size_t reused() const { return total_reused; }
+	size_t oversize() const { return total_oversize; }
+
+	// adds [ "POOL", name, in use, high water, allocations, reused, oversize ] for each pool
+	static void reportAll(cJSON *result);
+
+private:
+	enum { Granularity = 16 };
+	struct FreeBlock { FreeBlock *next; };
+
+	const char *name;
+	size_t max_size;
+	std::vector<FreeBlock*> free_lists; // indexed by size class
+	boost::mutex mutex;
+	size_t in_use;
+	size_t high_water;
+	size_t total_allocations;
+	size_t total_reused;
+	size_t total_oversize;
+	ObjectPool *next_pool;
+
+	static ObjectPool *all_pools;
+	static boost::mutex pools_mutex;
+
+	ObjectPool(const ObjectPool &);
+	ObjectPool &operator=(const ObjectPool &);
+};
+
+#endif
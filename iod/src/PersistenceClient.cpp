@@ -0,0 +1,82 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <list>
+#include "PersistenceClient.h"
+#include "MessageEncoding.h"
+#include "symboltable.h"
+
+static const size_t max_unacked = 1000;
+
+PersistenceClient::PersistenceClient(uint64_t window_usecs)
+	: window(window_usecs), first_change(0), next_seq(1), acked_seq(0) {
+}
+
+void PersistenceClient::update(const std::string &machine, const std::string &property,
+		const Value &val, uint64_t now) {
+	if (changes.empty()) first_change = now;
+	changes[std::make_pair(machine, property)] = val;
+}
+
+const std::string &PersistenceClient::takeBatch(uint64_t &seq) {
+	seq = next_seq++;
+	std::list<Value> params;
+	long count = 0;
+	std::map<PropertyKey, Value>::const_iterator iter = changes.begin();
+	while (iter != changes.end()) {
+		const std::pair<PropertyKey, Value> &item = *iter++;
+		if (item.second == SymbolTable::Null) continue; // has no encoding, as with single PROPERTY messages
+		params.push_back(Value(item.first.first, Value::t_string));
+		params.push_back(Value(item.first.second, Value::t_string));
+		params.push_back(item.second);
+		++count;
+	}
+	params.push_front(count);
+	params.push_front((long)seq);
+	batch.clear();
+	MessageEncoding::writeCommand(batch, "PERSIST", &params);
+
+	// when persistd is not answering, merge the oldest records but keep the time of the oldest change
+	unacked.push_back(std::make_pair(seq, first_change));
+	if (unacked.size() > max_unacked) {
+		unacked[2].second = unacked[1].second;
+		unacked.erase(unacked.begin() + 1);
+	}
+	changes.clear();
+	return batch;
+}
+
+void PersistenceClient::acknowledge(uint64_t seq) {
+	if (seq <= acked_seq || seq >= next_seq) return;
+	acked_seq = seq;
+	while (!unacked.empty() && unacked.front().first <= seq) unacked.pop_front();
+}
+
+void PersistenceClient::resynchronised() {
+	acked_seq = next_seq - 1;
+	unacked.clear();
+}
+
+uint64_t PersistenceClient::lag(uint64_t now) const {
+	uint64_t oldest = 0;
+	if (!unacked.empty()) oldest = unacked.front().second;
+	else if (!changes.empty()) oldest = first_change;
+	return (oldest && now > oldest) ? now - oldest : 0;
+}
@@ -0,0 +1,75 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __PersistenceClient_h__
+#define __PersistenceClient_h__
+
+#include <stdint.h>
+#include <string>
+#include <map>
+#include <deque>
+#include "value.h"
+
+/*
+	Collects the property changes iod sends to persistd on the
+	PERSISTENCE_CHANNEL. Changes to the same machine property within a
+	window are coalesced and the window's changes are sent as one batch:
+
+		{"command":"PERSIST","params":[seq, count, machine, property, value, ...]}
+
+	persistd replies with PERSISTENT ACK seq once the batch is saved; an ack
+	covers all earlier batches. A gap in the sequence tells persistd that
+	a batch was lost and it reloads the full state with PERSISTENT STATUS,
+	which also acknowledges everything sent so far.
+
+	The replication lag is the age of the oldest change that persistd has
+	not yet acknowledged. All methods are used on the processing thread.
+*/
+class PersistenceClient {
+public:
+	PersistenceClient(uint64_t window_usecs);
+
+	void update(const std::string &machine, const std::string &property, const Value &val, uint64_t now);
+	bool pending() const { return !changes.empty(); }
+	size_t pendingCount() const { return changes.size(); }
+	uint64_t dueTime() const { return first_change + window; }
+
+	// encodes the pending changes as the next batch, the result is valid until the next call
+	const std::string &takeBatch(uint64_t &seq);
+
+	void acknowledge(uint64_t seq);
+	void resynchronised(); // persistd has read the full state
+
+	uint64_t lag(uint64_t now) const;
+	uint64_t sentSeq() const { return next_seq - 1; }
+	uint64_t ackedSeq() const { return acked_seq; }
+
+private:
+	typedef std::pair<std::string, std::string> PropertyKey;
+	std::map<PropertyKey, Value> changes;
+	uint64_t window;
+	uint64_t first_change;
+	uint64_t next_seq;
+	uint64_t acked_seq;
+	std::deque< std::pair<uint64_t, uint64_t> > unacked; // batch sequence and the time of its oldest change
+	std::string batch;
+};
+
+#endif
@@ -0,0 +1,289 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <string.h>
+#include <unistd.h>
+#include <sstream>
+#include "ProcessImageStream.h"
+#include "MessagingInterface.h"
+#include "MessageLog.h"
+
+ProcessImagePublisher *ProcessImagePublisher::instance_ = 0;
+
+static const size_t MaxLiteral = 128;
+static const size_t MinRun = 3;
+static const size_t ShortRunLimit = MinRun + 0x7f; // runs this long or longer use a LEB128 count
+
+void ProcessImageFrame::compress(const uint8_t *src, size_t len, std::vector<uint8_t> &out) {
+	size_t i = 0;
+	size_t literal_start = 0;
+	while (i < len) {
+		size_t run = 1;
+		while (i + run < len && src[i + run] == src[i]) ++run;
+		if (run < MinRun) {
+			i += run;
+			continue;
+		}
+		while (literal_start < i) {
+			size_t n = i - literal_start;
+			if (n > MaxLiteral) n = MaxLiteral;
+			out.push_back((uint8_t)(n - 1));
+			out.insert(out.end(), src + literal_start, src + literal_start + n);
+			literal_start += n;
+		}
+		if (run < ShortRunLimit)
+			out.push_back((uint8_t)(0x80 | (run - MinRun)));
+		else {
+			out.push_back(0xff);
+			uint64_t count = run - ShortRunLimit;
+			do {
+				uint8_t b = count & 0x7f;
+				count >>= 7;
+				out.push_back(count ? (b | 0x80) : b);
+			} while (count);
+		}
+		out.push_back(src[i]);
+		i += run;
+		literal_start = i;
+	}
+	while (literal_start < len) {
+		size_t n = len - literal_start;
+		if (n > MaxLiteral) n = MaxLiteral;
+		out.push_back((uint8_t)(n - 1));
+		out.insert(out.end(), src + literal_start, src + literal_start + n);
+		literal_start += n;
+	}
+}
+
+bool ProcessImageFrame::expand(const uint8_t *src, size_t src_len, uint8_t *dest, size_t len, bool apply_xor) {
+	const uint8_t *end = src + src_len;
+	size_t pos = 0;
+	while (src < end) {
+		uint8_t token = *src++;
+		if (token < 0x80) {
+			size_t n = token + 1;
+			if (src + n > end || pos + n > len) return false;
+			if (apply_xor)
+				for (size_t i = 0; i < n; ++i) dest[pos + i] ^= src[i];
+			else
+				memcpy(dest + pos, src, n);
+			src += n;
+			pos += n;
+			continue;
+		}
+		uint64_t n = (token & 0x7f) + MinRun;
+		if (token == 0xff) {
+			uint64_t count = 0;
+			int shift = 0;
+			uint8_t b;
+			do {
+				if (src == end || shift > 56) return false;
+				b = *src++;
+				count |= (uint64_t)(b & 0x7f) << shift;
+				shift += 7;
+			} while (b & 0x80);
+			n = count + ShortRunLimit;
+		}
+		if (src == end || n > len - pos) return false;
+		uint8_t val = *src++;
+		if (!apply_xor)
+			memset(dest + pos, val, n);
+		else if (val)
+			for (size_t i = 0; i < n; ++i) dest[pos + i] ^= val;
+		pos += n;
+	}
+	return pos == len;
+}
+
+ProcessImageEncoder::ProcessImageEncoder(unsigned int keyframe_interval)
+	: previous_seq(0), interval(keyframe_interval ? keyframe_interval : 1), since_keyframe(0),
+		keyframe_requested(true) {
+}
+
+void ProcessImageEncoder::encode(uint64_t seq, uint64_t cycle_time, uint64_t global_clock,
+		const uint8_t *image, size_t size, std::vector<uint8_t> &frame) {
+	bool keyframe = keyframe_requested || size != previous.size() || ++since_keyframe >= interval;
+	frame.resize(sizeof(ProcessImageFrame::Header));
+	if (keyframe) {
+		ProcessImageFrame::compress(image, size, frame);
+		previous.assign(image, image + size);
+		since_keyframe = 0;
+		keyframe_requested = false;
+	}
+	else {
+		delta.resize(size);
+		bool changed = false;
+		for (size_t i = 0; i < size; ++i) {
+			delta[i] = image[i] ^ previous[i];
+			if (delta[i]) changed = true;
+		}
+		if (changed) {
+			ProcessImageFrame::compress(&delta[0], size, frame);
+			memcpy(&previous[0], image, size);
+		}
+	}
+	ProcessImageFrame::Header header;
+	header.magic = ProcessImageFrame::MAGIC;
+	header.version = ProcessImageFrame::VERSION;
+	header.flags = keyframe ? ProcessImageFrame::KEYFRAME : 0;
+	header.reserved = 0;
+	header.seq = seq;
+	header.base_seq = keyframe ? 0 : previous_seq;
+	header.cycle_time = cycle_time;
+	header.global_clock = global_clock;
+	header.image_size = (uint32_t)size;
+	header.payload_size = (uint32_t)(frame.size() - sizeof(header));
+	memcpy(&frame[0], &header, sizeof(header));
+	previous_seq = seq;
+}
+
+ProcessImageDecoder::ProcessImageDecoder()
+	: frames(0), keyframes(0), missed(0), resyncs(0), seq_(0), cycle_time(0), global_clock(0),
+		synchronised_(false) {
+}
+
+ProcessImageDecoder::Result ProcessImageDecoder::apply(const uint8_t *frame, size_t len) {
+	ProcessImageFrame::Header header;
+	if (len < sizeof(header)) return Invalid;
+	memcpy(&header, frame, sizeof(header));
+	if (header.magic != ProcessImageFrame::MAGIC || header.version != ProcessImageFrame::VERSION
+			|| header.payload_size != len - sizeof(header))
+		return Invalid;
+	if (synchronised_ && header.seq > seq_ + 1) missed += header.seq - seq_ - 1;
+	const uint8_t *payload = frame + sizeof(header);
+	if (header.flags & ProcessImageFrame::KEYFRAME) {
+		image_.resize(header.image_size);
+		if (!ProcessImageFrame::expand(payload, header.payload_size, image_.empty() ? 0 : &image_[0],
+				image_.size(), false)) {
+			synchronised_ = false;
+			return Invalid;
+		}
+		++keyframes;
+	}
+	else {
+		if (!synchronised_) return WaitingForKeyframe;
+		if (header.base_seq != seq_ || header.image_size != image_.size()) {
+			// the frame this one applies to was lost
+			synchronised_ = false;
+			++resyncs;
+			return WaitingForKeyframe;
+		}
+		if (header.payload_size && !ProcessImageFrame::expand(payload, header.payload_size, &image_[0],
+				image_.size(), true)) {
+			synchronised_ = false;
+			return Invalid;
+		}
+	}
+	synchronised_ = true;
+	seq_ = header.seq;
+	cycle_time = header.cycle_time;
+	global_clock = header.global_clock;
+	++frames;
+	return Applied;
+}
+
+ProcessImagePublisher::ProcessImagePublisher(int port_, unsigned int keyframe_interval)
+	: captured(0), dropped(0), bytes_in(0), bytes_out(0), port(port_), encoder(keyframe_interval),
+		write_pos(0), read_pos(0), next_seq(0), done(false) {
+}
+
+ProcessImagePublisher *ProcessImagePublisher::start(int port, unsigned int keyframe_interval) {
+	if (!instance_) instance_ = new ProcessImagePublisher(port, keyframe_interval);
+	return instance_;
+}
+
+// called on the ethercat thread
+void ProcessImagePublisher::capture(const uint8_t *image, size_t size, uint64_t cycle_time, uint64_t global_clock) {
+	uint64_t seq = ++next_seq; // dropped cycles still use a sequence number so subscribers see the gap
+	++captured;
+	size_t head = write_pos.load(std::memory_order_relaxed);
+	if (head - read_pos.load(std::memory_order_acquire) >= NumSlots) {
+		++dropped;
+		return;
+	}
+	Slot &slot = slots[head % NumSlots];
+	slot.seq = seq;
+	slot.cycle_time = cycle_time;
+	slot.global_clock = global_clock;
+	slot.image.assign(image, image + size); // only allocates if the image has grown
+	write_pos.store(head + 1, std::memory_order_release);
+}
+
+void ProcessImagePublisher::operator()() {
+	zmq::socket_t socket(*MessagingInterface::getContext(), ZMQ_PUB);
+	std::stringstream ss;
+	ss << "tcp://*:" << port;
+	try {
+		socket.bind(ss.str().c_str());
+	}
+	catch (zmq::error_t &) {
+		MessageLog::instance()->add("Process image publisher could not bind to ", ss.str(), ": ",
+				zmq_strerror(zmq_errno()));
+		return;
+	}
+	std::vector<uint8_t> frame;
+	while (!done) {
+		size_t tail = read_pos.load(std::memory_order_relaxed);
+		if (tail == write_pos.load(std::memory_order_acquire)) {
+			usleep(500);
+			continue;
+		}
+		Slot &slot = slots[tail % NumSlots];
+		encoder.encode(slot.seq, slot.cycle_time, slot.global_clock,
+				slot.image.empty() ? 0 : &slot.image[0], slot.image.size(), frame);
+		bytes_in += slot.image.size();
+		read_pos.store(tail + 1, std::memory_order_release);
+		try {
+			// a subscriber on a slow link loses frames once its queue is full and
+			// waits for the next keyframe
+			zmq::message_t msg(frame.size());
+			memcpy(msg.data(), &frame[0], frame.size());
+			if (socket.send(msg, ZMQ_DONTWAIT)) bytes_out += frame.size();
+		}
+		catch (zmq::error_t &) {
+			if (zmq_errno() == ETERM) break;
+		}
+	}
+}
+
+ProcessImageSubscriber::ProcessImageSubscriber(zmq::context_t &context, const std::string &host, int port)
+	: socket(context, ZMQ_SUB), bytes_received(0) {
+	std::stringstream ss;
+	ss << "tcp://" << host << ":" << port;
+	socket.setsockopt(ZMQ_SUBSCRIBE, "", 0);
+	socket.connect(ss.str().c_str());
+}
+
+bool ProcessImageSubscriber::next(long timeout_ms) {
+	zmq::pollitem_t items[] = { { (void*)socket, 0, ZMQ_POLLIN, 0 } };
+	while (true) {
+		try {
+			if (zmq::poll(items, 1, timeout_ms) <= 0) return false;
+			if (!socket.recv(&frame, ZMQ_DONTWAIT)) continue;
+		}
+		catch (zmq::error_t &) {
+			if (zmq_errno() == EINTR) continue;
+			throw;
+		}
+		bytes_received += frame.size();
+		if (decoder_.apply((const uint8_t *)frame.data(), frame.size()) == ProcessImageDecoder::Applied)
+			return true;
+	}
+}
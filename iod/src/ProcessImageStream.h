@@ -0,0 +1,180 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __PROCESSIMAGESTREAM_H__
+#define __PROCESSIMAGESTREAM_H__
+
+#include <stdint.h>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <zmq.hpp>
+
+/*
+	The EtherCAT process image published as a stream of frames, one for each
+	bus cycle. Each frame carries the cycle time and the ethercat thread's clock
+	and, except for keyframes, only the bytes that differ from the image of the
+	previous frame: the image is XORed with the previous one and the result,
+	mostly zero, is run-length encoded. Keyframes carry the whole image and are
+	sent periodically so that subscribers can join at any time and recover from
+	lost frames.
+
+	A frame is a ProcessImageFrame::Header followed by payload_size bytes of
+	run-length encoded data. A payload is a sequence of tokens:
+		0x00..0x7f  followed by (token + 1) literal bytes
+		0x80..0xfe  followed by one byte that is repeated ((token & 0x7f) + 3) times
+		0xff        followed by a LEB128 count and one byte that is repeated (count + 130) times
+	An empty payload means the image did not change.
+
+	Frames are self contained byte strings so a subscriber can record them as
+	received and decode the recording later.
+*/
+struct ProcessImageFrame {
+	static const uint32_t MAGIC = 0x49505743; // "CWPI"
+	static const uint8_t VERSION = 1;
+	enum Flags { KEYFRAME = 1 };
+
+	struct Header {
+		uint32_t magic;
+		uint8_t version;
+		uint8_t flags;
+		uint16_t reserved;
+		uint64_t seq; // counts bus cycles; a gap means cycles were not published
+		uint64_t base_seq; // the frame whose image this frame's delta applies to
+		uint64_t cycle_time; // microsecs when the image was received from the bus
+		uint64_t global_clock; // the ethercat thread's cycle clock
+		uint32_t image_size;
+		uint32_t payload_size;
+	};
+
+	static void compress(const uint8_t *src, size_t len, std::vector<uint8_t> &out); // appends to out
+	// writes len bytes to dest, or XORs them into dest; false if the data is malformed
+	static bool expand(const uint8_t *src, size_t src_len, uint8_t *dest, size_t len, bool apply_xor);
+};
+
+class ProcessImageEncoder {
+public:
+	ProcessImageEncoder(unsigned int keyframe_interval);
+
+	// replaces frame with the encoding of image, a keyframe when one is due
+	void encode(uint64_t seq, uint64_t cycle_time, uint64_t global_clock,
+			const uint8_t *image, size_t size, std::vector<uint8_t> &frame);
+	void requestKeyframe() { keyframe_requested = true; }
+
+private:
+	std::vector<uint8_t> previous;
+	std::vector<uint8_t> delta;
+	uint64_t previous_seq;
+	unsigned int interval;
+	unsigned int since_keyframe;
+	bool keyframe_requested;
+};
+
+class ProcessImageDecoder {
+public:
+	enum Result { Applied, WaitingForKeyframe, Invalid };
+
+	ProcessImageDecoder();
+	Result apply(const uint8_t *frame, size_t len);
+
+	bool synchronised() const { return synchronised_; }
+	const std::vector<uint8_t> &image() const { return image_; }
+	uint64_t seq() const { return seq_; }
+	uint64_t cycleTime() const { return cycle_time; }
+	uint64_t globalClock() const { return global_clock; }
+
+	uint64_t frames; // frames applied
+	uint64_t keyframes;
+	uint64_t missed; // cycles that were not published or not received
+	uint64_t resyncs; // times a lost frame meant waiting for a keyframe
+
+private:
+	std::vector<uint8_t> image_;
+	uint64_t seq_;
+	uint64_t cycle_time;
+	uint64_t global_clock;
+	bool synchronised_;
+};
+
+/*
+	Publishes the process image on a PUB socket. The ethercat thread calls
+	capture() each cycle, which only copies the image into a free slot of a
+	ring that the publisher thread drains; if the publisher falls behind, the
+	cycle is counted as dropped rather than delaying the ethercat thread.
+	Encoding and sending happen on the publisher thread.
+*/
+class ProcessImagePublisher {
+public:
+	static ProcessImagePublisher *instance() { return instance_; } // zero unless started
+	static ProcessImagePublisher *start(int port, unsigned int keyframe_interval);
+
+	void capture(const uint8_t *image, size_t size, uint64_t cycle_time, uint64_t global_clock);
+	void operator()();
+	void stop() { done = true; }
+
+	std::atomic<uint64_t> captured;
+	std::atomic<uint64_t> dropped; // cycles not published because the ring was full
+	std::atomic<uint64_t> bytes_in; // image bytes encoded
+	std::atomic<uint64_t> bytes_out; // frame bytes sent
+
+private:
+	ProcessImagePublisher(int port, unsigned int keyframe_interval);
+
+	struct Slot {
+		uint64_t seq;
+		uint64_t cycle_time;
+		uint64_t global_clock;
+		std::vector<uint8_t> image;
+	};
+	enum { NumSlots = 256 };
+
+	static ProcessImagePublisher *instance_;
+	int port;
+	ProcessImageEncoder encoder;
+	Slot slots[NumSlots];
+	std::atomic<size_t> write_pos; // written only by capture()
+	std::atomic<size_t> read_pos; // written only by the publisher thread
+	uint64_t next_seq;
+	std::atomic<bool> done;
+};
+
+/*
+	Receives and decodes the frames published by an iod started with
+	--image_port. next() returns true when image() holds a new image.
+*/
+class ProcessImageSubscriber {
+public:
+	ProcessImageSubscriber(zmq::context_t &context, const std::string &host, int port);
+
+	bool next(long timeout_ms);
+
+	const ProcessImageDecoder &decoder() const { return decoder_; }
+	const std::vector<uint8_t> &image() const { return decoder_.image(); }
+	const zmq::message_t &lastFrame() const { return frame; } // as received, for recording
+	uint64_t bytesReceived() const { return bytes_received; }
+
+private:
+	zmq::socket_t socket;
+	zmq::message_t frame;
+	ProcessImageDecoder decoder_;
+	uint64_t bytes_received;
+};
+
+#endif
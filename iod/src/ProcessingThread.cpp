@@ -48,8 +48,11 @@
 #include "symboltable.h"
 #include "DebugExtra.h"
 #include "Scheduler.h"
+#include "LatencyHistogram.h"
+#include "CycleTimer.h"
 #include "PredicateAction.h"
 #include "ModbusInterface.h"
+#include "MQTTInterface.h"
 #include "Statistics.h"
 #include "IODCommands.h"
 #include <signal.h>
@@ -57,6 +60,8 @@
 #include "ClientInterface.h"
 #include "MessageLog.h"
 #include "MessagingInterface.h"
+#include "SharedStateTable.h"
+#include "IOTrace.h"
 
 #include "ControlSystemMachine.h"
 #include "ProcessingThread.h"
@@ -94,14 +99,52 @@ public:
 	static const int ECAT_OUT_ITEM = 4; //io has data update for ethercat
 	static const int CMD_SYNC_ITEM = 5; // client interface sending message
 
+	static const int NUM_FIXED_ITEMS = 6;
+
 	Watchdog processing_wd;
 	ClockworkProcessManager process_manager;
+
+	// channels register and unregister from other threads
+	boost::mutex channel_mutex;
 	std::list<CommandSocketInfo*> channel_sockets;
+	bool channels_changed;
+
+	/* the poll items are only rebuilt when a channel registers or unregisters:
+		the fixed items, one item per channel command socket then the MQTT
+		notification descriptor, if there is one.
+	*/
+	std::vector<zmq::pollitem_t> poll_items;
+	std::vector<CommandSocketInfo*> polled_channels; // channel of poll item NUM_FIXED_ITEMS + i
+	int polled_mqtt_fd;
+	size_t next_channel; // where the next command pass starts, so every channel gets a turn
 
 	ProcessingThreadInternals() : sequence(0), cycle_delay(1000),
-		processing_wd("Processing Loop Watchdog", 2000) { }
+		processing_wd("Processing Loop Watchdog", 2000), channels_changed(true),
+		polled_mqtt_fd(-1), next_channel(0) { }
+
+	void updatePollItems(const zmq::pollitem_t *fixed_items, int mqtt_fd);
 };
 
+void ProcessingThreadInternals::updatePollItems(const zmq::pollitem_t *fixed_items, int mqtt_fd) {
+	boost::mutex::scoped_lock lock(channel_mutex);
+	if (!channels_changed && mqtt_fd == polled_mqtt_fd) return;
+	poll_items.assign(fixed_items, fixed_items + NUM_FIXED_ITEMS);
+	polled_channels.assign(channel_sockets.begin(), channel_sockets.end());
+	std::vector<CommandSocketInfo*>::iterator iter = polled_channels.begin();
+	while (iter != polled_channels.end()) {
+		CommandSocketInfo *info = *iter++;
+		zmq::pollitem_t item = { (void*)(*info->sock), 0, ZMQ_POLLERR | ZMQ_POLLIN, 0 };
+		poll_items.push_back(item);
+	}
+	if (mqtt_fd != -1) {
+		zmq::pollitem_t item = { 0, mqtt_fd, ZMQ_POLLIN, 0 };
+		poll_items.push_back(item);
+	}
+	if (next_channel >= polled_channels.size()) next_channel = 0;
+	polled_mqtt_fd = mqtt_fd;
+	channels_changed = false;
+}
+
 ProcessingThread &ProcessingThread::create(ControlSystemMachine *m, HardwareActivation &activator, IODCommandThread &cmd_interface) {
 	if (!instance_) instance_ = new ProcessingThread(m, activator,cmd_interface);
 	return *instance_;
@@ -109,7 +152,8 @@ ProcessingThread &ProcessingThread::create(ControlSystemMachine *m, HardwareActi
 
 ProcessingThread::ProcessingThread(ControlSystemMachine *m, HardwareActivation &activator, IODCommandThread &cmd_interface)
 : internals(0), machine(*m), status(e_waiting),
-activate_hardware(activator), command_interface(cmd_interface), program_start(0)
+activate_hardware(activator), command_interface(cmd_interface), program_start(0),
+runnable(&MachineInstance::runnable_node)
 {
 	program_start = microsecs();
 	internals = new ProcessingThreadInternals();
@@ -127,24 +171,33 @@ void ProcessingThread::stop()
 }
 
 CommandSocketInfo *ProcessingThread::addCommandChannel(CommandSocketInfo *csi) {
+	boost::mutex::scoped_lock lock(internals->channel_mutex);
 	std::list<CommandSocketInfo*>::iterator iter= internals->channel_sockets.begin();
-	int idx = 0;
 	while (iter != internals->channel_sockets.end() ) {
-		CommandSocketInfo *info = *iter++; ++idx;
-		if (info == csi) {
-			NB_MSG << "Processing thread already has command socket info for " << csi->address << " at index " << idx << "\n";
-			return csi; // already configured
-		}
+		if (*iter++ == csi) return csi; // already configured
 	}
 	internals->channel_sockets.push_back(csi);
+	internals->channels_changed = true;
 	return csi;
 }
 
 CommandSocketInfo *ProcessingThread::addCommandChannel(Channel *chn) {
 	if (chn->definition()->isPublisher()) return 0;
 	CommandSocketInfo *info = new CommandSocketInfo(chn);
-	internals->channel_sockets.push_back(info);
-	return info;
+	return addCommandChannel(info);
+}
+
+/* the socket is not deleted, the channel owns it and may register it again when it restarts */
+void ProcessingThread::removeCommandChannel(CommandSocketInfo *csi) {
+	boost::mutex::scoped_lock lock(internals->channel_mutex);
+	size_t before = internals->channel_sockets.size();
+	internals->channel_sockets.remove(csi);
+	if (internals->channel_sockets.size() != before) internals->channels_changed = true;
+}
+
+size_t ProcessingThread::numCommandChannels() {
+	boost::mutex::scoped_lock lock(internals->channel_mutex);
+	return internals->channel_sockets.size();
 }
 
 bool ProcessingThread::checkAndUpdateCycleDelay()
@@ -339,6 +392,7 @@ DBG_MSG << "recv stage: " << (int)stage << " " << msglen << "\n";
 }
 
 ProcessingThread *ProcessingThread::instance_ = 0;
+ProcessingCycleMonitor *ProcessingThread::cycle_monitor = 0;
 ProcessingThread *ProcessingThread::instance() {
 	return instance_;
 }
@@ -348,17 +402,17 @@ void ProcessingThread::setProcessingThreadInstance( ProcessingThread* pti) {
 
 void ProcessingThread::activate(MachineInstance *m) {
 	boost::recursive_mutex::scoped_lock scoped_lock(instance()->runnable_mutex);
-	instance()->runnable.insert(m);
+	instance()->runnable.push(m);
 }
 
 void ProcessingThread::suspend(MachineInstance *m) {
 	boost::recursive_mutex::scoped_lock scoped_lock(instance()->runnable_mutex);
-	instance()->runnable.erase(m);
+	instance()->runnable.remove(m);
 }
 
 bool ProcessingThread::is_pending(MachineInstance *m) {
 	boost::recursive_mutex::scoped_lock scoped_lock(instance()->runnable_mutex);
-	return instance()->runnable.count(m);
+	return instance()->runnable.contains(m);
 }
 
 
@@ -379,6 +433,9 @@ void ProcessingThread::HandleIncomingEtherCatData( std::set<IOComponent *> &io_w
 #ifdef KEEPSTATS
 			AutoStat stats(avg_io_time);
 #endif
+			if (IOTraceRecorder::instance())
+				IOTraceRecorder::instance()->processData(global_clock, incoming_data_size,
+						incoming_process_mask, incoming_process_data);
 			IOComponent::processAll( global_clock, incoming_data_size, incoming_process_mask, 
 					incoming_process_data, io_work_queue);
 		}
@@ -400,10 +457,17 @@ void ProcessingThread::operator()()
 #else
 	pthread_setname_np(pthread_self(), "iod processing");
 #endif
+	setThreadRealtime("processing", processing_priority(), processing_cpu());
 
 
 	Statistic *cycle_delay_stat = new Statistic("Cycle Delay");
 	Statistic::add(cycle_delay_stat);
+	LatencyHistogram *cycle_time = new LatencyHistogram("cycle_time",
+		"Time the processing thread spends working in each cycle");
+	LatencyHistogram *command_latency = new LatencyHistogram("command_latency",
+		"Time from receiving a client or channel command to sending its reply");
+	uint64_t last_metrics_write = 0;
+	uint64_t last_timer_publish = 0;
 	long delta, delta2;
 
 	AutoStatStorage avg_io_time("AVG_IO_TIME", 0);
@@ -442,6 +506,12 @@ void ProcessingThread::operator()()
 
 	Channel::initialiseChannels();
 
+	SharedStateTable *state_table_writer = 0;
+	if (state_table()) {
+		state_table_writer = SharedStateTable::instance();
+		if (!state_table_writer->open(state_table())) state_table_writer = 0;
+	}
+
 	safeSend(sched_sync,"go",2); // scheduled items
 	usleep(10000);
 	safeSend(dispatch_sync,"go",2); //  permit handling of events
@@ -459,6 +529,9 @@ void ProcessingThread::operator()()
 
 	checkAndUpdateCycleDelay();
 
+	// from here on, property changes are announced once per cycle (see commitChanges below)
+	MachineInstance::setChangeJournalling(true);
+
 	uint64_t last_checked_cycle_time = 0;
 	uint64_t last_checked_plugins = 0;
 	uint64_t last_checked_machines = 0;
@@ -534,10 +607,8 @@ void ProcessingThread::operator()()
 			{ (void*)ecat_out, 0, ZMQ_POLLIN, 0 },
 			{ (void*)command_sync, 0, ZMQ_POLLIN, 0 }
 		};
-		const int max_poll_sockets = 15;
-		zmq::pollitem_t items[max_poll_sockets];
-		memset((void*)items, 0, max_poll_sockets * sizeof(zmq::pollitem_t));
-		int dynamic_poll_start_idx = 6;
+		zmq::pollitem_t *items = 0;
+		int num_poll_items = 0;
 
 		char buf[100];
 		int poll_wait = internals->cycle_delay / 1000; // millisecs
@@ -546,7 +617,8 @@ void ProcessingThread::operator()()
 		uint64_t curr_t = 0;
 		uint64_t last_sample_poll = 0;
 		bool machines_have_work = false;
-		unsigned int num_channels = 0;
+		unsigned int machines_evaluated = 0;
+		if (cycle_monitor) cycle_monitor->beginCycle();
 		while (!program_done)
 		{
 			MEMCHECK();
@@ -554,30 +626,15 @@ void ProcessingThread::operator()()
 			internals->process_manager.SetTime(curr_t);
 			//TBD add a guard here to detect/prevent rapid cycling
 
-			for (int i=0; i<dynamic_poll_start_idx; ++i) {
-				items[i] = fixed_items[i];
-			}
-
-			// add the channel sockets to our poll info
-			{
-				std::list<CommandSocketInfo*>::iterator csi_iter = internals->channel_sockets.begin();
-				int idx = dynamic_poll_start_idx;
-				while (csi_iter != internals->channel_sockets.end()) {
-					CommandSocketInfo *info = *csi_iter++;
-					items[idx].socket = (void*)(*info->sock);
-					items[idx].fd = 0;
-					items[idx].events = ZMQ_POLLERR | ZMQ_POLLIN;
-					items[idx].revents = 0;
-					idx++;
-					if (idx == max_poll_sockets) break;
-				}
-				num_channels = idx - dynamic_poll_start_idx; // the number channels we are actually monitoring
-			}
+			// channel command sockets and messages received by the MQTT network thread
+			internals->updatePollItems(fixed_items, MQTTInterface::notifyFd());
+			items = &internals->poll_items[0];
+			num_poll_items = internals->poll_items.size();
 
 			//machines_have_work = MachineInstance::workToDo();
 			{
 				static size_t last_runnable_count = 0;
-				boost::mutex::scoped_lock(runnable_mutex);
+				boost::recursive_mutex::scoped_lock lock(runnable_mutex);
 				machines_have_work = !runnable.empty() || !MachineInstance::pendingEvents().empty();
 				size_t runnable_count = runnable.size();
 				if (runnable_count != last_runnable_count) {
@@ -585,7 +642,8 @@ void ProcessingThread::operator()()
 					last_runnable_count = runnable_count;
 				}
 			}
-			if (machines_have_work || IOComponent::updatesWaiting() || !io_work_queue.empty())
+			bool monitor_waiting = cycle_monitor && cycle_monitor->wantsCycle();
+			if (machines_have_work || IOComponent::updatesWaiting() || !io_work_queue.empty() || monitor_waiting)
 				poll_wait = 1;
 			else {
 				poll_wait = 100;
@@ -593,12 +651,12 @@ void ProcessingThread::operator()()
 
 			//if (Watchdog::anyTriggered(curr_t))
 			//	Watchdog::showTriggered(curr_t, true);
-			systems_waiting = pollZMQItems(poll_wait, items, 6 + num_channels,
+			systems_waiting = pollZMQItems(poll_wait, items, num_poll_items,
 				ecat_sync, resource_mgr, dispatch_sync, sched_sync, ecat_out);
 
 			if (systems_waiting > 0 
 				|| (machines_have_work && curr_t - last_checked_machines >= machine_check_delay)) break;
-			if (IOComponent::updatesWaiting() || !io_work_queue.empty()) break;
+			if (IOComponent::updatesWaiting() || !io_work_queue.empty() || monitor_waiting) break;
 			if (!MachineInstance::pluginMachines().empty() && curr_t - last_checked_plugins >= 1000) break;
 			if ( curr_t - last_machine_change >10000) { last_machine_change = curr_t; machine.idle(); }
 			if ( last_machine_change < machine.lastUpdated() ) break;
@@ -612,6 +670,7 @@ void ProcessingThread::operator()()
 #ifdef KEEPSTATS
 		avg_poll_time.update();
 #endif
+		uint64_t cycle_start = microsecs();
 
 #if 0
 		// debug code to work out what machines or systems tend to need processing
@@ -680,6 +739,9 @@ void ProcessingThread::operator()()
 			Channel::handleChannels();
 		}
 
+		if (status == e_waiting)
+			MQTTInterface::processAll();
+
 		if (program_done) break;
 		if (status == e_waiting)  {
 			if (items[internals->CMD_ITEM].revents & ZMQ_POLLIN) {
@@ -733,7 +795,8 @@ void ProcessingThread::operator()()
 				have_command = true;
 			}
 			else {
-				for (unsigned int i = dynamic_poll_start_idx; i < dynamic_poll_start_idx + num_channels; ++i) {
+				unsigned int num_channels = internals->polled_channels.size();
+				for (unsigned int i = internals->NUM_FIXED_ITEMS; i < internals->NUM_FIXED_ITEMS + num_channels; ++i) {
 					if (items[i].revents & ZMQ_POLLIN) {
 						//NB_MSG << "Processing thread has a command from a channel command interface\n";
 						have_command = true;
@@ -751,31 +814,26 @@ void ProcessingThread::operator()()
 				int count = 0;
 				while (have_command && (long)(now - start_time) < internals->cycle_delay/2) {
 					have_command = false;
-					std::list<CommandSocketInfo*>::iterator csi_iter = internals->channel_sockets.begin();
-					unsigned int i = internals->CMD_SYNC_ITEM;
-					while (i<=CommandSocketInfo::lastIndex() && (long)(now - start_time) < internals->cycle_delay/2 ) {
+					/* each pass takes one message from the client interface then from each
+						channel in turn, starting after the channel that was last served
+					*/
+					size_t num_channels = internals->polled_channels.size();
+					size_t first = internals->next_channel;
+					for (size_t k = 0; k <= num_channels && (long)(now - start_time) < internals->cycle_delay/2; ++k) {
 						zmq::socket_t *sock = 0;
-						CommandSocketInfo *info = 0;
-						if (i == internals->CMD_SYNC_ITEM) {
+						unsigned int i = internals->CMD_SYNC_ITEM;
+						size_t channel = 0;
+						if (k == 0) {
 							sock = &command_sync;
 						}
 						else {
-							if (csi_iter == internals->channel_sockets.end()) break;
-							info = *csi_iter++;
-							sock = info->sock;
-						}
-						{
-						int rc = zmq::poll(&items[i], 1, 0);
-						}
-						if (! (items[i].revents & ZMQ_POLLIN) ) {
-							++i;
-							continue;
-						}
-#if 0
-						if (i>5) {
-							NB_MSG << "Processing thread has activity on poll item " << i << " of 0.." << CommandSocketInfo::lastIndex() << "\n";
+							channel = (first + k - 1) % num_channels;
+							i = internals->NUM_FIXED_ITEMS + channel;
+							sock = internals->polled_channels[channel]->sock;
 						}
-#endif
+						zmq::poll(&items[i], 1, 0);
+						if (! (items[i].revents & ZMQ_POLLIN) ) continue;
+						if (k > 0) internals->next_channel = (channel + 1) % num_channels;
 						have_command = true;
 
 						zmq::message_t msg;
@@ -784,6 +842,7 @@ void ProcessingThread::operator()()
 						MessageHeader mh;
 						uint32_t default_id = mh.getId(); // save the msgid to following check
 						if (safeRecv(*sock, &buf, &len, false, 0, mh) ) {
+							uint64_t command_start = microsecs();
 							++count;
 							if (false && len>10){
 								FileLogger fl(program_name);
@@ -792,7 +851,10 @@ void ProcessingThread::operator()()
 								fl.f() << "\n";
 							}
 							if (!buf) continue;
-							IODCommand *command = parseCommandString(buf);
+							if (IOTraceRecorder::instance())
+								IOTraceRecorder::instance()->command( (k == 0) ? "client"
+										: internals->polled_channels[channel]->commandSocketName().c_str(), buf, len);
+							IODCommand *command = acquireCommand(buf);
 							if (command) {
 								bool ok = false;
 								try {
@@ -820,6 +882,7 @@ void ProcessingThread::operator()()
 									//safeSend(*sock, response, strlen(response));
 									//free(response);
 								}
+								command_latency->record(microsecs() - command_start);
 							}
 							else {
 								if (mh.needsReply() || mh.getId() == default_id) {
@@ -842,10 +905,9 @@ void ProcessingThread::operator()()
 								}
 								delete[] buf;
 							}
-							delete command;
+							releaseCommand(command);
 						}
-						++i;
-
+						now = microsecs();
 					}
 					usleep(0);
 					now = microsecs();
@@ -908,51 +970,50 @@ void ProcessingThread::operator()()
 	#ifdef KEEPSTATS
 					avg_clockwork_time.start();
 	#endif
-					std::set<MachineInstance *> to_process;
+					to_process.clear();
 					{
-						boost::mutex::scoped_lock(runnable_mutex);
-						std::set<MachineInstance *>::iterator iter = runnable.begin();
-						while (iter != runnable.end()) {
-							MachineInstance *mi = *iter;
+						boost::recursive_mutex::scoped_lock lock(runnable_mutex);
+						MachineInstance *mi = runnable.front();
+						while (mi) {
+							MachineInstance *next = runnable.next(mi);
 							if (mi->executingCommand() || !mi->pendingEvents().empty() || mi->hasMail()) {
-								to_process.insert(mi);
-  							if (!mi->queuedForStableStateTest()) {
-  								iter = runnable.erase(iter);
-  							}
-  							else iter++;
-              }
-							else iter++;
+								to_process.push_back(mi);
+								if (!mi->queuedForStableStateTest()) runnable.remove(mi);
+							}
+							mi = next;
 						}
 					}
 
 					if (!to_process.empty()) {
 						DBG_SCHEDULER << "processing " << to_process.size() << " machines\n";
 						MachineInstance::processAll(to_process, 150000, MachineInstance::NO_BUILTINS);
+						machines_evaluated += to_process.size();
 					}
+					// announce property changes so that dependents are queued for the stable state check
+					MachineInstance::commitChanges();
 					processing_state = eStableStates;
 				}
 				if (processing_state == eStableStates)
 				{
-					std::set<MachineInstance *> to_process;
-					{	boost::mutex::scoped_lock(runnable_mutex);
-						std::set<MachineInstance *>::iterator iter = runnable.begin();
-						while (iter != runnable.end()) {
-							MachineInstance *mi = *iter;
-							if (mi->executingCommand() || !mi->pendingEvents().empty()) {
-								iter++;
-								continue;
-							}
-							if (mi->queuedForStableStateTest()) {
-								to_process.insert(mi);
-								iter = runnable.erase(iter);
+					to_process.clear();
+					{
+						boost::recursive_mutex::scoped_lock lock(runnable_mutex);
+						MachineInstance *mi = runnable.front();
+						while (mi) {
+							MachineInstance *next = runnable.next(mi);
+							if (!mi->executingCommand() && mi->pendingEvents().empty()
+									&& mi->queuedForStableStateTest()) {
+								to_process.push_back(mi);
+								runnable.remove(mi);
 							}
-							else iter++;
+							mi = next;
 						}
 					}
 
 					if (!to_process.empty()) {
 						DBG_SCHEDULER << "processing stable states\n";
 						MachineInstance::checkStableStates(to_process, 150000);
+						machines_evaluated += to_process.size();
 					}
 					if (i<num_loops-1)
 						processing_state = ePollingMachines;
@@ -1142,10 +1203,31 @@ void ProcessingThread::operator()()
 			checkAndUpdateCycleDelay();
 		}
 
+		MachineInstance::commitChanges(); // fan out the final value of each property changed this cycle
 		machine.idle(); // in case any of the above triggered a change to the machine state
 		last_machine_change = machine.lastUpdated();
+		if (state_table_writer) state_table_writer->update();
+		uint64_t cycle_end = microsecs();
+		cycle_time->record(cycle_end - cycle_start);
+		if (cycle_monitor) cycle_monitor->endCycle(cycle_start, cycle_end, machines_evaluated);
+		if (IOTraceRecorder::instance()) IOTraceRecorder::instance()->endCycle();
+		if (metrics_file() && processing_state == eIdle && cycle_end - last_metrics_write >= 10000000) {
+			if (!LatencyHistogram::writeAll(metrics_file()) && last_metrics_write == 0) {
+				char buf[150];
+				snprintf(buf, 150, "Warning: could not write metrics to %s", metrics_file());
+				MessageLog::instance()->add(buf);
+			}
+			last_metrics_write = cycle_end;
+		}
+		if (cycle_end - last_timer_publish >= 1000000) {
+			CycleTimer::publishAll(system); // deadline and jitter counts of the realtime threads
+			last_timer_publish = cycle_end;
+		}
 		if (program_done) break;
 	}
+	MachineInstance::commitChanges();
+	MachineInstance::setChangeJournalling(false);
+	if (state_table_writer) state_table_writer->close();
 	//		std::cout << std::flush;
 	//		model_mutex.lock();
 	//		model_updated.notify_one();
@@ -2,10 +2,12 @@
 #define __cw_processingthread_h__
 
 #include <set>
+#include <vector>
 #include <boost/thread/mutex.hpp>
 #include "ClientInterface.h"
 #include "AutoStats.h"
 #include "clockwork.h"
+#include "WorkQueue.h"
 
 class IOComponent;
 class HardwareActivation {
@@ -15,6 +17,19 @@ class HardwareActivation {
 		virtual void operator()(void) { }
 };
 
+/* an optional observer of the processing loop, used by the benchmark
+	harness to inject inputs and time each cycle. Its methods are called
+	on the processing thread.
+*/
+class ProcessingCycleMonitor {
+	public:
+		virtual ~ProcessingCycleMonitor() {}
+		virtual bool wantsCycle() { return false; } // wake the loop even if there is no other work
+		virtual void beginCycle() { } // before the loop waits for work
+		// start is the time the loop stopped waiting, the cycle's work is done at end
+		virtual void endCycle(uint64_t start, uint64_t end, unsigned int machines_evaluated) { }
+};
+
 class ProcessingThreadInternals;
 class ControlSystemMachine;
 class CommandSocketInfo;
@@ -31,6 +46,8 @@ public:
 	static void setProcessingThreadInstance( ProcessingThread* pti);
 	CommandSocketInfo *addCommandChannel(Channel *);
 	CommandSocketInfo *addCommandChannel(CommandSocketInfo*);
+	void removeCommandChannel(CommandSocketInfo*);
+	size_t numCommandChannels();
 
 	static void activate(MachineInstance *m);
 	static void suspend(MachineInstance *m);
@@ -57,12 +74,11 @@ public:
 
 	void waitForCommandProcessing(zmq::socket_t &resource_mgr);
 	static uint64_t programStartTime() { return instance()->program_start; }
-
-	std::set<MachineInstance*>::iterator begin() { return runnable.begin(); }
-	std::set<MachineInstance*>::iterator end() { return runnable.end(); }
+	static void setCycleMonitor(ProcessingCycleMonitor *m) { cycle_monitor = m; }
 
 private:
 	static ProcessingThread *instance_;
+	static ProcessingCycleMonitor *cycle_monitor;
 	ProcessingThread(ControlSystemMachine *m, HardwareActivation &activator, IODCommandThread &cmd_interface);
 	ProcessingThread(const ProcessingThread &other);
 	ProcessingThread &operator=(const ProcessingThread &other);
@@ -75,7 +91,8 @@ private:
 	uint64_t program_start;
 
 	boost::recursive_mutex runnable_mutex;
-	std::set<MachineInstance*> runnable;
+	WorkQueue runnable; // machines in the order they became runnable
+	std::vector<MachineInstance*> to_process; // reused by each processing pass
 };
 
 #endif
@@ -0,0 +1,218 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include "Profiler.h"
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <cxxabi.h>
+#include <algorithm>
+#include <fstream>
+
+bool Profiler::enabled = false;
+Profiler::Node *Profiler::current_node = 0;
+
+static const char *kind_prefix[] = { "", "state:", "action:", "message:" };
+
+Profiler::Node::Node(Node *owner, Kind k, const std::string &frame_name)
+		: parent(owner), kind(k), calls(0), total_ns(0), child_ns(0) {
+	std::string name(frame_name);
+	if (k == Action) {
+		// actions are identified by their type
+		int status = 0;
+		char *demangled = abi::__cxa_demangle(frame_name.c_str(), 0, 0, &status);
+		if (demangled && status == 0) name = demangled;
+		free(demangled);
+	}
+	// folded stacks use ';' to separate frames and a space before the count
+	label = kind_prefix[k];
+	for (size_t i = 0; i < name.length(); ++i) {
+		char ch = name[i];
+		label += (ch == ';' || ch == ' ' || ch == '\n') ? '_' : ch;
+	}
+}
+
+Profiler::Node::~Node() {
+	std::map<const void *, Node*>::iterator k_iter = keyed_children.begin();
+	while (k_iter != keyed_children.end()) delete (*k_iter++).second;
+	std::map<std::string, Node*>::iterator n_iter = named_children.begin();
+	while (n_iter != named_children.end()) delete (*n_iter++).second;
+}
+
+Profiler::Node *Profiler::Node::child(Kind k, const void *key, const char *name) {
+	std::map<const void *, Node*>::iterator found = keyed_children.find(key);
+	if (found != keyed_children.end()) return (*found).second;
+	Node *node = new Node(this, k, (name) ? name : "unknown");
+	keyed_children[key] = node;
+	return node;
+}
+
+Profiler::Node *Profiler::Node::child(Kind k, const std::string &name) {
+	std::map<std::string, Node*>::iterator found = named_children.find(name);
+	if (found != named_children.end()) return (*found).second;
+	Node *node = new Node(this, k, name);
+	named_children[name] = node;
+	return node;
+}
+
+void Profiler::Node::clear() {
+	calls = 0;
+	total_ns = 0;
+	child_ns = 0;
+	std::map<const void *, Node*>::iterator k_iter = keyed_children.begin();
+	while (k_iter != keyed_children.end()) (*k_iter++).second->clear();
+	std::map<std::string, Node*>::iterator n_iter = named_children.begin();
+	while (n_iter != named_children.end()) (*n_iter++).second->clear();
+}
+
+Profiler::Node *Profiler::root() {
+	static Node *root_node = new Node(0, Machine, "clockwork");
+	return root_node;
+}
+
+void Profiler::enable(bool which) {
+	enabled = which;
+}
+
+void Profiler::reset() {
+	root()->clear();
+}
+
+void Profiler::leave(Node *node, uint64_t elapsed) {
+	++node->calls;
+	node->total_ns += elapsed;
+	if (node->parent) node->parent->child_ns += elapsed;
+	current_node = node->parent;
+}
+
+static uint64_t nanosecs() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000L + now.tv_nsec;
+}
+
+void ProfileScope::start() {
+	Profiler::enter(node);
+	start_time = nanosecs();
+}
+
+uint64_t ProfileScope::elapsed() {
+	return nanosecs() - start_time;
+}
+
+static uint64_t selfTime(const Profiler::Node *node) {
+	// a frame entered before a reset may report more child time than total time
+	return (node->total_ns > node->child_ns) ? node->total_ns - node->child_ns : 0;
+}
+
+template<class Visitor> static void visit(Profiler::Node *node, Visitor &v) {
+	v(node);
+	std::map<const void *, Profiler::Node*>::iterator k_iter = node->keyed_children.begin();
+	while (k_iter != node->keyed_children.end()) visit((*k_iter++).second, v);
+	std::map<std::string, Profiler::Node*>::iterator n_iter = node->named_children.begin();
+	while (n_iter != node->named_children.end()) visit((*n_iter++).second, v);
+}
+
+struct FoldedWriter {
+	FoldedWriter(std::ostream &o, Profiler::Node *r) : out(o), root(r) {}
+	void operator()(Profiler::Node *node) {
+		if (node == root || !node->calls) return;
+		uint64_t self = selfTime(node);
+		if (!self) return;
+		std::vector<Profiler::Node*> path;
+		for (Profiler::Node *n = node; n && n != root; n = n->parent) path.push_back(n);
+		const char *sep = "";
+		while (!path.empty()) {
+			out << sep << path.back()->label;
+			path.pop_back();
+			sep = ";";
+		}
+		out << " " << self << "\n";
+	}
+	std::ostream &out;
+	Profiler::Node *root;
+};
+
+void Profiler::writeFolded(std::ostream &out) {
+	FoldedWriter writer(out, root());
+	visit(root(), writer);
+}
+
+bool Profiler::writeFolded(const char *filename) {
+	std::string tmpname(filename);
+	tmpname += ".tmp";
+	{
+		std::ofstream out(tmpname.c_str());
+		if (!out) return false;
+		writeFolded(out);
+		out.close();
+		if (!out) return false;
+	}
+	return rename(tmpname.c_str(), filename) == 0;
+}
+
+struct FrameTotal {
+	FrameTotal() : calls(0), self_ns(0), total_ns(0) {}
+	uint64_t calls;
+	uint64_t self_ns;
+	uint64_t total_ns;
+};
+
+struct FrameCollector {
+	FrameCollector(Profiler::Node *r) : root(r) {}
+	void operator()(Profiler::Node *node) {
+		if (node == root || !node->calls) return;
+		// states, actions and messages are named for the machine they belong to
+		std::string frame(node->label);
+		if (node->kind != Profiler::Machine) {
+			Profiler::Node *owner = node->parent;
+			while (owner && owner != root && owner->kind != Profiler::Machine) owner = owner->parent;
+			if (owner && owner != root) frame = owner->label + ";" + frame;
+		}
+		FrameTotal &ft = frames[frame];
+		ft.calls += node->calls;
+		ft.self_ns += selfTime(node);
+		ft.total_ns += node->total_ns;
+	}
+	Profiler::Node *root;
+	std::map<std::string, FrameTotal> frames;
+};
+
+static bool moreSelfTime(const std::pair<std::string, FrameTotal> &a,
+		const std::pair<std::string, FrameTotal> &b) {
+	return a.second.self_ns > b.second.self_ns;
+}
+
+void Profiler::reportTop(cJSON *result, unsigned int n) {
+	FrameCollector collector(root());
+	visit(root(), collector);
+	std::vector< std::pair<std::string, FrameTotal> > frames(collector.frames.begin(), collector.frames.end());
+	std::sort(frames.begin(), frames.end(), moreSelfTime);
+	if (frames.size() > n) frames.resize(n);
+	for (unsigned int i = 0; i < frames.size(); ++i) {
+		cJSON *row = cJSON_CreateArray();
+		cJSON_AddItemToArray(row, cJSON_CreateString("PROFILE"));
+		cJSON_AddItemToArray(row, cJSON_CreateString(frames[i].first.c_str()));
+		cJSON_AddItemToArray(row, cJSON_CreateNumber(frames[i].second.calls));
+		cJSON_AddItemToArray(row, cJSON_CreateNumber(frames[i].second.self_ns / 1000.0));
+		cJSON_AddItemToArray(row, cJSON_CreateNumber(frames[i].second.total_ns / 1000.0));
+		cJSON_AddItemToArray(result, row);
+	}
+}
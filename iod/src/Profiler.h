@@ -0,0 +1,119 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include <stdint.h>
+#include <ostream>
+#include <string>
+#include <map>
+#include <vector>
+#include "cJSON.h"
+
+/*
+	An instrumented profiler that attributes processing time to machines and,
+	within a machine, to the stable state conditions it evaluates, the actions
+	it runs and the messages it handles. Calls nest, so time spent in a machine
+	that is driven by another machine's action is charged to that action's
+	call path as well as to the machine itself.
+
+	Profiling is switched on and off at runtime with the PROFILE command. When
+	it is off a ProfileScope costs a single test of Profiler::enabled. Scopes
+	are only entered on the processing thread and the profile is only read
+	by commands, which also run on that thread, so no locking is done.
+
+	The call tree can be written as folded stacks for flamegraph.pl or reduced
+	to a table of the frames with the most self time.
+*/
+class Profiler {
+public:
+	enum Kind { Machine, StableState, Action, Message };
+
+	struct Node {
+		Node(Node *parent, Kind kind, const std::string &label);
+		~Node();
+		Node *child(Kind kind, const void *key, const char *label);
+		Node *child(Kind kind, const std::string &label);
+		void clear();
+
+		Node *parent;
+		Kind kind;
+		std::string label;
+		uint64_t calls;
+		uint64_t total_ns; // includes the time of nested frames
+		uint64_t child_ns;
+		std::map<const void *, Node*> keyed_children;
+		std::map<std::string, Node*> named_children;
+	};
+
+	static bool enabled;
+
+	static void enable(bool which);
+	static void reset(); // clears the counts but keeps the call tree
+	static Node *current() { return (current_node) ? current_node : root(); }
+	static void enter(Node *node) { current_node = node; }
+	static void leave(Node *node, uint64_t elapsed);
+
+	// one line per call path with self time: "frame;frame;frame nanoseconds"
+	static void writeFolded(std::ostream &out);
+	static bool writeFolded(const char *filename);
+	// [ "PROFILE", frame, calls, self_us, total_us ] for the n frames with the most self time;
+	// the times of a frame that appears on several call paths are summed
+	static void reportTop(cJSON *result, unsigned int n);
+
+private:
+	static Node *root();
+	static Node *current_node;
+};
+
+/*
+	Charges the time between construction and destruction to a frame below
+	the current one. Frames keyed by an address use the label only the first
+	time the frame is seen; the address must remain valid for the life of
+	the program (machines, stable states and type names qualify).
+*/
+class ProfileScope {
+public:
+	ProfileScope(Profiler::Kind kind, const void *key, const char *label) : node(0) {
+		if (Profiler::enabled) {
+			node = Profiler::current()->child(kind, key, label);
+			start();
+		}
+	}
+	ProfileScope(Profiler::Kind kind, const std::string &label) : node(0) {
+		if (Profiler::enabled) {
+			node = Profiler::current()->child(kind, label);
+			start();
+		}
+	}
+	~ProfileScope() {
+		if (node) Profiler::leave(node, elapsed());
+	}
+private:
+	void start();
+	uint64_t elapsed();
+	ProfileScope(const ProfileScope &);
+	ProfileScope &operator=(const ProfileScope &);
+	Profiler::Node *node;
+	uint64_t start_time;
+};
+
+#endif
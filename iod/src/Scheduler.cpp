@@ -26,6 +26,8 @@
 #include "DebugExtra.h"
 #include "MessagingInterface.h"
 #include "MessageLog.h"
+#include "ObjectPool.h"
+#include "LatencyHistogram.h"
 #include <zmq.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/chrono.hpp>
@@ -180,6 +182,19 @@ ScheduledItem::ScheduledItem(uint64_t starting, long delay, Trigger *t) : packag
 }
 
 
+static ObjectPool *scheduled_item_pool() {
+	static ObjectPool *pool = new ObjectPool("ScheduledItem");
+	return pool;
+}
+
+void *ScheduledItem::operator new(size_t size) {
+	return scheduled_item_pool()->allocate(size);
+}
+
+void ScheduledItem::operator delete(void *p, size_t size) {
+	scheduled_item_pool()->release(p, size);
+}
+
 ScheduledItem::~ScheduledItem() {
 	if (trigger) trigger->release();
 	trigger = 0;
@@ -319,6 +334,9 @@ void Scheduler::idle() {
 		boost::this_thread::sleep_for(boost::chrono::microseconds(100));
 	NB_MSG << "Scheduler started\n";
 
+	LatencyHistogram *lateness = new LatencyHistogram("scheduler_lateness",
+		"How long after its delivery time a scheduled item is activated");
+
 	state = e_waiting;
 	bool is_ready;
 	uint64_t last_poll = nowMicrosecs();
@@ -361,6 +379,8 @@ void Scheduler::idle() {
 				DBG_SCHEDULER << "Scheduler activating scheduled item " << (*item) << " ready. " << items.size() << " items remain\n";
 				pop();
 			}
+			if (last_poll > item->delivery_time) lateness->record(last_poll - item->delivery_time);
+			else lateness->record(0);
 			next_time = 0;
 			if (item->trigger) {
 				if (item->trigger->enabled()) {
@@ -48,6 +48,8 @@ struct ScheduledItem {
 	ScheduledItem(uint64_t starting, long delay, Trigger *t);
 	~ScheduledItem();
     std::ostream &operator <<(std::ostream &out) const;
+	static void *operator new(size_t size); // allocated from a pool, see ObjectPool.h
+	static void operator delete(void *p, size_t size);
 
 private:
 	bool operator<=(const ScheduledItem& other) const;
@@ -21,6 +21,8 @@
 #include "SetOperationAction.h"
 #include "MachineInstance.h"
 #include "Logger.h"
+#include "ListAggregates.h"
+#include "ValueIndex.h"
 
 
 static void debugParameterChange(MachineInstance *dest_machine) {
@@ -101,6 +103,7 @@ bool CompareSymbolAndValue(MachineInstance*scope, Value &sym, std::string &prop,
 }
 
 bool MachineIncludesParameter(MachineInstance *m, Value &param) {
+    if (m->_type == "LIST") return m->listAggregates()->includes(param);
     for (unsigned int i=0; i<m->parameters.size(); ++i) {
         if (m->parameters[i].val == param) return true;
     }
@@ -204,6 +207,67 @@ public:
 	}
 };
 
+/* Without a predicate, each item of a that refers to a machine is compared with
+	each item of b that refers to a machine, by value or by the value of the named
+	property, and is copied once for every match. Unless a symbol is compared with a
+	string or number (which compares a property of the machine with the value and
+	stops at the first match) this can be done as a hash join on b, giving the same
+	result in the same order.
+*/
+static bool intersectByHash(MachineInstance *owner, MachineInstance *source_a_machine,
+		MachineInstance *source_b_machine, MachineInstance *dest_machine,
+		const std::string &property_name, IndexTracker &track_a, IndexTracker &track_b) {
+	if (dest_machine == source_a_machine || dest_machine == source_b_machine) return false;
+	bool a_symbols = false, a_values = false, b_symbols = false, b_values = false;
+	for (unsigned int i = 0; i < source_a_machine->parameters.size(); ++i) {
+		Value &a(source_a_machine->parameters.at(i).val);
+		if (!owner->lookup(a)) continue;
+		if (a.kind == Value::t_symbol) a_symbols = true;
+		else if (a.kind == Value::t_string || a.kind == Value::t_integer) a_values = true;
+	}
+	Value *last_b = 0;
+	for (unsigned int j = 0; j < source_b_machine->parameters.size(); ++j) {
+		Value &b(source_b_machine->parameters.at(j).val);
+		if (!b.cached_machine) owner->lookup(b);
+		if (!b.cached_machine) continue;
+		if (b.kind == Value::t_symbol) b_symbols = true;
+		else if (b.kind == Value::t_string || b.kind == Value::t_integer) b_values = true;
+		last_b = &b;
+	}
+	if ( (a_symbols && b_values) || (b_symbols && a_values) ) return false;
+
+	ValueIndex index;
+	for (unsigned int j = 0; j < source_b_machine->parameters.size(); ++j) {
+		Value &b(source_b_machine->parameters.at(j).val);
+		if (!b.cached_machine) continue;
+		if (property_name.length())
+			index.add(b.cached_machine->getValue(property_name));
+		else
+			index.add(b);
+	}
+	for (unsigned int i = 0; i < source_a_machine->parameters.size(); ++i) {
+		Value &a(source_a_machine->parameters.at(i).val);
+		if (!a.cached_machine) continue;
+		setListItem(source_a_machine, a, track_a.index, track_a.add_item);
+		if (!last_b) continue;
+		// the ITEM of b is left at the last item, as it is after a full scan
+		setListItem(source_b_machine, *last_b, track_b.index, track_b.add_item);
+		source_a_machine->localised_names.erase("ITEM");
+		source_b_machine->localised_names.erase("ITEM");
+		if (property_name.length()) {
+			const Value &v1 = a.cached_machine->getValue(property_name);
+			if (v1 == SymbolTable::Null) continue;
+			for (unsigned int n = index.count(v1); n > 0; --n)
+				dest_machine->addParameter(a, a.cached_machine);
+		}
+		else {
+			for (unsigned int n = index.count(a); n > 0; --n)
+				dest_machine->addParameter(a);
+		}
+	}
+	return true;
+}
+
 Action::Status IntersectSetOperation::doOperation() {
     long num_copied = 0;
     long to_copy;
@@ -221,8 +285,14 @@ Action::Status IntersectSetOperation::doOperation() {
 #endif
 	IndexTracker track_a(source_a_machine->locals);
 	IndexTracker track_b(source_b_machine->locals);
-
 	unsigned int i=0;
+
+#ifndef DEPENDENCYFIX
+	if (!condition.predicate && intersectByHash(owner, source_a_machine, source_b_machine, dest_machine,
+			property_name, track_a, track_b))
+		goto doneIntersectOperation;
+#endif
+
     while (i < source_a_machine->parameters.size()) {
         Value &a(source_a_machine->parameters.at(i).val);
         MachineInstance *mi = owner->lookup(a);
@@ -384,7 +454,38 @@ DifferenceSetOperation::DifferenceSetOperation(MachineInstance *m, const SetOper
     
 }
 
+/* Items are compared by value unless a symbol is compared with a string or
+	number, so unless the lists mix these the items of a not in b can be found
+	with a hash of b.
+*/
+static bool differenceByHash(MachineInstance *source_a_machine, MachineInstance *source_b_machine,
+		MachineInstance *dest_machine) {
+	if (dest_machine == source_a_machine || dest_machine == source_b_machine) return false;
+	bool a_symbols = false, a_values = false, b_symbols = false, b_values = false;
+	for (unsigned int i = 0; i < source_a_machine->parameters.size(); ++i) {
+		Value::Kind kind = source_a_machine->parameters[i].val.kind;
+		if (kind == Value::t_symbol) a_symbols = true;
+		else if (kind == Value::t_string || kind == Value::t_integer) a_values = true;
+	}
+	for (unsigned int j = 0; j < source_b_machine->parameters.size(); ++j) {
+		Value::Kind kind = source_b_machine->parameters[j].val.kind;
+		if (kind == Value::t_symbol) b_symbols = true;
+		else if (kind == Value::t_string || kind == Value::t_integer) b_values = true;
+	}
+	if ( (a_symbols && b_values) || (b_symbols && a_values) ) return false;
+
+	ValueIndex index;
+	for (unsigned int j = 0; j < source_b_machine->parameters.size(); ++j)
+		index.add(source_b_machine->parameters[j].val);
+	for (unsigned int i = 0; i < source_a_machine->parameters.size(); ++i) {
+		Value &a(source_a_machine->parameters.at(i).val);
+		if (!index.contains(a)) dest_machine->addParameter(a);
+	}
+	return true;
+}
+
 Action::Status DifferenceSetOperation::doOperation() {
+    if (!differenceByHash(source_a_machine, source_b_machine, dest_machine))
     for (unsigned int i=0; i < source_a_machine->parameters.size(); ++i) {
         Value &a(source_a_machine->parameters.at(i).val);
         bool found = false;
@@ -0,0 +1,271 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include "SharedStateTable.h"
+#include <set>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "MachineInstance.h"
+#include "MessageLog.h"
+#include "Logger.h"
+#include "value.h"
+
+SharedStateTable *SharedStateTable::instance_ = 0;
+
+SharedStateTable *SharedStateTable::instance() {
+	if (!instance_) instance_ = new SharedStateTable;
+	return instance_;
+}
+
+SharedStateTable::SharedStateTable() : fd(-1), size(0), header(0), entries(0),
+		known_machines(0), published_change(0), cycle(0) {
+}
+
+SharedStateTable::~SharedStateTable() {
+	close();
+}
+
+// mark any existing segment of the given name as invalid so its readers reopen, then remove it.
+// A segment that is still being written by another live process is left alone.
+static bool retire(const char *name) {
+	int old_fd = shm_open(name, O_RDWR, 0);
+	if (old_fd == -1) return true;
+	struct stat st;
+	if (fstat(old_fd, &st) == 0 && (size_t)st.st_size >= sizeof(struct cw_state_header)) {
+		void *mem = mmap(0, sizeof(struct cw_state_header), PROT_READ | PROT_WRITE, MAP_SHARED, old_fd, 0);
+		if (mem != MAP_FAILED) {
+			struct cw_state_header *hdr = (struct cw_state_header *)mem;
+			pid_t writer = (pid_t)hdr->writer_pid;
+			if (hdr->magic == CW_STATE_MAGIC && writer && writer != getpid()
+					&& (kill(writer, 0) == 0 || errno == EPERM)) {
+				munmap(mem, sizeof(struct cw_state_header));
+				::close(old_fd);
+				char buf[200];
+				snprintf(buf, 200, "Error: shared state table %s is in use by process %d", name, (int)writer);
+				MessageLog::instance()->add(buf);
+				NB_MSG << buf << "\n";
+				return false;
+			}
+			hdr->magic = 0;
+			munmap(mem, sizeof(struct cw_state_header));
+		}
+	}
+	::close(old_fd);
+	shm_unlink(name);
+	return true;
+}
+
+bool SharedStateTable::open(const char *segment_name) {
+	close();
+	name = (segment_name) ? segment_name : CW_STATE_DEFAULT_NAME;
+	if (name[0] != '/') name = "/" + name;
+	if (!retire(name.c_str())) { name.clear(); return false; }
+	if (!allocate(64)) return false;
+	rebuild();
+	return true;
+}
+
+void SharedStateTable::close() {
+	if (header) {
+		header->magic = 0;
+		munmap(header, size);
+		::close(fd);
+		shm_unlink(name.c_str());
+	}
+	header = 0;
+	entries = 0;
+	fd = -1;
+	size = 0;
+	slots.clear();
+	machines.clear();
+	known_machines = 0;
+}
+
+bool SharedStateTable::allocate(unsigned int required) {
+	if (header && header->max_entries >= required) return true;
+	uint32_t layout = 0;
+	if (header) {
+		layout = header->layout;
+		header->magic = 0;
+		munmap(header, size);
+		::close(fd);
+		shm_unlink(name.c_str());
+		header = 0;
+		entries = 0;
+	}
+	unsigned int capacity = 64;
+	while (capacity < required + required / 4) capacity *= 2;
+	size = cw_state_segment_size(capacity);
+
+	fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0644);
+	if (fd == -1 || ftruncate(fd, size) == -1) {
+		char buf[200];
+		snprintf(buf, 200, "Error: failed to create shared state table %s: %s", name.c_str(), strerror(errno));
+		MessageLog::instance()->add(buf);
+		NB_MSG << buf << "\n";
+		if (fd != -1) { ::close(fd); shm_unlink(name.c_str()); }
+		fd = -1;
+		return false;
+	}
+	void *mem = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (mem == MAP_FAILED) {
+		char buf[200];
+		snprintf(buf, 200, "Error: failed to map shared state table %s: %s", name.c_str(), strerror(errno));
+		MessageLog::instance()->add(buf);
+		NB_MSG << buf << "\n";
+		::close(fd);
+		shm_unlink(name.c_str());
+		fd = -1;
+		return false;
+	}
+	memset(mem, 0, size);
+	header = (struct cw_state_header *)mem;
+	entries = (struct cw_state_entry *)((char*)mem + sizeof(struct cw_state_header));
+	header->version = CW_STATE_VERSION;
+	header->layout = layout;
+	header->max_entries = capacity;
+	header->entry_size = sizeof(struct cw_state_entry);
+	header->writer_pid = getpid();
+	__sync_synchronize();
+	header->magic = CW_STATE_MAGIC;
+	return true;
+}
+
+void SharedStateTable::beginWrite() {
+	++header->sequence;
+	__sync_synchronize();
+}
+
+void SharedStateTable::endWrite() {
+	__sync_synchronize();
+	++header->sequence;
+}
+
+static void copyName(char *dest, const std::string &src, size_t len) {
+	strncpy(dest, src.c_str(), len);
+	dest[len-1] = 0;
+}
+
+void SharedStateTable::rebuild() {
+	slots.clear();
+	machines.clear();
+	known_machines = 0;
+	uint64_t change = MachineInstance::changeSequence();
+	std::list<MachineInstance*>::iterator iter = MachineInstance::begin();
+	while (iter != MachineInstance::end()) {
+		MachineInstance *m = *iter++;
+		++known_machines;
+		MachineSlots ms;
+		ms.machine = m;
+		ms.first = slots.size();
+		slots.push_back(Slot(m, "STATE"));
+		std::set<std::string> exported;
+		if (m->_type == "VARIABLE" || m->_type == "CONSTANT") {
+			slots.push_back(Slot(m, "VALUE"));
+			exported.insert("VALUE");
+		}
+		std::map<std::string, ModbusAddress>::const_iterator ex = m->modbus_exports.begin();
+		while (ex != m->modbus_exports.end()) {
+			const ModbusAddress &addr = (*ex).second;
+			std::string property((*ex++).first);
+			if (addr.getSource() != ModbusAddress::property) continue;
+			if (property.rfind('.') != std::string::npos) property = property.substr(property.rfind('.') + 1);
+			if (exported.count(property)) continue;
+			exported.insert(property);
+			slots.push_back(Slot(m, property));
+		}
+		ms.count = slots.size() - ms.first;
+		machines.push_back(ms);
+	}
+	if (!allocate(slots.size())) return;
+	beginWrite();
+	memset(entries, 0, header->max_entries * sizeof(struct cw_state_entry));
+	for (unsigned int i = 0; i < slots.size(); ++i) writeEntry(i, slots[i]);
+	header->num_entries = slots.size();
+	++header->layout;
+	header->cycle = cycle;
+	header->update_time = microsecs();
+	endWrite();
+	published_change = change;
+}
+
+void SharedStateTable::writeEntry(unsigned int index, const Slot &slot) {
+	struct cw_state_entry *e = entries + index;
+	char value[CW_STATE_VALUE_LEN];
+	int32_t kind = cw_state_none;
+	int64_t ival = 0;
+	double fval = 0.0;
+	if (slot.property == "STATE") {
+		kind = cw_state_state;
+		copyName(value, slot.machine->getCurrentStateString(), CW_STATE_VALUE_LEN);
+	}
+	else {
+		const Value &v = slot.machine->getValue(slot.property);
+		long l;
+		double d;
+		if (v.kind == Value::t_float && v.asFloat(d)) {
+			kind = cw_state_float;
+			fval = d;
+			ival = (int64_t)d;
+		}
+		else if ( (v.kind == Value::t_integer || v.kind == Value::t_bool) && v.asInteger(l)) {
+			kind = cw_state_integer;
+			ival = l;
+			fval = l;
+		}
+		else if (v.kind != Value::t_empty)
+			kind = cw_state_string;
+		copyName(value, v.asString(), CW_STATE_VALUE_LEN);
+	}
+	if (e->kind == kind && e->ival == ival && e->fval == fval && strcmp(e->value, value) == 0
+			&& e->machine[0]) return;
+	copyName(e->machine, slot.machine->fullName(), CW_STATE_NAME_LEN);
+	copyName(e->property, slot.property, CW_STATE_PROPERTY_LEN);
+	memcpy(e->value, value, CW_STATE_VALUE_LEN);
+	e->kind = kind;
+	e->ival = ival;
+	e->fval = fval;
+	e->changed = cycle;
+}
+
+void SharedStateTable::update() {
+	if (!header) return;
+	++cycle;
+	if (MachineInstance::machineCount() != known_machines) { rebuild(); return; }
+	uint64_t change = MachineInstance::changeSequence();
+	if (change == published_change) return;
+	beginWrite();
+	std::vector<MachineSlots>::iterator iter = machines.begin();
+	while (iter != machines.end()) {
+		const MachineSlots &ms = *iter++;
+		if (ms.machine->lastChange() <= published_change) continue;
+		for (unsigned int i = ms.first; i < ms.first + ms.count; ++i) writeEntry(i, slots[i]);
+	}
+	header->cycle = cycle;
+	header->update_time = microsecs();
+	endWrite();
+	published_change = change;
+}
@@ -0,0 +1,84 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __SHAREDSTATETABLE_H__
+#define __SHAREDSTATETABLE_H__
+
+#include <string>
+#include <vector>
+#include <inttypes.h>
+#include "statetable.h"
+
+class MachineInstance;
+class Value;
+
+/*
+	Publishes machine states and exported properties to a shared memory
+	segment (see statetable.h) so that local readers do not need to
+	go through the command interface. Only called from the processing thread.
+*/
+class SharedStateTable {
+public:
+	static SharedStateTable *instance();
+
+	bool open(const char *name);
+	void close();
+	bool isOpen() const { return header != 0; }
+
+	// copy any machines that have changed since the last call into the table
+	void update();
+
+private:
+	SharedStateTable();
+	SharedStateTable(const SharedStateTable &);
+	SharedStateTable &operator=(const SharedStateTable &);
+	~SharedStateTable();
+
+	struct Slot {
+		MachineInstance *machine;
+		std::string property;
+		Slot(MachineInstance *m, const std::string &p) : machine(m), property(p) {}
+	};
+	struct MachineSlots {
+		MachineInstance *machine;
+		unsigned int first;
+		unsigned int count;
+	};
+
+	bool allocate(unsigned int entries);
+	void rebuild();
+	void writeEntry(unsigned int index, const Slot &slot);
+	void beginWrite();
+	void endWrite();
+
+	static SharedStateTable *instance_;
+	std::string name;
+	int fd;
+	size_t size;
+	struct cw_state_header *header;
+	struct cw_state_entry *entries;
+	std::vector<Slot> slots;
+	std::vector<MachineSlots> machines;
+	size_t known_machines;
+	uint64_t published_change;
+	uint64_t cycle;
+};
+
+#endif
@@ -1,6 +1,7 @@
 #include <boost/thread/recursive_mutex.hpp>
 #include <boost/thread/mutex.hpp>
 #include "SharedWorkSet.h"
+#include "MachineInstance.h"
 
 SharedWorkSet *SharedWorkSet::instance_ = 0;
 
@@ -9,19 +10,16 @@ SharedWorkSet *SharedWorkSet::instance() {
 	return instance_;
 }
 
+SharedWorkSet::SharedWorkSet() : busy_machines(&MachineInstance::busy_node) {}
+
 void SharedWorkSet::add(MachineInstance *m) {
 	boost::recursive_mutex::scoped_lock lock(mutex);
-	busy_machines.insert(m);
+	busy_machines.push(m);
 }
 
 void SharedWorkSet::remove(MachineInstance *m) {
 	boost::recursive_mutex::scoped_lock scoped_lock(mutex);
-	busy_machines.erase(m);
-}
-
-std::set<MachineInstance*>::iterator SharedWorkSet::erase(std::set<MachineInstance*>::iterator &iter) {
-	boost::recursive_mutex::scoped_lock scoped_lock(mutex);
-	return busy_machines.erase(iter);
+	busy_machines.remove(m);
 }
 
 bool SharedWorkSet::empty() {
@@ -33,6 +31,3 @@ size_t SharedWorkSet::size() {
 	boost::recursive_mutex::scoped_lock scoped_lock(mutex);
 	return busy_machines.size();
 }
-
-std::set<MachineInstance*>::iterator SharedWorkSet::begin() { return busy_machines.begin(); }
-std::set<MachineInstance*>::iterator SharedWorkSet::end() { return busy_machines.end(); }
@@ -1,8 +1,9 @@
 #ifndef __SHAREDWORKSET_H
 #define __SHAREDWORKSET_H
 
-#include <set>
 #include <boost/thread/mutex.hpp>
+#include <boost/thread/recursive_mutex.hpp>
+#include "WorkQueue.h"
 
 class MachineInstance;
 class SharedWorkSet {
@@ -10,17 +11,17 @@ public:
 	static SharedWorkSet *instance();
 	void add(MachineInstance *m);
 	void remove(MachineInstance *m);
-	std::set<MachineInstance*>::iterator erase(std::set<MachineInstance*>::iterator &iter);
 	bool empty();
 	size_t size();
-	std::set<MachineInstance*>::iterator begin();
-	std::set<MachineInstance*>::iterator end();
+	// iterate in the order machines became busy, hold the mutex while iterating
+	MachineInstance *front() { return busy_machines.front(); }
+	MachineInstance *next(MachineInstance *m) { return busy_machines.next(m); }
 	boost::recursive_mutex &getMutex() { return mutex; }
 private:
 	static SharedWorkSet *instance_;
 	boost::recursive_mutex mutex;
-	SharedWorkSet() {}
-	std::set<MachineInstance*> busy_machines; // machines that have work queued to them
+	SharedWorkSet();
+	WorkQueue busy_machines; // machines that have work queued to them
 };
 
 #endif
@@ -31,7 +31,7 @@
 
 class Statistic {
 public:
-    Statistic(const char *msg) : text(msg), sum(0), count(0), min_value(LONG_MAX), max_value(LONG_MIN) {};
+    Statistic(const char *msg) : text(msg), sum(0), count(0), min_value(LONG_MAX), max_value(LONG_MIN), ssq(0) {};
     Statistic &operator=(const Statistic &other);
     std::ostream &operator<<(std::ostream &out) const;
     bool operator==(const Statistic &other);
@@ -41,6 +41,7 @@ public:
 		count = 0;
 		min_value = LONG_MAX;
 		max_value = LONG_MIN;
+		ssq = 0;
 	}
 
 	void add(long new_value) {
@@ -0,0 +1,103 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include "ValueIndex.h"
+
+unsigned int ValueIndex::matches(const Bucket &bucket, const Value &v, bool first_only) {
+	unsigned int n = 0;
+	for (unsigned int i = 0; i < bucket.size(); ++i) {
+		if (bucket[i] == v) {
+			++n;
+			if (first_only) break;
+		}
+	}
+	return n;
+}
+
+bool ValueIndex::removeFrom(Bucket &bucket, const Value &v) {
+	// equal values may differ in kind, prefer to remove one of the same kind
+	Bucket::iterator found = bucket.end();
+	for (Bucket::iterator iter = bucket.begin(); iter != bucket.end(); ++iter) {
+		if (*iter == v) {
+			if ((*iter).kind == v.kind) { found = iter; break; }
+			if (found == bucket.end()) found = iter;
+		}
+	}
+	if (found == bucket.end()) return false;
+	bucket.erase(found);
+	return true;
+}
+
+void ValueIndex::add(const Value &v) {
+	std::string key;
+	if (v.hashKey(key))
+		hashed[key].push_back(v);
+	else
+		unhashed.push_back(v);
+	++entries;
+}
+
+bool ValueIndex::remove(const Value &v) {
+	std::string key;
+	bool done = false;
+	if (v.hashKey(key)) {
+		std::unordered_map<std::string, Bucket>::iterator found = hashed.find(key);
+		if (found != hashed.end()) {
+			done = removeFrom((*found).second, v);
+			if ((*found).second.empty()) hashed.erase(found);
+		}
+	}
+	if (!done) done = removeFrom(unhashed, v);
+	if (done) --entries;
+	return done;
+}
+
+void ValueIndex::clear() {
+	hashed.clear();
+	unhashed.clear();
+	entries = 0;
+}
+
+bool ValueIndex::contains(const Value &v) const {
+	std::string key;
+	if (v.hashKey(key)) {
+		std::unordered_map<std::string, Bucket>::const_iterator found = hashed.find(key);
+		if (found != hashed.end() && matches((*found).second, v, true)) return true;
+		return matches(unhashed, v, true) > 0;
+	}
+	std::unordered_map<std::string, Bucket>::const_iterator iter = hashed.begin();
+	while (iter != hashed.end()) {
+		if (matches((*iter++).second, v, true)) return true;
+	}
+	return matches(unhashed, v, true) > 0;
+}
+
+unsigned int ValueIndex::count(const Value &v) const {
+	std::string key;
+	unsigned int n = matches(unhashed, v, false);
+	if (v.hashKey(key)) {
+		std::unordered_map<std::string, Bucket>::const_iterator found = hashed.find(key);
+		if (found != hashed.end()) n += matches((*found).second, v, false);
+		return n;
+	}
+	std::unordered_map<std::string, Bucket>::const_iterator iter = hashed.begin();
+	while (iter != hashed.end()) n += matches((*iter++).second, v, false);
+	return n;
+}
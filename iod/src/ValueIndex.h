@@ -0,0 +1,58 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __ValueIndex_h__
+#define __ValueIndex_h__
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "value.h"
+
+/*
+	A hash index of values that answers whether, or how many times, a value
+	equal to a given value (by Value::operator==) has been added. Candidates
+	are found by Value::hashKey and confirmed by comparison; values that have
+	no key are kept aside and compared with every probe, and a probe that
+	has no key is compared with everything.
+*/
+class ValueIndex {
+public:
+	void add(const Value &v);
+	bool remove(const Value &v);
+	void clear();
+
+	bool contains(const Value &v) const;
+	unsigned int count(const Value &v) const;
+	size_t size() const { return entries; }
+
+	ValueIndex() : entries(0) {}
+
+private:
+	typedef std::vector<Value> Bucket;
+	static unsigned int matches(const Bucket &bucket, const Value &v, bool first_only);
+	static bool removeFrom(Bucket &bucket, const Value &v);
+
+	std::unordered_map<std::string, Bucket> hashed;
+	Bucket unhashed;
+	size_t entries;
+};
+
+#endif
@@ -0,0 +1,43 @@
+#include "WorkQueue.h"
+#include "MachineInstance.h"
+
+bool WorkQueue::push(MachineInstance *m) {
+	WorkQueueNode &node = m->*node_member;
+	if (node.queued) return false;
+	node.queued = true;
+	node.next = 0;
+	node.prev = tail;
+	if (tail) (tail->*node_member).next = m; else head = m;
+	tail = m;
+	++count;
+	return true;
+}
+
+bool WorkQueue::remove(MachineInstance *m) {
+	WorkQueueNode &node = m->*node_member;
+	if (!node.queued) return false;
+	if (node.prev) (node.prev->*node_member).next = node.next; else head = node.next;
+	if (node.next) (node.next->*node_member).prev = node.prev; else tail = node.prev;
+	node.prev = node.next = 0;
+	node.queued = false;
+	--count;
+	return true;
+}
+
+MachineInstance *WorkQueue::pop() {
+	MachineInstance *m = head;
+	if (m) remove(m);
+	return m;
+}
+
+void WorkQueue::clear() {
+	while (head) remove(head);
+}
+
+bool WorkQueue::contains(MachineInstance *m) const {
+	return (m->*node_member).queued;
+}
+
+MachineInstance *WorkQueue::next(MachineInstance *m) const {
+	return (m->*node_member).next;
+}
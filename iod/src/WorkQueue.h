@@ -0,0 +1,50 @@
+#ifndef __WORKQUEUE_H__
+#define __WORKQUEUE_H__
+
+#include <stddef.h>
+
+class MachineInstance;
+
+/* the links that let a machine belong to a WorkQueue without any allocation */
+struct WorkQueueNode {
+	MachineInstance *prev;
+	MachineInstance *next;
+	bool queued;
+	WorkQueueNode() : prev(0), next(0), queued(false) {}
+};
+
+/*
+	A FIFO of machines, linked through one of the WorkQueueNode members of
+	MachineInstance. Adding a machine that is already queued leaves it in
+	its current position so machines are processed in the order they first
+	became ready. All operations are O(1); callers provide any locking.
+*/
+class WorkQueue {
+public:
+	typedef WorkQueueNode MachineInstance::*NodeMember;
+
+	explicit WorkQueue(NodeMember member) : node_member(member), head(0), tail(0), count(0) {}
+
+	bool push(MachineInstance *m); // returns false if the machine was already queued
+	bool remove(MachineInstance *m); // returns false if the machine was not queued
+	MachineInstance *pop();
+	void clear();
+
+	bool contains(MachineInstance *m) const;
+	bool empty() const { return count == 0; }
+	size_t size() const { return count; }
+
+	// iteration, it is safe to remove the current machine after fetching its successor
+	MachineInstance *front() const { return head; }
+	MachineInstance *next(MachineInstance *m) const;
+
+private:
+	WorkQueue(const WorkQueue &);
+	WorkQueue &operator=(const WorkQueue &);
+	NodeMember node_member;
+	MachineInstance *head;
+	MachineInstance *tail;
+	size_t count;
+};
+
+#endif
@@ -104,6 +104,16 @@ void usage(int argc, char const *argv[])
 		<< "[-c debug_config_file] [-m modbus_mapping] [-g graph_output] [-s maxlogfilesize]\n"
 		<< "[-mp modbus_port] [-ps persistent_store_port]"
 		<< "[-cp command/iosh port] [--name device_name] [--stats | --nostats] enable/disable statistics"
+		<< "\n[--state_table shm_name] publish states to shared memory"
+		<< "\n[--simulator_config file] io simulation settings (simulator builds)"
+		<< "\n[--metrics_file file] periodically write latency histograms in Prometheus text format"
+		<< "\n[--ecat_priority n] [--processing_priority n] run the thread at SCHED_FIFO priority n"
+		<< "\n[--ecat_cpu n] [--processing_cpu n] bind the thread to cpu n"
+		<< "\n[--mlockall] lock the process into memory"
+		<< "\n[--rtc] pace the EtherCAT cycle from /dev/rtc instead of the monotonic clock"
+		<< "\n[--image_port n] publish the EtherCAT process image each cycle on port n"
+		<< "\n[--image_keyframes n] send the whole process image every n cycles (default 1000)"
+		<< "\n[--record file] record process data, commands and MQTT messages for cw-bench --replay"
 		<< "\n";
 }
 
@@ -954,6 +964,42 @@ int loadOptions(int argc, const char *argv[], std::list<std::string> &files) {
 		else if (strcmp(argv[i], "--export_c") == 0 ) { // command port
 			set_export_to_c(true);
 		}
+		else if (strcmp(argv[i], "--state_table") == 0 && i < argc-1) { // shared memory state table
+			set_state_table(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--simulator_config") == 0 && i < argc-1) { // EtherCAT simulator settings
+			set_simulator_config(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--metrics_file") == 0 && i < argc-1) { // latency histograms for Prometheus
+			set_metrics_file(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--ecat_priority") == 0 && i < argc-1) { // SCHED_FIFO priority
+			set_ecat_priority((int)strtol(argv[++i], 0, 10));
+		}
+		else if (strcmp(argv[i], "--ecat_cpu") == 0 && i < argc-1) { // cpu affinity
+			set_ecat_cpu((int)strtol(argv[++i], 0, 10));
+		}
+		else if (strcmp(argv[i], "--processing_priority") == 0 && i < argc-1) { // SCHED_FIFO priority
+			set_processing_priority((int)strtol(argv[++i], 0, 10));
+		}
+		else if (strcmp(argv[i], "--processing_cpu") == 0 && i < argc-1) { // cpu affinity
+			set_processing_cpu((int)strtol(argv[++i], 0, 10));
+		}
+		else if (strcmp(argv[i], "--mlockall") == 0) {
+			set_lock_memory(true);
+		}
+		else if (strcmp(argv[i], "--rtc") == 0) {
+			set_use_rtc(true);
+		}
+		else if (strcmp(argv[i], "--image_port") == 0 && i < argc-1) { // process image stream
+			set_image_port((int)strtol(argv[++i], 0, 10));
+		}
+		else if (strcmp(argv[i], "--image_keyframes") == 0 && i < argc-1) {
+			set_image_keyframe_interval((unsigned int)strtol(argv[++i], 0, 10));
+		}
+		else if (strcmp(argv[i], "--record") == 0 && i < argc-1) { // I/O trace for replay
+			set_io_trace(argv[++i]);
+		}
         else if (*(argv[i]) == '-' && strlen(argv[i]) > 1)
         {
             usage(argc, argv);
@@ -65,6 +65,8 @@
 #include "MessagingInterface.h"
 #include "Channel.h"
 #include "ProcessingThread.h"
+#include "IOTrace.h"
+#include "CycleTimer.h"
 #include <libgen.h>
 
 bool program_done = false;
@@ -167,6 +169,7 @@ int main (int argc, char const *argv[])
 	std::list<std::string> source_files;
 	int load_result = loadOptions(argc, argv, source_files);
 	if (load_result) return load_result;
+	if (lock_memory()) lockProcessMemory();
 
 	IODCommandListJSON::no_display.insert("tab");
 	IODCommandListJSON::no_display.insert("type");
@@ -270,6 +273,9 @@ int main (int argc, char const *argv[])
                     }
                     module = new MQTTModule(m->getName().c_str());
                     module->host = m->parameters[0].val.asString();
+                    long qos;
+                    if (m->properties.exists("qos") && m->properties.lookup("qos").asInteger(qos) && qos >= 0 && qos <= 2)
+                        module->qos = (int)qos;
                     long port;
                     if (m->parameters[1].val.asInteger(port)) {
                         module->port = (int)port;
@@ -366,6 +372,8 @@ int main (int argc, char const *argv[])
 	ModbusAddress::message("STARTUP");
 	Dispatcher::start();
 
+	if (io_trace() && !IOTraceRecorder::start(io_trace()))
+		std::cerr << "Warning: could not record to " << io_trace() << "\n";
 	processMonitor.setProcessingThreadInstance(&processMonitor);
 	boost::thread process(boost::ref(processMonitor));
     
@@ -381,8 +389,6 @@ int main (int argc, char const *argv[])
     NB_MSG << "processing has started\n";
     uint64_t then = microsecs();
     while (!program_done) {
-        MQTTInterface::instance()->collectState();
-
         //sim_io.send("ecat", 4);
         safeRecv(sim_io, buf, 10, false, response_len, 100);
         uint64_t now = microsecs();
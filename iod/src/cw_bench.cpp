@@ -0,0 +1,699 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+/*
+	cw-bench loads a clockwork program, drives its inputs from a scenario
+	file and runs the ordinary processing thread for a fixed number of
+	processing cycles. It reports the distribution of the time spent working
+	in each cycle, machines evaluated and messages dispatched per second and
+	heap allocations per cycle, and can save or compare against a baseline.
+
+	usage: cw-bench [--scenario file] [--cycles n] [--settle n]
+	                [--baseline file] [--save-baseline file] [--tolerance percent]
+	                [--channels n] [--replay file [--fast]] [clockwork options] program.cw ...
+	       cw-bench --generate machines prefix
+	       cw-bench --generate-lists items prefix
+
+	Scenario files contain one directive per line:
+
+		cycles <n>                           cycles to measure (--cycles overrides)
+		settle <n>                           cycles to run before measuring
+		at <cycle> <machine> <state>         SET machine TO state at the given cycle
+		every <period> <machine> <state> ... step through the states every period cycles
+		property <cycle> <machine> <property> <value>
+
+	Cycles are counted by the processing loop, not by the clock, so a
+	scenario applies the same inputs in the same order on every run. The
+	--generate option writes prefix.cw and prefix.scn containing a stress
+	program of approximately the given number of machines. --generate-lists
+	writes a program in the style of tests/lists.cw with lists of the given
+	number of items that are repeatedly intersected, differenced, combined
+	and searched with INCLUDES.
+
+	--channels registers n command sockets with the processing thread, as
+	channels do, and runs a client on each that repeatedly sends a GET
+	command and waits for the reply. The reply rate, latency and the fewest
+	and most replies received by any one channel are reported and the
+	bench fails if any channel is starved.
+
+	--replay feeds a trace recorded by iod or cw with --record back to the
+	processing thread, at the recorded pace or with --fast, one recorded
+	processing cycle per cycle. The bench measures every cycle until the
+	trace ends unless --cycles or --settle are given. Process data is only
+	replayed when the program's process image is the size recorded.
+*/
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libgen.h>
+#include <atomic>
+#include <algorithm>
+#include <limits>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <list>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+#include <zmq.hpp>
+#include <boost/thread.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+
+#define __MAIN__
+#include "cwlang.h"
+#include "ControlSystemMachine.h"
+#include "Channel.h"
+#include "ClientInterface.h"
+#include "Dispatcher.h"
+#include "IODCommand.h"
+#include "IOTrace.h"
+#include "Logger.h"
+#include "MachineInstance.h"
+#include "MessageLog.h"
+#include "MessagingInterface.h"
+#include "ModbusInterface.h"
+#include "ProcessingThread.h"
+#include "Scheduler.h"
+#include "Statistic.h"
+#include "Statistics.h"
+#include "clockwork.h"
+#include "options.h"
+#include "value.h"
+
+bool program_done = false;
+bool machine_is_ready = false;
+
+Statistics *statistics = NULL;
+std::list<Statistic *> Statistic::stats;
+
+/* every heap allocation in the process is counted, the per cycle figure
+	includes allocations made by the scheduler and dispatcher threads on
+	behalf of the cycle
+*/
+static std::atomic<unsigned long> heap_allocations(0);
+
+static std::atomic<bool> measuring(false); // set once the settling cycles are done
+
+void *operator new(size_t size) {
+	++heap_allocations;
+	void *p = malloc(size ? size : 1);
+	if (!p) throw std::bad_alloc();
+	return p;
+}
+void *operator new[](size_t size) {
+	++heap_allocations;
+	void *p = malloc(size ? size : 1);
+	if (!p) throw std::bad_alloc();
+	return p;
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+struct ScenarioStep {
+	unsigned long cycle;   // the cycle to apply at, or the period for repeating steps
+	bool repeats;
+	std::vector<std::string> commands; // repeating steps rotate through these
+	ScenarioStep(unsigned long c, bool r) : cycle(c), repeats(r) {}
+};
+
+class Scenario {
+public:
+	Scenario() : cycles(1000), settle(100), replay(0) {}
+	bool load(const char *file_name);
+	void apply(unsigned long cycle);
+	bool finished() const { return replay && replay->finished(); }
+
+	unsigned long cycles;
+	unsigned long settle;
+	IOTraceReplay *replay;
+private:
+	std::multimap<unsigned long, std::string> once; // cycle -> command
+	std::vector<ScenarioStep> repeating;
+	void run(const std::string &command);
+};
+
+bool Scenario::load(const char *file_name) {
+	std::ifstream in(file_name);
+	if (!in) {
+		std::cerr << "cw-bench: could not open scenario " << file_name << "\n";
+		return false;
+	}
+	std::string line;
+	int line_no = 0;
+	bool result = true;
+	while (std::getline(in, line)) {
+		++line_no;
+		if (line.find('#') != std::string::npos) line.erase(line.find('#'));
+		std::istringstream iss(line);
+		std::string directive;
+		if (!(iss >> directive)) continue;
+		bool ok = true;
+		unsigned long n;
+		std::string machine, item, value;
+		if (directive == "cycles") ok = !!(iss >> cycles) && cycles > 0;
+		else if (directive == "settle") ok = !!(iss >> settle);
+		else if (directive == "at") {
+			if ( (ok = !!(iss >> n >> machine >> item)) )
+				once.insert(std::make_pair(n, "SET " + machine + " TO " + item));
+		}
+		else if (directive == "property") {
+			if ( (ok = !!(iss >> n >> machine >> item >> value)) )
+				once.insert(std::make_pair(n, "PROPERTY " + machine + " " + item + " " + value));
+		}
+		else if (directive == "every") {
+			if ( (ok = !!(iss >> n >> machine) && n > 0) ) {
+				ScenarioStep step(n, true);
+				while (iss >> item) step.commands.push_back("SET " + machine + " TO " + item);
+				ok = !step.commands.empty();
+				if (ok) repeating.push_back(step);
+			}
+		}
+		else ok = false;
+		if (!ok) {
+			std::cerr << "cw-bench: " << file_name << " line " << line_no << ": could not understand '" << line << "'\n";
+			result = false;
+		}
+	}
+	return result;
+}
+
+void Scenario::run(const std::string &command) {
+	IODCommand *cmd = acquireCommand(command.c_str());
+	if (!cmd) return;
+	if ((*cmd)() != IODCommand::Success) {
+		char buf[200];
+		snprintf(buf, 200, "cw-bench: %s failed: %s", command.c_str(), cmd->error());
+		MessageLog::instance()->add(buf);
+	}
+	releaseCommand(cmd);
+}
+
+void Scenario::apply(unsigned long cycle) {
+	if (replay) replay->apply(microsecs());
+	std::pair< std::multimap<unsigned long, std::string>::iterator,
+		std::multimap<unsigned long, std::string>::iterator > range = once.equal_range(cycle);
+	while (range.first != range.second) run((*range.first++).second);
+	std::vector<ScenarioStep>::iterator iter = repeating.begin();
+	while (iter != repeating.end()) {
+		ScenarioStep &step = *iter++;
+		if (cycle % step.cycle == 0)
+			run(step.commands[ (cycle / step.cycle) % step.commands.size() ]);
+	}
+}
+
+/* runs on the processing thread, applying the scenario and timing each cycle */
+class BenchMonitor : public ProcessingCycleMonitor {
+public:
+	BenchMonitor(Scenario &s) : scenario(s), cycle(0), done(false), machines(0),
+			window_start(0), window_end(0), allocations(0), messages(0) {
+		durations.reserve(std::min(s.cycles, 1000000UL));
+	}
+	bool wantsCycle() { return !done; }
+	void beginCycle() {
+		if (done) return;
+		if (cycle == scenario.settle) {
+			measuring = true;
+			allocations = heap_allocations;
+			messages = Dispatcher::instance()->deliveries();
+		}
+		scenario.apply(cycle);
+	}
+	void endCycle(uint64_t start, uint64_t end, unsigned int machines_evaluated) {
+		if (done) return;
+		if (cycle >= scenario.settle) {
+			if (cycle == scenario.settle) window_start = start;
+			durations.push_back( (uint32_t)(end - start) );
+			machines += machines_evaluated;
+		}
+		if (++cycle == scenario.settle + scenario.cycles || scenario.finished()) {
+			window_end = end;
+			allocations = heap_allocations - allocations;
+			messages = Dispatcher::instance()->deliveries() - messages;
+			boost::mutex::scoped_lock lock(finished_mutex);
+			done = true;
+			program_done = true;
+			finished.notify_all();
+		}
+	}
+	bool waitUntilDone(long seconds) {
+		boost::mutex::scoped_lock lock(finished_mutex);
+		boost::system_time limit = boost::get_system_time() + boost::posix_time::seconds(seconds);
+		while (!done) if (!finished.timed_wait(lock, limit)) return done;
+		return true;
+	}
+
+	Scenario &scenario;
+	unsigned long cycle;
+	bool done;
+	std::vector<uint32_t> durations;
+	unsigned long machines;
+	uint64_t window_start;
+	uint64_t window_end;
+	unsigned long allocations;
+	uint64_t messages;
+	boost::mutex finished_mutex;
+	boost::condition finished;
+};
+
+/* stands in for the remote end of a channel, sending a command through
+	the channel's command socket and waiting for the reply, over and over.
+*/
+class ChannelClient {
+public:
+	ChannelClient(const std::string &addr, const std::string &cmd)
+		: address(addr), command(cmd), replies(0) {}
+	void operator()();
+
+	std::string address;
+	std::string command;
+	unsigned long replies; // received while measuring
+	std::vector<uint32_t> latencies;
+};
+
+void ChannelClient::operator()() {
+	zmq::socket_t sock(*MessagingInterface::getContext(), ZMQ_PAIR);
+	sock.connect(address.c_str());
+	while (!program_done) {
+		uint64_t sent = microsecs();
+		MessageHeader mh(MessageHeader::SOCK_CW, MessageHeader::SOCK_CHAN, true);
+		safeSend(sock, command.c_str(), command.length(), mh);
+		while (!program_done) {
+			zmq::pollitem_t items[] = { { (void*)sock, 0, ZMQ_POLLIN, 0 } };
+			if (zmq::poll(items, 1, 100) <= 0) continue;
+			char *buf = 0;
+			size_t len = 0;
+			MessageHeader rh;
+			if (safeRecv(sock, &buf, &len, false, 0, rh) && measuring) {
+				++replies;
+				latencies.push_back( (uint32_t)(microsecs() - sent) );
+			}
+			delete[] buf;
+			break;
+		}
+	}
+}
+
+typedef std::vector< std::pair<std::string, double> > Results;
+
+static double percentile(const std::vector<uint32_t> &sorted, double p) {
+	if (sorted.empty()) return 0.0;
+	size_t idx = (size_t)(p / 100.0 * (sorted.size() - 1) + 0.5);
+	return sorted[idx];
+}
+
+static Results collectResults(BenchMonitor &monitor) {
+	Results results;
+	std::vector<uint32_t> sorted(monitor.durations);
+	std::sort(sorted.begin(), sorted.end());
+	double elapsed = (monitor.window_end > monitor.window_start)
+		? (monitor.window_end - monitor.window_start) / 1000000.0 : 0.0;
+	double n = sorted.empty() ? 1.0 : sorted.size();
+	results.push_back(std::make_pair("cycle_p50_us", percentile(sorted, 50)));
+	results.push_back(std::make_pair("cycle_p90_us", percentile(sorted, 90)));
+	results.push_back(std::make_pair("cycle_p99_us", percentile(sorted, 99)));
+	results.push_back(std::make_pair("cycle_max_us", sorted.empty() ? 0.0 : sorted.back()));
+	results.push_back(std::make_pair("machines_per_sec", elapsed > 0.0 ? monitor.machines / elapsed : 0.0));
+	results.push_back(std::make_pair("messages_per_sec", elapsed > 0.0 ? monitor.messages / elapsed : 0.0));
+	results.push_back(std::make_pair("allocations_per_cycle", monitor.allocations / n));
+	return results;
+}
+
+static void collectChannelResults(BenchMonitor &monitor, std::vector<ChannelClient*> &clients, Results &results) {
+	std::vector<uint32_t> sorted;
+	unsigned long total = 0, most = 0;
+	unsigned long fewest = clients.empty() ? 0 : clients.front()->replies;
+	std::vector<ChannelClient*>::iterator iter = clients.begin();
+	while (iter != clients.end()) {
+		ChannelClient *client = *iter++;
+		sorted.insert(sorted.end(), client->latencies.begin(), client->latencies.end());
+		if (client->replies < fewest) fewest = client->replies;
+		if (client->replies > most) most = client->replies;
+		total += client->replies;
+	}
+	std::sort(sorted.begin(), sorted.end());
+	double elapsed = (monitor.window_end > monitor.window_start)
+		? (monitor.window_end - monitor.window_start) / 1000000.0 : 0.0;
+	results.push_back(std::make_pair("channel_replies_per_sec", elapsed > 0.0 ? total / elapsed : 0.0));
+	results.push_back(std::make_pair("channel_reply_p50_us", percentile(sorted, 50)));
+	results.push_back(std::make_pair("channel_reply_p99_us", percentile(sorted, 99)));
+	results.push_back(std::make_pair("channel_fewest_replies", fewest));
+	results.push_back(std::make_pair("channel_most_replies", most));
+}
+
+// rates are better when higher, everything else is better when lower
+static bool higherIsBetter(const std::string &name) {
+	return name.find("_per_sec") != std::string::npos;
+}
+
+static bool loadBaseline(const char *file_name, std::map<std::string, double> &baseline) {
+	std::ifstream in(file_name);
+	if (!in) return false;
+	std::string name;
+	double value;
+	while (in >> name >> value) baseline[name] = value;
+	return true;
+}
+
+static bool saveBaseline(const char *file_name, const Results &results) {
+	std::ofstream out(file_name);
+	if (!out) return false;
+	Results::const_iterator iter = results.begin();
+	while (iter != results.end()) {
+		out << (*iter).first << " " << std::fixed << std::setprecision(2) << (*iter).second << "\n";
+		++iter;
+	}
+	return true;
+}
+
+// returns the number of metrics that are worse than the baseline by more than the tolerance
+static int compareResults(const Results &results, std::map<std::string, double> &baseline, double tolerance) {
+	int regressions = 0;
+	std::cout << "\n" << std::setw(24) << std::left << "metric"
+		<< std::setw(14) << std::right << "baseline" << std::setw(14) << "current" << std::setw(10) << "change\n";
+	Results::const_iterator iter = results.begin();
+	while (iter != results.end()) {
+		const std::string &name = (*iter).first;
+		double current = (*iter).second;
+		++iter;
+		std::map<std::string, double>::iterator found = baseline.find(name);
+		if (found == baseline.end()) continue;
+		double base = (*found).second;
+		double change = (base != 0.0) ? (current - base) * 100.0 / base : 0.0;
+		bool worse = higherIsBetter(name) ? change < -tolerance : change > tolerance;
+		// tiny absolute values (eg a 2us median) are too noisy to judge
+		if (!higherIsBetter(name) && current - base < 1.0) worse = false;
+		if (worse) ++regressions;
+		std::cout << std::setw(24) << std::left << name << std::right << std::fixed << std::setprecision(2)
+			<< std::setw(14) << base << std::setw(14) << current
+			<< std::setw(9) << change << "%" << (worse ? "  REGRESSION" : "") << "\n";
+	}
+	return regressions;
+}
+
+/* a stress program of independent input chains. Each input FLAG is followed
+	by a chain of machines that copy its state, every ten inputs are gathered
+	into a LIST that is watched by a machine counting the inputs that are on.
+*/
+static int generate(long num_machines, const char *prefix) {
+	const int chain_length = 9;
+	long chains = num_machines / (chain_length + 1);
+	if (chains < 10) chains = 10;
+	std::string program_name(prefix); program_name += ".cw";
+	std::string scenario_name(prefix); scenario_name += ".scn";
+	std::ofstream program(program_name.c_str());
+	std::ofstream scenario(scenario_name.c_str());
+	if (!program || !scenario) {
+		std::cerr << "cw-bench: could not write " << program_name << " or " << scenario_name << "\n";
+		return 1;
+	}
+	long groups = (chains + 9) / 10;
+	program << "# generated by cw-bench --generate " << num_machines << " " << prefix << "\n"
+		<< "# " << chains << " input chains of " << chain_length << " followers and "
+		<< groups << " watched groups, " << chains * (chain_length + 1) + groups * 2 << " machines\n\n"
+		<< "Follow MACHINE source {\n\ton WHEN source IS on;\n\toff DEFAULT;\n}\n\n"
+		<< "Watch MACHINE group {\n\tbusy WHEN COUNT on FROM group >= 5;\n\tidle DEFAULT;\n}\n\n";
+	char name[40], prev[40];
+	for (long i = 0; i < chains; ++i) {
+		snprintf(name, 40, "in%05ld", i);
+		program << name << " FLAG;\n";
+		for (int j = 1; j <= chain_length; ++j) {
+			strcpy(prev, name);
+			snprintf(name, 40, "f%05ld_%d", i, j);
+			program << name << " Follow " << prev << ";\n";
+		}
+	}
+	for (long g = 0; g < groups; ++g) {
+		program << "\ngroup" << g << " LIST";
+		for (long i = g * 10; i < chains && i < (g+1) * 10; ++i)
+			program << ( (i == g * 10) ? " " : ", " ) << "in" << std::setw(5) << std::setfill('0') << i << std::setfill(' ');
+		program << ";\nwatch" << g << " Watch group" << g << ";\n";
+	}
+	scenario << "# generated by cw-bench --generate " << num_machines << " " << prefix << "\n"
+		<< "settle 200\ncycles 2000\n";
+	// stagger the input periods so that each cycle has a similar amount of work
+	for (long i = 0; i < chains; ++i)
+		scenario << "every " << 20 + (i % 13) << " in" << std::setw(5) << std::setfill('0') << i << std::setfill(' ') << " on off\n";
+	std::cout << "wrote " << program_name << " and " << scenario_name << "\n";
+	return 0;
+}
+
+/* a list processing program. Every item is in all_items and every second item is
+	in evens, items have a code property that is shared by pairs of items. Each time the trigger turns on the worker rebuilds
+	the common, difference and combined lists and probes keep checking whether
+	the last item is included in the lists.
+*/
+static int generateLists(long num_items, const char *prefix) {
+	if (num_items < 10) num_items = 10;
+	std::string program_name(prefix); program_name += ".cw";
+	std::string scenario_name(prefix); scenario_name += ".scn";
+	std::ofstream program(program_name.c_str());
+	std::ofstream scenario(scenario_name.c_str());
+	if (!program || !scenario) {
+		std::cerr << "cw-bench: could not write " << program_name << " or " << scenario_name << "\n";
+		return 1;
+	}
+	program << "# generated by cw-bench --generate-lists " << num_items << " " << prefix << "\n\n"
+		<< "Item MACHINE { OPTION code 0; }\n\n"
+		<< "ListWork MACHINE a, b, common, same_code, diff, both, trigger {\n"
+		<< "\tbusy WHEN trigger IS on;\n\tidle DEFAULT;\n"
+		<< "\tENTER busy {\n"
+		<< "\t\tCLEAR common; CLEAR same_code; CLEAR diff; CLEAR both;\n"
+		<< "\t\tCOPY COMMON BETWEEN a AND b TO common;\n"
+		<< "\t\tCOPY COMMON BETWEEN a AND b TO same_code USING code;\n"
+		<< "\t\tCOPY DIFFERENCE BETWEEN a AND b TO diff;\n"
+		<< "\t\tCOPY ALL IN a OR b TO both;\n"
+		<< "\t}\n}\n\n"
+		<< "Probe MACHINE list, trigger {\n"
+		<< "\tfound WHEN trigger IS on AND list INCLUDES item" << std::setw(5) << std::setfill('0') << num_items - 1
+		<< std::setfill(' ') << ";\n\tmissing DEFAULT;\n}\n\n"
+		<< "trigger FLAG;\n";
+	char name[40];
+	for (long i = 0; i < num_items; ++i) {
+		snprintf(name, 40, "item%05ld", i);
+		program << name << " Item(code:" << i / 2 << ");\n";
+	}
+	const char *lists[] = { "all_items", "evens" };
+	for (int l = 0; l < 2; ++l) {
+		program << "\n" << lists[l] << " LIST";
+		for (long i = 0; i < num_items; i += l + 1) {
+			snprintf(name, 40, "item%05ld", i);
+			program << ( (i == 0) ? " " : ", " ) << name;
+		}
+		program << ";\n";
+	}
+	program << "\ncommon LIST;\nsame_code LIST;\ndiff LIST;\nboth LIST;\n"
+		<< "work ListWork all_items, evens, common, same_code, diff, both, trigger;\n"
+		<< "probe_all Probe all_items, trigger;\n"
+		<< "probe_evens Probe evens, trigger;\n"
+		<< "probe_both Probe both, trigger;\n";
+	scenario << "# generated by cw-bench --generate-lists " << num_items << " " << prefix << "\n"
+		<< "settle 20\ncycles 200\nevery 20 trigger on off\n";
+	std::cout << "wrote " << program_name << " and " << scenario_name << "\n";
+	return 0;
+}
+
+class BenchActivation : public HardwareActivation {
+	public:
+		void operator()(void) {
+			NB_MSG << "----------- Initialising machines ------------\n";
+			initialise_machines();
+		}
+};
+
+static void benchUsage(const char *name) {
+	std::cerr << "Usage: " << name << " [--scenario file] [--cycles n] [--settle n]\n"
+		<< "\t[--baseline file] [--save-baseline file] [--tolerance percent] [--timeout seconds]\n"
+		<< "\t[--channels n] [--replay file [--fast]] [clockwork options] program.cw ...\n"
+		<< "   or: " << name << " --generate machines prefix\n"
+		<< "   or: " << name << " --generate-lists items prefix\n";
+}
+
+int main(int argc, char const *argv[])
+{
+	char *pn = strdup(argv[0]);
+	program_name = strdup(basename(pn));
+	free(pn);
+
+	const char *scenario_file = 0;
+	const char *baseline_file = 0;
+	const char *save_baseline_file = 0;
+	double tolerance = 10.0;
+	long timeout = 600;
+	long cycles = 0, settle = -1;
+	long num_channels = 0;
+	const char *replay_file = 0;
+	bool fast_replay = false;
+
+	// take our own options and pass the rest to clockwork
+	std::vector<const char *> cw_args;
+	cw_args.push_back(argv[0]);
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "--generate") == 0 && i < argc-2)
+			return generate(strtol(argv[i+1], 0, 10), argv[i+2]);
+		else if (strcmp(argv[i], "--generate-lists") == 0 && i < argc-2)
+			return generateLists(strtol(argv[i+1], 0, 10), argv[i+2]);
+		else if (strcmp(argv[i], "--scenario") == 0 && i < argc-1) scenario_file = argv[++i];
+		else if (strcmp(argv[i], "--cycles") == 0 && i < argc-1) cycles = strtol(argv[++i], 0, 10);
+		else if (strcmp(argv[i], "--settle") == 0 && i < argc-1) settle = strtol(argv[++i], 0, 10);
+		else if (strcmp(argv[i], "--baseline") == 0 && i < argc-1) baseline_file = argv[++i];
+		else if (strcmp(argv[i], "--save-baseline") == 0 && i < argc-1) save_baseline_file = argv[++i];
+		else if (strcmp(argv[i], "--tolerance") == 0 && i < argc-1) tolerance = strtod(argv[++i], 0);
+		else if (strcmp(argv[i], "--timeout") == 0 && i < argc-1) timeout = strtol(argv[++i], 0, 10);
+		else if (strcmp(argv[i], "--channels") == 0 && i < argc-1) num_channels = strtol(argv[++i], 0, 10);
+		else if (strcmp(argv[i], "--replay") == 0 && i < argc-1) replay_file = argv[++i];
+		else if (strcmp(argv[i], "--fast") == 0) fast_replay = true;
+		else if (strcmp(argv[i], "--help") == 0) { benchUsage(argv[0]); return 0; }
+		else cw_args.push_back(argv[i]);
+	}
+
+	Scenario scenario;
+	if (scenario_file && !scenario.load(scenario_file)) return 1;
+	IOTraceReplay replay(fast_replay);
+	if (replay_file) {
+		if (!replay.open(replay_file)) {
+			std::cerr << "cw-bench: could not read the trace " << replay_file << "\n";
+			return 1;
+		}
+		scenario.replay = &replay;
+		scenario.cycles = std::numeric_limits<unsigned long>::max() / 2; // until the trace ends
+		scenario.settle = 0;
+	}
+	if (cycles > 0) scenario.cycles = cycles;
+	if (settle >= 0) scenario.settle = settle;
+
+	zmq::context_t *context = new zmq::context_t;
+	MessagingInterface::setContext(context);
+	Logger::instance();
+	Dispatcher::instance();
+	MessageLog::setMaxMemory(10000);
+	Scheduler::instance();
+	ControlSystemMachine machine;
+
+	std::list<std::string> source_files;
+	int load_result = loadOptions(cw_args.size(), &cw_args[0], source_files);
+	if (load_result) { benchUsage(argv[0]); return load_result; }
+	if (source_files.empty()) { benchUsage(argv[0]); return 1; }
+
+	statistics = new Statistics;
+	load_result = loadConfig(source_files);
+	if (load_result) {
+		Dispatcher::instance()->stop();
+		return load_result;
+	}
+
+	BenchMonitor monitor(scenario);
+	ProcessingThread::setCycleMonitor(&monitor);
+
+	IODCommandThread *stateMonitor = IODCommandThread::instance();
+	BenchActivation activation;
+	ProcessingThread &processMonitor(ProcessingThread::create(&machine, activation, *stateMonitor));
+
+	std::vector<ChannelClient*> channel_clients;
+	if (num_channels > 0) {
+		if (machines.empty()) {
+			std::cerr << "cw-bench: the program has no machines for the channels to query\n";
+			return 1;
+		}
+		std::string command("GET " + (*machines.begin()).first);
+		for (long i = 0; i < num_channels; ++i) {
+			char name[40];
+			snprintf(name, 40, "bench_channel_%ld", i);
+			CommandSocketInfo *info = processMonitor.addCommandChannel(new CommandSocketInfo(name));
+			channel_clients.push_back(new ChannelClient(info->address, command));
+		}
+	}
+
+	// stands in for the EtherCAT thread, the processing thread waits for this at startup
+	zmq::socket_t sim_io(*MessagingInterface::getContext(), ZMQ_REP);
+	sim_io.bind("inproc://ethercat_sync");
+
+	boost::thread scheduler_thread(boost::ref(*Scheduler::instance()));
+	Scheduler::instance()->setThreadRef(scheduler_thread);
+	boost::thread monitor_thread(boost::ref(*stateMonitor));
+	ModbusAddress::message("STARTUP");
+	Dispatcher::start();
+
+	processMonitor.setProcessingThreadInstance(&processMonitor);
+	boost::thread process(boost::ref(processMonitor));
+	boost::thread_group channel_threads;
+	for (size_t i = 0; i < channel_clients.size(); ++i)
+		channel_threads.create_thread(boost::ref(*channel_clients[i]));
+
+	char buf[10];
+	size_t response_len;
+	safeRecv(sim_io, buf, 10, true, response_len, 0);
+
+	if (!monitor.waitUntilDone(timeout)) {
+		std::cerr << "cw-bench: timed out after " << monitor.cycle << " cycles\n";
+		exit(2);
+	}
+
+	Results results = collectResults(monitor);
+	int rc = 0;
+	if (replay_file) {
+		results.push_back(std::make_pair("replayed_records", (double)replay.applied));
+		results.push_back(std::make_pair("replay_skipped", (double)replay.skipped));
+	}
+	if (!channel_clients.empty()) {
+		channel_threads.join_all(); // the clients stop when the processing loop is done
+		collectChannelResults(monitor, channel_clients, results);
+	}
+	std::cout << "\ncw-bench: " << source_files.front() << ", "
+		<< (monitor.cycle - scenario.settle) << " cycles after " << scenario.settle << " settling cycles\n";
+	Results::const_iterator iter = results.begin();
+	while (iter != results.end()) {
+		std::cout << std::setw(24) << std::left << (*iter).first << std::right
+			<< std::fixed << std::setprecision(2) << std::setw(14) << (*iter).second << "\n";
+		++iter;
+	}
+
+	if (!channel_clients.empty()) {
+		std::cout << processMonitor.numCommandChannels() << " command channels polled\n";
+		for (size_t i = 0; i < channel_clients.size(); ++i) {
+			if (channel_clients[i]->replies == 0) {
+				std::cerr << "cw-bench: " << channel_clients[i]->address << " received no replies\n";
+				rc = 4;
+			}
+		}
+	}
+	if (baseline_file) {
+		std::map<std::string, double> baseline;
+		if (!loadBaseline(baseline_file, baseline)) {
+			std::cerr << "cw-bench: could not read baseline " << baseline_file << "\n";
+			rc = 1;
+		}
+		else if (compareResults(results, baseline, tolerance)) rc = 3;
+	}
+	if (save_baseline_file && !saveBaseline(save_baseline_file, results)) {
+		std::cerr << "cw-bench: could not write baseline " << save_baseline_file << "\n";
+		rc = 1;
+	}
+	std::cout << std::flush;
+	// the clockwork threads are not designed to be joined
+	exit(rc);
+}
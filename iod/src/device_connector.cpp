@@ -22,6 +22,11 @@
     This program will ping the iod every second, as long as it has a connection
     to its device and that device is responding.
     ... and the rest..
+
+    One device is described by the command line options, more can be given in
+    a config file (--config), one device per line. All the devices are served
+    by a single epoll loop and updates to clockwork are queued in a pipeline so
+    that reading from the devices never waits for clockwork.
  */
 #include <iostream>
 #include "anet.h"
@@ -57,27 +62,29 @@
 #include "Logger.h"
 #include "DebugExtra.h"
 #include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/uio.h>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <list>
+#include <vector>
 
 volatile bool debug = false;
 
 class DeviceStatus {
 public:
     enum State {e_unknown, e_disconnected, e_connected, e_up, e_failed, e_timeout };
+    DeviceStatus() : status(e_unknown), prev_status(e_unknown) { }
     State current() { return status; }
-    State previous() { return status; }
-    static DeviceStatus *instance() { if (!instance_) instance_ = new DeviceStatus; return instance_; }
+    State previous() { return prev_status; }
     void setStatus(State s){ prev_status = status; status = s; }
 private:
-    static DeviceStatus *instance_;
     State status;
     State prev_status;
-    DeviceStatus() : status(e_unknown), prev_status(e_unknown) { }
-    DeviceStatus(const DeviceStatus &);
-    DeviceStatus& operator=(const DeviceStatus&);
 };
 
-DeviceStatus *DeviceStatus::instance_;
-
 static const char *stringFromDeviceStatus(DeviceStatus::State status) {
     switch(status) {
         case DeviceStatus::e_disconnected:
@@ -109,8 +116,10 @@ void usage(int argc, const char * argv[]) {
         << " | (--serial_port portname --serial_settings baud:bits:parity:stop_bits:flow_control )\n"
         << " --property property_name [--client] [--name device_name]\n"
         << " --watch_property property_name --collect_repeats [ --no_timeout_disconnect | --disconnect_on_timeout ]\n"
-        << " --no_json --queue queue_name --channel channel_name [--cw_port port] "
-        << "\n";
+        << " --no_json --queue queue_name --channel channel_name [--cw_port port] [--buffer_size bytes]\n"
+        << " [--config file] [--stats_interval seconds] [--max_backlog n]\n"
+        << "\n"
+        << " Each line of a config file gives the device options for one more device\n";
 }
 
 
@@ -137,22 +146,26 @@ std::string escapeNonprintables(const char *buf) {
 
 class Options {
 
-    Options() : is_server(true), port_(10240), host_(0), name_(0), machine_(0), property_(0), pattern_(0), iod_host_(0),
-        serial_port_name_(0), serial_settings_(0), watch_(0), queue_(0), collect_duplicates(false), disconnect_on_timeout(true),
-			cw_publisher(5556),
-                got_host(false), got_port(true), got_property(false), got_pattern(false), structured_messaging(true),
+    static Options *instance_;
+public:
+    // the instance holds the command line options, each device in a config file has its own Options
+    Options() : is_server(true), port_(10240), host_(0), name_(0), machine_(0), property_(0), pattern_(0),
+        compiled_pattern(0), iod_host_(0),
+        serial_port_name_(0), serial_settings_(0), watch_(0), queue_(0), channel_(0),
+        collect_duplicates(false), disconnect_on_timeout(true),
+			cw_publisher(5556), buffer_size_(4096),
+                got_host(false), got_port(true), got_property(false), got_pattern(false),
+                got_serial(false), got_serial_settings(false), structured_messaging(true),
                 got_queue(false) {
         setIODHost("localhost");
     }
-    static Options *instance_;
-public:
     static Options *instance() { if (!instance_) instance_ = new Options; return instance_; }
     ~Options() {
         if (host_) free(host_);
         if (name_) free(name_);
         if (machine_) free(machine_);
         if (property_) free(property_);
-        instance_ = 0;
+        if (instance_ == this) instance_ = 0;
     }
     bool valid() const {
         // serial implies client
@@ -290,6 +303,9 @@ public:
     int publisher_port() const { return cw_publisher; }
     void set_publisher_port(int port) { cw_publisher = port; }
 
+    size_t bufferSize() const { return buffer_size_; }
+    void setBufferSize(size_t n) { buffer_size_ = (n < 64) ? 64 : n; }
+
     
 protected:
     bool is_server;    // if true, listen for connections, otherwise, connect to a device
@@ -309,6 +325,7 @@ protected:
     bool collect_duplicates;
     bool disconnect_on_timeout;
     int cw_publisher;
+    size_t buffer_size_; // size of the input buffer for the device
     
     // validation
     bool got_host;
@@ -458,428 +475,711 @@ closePort:
 }
 
 
-/** The MatchFunction provides a regular expression interface so that data incoming on the
-    device connection can be filtered. Only matched data is passed back to iod/clockwork
- */
-
-static struct timeval last_send;
-static std::string last_message;
-
 static const char *iod_connection = "inproc://iod_interface";
 
-struct MatchFunction {
-    static MatchFunction *instance() { if (!instance_) instance_ = new MatchFunction; return instance_; }
-    static int match_func(const char *match, int index, void *data)
-    {
-        if (debug)std::cout << "match: " << index << " " << match << "\n";
-        if (data && index == 0) {
-            size_t *n = (size_t*)data;
-            *n += strlen(match);
+/** The FrameBuffer is a ring buffer holding data read from a device until the
+    pattern matches it. Data is read directly into the free space; when the
+    pattern is to be applied the contents are made contiguous (which only
+    moves data when it has wrapped around the end of the buffer).
+ */
+class FrameBuffer {
+public:
+    FrameBuffer(size_t size) : capacity(size), head(0), len(0) { buf = new char[capacity+1]; buf[0] = 0; }
+    ~FrameBuffer() { delete[] buf; }
+
+    size_t length() const { return len; }
+    bool full() const { return len == capacity; }
+    void clear() { head = 0; len = 0; }
+
+    // read as much as will fit, returns the result of readv()
+    ssize_t readFrom(int fd) {
+        size_t tail = (head + len) % capacity;
+        size_t space = capacity - len;
+        struct iovec iov[2];
+        int num_iov = 1;
+        iov[0].iov_base = buf + tail;
+        iov[0].iov_len = (tail + space <= capacity) ? space : capacity - tail;
+        if (iov[0].iov_len < space) {
+            iov[1].iov_base = buf;
+            iov[1].iov_len = space - iov[0].iov_len;
+            ++num_iov;
         }
-		int num_sub = (int)numSubexpressions(Options::instance()->regexpInfo());
-        if (num_sub == 0 || index>0) {
-            struct timeval now;
-            gettimeofday(&now, 0);
-            if (Options::instance()->sendJSON() && Options::instance()->queue()) {
-                // structured messaging, pushing each match to a queue
-                if (index == 0 || index == 1) {
-                    instance()->params.clear();
-                    instance()->params.push_back(Options::instance()->queue());
-                }
-                instance()->params.push_back(Value(match, Value::t_string));
-                if (index == num_sub) {
-                    char *msg = MessageEncoding::encodeCommand("DATA", &instance()->params);
-                    if ( (Options::instance()->skippingRepeats() == false
-                                            || last_message != msg || last_send.tv_sec +5 <  now.tv_sec)) {
-                        if (msg) {
-                            if (!instance_) { MatchFunction::instance(); usleep(50); }
-                            std::string response;
-							if(debug)std::cout << "sending: " << msg << "\n" << std::flush;
-                            if (sendMessage(msg, MatchFunction::instance()->iod_interface, response)) {
-                                last_message = msg;
-                                last_send.tv_sec = now.tv_sec;
-                                last_send.tv_usec = now.tv_usec;
-                            }
-                            free(msg);
-                        }
-                    }
-                    else if (msg) free(msg);
-                }
-            }
-            if (Options::instance()->property()) {
-                if (index == 0 || index == 1)
-                    MatchFunction::instance()->result = match;
-                else
-                    MatchFunction::instance()->result = MatchFunction::instance()->result + " " +match;
-                
-                std::string res = MatchFunction::instance()->result;
-                if (index == num_sub && (Options::instance()->skippingRepeats() == false
-                                            || last_message != res || last_send.tv_sec +5 <  now.tv_sec)) {
-                    char *cmd = MessageEncoding::encodeCommand("PROPERTY", Options::instance()->machine(), Options::instance()->property(), res.c_str());
-                    if (cmd) {
-                        std::string response;
-						if(debug)std::cout << "sending: " << cmd << "\n" << std::flush;
-                        if (sendMessage(cmd, MatchFunction::instance()->iod_interface, response)) {
-                            last_message = res;
-                            last_send.tv_sec = now.tv_sec;
-                            last_send.tv_usec = now.tv_usec;
-                        }
-                        free(cmd);
-                    }
-                }
-            }
+        ssize_t n = readv(fd, iov, num_iov);
+        if (n > 0) len += n;
+        return n;
+    }
+
+    // the buffered data as a null terminated string
+    const char *text() {
+        if (head + len > capacity) {
+            std::rotate(buf, buf + head, buf + capacity);
+            head = 0;
         }
-        return 0;
+        buf[head + len] = 0;
+        return buf + head;
     }
-    
-protected:
-    static MatchFunction *instance_;
+
+    void consume(size_t n) {
+        if (n >= len) { clear(); return; }
+        head = (head + n) % capacity;
+        len -= n;
+    }
+
+private:
+    char *buf;
+    size_t capacity;
+    size_t head;
+    size_t len;
+    FrameBuffer(const FrameBuffer &);
+    FrameBuffer &operator=(const FrameBuffer &);
+};
+
+/** Counters for a device, updated by the device loop and the update pipeline
+    and published to clockwork as properties of the device.
+ */
+struct DeviceStats {
+    std::atomic<uint64_t> bytes;        // bytes read from the device
+    std::atomic<uint64_t> frames;       // pattern matches
+    std::atomic<uint64_t> queued;       // updates queued for clockwork
+    std::atomic<uint64_t> sent;         // updates accepted by clockwork
+    std::atomic<uint64_t> failed;       // updates clockwork did not accept
+    std::atomic<uint64_t> coalesced;    // updates replaced by a later one before they were sent
+    std::atomic<uint64_t> dropped;      // updates discarded because the backlog was full
+    std::atomic<uint64_t> overflows;    // times input was discarded because the buffer filled without a match
+    std::atomic<uint64_t> reconnects;
+    std::atomic<uint64_t> backlog;      // updates waiting to be sent
+    DeviceStats() : bytes(0), frames(0), queued(0), sent(0), failed(0), coalesced(0),
+        dropped(0), overflows(0), reconnects(0), backlog(0) {}
+};
+
+/** A Device holds the connection to one device, either on a network (tcp) stream
+    or a serial port, and the state of the pattern matching of its input.
+
+    Device Status is used to report the connection state to clockwork via the status property
+ */
+struct Device {
+    Device(Options *opts) : options(opts), connection(-1), listener(-1), connecting(false),
+        was_connected(false), input(opts->bufferSize()), last_active(0), next_attempt(0), retry_delay(50000),
+        reported_status(DeviceStatus::e_unknown), last_status_report(0),
+        last_stats_report(0), last_stats_frames(0), last_send(0) { }
+
+    bool active() {
+        DeviceStatus::State s = status.current();
+        return s == DeviceStatus::e_connected || s == DeviceStatus::e_up || s == DeviceStatus::e_timeout;
+    }
+
+    Options *options;
+    DeviceStatus status;
+    int connection;
+    int listener;
+    bool connecting;                // a non blocking tcp connect is in progress
+    bool was_connected;
+    FrameBuffer input;
+    std::string to_send;
+    uint64_t last_active;           // time data was last received
+    uint64_t next_attempt;          // time of the next connection attempt
+    useconds_t retry_delay;         // usec delay before trying to setup the connection
+                                    // initialy 50ms with a back-off algorithim
+    DeviceStatus::State reported_status;
+    uint64_t last_status_report;
+    uint64_t last_stats_report;
+    uint64_t last_stats_frames;
+
+    // repeats of the last message are skipped for a while unless repeats are collected
+    std::string last_message;
+    uint64_t last_send;
+
+    // the current match
     std::list<Value> params;
     std::string result;
+
+    DeviceStats stats;
 private:
-    MatchFunction() : iod_interface(*MessagingInterface::getContext(), ZMQ_REQ){
-        iod_interface.connect(iod_connection);
-    }
-    zmq::socket_t iod_interface;
-    MatchFunction(const MatchFunction&);
-    MatchFunction &operator=(const MatchFunction&);
+    Device(const Device &);
+    Device &operator=(const Device &);
 };
-MatchFunction *MatchFunction::instance_;
 
-/** The ConnectionThread maintains a connection to the device, either on a network
-    (tcp) stream or a serial port.
- 
-   Device Status is used to report the connection state to clockwork via the status property
-*/
+/** The UpdatePipeline carries messages from the device loop to clockwork. Clockwork
+    is sent one request at a time by the pipeline thread while the device loop keeps
+    reading. A property update replaces a pending update of the same property, a
+    message to a queue that repeats a pending one is dropped (unless repeats are
+    being collected) and when a device has too many updates waiting the oldest is
+    discarded, so a slow clockwork does not stop data being read from the devices.
+ */
+class UpdatePipeline {
+public:
+    struct Update {
+        Device *device;
+        std::string key;    // updates with the same key are coalesced, empty if not
+        std::string message;
+        Update(Device *d, const std::string &k, const std::string &m) : device(d), key(k), message(m) { }
+    };
+
+    UpdatePipeline(uint64_t backlog_limit) : max_backlog(backlog_limit), done(false) { }
+
+    void setProperty(Device *device, const char *machine, const char *property, const Value &value) {
+        char *cmd = MessageEncoding::encodeCommand("PROPERTY", machine, property, value);
+        if (!cmd) return;
+        std::string key("PROPERTY ");
+        key = key + machine + "." + property;
+        push(device, key, cmd);
+        free(cmd);
+    }
 
-struct ConnectionThread {
-    
-    void operator()() {
+    void sendData(Device *device, const char *msg) {
+        if (device->options->skippingRepeats())
+            push(device, std::string("DATA ") + msg, msg);
+        else
+            push(device, "", msg);
+    }
 
-		char thread_name_buf[100];
-		snprintf(thread_name_buf, 100, "%s tcp connection", program_name);
+    // wait up to timeout milliseconds for the next update
+    bool next(Update &update, long timeout) {
+        boost::mutex::scoped_lock lock(mutex);
+        if (pending.empty() && !done)
+            ready.timed_wait(lock, boost::posix_time::milliseconds(timeout));
+        if (pending.empty()) return false;
+        update = pending.front();
+        if (update.key.length()) by_key.erase(update.key);
+        pending.pop_front();
+        --update.device->stats.backlog;
+        return true;
+    }
+
+    void stop() {
+        boost::mutex::scoped_lock lock(mutex);
+        done = true;
+        ready.notify_all();
+    }
 
+    bool empty() {
+        boost::mutex::scoped_lock lock(mutex);
+        return pending.empty();
+    }
+
+private:
+    void push(Device *device, const std::string &key, const std::string &msg) {
+        boost::mutex::scoped_lock lock(mutex);
+        if (key.length()) {
+            std::map<std::string, std::list<Update>::iterator>::iterator found = by_key.find(key);
+            if (found != by_key.end()) {
+                (*(*found).second).message = msg;
+                ++device->stats.coalesced;
+                return;
+            }
+        }
+        if (device->stats.backlog >= max_backlog) {
+            std::list<Update>::iterator oldest = pending.begin();
+            while (oldest != pending.end() && (*oldest).device != device) ++oldest;
+            if (oldest != pending.end()) {
+                if ((*oldest).key.length()) by_key.erase((*oldest).key);
+                pending.erase(oldest);
+                --device->stats.backlog;
+                ++device->stats.dropped;
+            }
+        }
+        pending.push_back(Update(device, key, msg));
+        if (key.length()) by_key[key] = --pending.end();
+        ++device->stats.queued;
+        ++device->stats.backlog;
+        ready.notify_one();
+    }
+
+    boost::mutex mutex;
+    boost::condition ready;
+    std::list<Update> pending;
+    std::map<std::string, std::list<Update>::iterator> by_key;
+    uint64_t max_backlog;
+    bool done;
+};
+
+UpdatePipeline *pipeline = 0;
+
+/** The PipelineThread sends updates from the pipeline to clockwork through the
+    processing thread's command socket.
+ */
+struct PipelineThread {
+    PipelineThread(UpdatePipeline &p) : updates(p), done(false), is_shutdown(false) { }
+
+    void operator()() {
+        char thread_name_buf[100];
+        snprintf(thread_name_buf, 100, "%s pipeline", program_name);
 #ifdef __APPLE__
-		pthread_setname_np(thread_name_buf);
+        pthread_setname_np(thread_name_buf);
 #else
-		pthread_setname_np(pthread_self(), thread_name_buf);
+        pthread_setname_np(pthread_self(), thread_name_buf);
 #endif
-
         try {
-            gettimeofday(&last_active, 0);
-            
-            if (Options::instance()->server()) {
-                listener = anetTcpServer(msg_buffer, Options::instance()->port(), Options::instance()->host());
-                if (listener == ANET_ERR) {
-                    std::cerr << msg_buffer << " attempting to listen on port " << Options::instance()->port() << "...aborting\n";
-                    DeviceStatus::instance()->setStatus(DeviceStatus::e_failed);
-                    updateProperty();
-                    done = true;
-                    return;
-                }
-            }
-            
-            const int buffer_size = 100;
-            char buf[buffer_size];
-            size_t offset = 0;
-            useconds_t retry_delay = 50000; // usec delay before trying to setup
-                                               // the connection initialy 50ms with a back-off algorithim
-            
-            DeviceStatus::instance()->setStatus(DeviceStatus::e_disconnected);
-            updateProperty();
+            zmq::socket_t iod_interface(*MessagingInterface::getContext(), ZMQ_REQ);
+            iod_interface.connect(iod_connection);
+            UpdatePipeline::Update update(0, "", "");
             while (!done) {
-//				std::cout << "c." << std::flush;
-                
-                // connect or accept connection
-                if (DeviceStatus::instance()->current() == DeviceStatus::e_disconnected && Options::instance()->client()) {
-                    if (Options::instance()->serialPort()) {
-                        connection = setupSerialPort(Options::instance()->serialPort(), Options::instance()->serialSettings());
-                        if (connection == -1) {
-                            usleep(retry_delay); // pause before trying again
-                            if (retry_delay < 2000000) retry_delay *= 1.2;
-                            continue;
-                        }
-                    }
-                    else {
-                        if (!done)
-							connection = anetTcpConnect(msg_buffer, Options::instance()->host(), Options::instance()->port());
-                        if (connection == -1) {
-                            std::cerr << msg_buffer << " retrying in " << (retry_delay/1000) << "ms\n";
-                            usleep(retry_delay); // pause before trying again
-                            if (retry_delay < 1000000) retry_delay *= 1.2;
-							if (retry_delay > 1000000) retry_delay = 1000000;
-                            continue;
-                        }
-                    }
-					if (done) break;
-                    retry_delay = 50000;
-                    DeviceStatus::instance()->setStatus(DeviceStatus::e_connected);
-                    updateProperty();
-                }
-                
-                fd_set read_ready;
-				const unsigned long wait_time = 2000000L;
-				unsigned long select_start;
-				select_start = microsecs();
-				int err = 0;
-				while (!done) {
-                	FD_ZERO(&read_ready);
-                	int nfds = 0;
-                	DeviceStatus::State dev_state = DeviceStatus::instance()->current();
-                	if (dev_state == DeviceStatus::e_connected  || dev_state == DeviceStatus::e_up || dev_state == DeviceStatus::e_timeout ) {
-                	    FD_SET(connection, &read_ready);
-                	    nfds = connection+1;
-                	}
-                	else if (Options::instance()->server()) {
-                	    FD_SET(listener, &read_ready);
-                	    nfds = listener+1;
-                	}
-                
-                	struct timeval select_timeout;
-                	select_timeout.tv_sec = 0;
-                	select_timeout.tv_usec = 200000L;
-	                err = select(nfds, &read_ready, NULL, NULL, &select_timeout);
-					if (err != 0) break;
-				
-					if (microsecs() - select_start >= wait_time) {
-						std::cerr << "\ntimeout\n";
-						break;
-					}
-				}
-				if (done) break;
-                if (err == -1) {
-                    if (errno != EINTR)
-                        std::cerr << "socket: " << strerror(errno) << "\n";
-					else
-						std::cerr << "select was interrupred\n";
-
+                if (!updates.next(update, 200)) continue;
+                std::string response;
+                if (debug) std::cout << "sending: " << update.message << "\n" << std::flush;
+                if (sendMessage(update.message.c_str(), iod_interface, response))
+                    ++update.device->stats.sent;
+                else {
+                    ++update.device->stats.failed;
+                    std::cerr << "Failed to send " << update.message << " response: " << response << "\n" << std::flush;
                 }
-                else if (err == 0) {
-                    DeviceStatus::State dev_state = DeviceStatus::instance()->current();
-                    if (dev_state == DeviceStatus::e_connected || dev_state == DeviceStatus::e_up) {
-                        DeviceStatus::instance()->setStatus( DeviceStatus::e_timeout );
-                        updateProperty();
-                        std::cerr << "select timeout " << (wait_time /1000000L) << "."
-                        << std::setfill('0') << std::setw(3) << ( (wait_time%1000000) / 1000) << "\n";
-                        
-                        // we disconnect from a TCP connection on a timeout but do nothing in the case of a serial port
-                        if (!Options::instance()->serialPort() && Options::instance()->disconnectOnTimeout()) {
-                            std::cerr << "Closing device connection due to timeout\n";
-                            close(connection);
-                            DeviceStatus::instance()->setStatus( DeviceStatus::e_disconnected );
-                            updateProperty();
-                        }
-                        continue;
-                    }
-                }
-                
-				if (done) break;
-                if (Options::instance()->server() 
-						&& DeviceStatus::instance()->current() == DeviceStatus::e_disconnected 
-						&& FD_ISSET(listener, &read_ready)) {
-                    // Accept and setup a connection
-                    int port;
-                    char hostip[16]; // dot notation
-                    connection = anetAccept(msg_buffer, listener, hostip, &port);
-                    
-                    if (anetTcpKeepAlive(msg_buffer, connection) == -1) {
-                        std::cerr << msg_buffer << "\n";
-                        close(connection);
-                        continue;
-                    }
-                    
-                    if (anetTcpNoDelay(msg_buffer, connection) == -1) {
-                        std::cerr << msg_buffer << "\n";
-                        close(connection);
-                        continue;
-                    }
-                    
-                    if (anetNonBlock(msg_buffer, connection) == -1) {
-                        std::cerr << msg_buffer << "\n";
-                        close(connection);
-                        continue;
-                    }
-                    DeviceStatus::instance()->setStatus( DeviceStatus::e_connected );
-                    updateProperty();
-                }
-                else if (connection != -1 && FD_ISSET(connection, &read_ready)) {
-                    if (offset < buffer_size-1) {
-                        ssize_t n = read(connection, buf+offset, buffer_size - offset - 1);
-						if (done) break;
-                        if (n == -1) {
-                            if (!done && errno != EINTR && errno != EAGAIN) { // stop() may cause a read error that we ignore
-                                std::cerr << "error: " << strerror(errno) << " reading from connection\n";
-                                close(connection);
-                                DeviceStatus::instance()->setStatus( DeviceStatus::e_disconnected );
-                                updateProperty();
-                            }
-                        }
-                        else if (n) {
-                            DeviceStatus::instance()->setStatus( DeviceStatus::e_up );
-                            updateProperty();
-                            
-                            buf[offset+n] = 0;
-                            {
-                                boost::mutex::scoped_lock lock(connection_mutex);
-                                gettimeofday(&last_active, 0);
-                                last_msg = buf;
-                            }
-                        }
-                        else {
-                            close(connection);
-                            DeviceStatus::instance()->setStatus( DeviceStatus::e_disconnected );
-                            updateProperty();
-                            std::cerr << "connection lost\n";
-                            connection = -1;
-                        }
-                        
-                        // recalculate offset as we step through matches
-                        offset = 0;
-                        each_match(Options::instance()->regexpInfo(), buf, &offset, &MatchFunction::match_func, 0);
-                        size_t len = strlen(buf);
-												if (debug) {
-	                        std::cout << "buf: ";
-	                        for (unsigned int i=0; i<=len; ++i) {
-	                            std::cout << std::setw(2) << std::setfill('0') << std::hex << (int)buf[i];
-															if (isprint(buf[i])) std::cout << "[" << (char)buf[i] << "] "; else std::cout <<" ";
-	                        }
-	                        std::cout << "\n";
-	                        std::cout << "     ";
-	                        
-	                        for (unsigned int i=0; i<offset; ++i) {
-	                            std::cout << std::hex << "   ";
-	                        }
-	                        std::cout << "^\n";
-													std::cout << "offset: " << offset << "\n";
-												}
-                        if (offset)  {
-                            memmove(buf, buf+offset, len+1-offset);
-                        }
-                        offset = strlen(buf);
-                    }
-                    else {
-                        std::cerr << "buffer full: " << buf << "\n";
-												offset = 0;
-                        close(connection);
-                        DeviceStatus::instance()->setStatus(DeviceStatus::e_disconnected);
-                        updateProperty();
-                    }
+                if (response == "Unknown device") {
+                    std::cout << "invalid clockwork device name " << update.device->options->name() << "\n"<< std::flush;
                 }
             }
-			std::cout << "Connection Thread Done\n";
-			is_shutdown = true;
-			
-        }catch (std::exception e) {
+        }
+        catch (std::exception e) {
             if (zmq_errno())
                 std::cerr << zmq_strerror(zmq_errno()) << "\n";
             else
                 std::cerr << e.what() << "\n";
         }
+        is_shutdown = true;
     }
-    
-    void send(const char *msg) {
-        boost::mutex::scoped_lock lock(connection_mutex);
-        to_send += msg;
-        if (connection != -1 && !to_send.empty()) {
-            //boost::mutex::scoped_lock lock(connection_mutex);
-            
-            size_t n = write(connection, to_send.c_str(), to_send.length());
-            if ((long)n == -1) {
-                std::cerr << "write error sending data to current connection\n";
+
+    void stop() { done = true; updates.stop(); }
+    bool stopped() { return is_shutdown; }
+
+    UpdatePipeline &updates;
+    volatile bool done;
+    bool is_shutdown;
+};
+
+/** The match function is called for each match of a device's pattern, and for each
+    subexpression, and passes the matched data to iod/clockwork via the pipeline.
+ */
+static int deviceMatch(const char *match, int index, void *data)
+{
+    Device *device = (Device*)data;
+    Options *options = device->options;
+    if (debug)std::cout << device->options->name() << " match: " << index << " " << match << "\n";
+    int num_sub = (int)numSubexpressions(options->regexpInfo());
+    if (num_sub == 0 || index>0) {
+        uint64_t now = microsecs();
+        if (index == num_sub) ++device->stats.frames;
+        if (options->sendJSON() && options->queue()) {
+            // structured messaging, pushing each match to a queue
+            if (index == 0 || index == 1) {
+                device->params.clear();
+                device->params.push_back(options->queue());
             }
-            else {
-                to_send = to_send.substr(n); // shift off the data that has been written
+            device->params.push_back(Value(match, Value::t_string));
+            if (index == num_sub) {
+                char *msg = MessageEncoding::encodeCommand("DATA", &device->params);
+                if (msg && (options->skippingRepeats() == false
+                            || device->last_message != msg || device->last_send + 5000000 < now)) {
+                    pipeline->sendData(device, msg);
+                    device->last_message = msg;
+                    device->last_send = now;
+                }
+                if (msg) free(msg);
+            }
+        }
+        if (options->property()) {
+            if (index == 0 || index == 1)
+                device->result = match;
+            else
+                device->result = device->result + " " +match;
+
+            const std::string &res = device->result;
+            if (index == num_sub && (options->skippingRepeats() == false
+                                        || device->last_message != res || device->last_send + 5000000 < now)) {
+                pipeline->setProperty(device, options->machine(), options->property(), res.c_str());
+                device->last_message = res;
+                device->last_send = now;
             }
         }
     }
-    
-    ConnectionThread() 
-	: done(false), is_shutdown(false),
-		connection(-1), cmd_interface(*MessagingInterface::getContext(), ZMQ_REQ), msg_buffer(0)
-    {
-        assert(Options::instance()->valid());
-        msg_buffer =new char[ANET_ERR_LEN];
-        gettimeofday(&last_active, 0);
-        last_property_update.tv_sec = 0;
-        last_property_update.tv_usec = 0;
-        last_status = DeviceStatus::e_unknown;
-        cmd_interface.connect(iod_connection);
+    return 0;
+}
+
+/** The DeviceLoop maintains the connections to all the devices using epoll, reading
+    the available data from each device into its FrameBuffer and matching it against
+    the device's pattern. Nothing in the loop waits for clockwork.
+ */
+class DeviceLoop {
+public:
+    DeviceLoop(std::vector<Device*> &devs, unsigned int stats_secs)
+        : devices(devs), stats_interval((uint64_t)stats_secs * 1000000L), epfd(-1), wakeup(-1),
+        done(false), is_shutdown(false) { }
+
+    void operator()() {
+        char thread_name_buf[100];
+        snprintf(thread_name_buf, 100, "%s devices", program_name);
+#ifdef __APPLE__
+        pthread_setname_np(thread_name_buf);
+#else
+        pthread_setname_np(pthread_self(), thread_name_buf);
+#endif
+        epfd = epoll_create1(0);
+        wakeup = eventfd(0, EFD_NONBLOCK);
+        if (epfd == -1 || wakeup == -1) {
+            std::cerr << "device loop: " << strerror(errno) << "\n";
+            is_shutdown = true;
+            return;
+        }
+        watch(wakeup, wakeup_id, EPOLLIN, EPOLL_CTL_ADD);
+
+        uint64_t now = microsecs();
+        for (unsigned int i = 0; i < devices.size(); ++i) {
+            Device *device = devices[i];
+            device->status.setStatus(DeviceStatus::e_disconnected);
+            reportStatus(device, now);
+            if (device->options->server()) listen(i, now);
+        }
+
+        const int max_events = 64;
+        struct epoll_event events[max_events];
+        while (!done) {
+            now = microsecs();
+            checkTimers(now);
+            int n = epoll_wait(epfd, events, max_events, 100);
+            if (done) break;
+            if (n == -1) {
+                if (errno != EINTR) std::cerr << "epoll: " << strerror(errno) << "\n";
+                continue;
+            }
+            for (int e = 0; e < n; ++e) {
+                uint64_t id = events[e].data.u64;
+                if (id == wakeup_id) { takeOutbox(); continue; }
+                unsigned int which = (unsigned int)(id >> 1);
+                if (which >= devices.size()) continue;
+                if (id & 1)
+                    accept(which);
+                else
+                    handle(which, events[e].events);
+            }
+        }
+        for (unsigned int i = 0; i < devices.size(); ++i) {
+            Device *device = devices[i];
+            if (device->connection != -1 || device->connecting) {
+                std::cout << "closing connection to " << device->options->name() << "\n";
+                disconnect(i, DeviceStatus::e_disconnected);
+            }
+            if (device->listener != -1) { close(device->listener); device->listener = -1; }
+        }
+        close(wakeup);
+        close(epfd);
+        std::cout << "Device Loop Done\n";
+        is_shutdown = true;
     }
-    
-	bool stopped() { return is_shutdown; }
+
+    // data to be written to a device, may be called from any thread
+    void send(Device *device, const char *msg) {
+        {
+            boost::mutex::scoped_lock lock(outbox_mutex);
+            outbox.push_back(std::make_pair(device, std::string(msg)));
+        }
+        signal();
+    }
+
     void stop() {
-        if(done) {
-			std::cout << "connection thread is already done\n"; 
-			return;
-		}
-		done = true;
-        DeviceStatus::State dev_state = DeviceStatus::instance()->current();
-		std::cout << "device connector connection thread got stop when status == " 
-			<< stringFromDeviceStatus(dev_state) << "\n";
-        if (dev_state == DeviceStatus::e_connected 
-				|| dev_state == DeviceStatus::e_up 
-				|| dev_state == DeviceStatus::e_disconnected) {
-			std::cout << "closing connection\n";
+        if (done) {
+            std::cout << "device loop is already done\n";
+            return;
+        }
+        done = true;
+        signal();
+    }
+    bool stopped() { return is_shutdown; }
+
+private:
+    static const uint64_t wakeup_id = ~(uint64_t)0;
+
+    void signal() {
+        uint64_t one = 1;
+        if (wakeup != -1 && write(wakeup, &one, sizeof(one)) == -1 && errno != EAGAIN)
+            std::cerr << "device loop wakeup: " << strerror(errno) << "\n";
+    }
+
+    void watch(int fd, uint64_t id, uint32_t events, int op) {
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = events;
+        ev.data.u64 = id;
+        if (epoll_ctl(epfd, op, fd, &ev) == -1)
+            std::cerr << "epoll_ctl: " << strerror(errno) << "\n";
+    }
+
+    void setStatus(Device *device, DeviceStatus::State s) {
+        device->status.setStatus(s);
+        reportStatus(device, microsecs());
+    }
+
+    // the status property is refreshed every five seconds and whenever it changes
+    void reportStatus(Device *device, uint64_t now) {
+        DeviceStatus::State current = device->status.current();
+        if (current == device->reported_status && now < device->last_status_report + 5000000L) return;
+        device->reported_status = current;
+        device->last_status_report = now;
+        pipeline->setProperty(device, device->options->name(), "status", stringFromDeviceStatus(current));
+    }
+
+    void reportStats(Device *device, uint64_t now) {
+        if (!stats_interval || now < device->last_stats_report + stats_interval) return;
+        DeviceStats &stats = device->stats;
+        const char *name = device->options->name();
+        uint64_t frames = stats.frames;
+        if (device->last_stats_report) {
+            double rate = (double)(frames - device->last_stats_frames) * 1000000.0 / (now - device->last_stats_report);
+            pipeline->setProperty(device, name, "frame_rate", Value(rate));
+        }
+        device->last_stats_report = now;
+        device->last_stats_frames = frames;
+        pipeline->setProperty(device, name, "received", Value((long)stats.bytes));
+        pipeline->setProperty(device, name, "frames", Value((long)frames));
+        pipeline->setProperty(device, name, "sent", Value((long)stats.sent));
+        pipeline->setProperty(device, name, "coalesced", Value((long)stats.coalesced));
+        pipeline->setProperty(device, name, "dropped", Value((long)stats.dropped));
+        pipeline->setProperty(device, name, "overflows", Value((long)stats.overflows));
+        pipeline->setProperty(device, name, "backlog", Value((long)stats.backlog));
+        if (debug)
+            std::cout << name << " received: " << stats.bytes << " frames: " << frames
+                << " sent: " << stats.sent << " coalesced: " << stats.coalesced
+                << " dropped: " << stats.dropped << " backlog: " << stats.backlog << "\n";
+    }
+
+    void retryLater(Device *device, uint64_t now, useconds_t limit) {
+        device->next_attempt = now + device->retry_delay;
+        if (device->retry_delay < limit) device->retry_delay *= 1.2;
+        if (device->retry_delay > limit) device->retry_delay = limit;
+    }
+
+    void listen(unsigned int which, uint64_t now) {
+        Device *device = devices[which];
+        Options *options = device->options;
+        device->listener = anetTcpServer(msg_buffer, options->port(), options->host());
+        if (device->listener == ANET_ERR) {
+            device->listener = -1;
+            std::cerr << msg_buffer << " attempting to listen on port " << options->port() << " for "
+                << options->name() << "\n";
+            setStatus(device, DeviceStatus::e_failed);
+            device->next_attempt = now + 5000000L;
+            return;
+        }
+        anetNonBlock(msg_buffer, device->listener);
+        watch(device->listener, ((uint64_t)which << 1) | 1, EPOLLIN, EPOLL_CTL_ADD);
+        if (device->status.current() == DeviceStatus::e_failed)
+            setStatus(device, DeviceStatus::e_disconnected);
+    }
+
+    void connect(unsigned int which, uint64_t now) {
+        Device *device = devices[which];
+        Options *options = device->options;
+        if (options->serialPort()) {
+            device->connection = setupSerialPort(options->serialPort(), options->serialSettings());
+            if (device->connection == -1) { retryLater(device, now, 2000000); return; }
+            connected(which);
+            return;
+        }
+        device->connection = anetTcpNonBlockConnect(msg_buffer, options->host(), options->port());
+        if (device->connection == -1) {
+            std::cerr << msg_buffer << " retrying in " << (device->retry_delay/1000) << "ms\n";
+            retryLater(device, now, 1000000);
+            return;
+        }
+        device->connecting = true;
+        device->next_attempt = now + 5000000L; // time allowed for the connection to complete
+        watch(device->connection, (uint64_t)which << 1, EPOLLIN | EPOLLOUT, EPOLL_CTL_ADD);
+    }
+
+    void connected(unsigned int which) {
+        Device *device = devices[which];
+        if (!device->connecting)
+            watch(device->connection, (uint64_t)which << 1, EPOLLIN, EPOLL_CTL_ADD);
+        device->connecting = false;
+        device->retry_delay = 50000;
+        device->last_active = microsecs();
+        device->input.clear();
+        if (device->was_connected) ++device->stats.reconnects;
+        device->was_connected = true;
+        setStatus(device, DeviceStatus::e_connected);
+        writeOutput(which);
+    }
+
+    void accept(unsigned int which) {
+        Device *device = devices[which];
+        int port;
+        char hostip[16]; // dot notation
+        int connection = anetAccept(msg_buffer, device->listener, hostip, &port);
+        if (connection == ANET_ERR) return;
+        if (device->connection != -1) {
+            std::cerr << device->options->name() << " is already connected, refusing connection from " << hostip << "\n";
+            close(connection);
+            return;
+        }
+        if (anetTcpKeepAlive(msg_buffer, connection) == -1
+                || anetTcpNoDelay(msg_buffer, connection) == -1
+                || anetNonBlock(msg_buffer, connection) == -1) {
+            std::cerr << msg_buffer << "\n";
             close(connection);
-			connection = -1;
-			DeviceStatus::instance()->setStatus( DeviceStatus::e_disconnected );
-			updateProperty();
+            return;
         }
+        device->connection = connection;
+        connected(which);
     }
-    
-    // returns the last received message and the time it arrived
-    void get_last_message(std::string &msg, struct timeval &msg_time) {
-        boost::mutex::scoped_lock lock(connection_mutex);
-        msg = last_msg;
-        msg_time = last_active;
+
+    void disconnect(unsigned int which, DeviceStatus::State new_status) {
+        Device *device = devices[which];
+        if (device->connection != -1) {
+            epoll_ctl(epfd, EPOLL_CTL_DEL, device->connection, 0);
+            close(device->connection);
+        }
+        device->connection = -1;
+        device->connecting = false;
+        setStatus(device, new_status);
+        if (device->options->client()) retryLater(device, microsecs(), 1000000);
     }
-    
-    void updateProperty() {
-        struct timeval now;
-        gettimeofday(&now, 0);
-        if (last_status != DeviceStatus::instance()->current() || now.tv_sec >= last_property_update.tv_sec + 5) {
-            {
-            boost::mutex::scoped_lock lock(connection_mutex);
-            last_property_update.tv_sec = now.tv_sec;
-            last_property_update.tv_usec = now.tv_usec;
-            last_status = DeviceStatus::instance()->current();
+
+    void handle(unsigned int which, uint32_t events) {
+        Device *device = devices[which];
+        if (device->connection == -1) return;
+        if (device->connecting) {
+            int err = 0;
+            socklen_t len = sizeof(err);
+            if (getsockopt(device->connection, SOL_SOCKET, SO_ERROR, &err, &len) == -1) err = errno;
+            if (err) {
+                std::cerr << "connect: " << strerror(err) << " connecting to " << device->options->host()
+                    << ":" << device->options->port() << "\n";
+                disconnect(which, DeviceStatus::e_disconnected);
+                return;
             }
-            bool sent = false;
-            char *cmd_str = MessageEncoding::encodeCommand("PROPERTY", Options::instance()->name(),
-                                                           "status", stringFromDeviceStatus(DeviceStatus::instance()->current()));
-            std::string response;
-            if (cmd_str) {
-                sent = sendMessage(cmd_str, cmd_interface, response);
-                free(cmd_str);
+            if (!(events & (EPOLLOUT | EPOLLIN))) return;
+            connected(which);
+        }
+        if (events & EPOLLIN) readInput(which);
+        if (device->connection != -1 && (events & EPOLLOUT)) writeOutput(which);
+        if (device->connection != -1 && (events & (EPOLLERR | EPOLLHUP)) && !(events & EPOLLIN)) {
+            std::cerr << device->options->name() << " connection lost\n";
+            disconnect(which, DeviceStatus::e_disconnected);
+        }
+    }
+
+    void readInput(unsigned int which) {
+        Device *device = devices[which];
+        for (;;) {
+            if (device->input.full()) {
+                // no frame was found in a full buffer, keep the most recent half
+                std::cerr << device->options->name() << " buffer full: " << escapeNonprintables(device->input.text()) << "\n";
+                ++device->stats.overflows;
+                device->input.consume(device->input.length() / 2);
             }
-//            sent = iod_interface.setProperty(Options::instance()->name(),
-//                                            "status", stringFromDeviceStatus(DeviceStatus::instance()->current()));
-            if (!sent) {
-                std::cerr << "Failed to set status property " << Options::instance()->name() << ".status\n"
-				<< " response: " << response << "\n" << std::flush;
+            ssize_t n = device->input.readFrom(device->connection);
+            if (n > 0) {
+                device->stats.bytes += n;
+                device->last_active = microsecs();
+                if (device->status.current() != DeviceStatus::e_up) setStatus(device, DeviceStatus::e_up);
+                matchFrames(device);
+                continue;
+            }
+            if (n == -1 && errno == EINTR) continue;
+            if (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+            if (n == -1)
+                std::cerr << "error: " << strerror(errno) << " reading from " << device->options->name() << "\n";
+            else
+                std::cerr << device->options->name() << " connection lost\n";
+            disconnect(which, DeviceStatus::e_disconnected);
+            return;
+        }
+    }
+
+    void matchFrames(Device *device) {
+        for (;;) {
+            const char *text = device->input.text();
+            size_t offset = 0;
+            each_match(device->options->regexpInfo(), text, &offset, &deviceMatch, device);
+            if (debug) std::cout << device->options->name() << " buf: " << escapeNonprintables(text)
+                << " offset: " << offset << "\n";
+            size_t text_len = strlen(text);
+            if (text_len < device->input.length()) {
+                // the pattern cannot see past a null, discard the data up to and including it
+                device->input.consume(text_len + 1);
+                continue;
             }
-            if (response == "Unknown device") {
-                std::cout << "invalid clockwork device name " << Options::instance()->name() << "\n"<< std::flush;
+            device->input.consume(offset);
+            return;
+        }
+    }
+
+    void writeOutput(unsigned int which) {
+        Device *device = devices[which];
+        if (device->connection == -1 || device->connecting) return;
+        while (!device->to_send.empty()) {
+            ssize_t n = write(device->connection, device->to_send.c_str(), device->to_send.length());
+            if (n == -1 && errno == EINTR) continue;
+            if (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+            if (n == -1) {
+                std::cerr << "write error sending data to " << device->options->name() << "\n";
+                device->to_send.clear();
+                break;
             }
+            device->to_send.erase(0, n); // shift off the data that has been written
         }
+        watch(device->connection, (uint64_t)which << 1,
+                EPOLLIN | (device->to_send.empty() ? 0 : EPOLLOUT), EPOLL_CTL_MOD);
     }
-    bool done;
-	bool is_shutdown;
-    int listener;
-    int connection;
-    zmq::socket_t cmd_interface;
-    std::string last_msg;
-    char *msg_buffer;
-    struct timeval last_active;
-    DeviceStatus::State last_status;
-    struct timeval last_property_update;
-    boost::mutex connection_mutex;
-    struct termios terminal_settings;
-    std::string to_send;
+
+    void takeOutbox() {
+        uint64_t count;
+        while (read(wakeup, &count, sizeof(count)) > 0) { }
+        std::list< std::pair<Device*, std::string> > messages;
+        {
+            boost::mutex::scoped_lock lock(outbox_mutex);
+            messages.swap(outbox);
+        }
+        while (!messages.empty()) {
+            Device *device = messages.front().first;
+            device->to_send += messages.front().second;
+            messages.pop_front();
+            for (unsigned int i = 0; i < devices.size(); ++i)
+                if (devices[i] == device) { writeOutput(i); break; }
+        }
+    }
+
+    void checkTimers(uint64_t now) {
+        const uint64_t wait_time = 2000000L;
+        for (unsigned int i = 0; i < devices.size(); ++i) {
+            Device *device = devices[i];
+            Options *options = device->options;
+            DeviceStatus::State dev_state = device->status.current();
+            if (options->client() && device->connection == -1 && now >= device->next_attempt)
+                connect(i, now);
+            else if (device->connecting && now >= device->next_attempt) {
+                std::cerr << "timeout connecting to " << options->host() << ":" << options->port() << "\n";
+                disconnect(i, DeviceStatus::e_disconnected);
+            }
+            else if (options->server() && device->listener == -1 && now >= device->next_attempt)
+                listen(i, now);
+            else if ( (dev_state == DeviceStatus::e_connected || dev_state == DeviceStatus::e_up)
+                    && now >= device->last_active + wait_time) {
+                std::cerr << options->name() << " timeout " << (wait_time /1000000L) << "."
+                    << std::setfill('0') << std::setw(3) << ( (wait_time%1000000) / 1000) << "\n";
+                setStatus(device, DeviceStatus::e_timeout);
+                // we disconnect from a TCP connection on a timeout but do nothing in the case of a serial port
+                if (!options->serialPort() && options->disconnectOnTimeout()) {
+                    std::cerr << "Closing device connection due to timeout\n";
+                    disconnect(i, DeviceStatus::e_disconnected);
+                }
+            }
+            reportStatus(device, now);
+            reportStats(device, now);
+        }
+    }
+
+    std::vector<Device*> &devices;
+    uint64_t stats_interval;
+    int epfd;
+    int wakeup;
+    boost::mutex outbox_mutex;
+    std::list< std::pair<Device*, std::string> > outbox;
+    volatile bool done;
+    bool is_shutdown;
+    char msg_buffer[ANET_ERR_LEN];
 };
 
 volatile bool done = false;
-ConnectionThread *connection_thread = 0;
+std::vector<Device*> devices;
+DeviceLoop *device_loop = 0;
 Options *Options::instance_;
 
 static void finish(int sig)
@@ -924,7 +1224,7 @@ public:
 
 class ProcessingThread {
 public:
-	Options &options;
+	bool watching; // a device watches a property, clockwork is reached through a channel
 	zmq::socket_t &cmd;
 	ConnectionManager *connection_manager;
 	bool done;
@@ -936,9 +1236,9 @@ public:
 	}
 	bool stopped() { return is_shutdown; }
 
-	ProcessingThread(Options &opt, zmq::socket_t &command_sock,
+	ProcessingThread(bool watch, zmq::socket_t &command_sock,
 					 ConnectionManager *connection_mgr)
-	: options(opt), cmd(command_sock), connection_manager(connection_mgr), done(false), is_shutdown(false) {
+	: watching(watch), cmd(command_sock), connection_manager(connection_mgr), done(false), is_shutdown(false) {
 
 	}
 	void operator()() {
@@ -950,7 +1250,7 @@ public:
 
 		int subs_index = -1;
 		int num_items = 0;
-		if (options.watchProperty()) {
+		if (watching) {
 			SubscriptionManager *sm = dynamic_cast<SubscriptionManager*>(connection_manager);
 			assert(sm);
 			items[idx].socket = (void*)sm->setup(); items[idx].events = ZMQ_POLLERR | ZMQ_POLLIN;  idx++;
@@ -1035,10 +1335,12 @@ public:
 						if (cmd == "PROPERTY") {
 							std::string prop = params->at(0).asString();
 							prop = prop + "." + params->at(1).asString();
-							if (prop == options.watchProperty()) {
-								connection_thread->send(params->at(2).asString().c_str());
-								if (debug)std::cout << "sending: " << params->at(2).asString().c_str() << "\n";
-
+							for (unsigned int i = 0; i < devices.size(); ++i) {
+								const char *watched = devices[i]->options->watchProperty();
+								if (watched && prop == watched) {
+									device_loop->send(devices[i], params->at(2).asString().c_str());
+									if (debug)std::cout << "sending: " << params->at(2).asString().c_str() << "\n";
+								}
 							}
 						}
 						if (params) delete params;
@@ -1054,13 +1356,126 @@ public:
 			else usleep(500);
 		}
 		
-		if (connection_thread) connection_thread->stop();
+		if (device_loop) device_loop->stop();
 //		std::cout << "p.done\n" << std::flush;
 		is_shutdown = true;
 	}
 };
 
 
+// device options may be given on the command line or in each line of a config file
+static bool parseDeviceOption(Options &options, int argc, const char * argv[], int &i) {
+    if (strcmp(argv[i], "--port") == 0 && i < argc-1) {
+        long port;
+        char *next;
+        port = strtol(argv[++i], &next, 10);
+        if (!*next) options.setPort(port & 0xffff);
+    }
+    else if (strcmp(argv[i], "--host") == 0 && i < argc-1) {
+        options.setHost(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--name") == 0 && i < argc-1) {
+        options.setName(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--property") == 0 && i < argc-1) {
+        options.setProperty(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--pattern") == 0 && i < argc-1) {
+        options.setPattern(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--queue") == 0 && i < argc-1) {
+        options.setQueue(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--client") == 0) {
+        options.clientMode();
+    }
+    else if (strcmp(argv[i], "--serial_port") == 0 && i < argc-1) {
+        options.setSerialPort(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--serial_settings") == 0 && i < argc-1) {
+        options.setSerialSettings(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--watch_property") == 0 && i < argc-1) {
+        options.setWatch(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--collect_repeats") == 0) {
+        options.doNotSkipRepeats();
+    }
+    else if (strcmp(argv[i], "--disconnect_on_timeout") == 0) {
+        options.setDisconnectOnTimeout(true);
+    }
+    else if (strcmp(argv[i], "--no_timeout_disconnect") == 0) {
+        options.setDisconnectOnTimeout(false);
+    }
+    else if (strcmp(argv[i], "--no_json") == 0) {
+        options.setSendJSON(false);
+    }
+    else if (strcmp(argv[i], "--buffer_size") == 0 && i < argc-1) {
+        options.setBufferSize(strtol(argv[++i], 0, 10));
+    }
+    else
+        return false;
+    return true;
+}
+
+// split a config line into words, words may be quoted with ' or "
+static void splitConfigLine(const std::string &line, std::vector<std::string> &words) {
+    size_t i = 0;
+    while (i < line.length()) {
+        while (i < line.length() && isspace(line[i])) ++i;
+        if (i == line.length() || line[i] == '#') return;
+        std::string word;
+        while (i < line.length() && !isspace(line[i])) {
+            if (line[i] == '"' || line[i] == '\'') {
+                char quote = line[i++];
+                while (i < line.length() && line[i] != quote) {
+                    if (quote == '"' && line[i] == '\\' && i+1 < line.length() && line[i+1] == '"') ++i;
+                    word += line[i++];
+                }
+                if (i < line.length()) ++i;
+            }
+            else
+                word += line[i++];
+        }
+        words.push_back(word);
+    }
+}
+
+/* each line of the config file gives the options for a device, for example
+    --name scale1 --host 10.1.2.3 --port 4001 --client --pattern "([0-9.]+)kg" --property scale1.weight
+*/
+static bool loadDevices(const char *config_file, std::vector<Device*> &devices) {
+    std::ifstream config(config_file);
+    if (!config) {
+        std::cerr << "Error: could not read config file " << config_file << "\n";
+        return false;
+    }
+    bool ok = true;
+    std::string line;
+    int line_no = 0;
+    while (std::getline(config, line)) {
+        ++line_no;
+        std::vector<std::string> words;
+        splitConfigLine(line, words);
+        if (words.empty()) continue;
+        std::vector<const char *> args;
+        for (unsigned int w = 0; w < words.size(); ++w) args.push_back(words[w].c_str());
+        Options *options = new Options;
+        for (int i = 0; i < (int)args.size(); ++i) {
+            if (!parseDeviceOption(*options, (int)args.size(), &args[0], i))
+                std::cerr << config_file << ":" << line_no << " Warning: parameter " << args[i] << " not understood\n";
+        }
+        if (!options->valid()) {
+            std::cerr << "  in " << config_file << ":" << line_no << "\n";
+            delete options;
+            ok = false;
+            continue;
+        }
+        devices.push_back(new Device(options));
+    }
+    return ok;
+}
+
 int main(int argc, const char * argv[])
 {
 	char *pn = strdup(argv[0]);
@@ -1076,78 +1491,56 @@ int main(int argc, const char * argv[])
 	std::cout << "ZMQ version " << major << "." << minor << "." << patch << "\n";
 #endif
 
-    last_send.tv_sec = 0;
-    last_send.tv_usec = 0;
     try {
         Options &options = *Options::instance();
+        const char *config_file = 0;
+        bool device_options = false; // the command line also describes a device
+        unsigned int stats_interval = 5;
+        long max_backlog = 1000;
         for (int i=1; i<argc; i++) {
-            if (strcmp(argv[i], "--port") == 0 && i < argc-1) {
-                long port;
-                char *next;
-                port = strtol(argv[++i], &next, 10);
-                if (!*next) options.setPort(port & 0xffff);
-            }
-            else if (strcmp(argv[i], "--host") == 0 && i < argc-1) {
-                options.setHost(argv[++i]);
+            if (parseDeviceOption(options, argc, argv, i)) {
+                device_options = true;
             }
             else if (strcmp(argv[i], "--cw_host") == 0 && i < argc-1) {
                 options.setIODHost(argv[++i]);
             }
-            else if (strcmp(argv[i], "--name") == 0 && i < argc-1) {
-                options.setName(argv[++i]);
-            }
-            else if (strcmp(argv[i], "--property") == 0 && i < argc-1) {
-                options.setProperty(argv[++i]);
-            }
-            else if (strcmp(argv[i], "--pattern") == 0 && i < argc-1) {
-                options.setPattern(argv[++i]);
-            }
-            else if (strcmp(argv[i], "--queue") == 0 && i < argc-1) {
-                options.setQueue(argv[++i]);
-            }
-            else if (strcmp(argv[i], "--client") == 0) {
-                options.clientMode();
-            }
-            else if (strcmp(argv[i], "--serial_port") == 0) {
-                options.setSerialPort(argv[++i]);
-            }
-            else if (strcmp(argv[i], "--serial_settings") == 0) {
-                options.setSerialSettings(argv[++i]);
-            }
-            else if (strcmp(argv[i], "--watch_property") == 0) {
-                options.setWatch(argv[++i]);
-            }
-            else if (strcmp(argv[i], "--collect_repeats") == 0) {
-                options.doNotSkipRepeats();
-            }
-            else if (strcmp(argv[i], "--disconnect_on_timeout") == 0) {
-                options.setDisconnectOnTimeout(true);
-            }
-            else if (strcmp(argv[i], "--no_timeout_disconnect") == 0) {
-                options.setDisconnectOnTimeout(false);
-            }
-            else if (strcmp(argv[i], "--no_json") == 0) {
-                options.setSendJSON(false);
-            }
             else if (strcmp(argv[i], "--cw_port") == 0 && i < argc-1) {
                 int pport = (int)strtol(argv[++i], 0, 10);
                 options.set_publisher_port(pport);
                 set_publisher_port(pport);
             }
-			else if (strcmp(argv[i], "--channel") == 0) {
+			else if (strcmp(argv[i], "--channel") == 0 && i < argc-1) {
 				options.setChannelName(argv[++i]);
 			}
+            else if (strcmp(argv[i], "--config") == 0 && i < argc-1) {
+                config_file = argv[++i];
+            }
+            else if (strcmp(argv[i], "--stats_interval") == 0 && i < argc-1) {
+                stats_interval = (unsigned int)strtol(argv[++i], 0, 10);
+            }
+            else if (strcmp(argv[i], "--max_backlog") == 0 && i < argc-1) {
+                max_backlog = strtol(argv[++i], 0, 10);
+                if (max_backlog < 1) max_backlog = 1;
+            }
             else {
                 std::cerr << "Warning: parameter " << argv[i] << " not understood\n"<<std::flush;
             }
         }
-        if (!options.valid()) {
+        if (config_file && !loadDevices(config_file, devices)) {
             usage(argc, argv);
             exit(EXIT_FAILURE);
         }
+        if (device_options || !config_file) {
+            if (!options.valid()) {
+                usage(argc, argv);
+                exit(EXIT_FAILURE);
+            }
+            devices.push_back(new Device(&options));
+        }
+        bool watching = false;
+        for (unsigned int i = 0; i < devices.size(); ++i)
+            if (devices[i]->options->watchProperty()) watching = true;
 
-        struct timeval last_time;
-        gettimeofday(&last_time, 0);
         if (!setup_signals()) {
             std::cerr << "Error setting up signals " << strerror(errno) << "\n"<<std::flush;
         }
@@ -1158,7 +1551,7 @@ int main(int argc, const char * argv[])
 
 		ConnectionManager *connection_manager = 0;
 		try {
-			if (options.watchProperty())
+			if (watching)
 				connection_manager = new SubscriptionManager(Options::instance()->getChannelName(), eCLOCKWORK);
 			else
 				connection_manager = new CommandManager(options.iodHost(), 5555);
@@ -1171,10 +1564,14 @@ int main(int argc, const char * argv[])
 		}
 		assert(connection_manager);
 
-		connection_thread = new ConnectionThread;
-		boost::thread monitor(boost::ref(*connection_thread));
+		pipeline = new UpdatePipeline(max_backlog);
+		PipelineThread pipeline_thread(*pipeline);
+		boost::thread sender(boost::ref(pipeline_thread));
+
+		device_loop = new DeviceLoop(devices, stats_interval);
+		boost::thread monitor(boost::ref(*device_loop));
 
-		ProcessingThread processing_thread(options, cmd, connection_manager);
+		ProcessingThread processing_thread(watching, cmd, connection_manager);
 		boost::thread processing(boost::ref(processing_thread));
 
 		// main processing loop: just wait for a TERM signal
@@ -1183,29 +1580,26 @@ int main(int argc, const char * argv[])
 			usleep(100000);
 		}
 //		std::cout << "m.done\n" << std::flush;
-		connection_thread->stop();
+		device_loop->stop();
+		while (!device_loop->stopped()) usleep(100000);
+		// give the pipeline a moment to deliver the final status updates
+		for (int i = 0; i < 10 && !pipeline->empty(); ++i) usleep(100000);
+		pipeline_thread.stop();
 		processing_thread.stop();
 
-		//PropertyMonitorThread watch_thread(options, connection_thread);
-		//boost::thread *watcher = 0;
-
-		//if (options.watchProperty()) {
-		//    watcher = new boost::thread(boost::ref(watch_thread));
-		//}
-
-        //if (watcher) watch_thread.stop();
-		while (!processing_thread.stopped() || !connection_thread->stopped() )  {
+		while (!processing_thread.stopped() || !pipeline_thread.stopped() )  {
 			usleep(100000);
-			if (!processing_thread.stopped() && !connection_thread->stopped() ){
+			if (!processing_thread.stopped() && !pipeline_thread.stopped() ){
 				std::cout << "Waiting for threads to stop\n" << std::flush;
 			}
 			else if (!processing_thread.stopped()) 
 				std::cout << "Waiting for processing thread to stop\n" << std::flush;
 			else
-				std::cout << "Waiting for connection thread to stop\n" << std::flush;
+				std::cout << "Waiting for pipeline thread to stop\n" << std::flush;
 		}
 			
         monitor.join();
+		sender.join();
 		processing.join();
 		std::cout << "done\n" << std::flush;
     }
@@ -1218,4 +1612,3 @@ int main(int argc, const char * argv[])
     }
     return 0;
 }
-
@@ -11,6 +11,7 @@
 #include "MachineInstance.h"
 #include "dynamic_value.h"
 #include "MessageLog.h"
+#include "ListAggregates.h"
 
 static uint64_t currentTime() {
     return microsecs();
@@ -182,6 +183,7 @@ AnyInValue::AnyInValue(const AnyInValue &other) {
     state = other.state;
     machine_list_name = other.machine_list_name;
     machine_list = 0;
+    list_scope = 0;
 	state_property = 0;
 }
 
@@ -196,7 +198,10 @@ const Value &AnyInValue::operator()() {
 			NB_MSG << buf << "\n";
 		}
 
-	machine_list = mi->lookup(machine_list_name);
+	if (!machine_list || list_scope != mi) {
+		machine_list = mi->lookup(machine_list_name);
+		list_scope = mi;
+	}
 
 	if (!machine_list) {
 		char buf[400];
@@ -206,29 +211,12 @@ const Value &AnyInValue::operator()() {
 		last_result = false; return last_result;
 	}
 
-#if 0
-	if (last_process_time > mi->lastStateEvaluationTime()) {
-		//DBG_MSG << "avoiding recalc of " << *this << " last_process_time: "
-		//	<< last_process_time << " last list eval: " << machine_list->lastStateEvaluationTime() << "\n";
-        return last_result;
-    }
-#endif
-    
 	last_process_time = currentTime();
 	std::string state_val = state;
 	if (state_property && state_property != & SymbolTable::Null)
 		state_val = state_property->asString();
-    for (unsigned int i=0; i<machine_list->parameters.size(); ++i) {
-        if (!machine_list->parameters[i].machine) mi->lookup(machine_list->parameters[i]);
-        if (!machine_list->parameters[i].machine) continue;
-        //std::cout << mi->getName() << " machine " << machine_list->parameters[i].machine->getName()
-        //<< " is  "<< machine_list->parameters[i].machine->getCurrent().getName() <<" want " << state_val << "\n";
-        
-        if (state_val == machine_list->parameters[i].machine->getCurrent().getName()) {
-            last_result = true; return last_result;
-        }
-    }
-    last_result = false; return last_result;
+	last_result = machine_list->listAggregates()->any(state_val);
+	return last_result;
 }
 
 
@@ -236,13 +224,17 @@ AllInValue::AllInValue(const AllInValue &other) {
     state = other.state;
     machine_list_name = other.machine_list_name;
     machine_list = 0;
+    list_scope = 0;
 	state_property = 0;
 }
 const Value &AllInValue::operator()() {
 	MachineInstance *mi = scope;
 	if (state_property == 0)
 		state_property = &mi->getValue(state.c_str());
-	machine_list = mi->lookup(machine_list_name);
+	if (!machine_list || list_scope != mi) {
+		machine_list = mi->lookup(machine_list_name);
+		list_scope = mi;
+	}
 	if (!machine_list) {
 		char buf[400];
 		snprintf(buf, 400, "%s: no machine %s for ALL %s",
@@ -251,29 +243,14 @@ const Value &AllInValue::operator()() {
 		last_result = false; return last_result;
 	}
 
-#if 0
-    if (last_process_time > mi->lastStateEvaluationTime()) {
-        //std::cout << "avoiding recalc of " << *this << "\n";
-        return last_result;
-    }
-#endif
-
 	last_process_time = currentTime();
 	if (machine_list->parameters.size() == 0) {  last_result = false; return last_result; }
 
 	std::string state_val = state;
 	if (state_property && state_property != & SymbolTable::Null)
 		state_val = state_property->asString();
-    for (unsigned int i=0; i<machine_list->parameters.size(); ++i) {
-        if (!machine_list->parameters[i].machine) mi->lookup(machine_list->parameters[i]);
-        if (!machine_list->parameters[i].machine) continue;
-        
-        if (state_val != machine_list->parameters[i].machine->getCurrent().getName()) {
-            last_result = false; return last_result;
-        }
-    }
-    last_result = true;
-    return last_result;
+	last_result = machine_list->listAggregates()->all(state_val);
+	return last_result;
 }
 
 AnyEnabledDisabledValue::AnyEnabledDisabledValue(const AnyEnabledDisabledValue &other) {
@@ -341,6 +318,7 @@ CountValue::CountValue(const CountValue &other) {
     state = other.state;
     machine_list_name = other.machine_list_name;
     machine_list = 0;
+    list_scope = 0;
 	state_property = 0;
 }
 
@@ -348,7 +326,10 @@ const Value &CountValue::operator()() {
 	MachineInstance *mi = scope;
 	if (state_property == 0)
 		state_property = &mi->getValue(state.c_str());
-	machine_list = mi->lookup(machine_list_name);
+	if (!machine_list || list_scope != mi) {
+		machine_list = mi->lookup(machine_list_name);
+		list_scope = mi;
+	}
 	if (!machine_list) {
 		char buf[400];
 		snprintf(buf, 400, "%s: no machine %s for count %s",
@@ -358,11 +339,6 @@ const Value &CountValue::operator()() {
 		return last_result;
 	}
 
-#if 0
-    if (last_process_time > machine_list->lastStateEvaluationTime()) 
-    	return last_result;
-#endif
-
 	last_process_time = currentTime();
 	if (machine_list->parameters.size() == 0) {
 		last_result = 0;
@@ -372,15 +348,8 @@ const Value &CountValue::operator()() {
 	std::string state_val = state;
 	if (state_property != & SymbolTable::Null)
 		state_val = state_property->asString();
-    int result = 0;
-    for (unsigned int i=0; i<machine_list->parameters.size(); ++i) {
-        if (!machine_list->parameters[i].machine) mi->lookup(machine_list->parameters[i]);
-        if (!machine_list->parameters[i].machine) continue;
-        
-        if (state_val == machine_list->parameters[i].machine->getCurrent().getName()) ++result;
-    }
-    last_result = result;
-    return last_result;
+	last_result = machine_list->listAggregates()->count(state_val);
+	return last_result;
 }
 
 FindValue::FindValue(const FindValue &other) {
@@ -464,11 +433,15 @@ SumValue::SumValue(const SumValue &other) {
 	property = other.property;
 	machine_list_name = other.machine_list_name;
 	machine_list = 0;
+	list_scope = 0;
 }
 
 const Value &SumValue::operator()() {
 	MachineInstance *mi = scope;
-	machine_list = mi->lookup(machine_list_name);
+	if (!machine_list || list_scope != mi) {
+		machine_list = mi->lookup(machine_list_name);
+		list_scope = mi;
+	}
 	if (!machine_list) {
 		char buf[400];
 		snprintf(buf, 400, "%s: no machine %s for sum %s",
@@ -484,6 +457,13 @@ const Value &SumValue::operator()() {
 		return last_result;
 	}
 
+	// totals are kept by the list unless the property is on another machine or is not numeric
+	Value aggregate;
+	if (property.find('.') == std::string::npos && machine_list->listAggregates()->sum(property, aggregate)) {
+		last_result = aggregate;
+		return last_result;
+	}
+
 	Value sum(0);
 	for (unsigned int i=0; i<machine_list->parameters.size(); ++i) {
 		if (!machine_list->parameters[i].machine) mi->lookup(machine_list->parameters[i]);
@@ -499,11 +479,15 @@ MeanValue::MeanValue(const MeanValue &other) {
 	property = other.property;
 	machine_list_name = other.machine_list_name;
 	machine_list = 0;
+	list_scope = 0;
 }
 
 const Value &MeanValue::operator()() {
 	MachineInstance *mi = scope;
-	machine_list = mi->lookup(machine_list_name);
+	if (!machine_list || list_scope != mi) {
+		machine_list = mi->lookup(machine_list_name);
+		list_scope = mi;
+	}
 	if (!machine_list) {
 		char buf[400];
 		snprintf(buf, 400, "%s: no machine %s for sum %s",
@@ -519,6 +503,12 @@ const Value &MeanValue::operator()() {
 		return last_result;
 	}
 
+	Value aggregate;
+	if (property.find('.') == std::string::npos && machine_list->listAggregates()->mean(property, aggregate)) {
+		last_result = aggregate;
+		return last_result;
+	}
+
 	Value sum(0);
 	int n = 0;
 	last_result = 0;
@@ -537,11 +527,17 @@ const Value &MeanValue::operator()() {
 
 MinValue::MinValue(const MinValue &other) {
 	property = other.property;
+	machine_list_name = other.machine_list_name;
+	machine_list = 0;
+	list_scope = 0;
 }
 
 const Value &MinValue::operator()() {
 	MachineInstance *mi = scope;
-	machine_list = mi->lookup(machine_list_name);
+	if (!machine_list || list_scope != mi) {
+		machine_list = mi->lookup(machine_list_name);
+		list_scope = mi;
+	}
 	if (!machine_list) {
 		char buf[400];
 		snprintf(buf, 400, "%s: no machine %s for min %s",
@@ -557,6 +553,12 @@ const Value &MinValue::operator()() {
 		return last_result;
 	}
 
+	Value aggregate;
+	if (property.find('.') == std::string::npos && machine_list->listAggregates()->min(property, aggregate)) {
+		last_result = aggregate;
+		return last_result;
+	}
+
 	Value min(LONG_MAX);
 	bool unassigned = true;
 	for (unsigned int i=0; i<machine_list->parameters.size(); ++i) {
@@ -573,11 +575,17 @@ const Value &MinValue::operator()() {
 
 MaxValue::MaxValue(const MaxValue &other) {
 	property = other.property;
+	machine_list_name = other.machine_list_name;
+	machine_list = 0;
+	list_scope = 0;
 }
 
 const Value &MaxValue::operator()() {
 	MachineInstance *mi = scope;
-	machine_list = mi->lookup(machine_list_name);
+	if (!machine_list || list_scope != mi) {
+		machine_list = mi->lookup(machine_list_name);
+		list_scope = mi;
+	}
 	if (!machine_list) {
 		char buf[400];
 		snprintf(buf, 400, "%s: no machine %s for min %s",
@@ -593,6 +601,12 @@ const Value &MaxValue::operator()() {
 		return last_result;
 	}
 
+	Value aggregate;
+	if (property.find('.') == std::string::npos && machine_list->listAggregates()->max(property, aggregate)) {
+		last_result = aggregate;
+		return last_result;
+	}
+
 	Value max(LONG_MIN);
 	bool unassigned = true;
 	for (unsigned int i=0; i<machine_list->parameters.size(); ++i) {
@@ -642,12 +656,12 @@ const Value &IncludesValue::operator()() {
 		last_result = false; return last_result;
 	}
 
-#if 0
-	if (last_process_time > machine_list->lastStateEvaluationTime())
- 		return last_result;
-#endif
-
 	last_process_time = currentTime();
+	if (machine_list->_type == "LIST") {
+		ListAggregates *index = machine_list->listAggregates();
+		last_result = index->includes(entry) || index->includesName(entry.asString());
+		return last_result;
+	}
 	for (unsigned int i=0; i<machine_list->parameters.size(); ++i) {
 		if (!machine_list->parameters[i].machine) mi->lookup(machine_list->parameters[i]);
 		if (entry == machine_list->parameters[i].val )  { last_result = true; return last_result; }
@@ -727,6 +741,7 @@ Value &PopListBackValue::operator()(MachineInstance *mi) {
         if (remove_from_list){
 					machine_list->removeDependancy(machine_list->parameters[0].machine);
 					machine_list->stopListening(machine_list->parameters[0].machine);
+					if (machine_list->existingListAggregates()) machine_list->existingListAggregates()->removed(machine_list->parameters[i]);
 					machine_list->parameters.pop_back();
 					machine_list->setNeedsCheck();
 					displayList(machine_list);
@@ -781,6 +796,7 @@ Value &PopListFrontValue::operator()(MachineInstance *mi) {
             if (remove_from_list){
 								machine_list->removeDependancy(machine_list->parameters[0].machine);
 								machine_list->stopListening(machine_list->parameters[0].machine);
+								if (machine_list->existingListAggregates()) machine_list->existingListAggregates()->removed(machine_list->parameters[0]);
 								machine_list->parameters.erase(machine_list->parameters.begin());
 								if (machine_list->_type == "LIST") {
 										machine_list->setNeedsCheck();
@@ -835,6 +851,7 @@ Value &ItemAtPosValue::operator()(MachineInstance *mi) {
 			if (!machine_list->parameters[idx].machine) mi->lookup(machine_list->parameters[idx]);
             last_result = machine_list->parameters[idx].val;
             if (remove_from_list) {
+                if (machine_list->existingListAggregates()) machine_list->existingListAggregates()->removed(machine_list->parameters[idx]);
                 machine_list->parameters.erase(machine_list->parameters.begin()+idx);
                 if (machine_list->_type == "LIST") {
                     machine_list->setNeedsCheck();
@@ -74,7 +74,7 @@ private:
 
 class AnyInValue : public DynamicValue {
 public:
-    AnyInValue(const char *state_str, const char *list) : state(state_str), machine_list_name(list), machine_list(0), state_property(0) {}
+    AnyInValue(const char *state_str, const char *list) : state(state_str), machine_list_name(list), machine_list(0), list_scope(0), state_property(0) {}
     virtual ~AnyInValue() {}
 		virtual const Value &operator()();
     virtual DynamicValue *clone() const;
@@ -86,12 +86,13 @@ private:
     std::string state;
     std::string machine_list_name;
     MachineInstance *machine_list;
+	MachineInstance *list_scope; // the scope machine_list was found from
 	const Value *state_property;
 };
 
 class AllInValue : public DynamicValue {
 public:
-    AllInValue(const char *state_str, const char *list) : state(state_str), machine_list_name(list), machine_list(0), state_property(0) {}
+    AllInValue(const char *state_str, const char *list) : state(state_str), machine_list_name(list), machine_list(0), list_scope(0), state_property(0) {}
     virtual ~AllInValue() {}
 		virtual const Value &operator()();
     virtual DynamicValue *clone() const;
@@ -103,6 +104,7 @@ private:
     std::string state;
     std::string machine_list_name;
     MachineInstance *machine_list;
+	MachineInstance *list_scope;
 	const Value *state_property;
 };
 
@@ -142,7 +144,7 @@ private:
 
 class CountValue : public DynamicValue {
 public:
-    CountValue(const char *state_str, const char *list) : state(state_str), machine_list_name(list), machine_list(0), state_property(0)  { }
+    CountValue(const char *state_str, const char *list) : state(state_str), machine_list_name(list), machine_list(0), list_scope(0), state_property(0)  { }
     virtual ~CountValue() {}
     virtual const Value &operator()();
     virtual DynamicValue *clone() const;
@@ -154,6 +156,7 @@ private:
     std::string state;
     std::string machine_list_name;
     MachineInstance *machine_list;
+	MachineInstance *list_scope;
 	const Value *state_property;
 };
 
@@ -178,7 +181,7 @@ private:
 
 class SumValue : public DynamicValue {
 public:
-	SumValue(const char *property_name, const char *list) : property(property_name), machine_list_name(list), machine_list(0)  { }
+	SumValue(const char *property_name, const char *list) : property(property_name), machine_list_name(list), machine_list(0), list_scope(0)  { }
 	virtual ~SumValue() {}
 	virtual const Value &operator()();
 	virtual DynamicValue *clone() const;
@@ -190,11 +193,12 @@ private:
 	std::string property;
 	std::string machine_list_name;
 	MachineInstance *machine_list;
+	MachineInstance *list_scope;
 };
 
 class MinValue : public DynamicValue {
 public:
-	MinValue(const char *property_name, const char *list) : property(property_name), machine_list_name(list), machine_list(0)  { }
+	MinValue(const char *property_name, const char *list) : property(property_name), machine_list_name(list), machine_list(0), list_scope(0)  { }
 	virtual ~MinValue() {}
 	virtual const Value &operator()();
 	virtual DynamicValue *clone() const;
@@ -206,11 +210,12 @@ private:
 	std::string property;
 	std::string machine_list_name;
 	MachineInstance *machine_list;
+	MachineInstance *list_scope;
 };
 
 class MaxValue : public DynamicValue {
 public:
-	MaxValue(const char *property_name, const char *list) : property(property_name), machine_list_name(list), machine_list(0)  { }
+	MaxValue(const char *property_name, const char *list) : property(property_name), machine_list_name(list), machine_list(0), list_scope(0)  { }
 	virtual ~MaxValue() {}
 	virtual const Value &operator()();
 	virtual DynamicValue *clone() const;
@@ -222,12 +227,13 @@ private:
 	std::string property;
 	std::string machine_list_name;
 	MachineInstance *machine_list;
+	MachineInstance *list_scope;
 };
 
 
 class MeanValue : public DynamicValue {
 public:
-	MeanValue(const char *property_name, const char *list) : property(property_name), machine_list_name(list), machine_list(0)  { }
+	MeanValue(const char *property_name, const char *list) : property(property_name), machine_list_name(list), machine_list(0), list_scope(0)  { }
 	virtual ~MeanValue() {}
 	virtual const Value &operator()();
 	virtual DynamicValue *clone() const;
@@ -239,6 +245,7 @@ private:
 	std::string property;
 	std::string machine_list_name;
 	MachineInstance *machine_list;
+	MachineInstance *list_scope;
 };
 
 class AbsoluteValue : public DynamicValue {
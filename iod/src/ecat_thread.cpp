@@ -32,6 +32,8 @@
 #include <map>
 #include <utility>
 #include <fstream>
+#include <time.h>
+#include <errno.h>
 #ifndef EC_SIMULATOR
 #include <tool/MasterDevice.h>
 #endif
@@ -47,9 +49,13 @@
 #include "DebugExtra.h"
 #include "MachineInstance.h"
 #include "IOComponent.h"
+#include "CycleTimer.h"
+#include "ProcessImageStream.h"
 //#include "SetStateAction.h"
 
+#ifndef EC_SIMULATOR
 #define USE_RTC 1
+#endif
 
 #ifdef USE_RTC
 #include <sys/ioctl.h>
@@ -68,7 +74,7 @@ const char *EtherCATThread::ZMQ_Addr = "inproc://ecat_thread";
 static bool machine_was_ready = false;
 uint64_t next_ecat_receive = 0;
 
-EtherCATThread::EtherCATThread() : status(e_collect), program_done(false), cycle_delay(1000), keep_alive(4000),last_ping(0) { 
+EtherCATThread::EtherCATThread() : status(e_collect), program_done(false), cycle_delay(1000), rtc(-1), keep_alive(4000),last_ping(0) { 
 }
 
 void EtherCATThread::setCycleDelay(long new_val) { cycle_delay = new_val; }
@@ -207,23 +213,6 @@ void sync(int rtc) {
 		}
 	}
 }
-#else
-void sync() {
-	uint64_t now = nowMicrosecs();
-	int64_t delta = now - then;
-	int64_t delay = cycle_delay-delta-100;
-	if (delay>0) {
-		struct timespec sleep_time;
-		sleep_time.tv_sec = delay / 1000000;
-		sleep_time.tv_nsec = (delay * 1000) % 1000000000L;
-		int rc;
-		struct timespec remaining;
-		while ( (rc = nanosleep(&sleep_time, &remaining) == -1) ) {
-			sleep_time = remaining;
-		}
-	}
-	gettimeofday(&then,0);
-}
 #endif
 #endif
 
@@ -563,23 +552,28 @@ bool EtherCATThread::getClockworkMessage(zmq::socket_t &out_sock, bool ec_ok) {
 
 void EtherCATThread::operator()() {
     pthread_setname_np(pthread_self(), "iod ethercat");
+	setThreadRealtime("ethercat", ecat_priority(), ecat_cpu());
 	Statistic *keep_alive_stat = new Statistic("keep alive margin");
 	Statistic::add(keep_alive_stat);
 
-#ifdef USE_RTC
-	rtc = open("/dev/rtc", 0);
-	if (rtc == -1) { perror("open rtc"); exit(1); }
 	unsigned long freq = ECInterface::FREQUENCY;
+	// cycles are paced by absolute deadlines on the monotonic clock unless the RTC is requested
+	CycleTimer *cycle_timer = new CycleTimer("ECAT", 1000000 / freq);
+#ifdef USE_RTC
+	if (use_rtc()) {
+		rtc = open("/dev/rtc", 0);
+		if (rtc == -1) { perror("open rtc"); exit(1); }
 
-	int rc = ioctl(rtc, RTC_IRQP_SET, freq);
-	if (rc == -1) { perror("set rtc freq"); exit(1); }
+		int rc = ioctl(rtc, RTC_IRQP_SET, freq);
+		if (rc == -1) { perror("set rtc freq"); exit(1); }
 
-	rc = ioctl(rtc, RTC_IRQP_READ, &freq);
-	if (rc == -1) { perror("ioctl"); exit(1); }
-	std::cout << "Real time clock: freq set to : " << freq << "\n";
+		rc = ioctl(rtc, RTC_IRQP_READ, &freq);
+		if (rc == -1) { perror("ioctl"); exit(1); }
+		std::cout << "Real time clock: freq set to : " << freq << "\n";
 
-	rc = ioctl(rtc, RTC_PIE_ON, 0);
-	if (rc == -1) { perror("enable rtc pie"); exit(1); }
+		rc = ioctl(rtc, RTC_PIE_ON, 0);
+		if (rc == -1) { perror("enable rtc pie"); exit(1); }
+	}
 #endif
 	uint64_t then = nowMicrosecs();
 	ECInterface::instance()->setReferenceTime(then % 0x100000000);
@@ -604,14 +598,17 @@ void EtherCATThread::operator()() {
 	static bool ec_ok = true; 
 	while (!program_done && !waitForSync(*sync_sock)) usleep(100);
 	while (!program_done) {
-#ifdef USE_RTC
-		sync(rtc);	
-#else
 #ifdef USE_SIGNALLER
 		sync(clock_sync);	
 #else
-		sync();
+		bool paced = false;
+#ifdef USE_RTC
+		if (rtc != -1) { sync(rtc); paced = true; }
 #endif
+		if (!paced) {
+			cycle_timer->setPeriod(1000000 / ECInterface::FREQUENCY);
+			cycle_timer->wait();
+		}
 #endif
 		uint64_t now = nowMicrosecs();
 		ECInterface::instance()->setReferenceTime(now % 0x100000000);
@@ -638,6 +635,11 @@ void EtherCATThread::operator()() {
 		// exchange clockwork machine state
 		next_ecat_receive = microsecs() + period / 2;
 		ECInterface::instance()->receiveState();
+		if (ProcessImagePublisher::instance()) {
+			size_t image_size;
+			uint8_t *image = ECInterface::instance()->getDomainData(image_size);
+			if (image) ProcessImagePublisher::instance()->capture(image, image_size, now, global_clock);
+		}
 
 		if (machine_is_ready && ECInterface::instance()->getProcessMask()) {
 			global_clock = updateClock(global_clock);
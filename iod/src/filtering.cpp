@@ -3,30 +3,64 @@
 //#include <boost/thread/mutex.hpp>
 #include "filtering.h"
 
-#if 0
-class scoped_lock {
+// locks a buffer unless it has been marked as only being used by one thread
+class BufferLock {
 public:
-	scoped_lock( boost::recursive_mutex &mut) : mutex(mut) { mutex.lock(); }
-	~scoped_lock() { mutex.unlock(); }
-	boost::recursive_mutex &mutex;
+	BufferLock(const Buffer &buf) : mutex( (buf.single_threaded) ? 0 : &buf.q_mutex) { if (mutex) mutex->lock(); }
+	~BufferLock() { if (mutex) mutex->unlock(); }
+private:
+	boost::recursive_mutex *mutex;
 };
-#endif
 
-Buffer::Buffer(int buf_size): BUFSIZE(buf_size) {
+void RunningStats::clear() {
+	n = 0;
+	total.clear();
+	mean_ = 0.0;
+	m2 = 0.0;
+}
+
+void RunningStats::add(double x) {
+	++n;
+	total.add(x);
+	double delta = x - mean_;
+	mean_ += delta / n;
+	m2 += delta * (x - mean_);
+}
+
+void RunningStats::remove(double x) {
+	if (n <= 1) { clear(); return; }
+	total.subtract(x);
+	double old_mean = mean_;
+	--n;
+	mean_ = old_mean - (x - old_mean) / n;
+	m2 -= (x - old_mean) * (x - mean_);
+	if (m2 < 0.0) m2 = 0.0;
+}
+
+Buffer::Buffer(int buf_size, bool single_thread): BUFSIZE(buf_size), single_threaded(single_thread) {
     front = -1;
     back = -1;
 }
 
-int Buffer::length()
+int Buffer::length() const
 {
     if (front == -1) return 0;
     return (front - back + BUFSIZE) % BUFSIZE + 1;
 }
 
 void Buffer::reset() {
-	boost::recursive_mutex::scoped_lock scoped_lock(q_mutex);;
+	BufferLock lock(*this);
     front = back = -1;
-	total_ = 0.0;
+	stats.clear();
+}
+
+int Buffer::advance() {
+	int dropped = -1;
+	front = (front + 1) % BUFSIZE;
+	if (front == back) dropped = front;
+	if (front == back || back == -1)
+		back = (back + 1) % BUFSIZE;
+	return dropped;
 }
 
 double Buffer::difference(int idx_a, int idx_b) const
@@ -48,15 +82,13 @@ double Buffer::distance(int idx_a, int idx_b) const
 
 double Buffer::average(int n)
 {
-	boost::recursive_mutex::scoped_lock scoped_lock(q_mutex);;
+	BufferLock lock(*this);
   double res = 0.0f;
   if (front == -1) return 0.0; // empty buffer
-  if (n == 0) return 0.0;
+  if (n <= 0) return 0.0;
   int len = length();
   if (len <= 0) return 0.0;
-  if (len < n) n = len;
-//  return total_ / (double)n;
-#if 1
+  if (len <= n) return stats.sum() / (double)len;
   int i = (front + BUFSIZE - n + 1) % BUFSIZE;
   while (i != front)
   {
@@ -71,18 +103,15 @@ double Buffer::average(int n)
 #endif
   res += getFloatAtIndex(i);
   return res / (double)n;
-#endif
 }
 
 void LongBuffer::append(long val)
 {
-	boost::recursive_mutex::scoped_lock scoped_lock(q_mutex);;
-    front = (front + 1) % BUFSIZE;
-	if (front == back) total_ -= buf[front];
+	BufferLock lock(*this);
+	int dropped = advance();
+	if (dropped != -1) stats.remove(buf[dropped]);
     buf[front] = val;
-	total_ += val;
-    if (front == back || back == -1)
-        back = (back + 1) % BUFSIZE;
+	stats.add(val);
 }
 long LongBuffer::get(unsigned int n) const
 {
@@ -90,7 +119,10 @@ long LongBuffer::get(unsigned int n) const
 }
 void LongBuffer::set(unsigned int n, long value)
 {
-    buf[ (front + BUFSIZE - n) % BUFSIZE] = value;
+	BufferLock lock(*this);
+	long &entry = buf[ (front + BUFSIZE - n) % BUFSIZE];
+	stats.replace(entry, value);
+    entry = value;
 }
 
 double LongBuffer::getFloatAtOffset(int offset) const
@@ -115,13 +147,11 @@ double FloatBuffer::getFloatAtIndex(int idx) const
 
 void FloatBuffer::append( double val)
 {
-	boost::recursive_mutex::scoped_lock scoped_lock(q_mutex);;
-    front = (front + 1) % BUFSIZE;
-	if (front == back) total_ -= buf[front];
+	BufferLock lock(*this);
+	int dropped = advance();
+	if (dropped != -1) stats.remove(buf[dropped]);
     buf[front] = val;
-	total_ += val;
-    if (front == back || back == -1)
-      back = (back + 1) % BUFSIZE;
+	stats.add(val);
 }
 
 double FloatBuffer::get(unsigned int n) const
@@ -131,12 +161,16 @@ double FloatBuffer::get(unsigned int n) const
 
 void FloatBuffer::set(unsigned int n, double value)
 {
-    buf[ (front + BUFSIZE - n) % BUFSIZE] = value;
+	BufferLock lock(*this);
+	double &entry = buf[ (front + BUFSIZE - n) % BUFSIZE];
+	stats.replace(entry, value);
+    entry = value;
 }
 
+/* this rescans the window on each call, RegressionBuffer keeps the sums as samples are added */
 double FloatBuffer::slopeFromLeastSquaresFit(const LongBuffer &time_buf)
 {
-	boost::recursive_mutex::scoped_lock scoped_lock(q_mutex);;
+	BufferLock lock(*this);
   double sumX = 0.0f, sumY = 0.0f, sumXY = 0.0f;
   double sumXsquared = 0.0f, sumYsquared = 0.0f;
   int n = length()-1;
@@ -168,16 +202,15 @@ double SampleBuffer::getFloatAtIndex(int idx) const {
     return values[ idx ];
 }
 void SampleBuffer::quickAppend( double val, uint64_t time) {
-	front = (front + 1) % BUFSIZE;
-	if (front == back) total_ -= values[front];
-	if (front == back || back == -1) back = (back + 1) % BUFSIZE;
-	total_ += val;
+	int dropped = advance();
+	if (dropped != -1) stats.remove(values[dropped]);
+	stats.add(val);
 	values[front] = val;
 	times[front] = time;
 }
 
 void SampleBuffer::append( double val, uint64_t time) {
-	boost::recursive_mutex::scoped_lock scoped_lock(q_mutex);;
+	BufferLock lock(*this);
 
     /* if we are not running on a real time system, we may have missed samples
        the following generates the missing samples based on past recording rates.
@@ -198,12 +231,7 @@ void SampleBuffer::append( double val, uint64_t time) {
 			quickAppend(val-i*mean_change, time - i * (time-last_time)/missing);
 		}
 	}
-	front = (front + 1) % BUFSIZE;
-	if (front == back) total_ -= values[front];
-	if (front == back || back == -1) back = (back + 1) % BUFSIZE;
-	total_ += val;
-	values[front] = val;
-	times[front] = time;
+	quickAppend(val, time);
 }
 
 double SampleBuffer::rate() const // returns dv/dt between the two sample positions
@@ -216,6 +244,72 @@ double SampleBuffer::rate() const // returns dv/dt between the two sample positi
     return ds/dt;
 }
 
+RegressionBuffer::RegressionBuffer(int buf_size, bool single_thread)
+		: Buffer(buf_size, single_thread), origin_t(0), origin_v(0.0), appends_since_recalc(0) {
+	values = new double[buf_size];
+	times = new uint64_t[buf_size];
+}
+
+double RegressionBuffer::getFloatAtOffset(int offset) const {
+    return values[ (front + BUFSIZE - offset) % BUFSIZE];
+}
+
+double RegressionBuffer::getFloatAtIndex(int idx) const {
+    return values[ idx ];
+}
+
+void RegressionBuffer::clear() {
+	BufferLock lock(*this);
+	reset();
+	sum_x.clear(); sum_y.clear(); sum_xx.clear(); sum_xy.clear();
+	appends_since_recalc = 0;
+}
+
+void RegressionBuffer::append(double val, uint64_t time) {
+	BufferLock lock(*this);
+	if (front == -1) { origin_t = time; origin_v = val; }
+	int dropped = advance();
+	if (dropped != -1) {
+		double x = (double)(int64_t)(times[dropped] - origin_t);
+		double y = values[dropped] - origin_v;
+		sum_x.subtract(x); sum_y.subtract(y); sum_xx.subtract(x*x); sum_xy.subtract(x*y);
+		stats.remove(values[dropped]);
+	}
+	values[front] = val;
+	times[front] = time;
+	double x = (double)(int64_t)(time - origin_t);
+	double y = val - origin_v;
+	sum_x.add(x); sum_y.add(y); sum_xx.add(x*x); sum_xy.add(x*y);
+	stats.add(val);
+	if (++appends_since_recalc >= BUFSIZE) recalculate();
+}
+
+void RegressionBuffer::recalculate() {
+	sum_x.clear(); sum_y.clear(); sum_xx.clear(); sum_xy.clear();
+	appends_since_recalc = 0;
+	if (front == -1) return;
+	origin_t = times[back];
+	origin_v = values[back];
+	int i = back;
+	while (true) {
+		double x = (double)(int64_t)(times[i] - origin_t);
+		double y = values[i] - origin_v;
+		sum_x.add(x); sum_y.add(y); sum_xx.add(x*x); sum_xy.add(x*y);
+		if (i == front) break;
+		i = (i + 1) % BUFSIZE;
+	}
+}
+
+double RegressionBuffer::slope() const {
+	BufferLock lock(*this);
+	int n = length();
+	if (n < 2) return 0.0;
+	double sx = sum_x.value(), sy = sum_y.value();
+	double denom = (double)n * sum_xx.value() - sx * sx;
+	if (fabs(denom) < 0.00001f ) return 0.0f;
+	return ((double)n * sum_xy.value() - sx * sy) / denom;
+}
+
 #ifdef TESTING
 #include <iostream>
 #include <inttypes.h>
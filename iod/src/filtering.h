@@ -1,29 +1,84 @@
 #ifndef __FILTERING_H__
 #define __FILTERING_H__
 
+#include <inttypes.h>
 #include <boost/thread.hpp>
 
+// a sum with Kahan compensation to limit the error from many small updates
+class KahanSum
+{
+public:
+    KahanSum() : total(0.0), compensation(0.0) {}
+    void clear() { total = compensation = 0.0; }
+    void add(double x) {
+        double y = x - compensation;
+        double t = total + y;
+        compensation = (t - total) - y;
+        total = t;
+    }
+    void subtract(double x) { add(-x); }
+    double value() const { return total; }
+private:
+    double total;
+    double compensation;
+};
+
+/*
+	Statistics over a sliding window, updated in O(1) as values enter and
+	leave the window. The sum is Kahan compensated and the mean and
+	variance are maintained using Welford's method.
+*/
+class RunningStats
+{
+public:
+    RunningStats() { clear(); }
+    void clear();
+    void add(double x);
+    void remove(double x);
+    void replace(double old_x, double new_x) { remove(old_x); add(new_x); }
+    unsigned long count() const { return n; }
+    double sum() const { return total.value(); }
+    double mean() const { return mean_; }
+    double variance() const { return (n > 1) ? m2 / (n - 1) : 0.0; }
+private:
+    unsigned long n;
+    KahanSum total;
+    double mean_;
+    double m2;
+};
+
 class Buffer
 {
 public:
     const int BUFSIZE;
     int front;
     int back;
-	double total_;
     virtual double getFloatAtOffset(int offset) const = 0;
     virtual double getFloatAtIndex(int idx) const = 0;
     double difference(int idx_a, int idx_b) const;
     double distance(int idx_a, int idx_b) const;
-    double average(int n);
-    int length();
+    double average(int n); // O(1) when n covers the whole buffer
+    double sum() const { return stats.sum(); }
+    double mean() const { return stats.mean(); }
+    double variance() const { return stats.variance(); }
+    int length() const;
     void reset();
-    Buffer(int buf_size);
+
+    // buffers that are only used from one thread can skip locking
+    void setSingleThreaded(bool which) { single_threaded = which; }
+    bool singleThreaded() const { return single_threaded; }
+
+    Buffer(int buf_size, bool single_thread = false);
 	virtual ~Buffer() { }
 private:
     Buffer(const Buffer &);
     Buffer &operator=(const Buffer&);
 protected:
-    boost::recursive_mutex q_mutex;
+    friend class BufferLock;
+    int advance(); // moves front along and returns the index of the value being dropped, or -1
+    RunningStats stats;
+    bool single_threaded;
+    mutable boost::recursive_mutex q_mutex;
 };
 
 class LongBuffer : public Buffer
@@ -35,7 +90,8 @@ public:
     void append(long val);
     long get(unsigned int n) const;
     void set(unsigned int n, long value);
-    LongBuffer(int buf_size) : Buffer(buf_size) { buf = new long[BUFSIZE]; }
+    LongBuffer(int buf_size, bool single_thread = false)
+		: Buffer(buf_size, single_thread) { buf = new long[BUFSIZE]; }
 	~LongBuffer() { delete[] buf; }
 private:
     LongBuffer(const LongBuffer &);
@@ -53,7 +109,8 @@ public:
     double get(unsigned int n) const;
     void set(unsigned int n, double value);
     double slopeFromLeastSquaresFit(const LongBuffer &time_buf);
-    FloatBuffer(int buf_size) : Buffer(buf_size) { buf = new double[BUFSIZE]; }
+    FloatBuffer(int buf_size, bool single_thread = false)
+		: Buffer(buf_size, single_thread) { buf = new double[BUFSIZE]; }
 	~FloatBuffer() { delete[] buf; }
 private:
     FloatBuffer(const FloatBuffer &);
@@ -72,7 +129,8 @@ public:
     
     double rate() const; // returns dv/dt between the two sample positions
     
-    SampleBuffer(int buf_size) : Buffer(buf_size) { values = new double[buf_size]; times = new uint64_t[buf_size]; }
+    SampleBuffer(int buf_size, bool single_thread = false)
+		: Buffer(buf_size, single_thread) { values = new double[buf_size]; times = new uint64_t[buf_size]; }
     ~SampleBuffer() { delete[] values; delete[] times; }
 
 private:
@@ -80,5 +138,38 @@ private:
     SampleBuffer &operator=(const SampleBuffer&);
 };
 
-#endif
+/*
+	A window of (time, value) samples that keeps the sums needed for a
+	least squares fit so that slope() does not rescan the window.
+	Samples are held relative to an origin that is moved forward each time
+	the window turns over, at which point the sums are recalculated to
+	discard accumulated rounding error.
+*/
+class RegressionBuffer : public Buffer {
+public:
+    double *values;
+    uint64_t *times;
+    double getFloatAtOffset(int offset) const;
+    double getFloatAtIndex(int idx) const;
 
+    void append(double val, uint64_t time);
+    double slope() const; // least squares estimate of dv/dt, in value units per time unit
+    void clear();
+
+    RegressionBuffer(int buf_size, bool single_thread = false);
+    ~RegressionBuffer() { delete[] values; delete[] times; }
+
+private:
+    void recalculate();
+    uint64_t origin_t;
+    double origin_v;
+    int appends_since_recalc;
+    KahanSum sum_x;
+    KahanSum sum_y;
+    KahanSum sum_xx;
+    KahanSum sum_xy;
+    RegressionBuffer(const RegressionBuffer &);
+    RegressionBuffer &operator=(const RegressionBuffer&);
+};
+
+#endif
@@ -0,0 +1,168 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+/*
+	filtering_bench feeds simulated analogue channels through the filtering
+	buffers and reports how many samples per second each approach can handle
+	compared with the rate needed for the given number of channels (default
+	500 channels sampled at 1kHz).
+
+	usage: filtering_bench [channels] [sample_rate_hz] [seconds] [window]
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "filtering.h"
+
+static uint64_t now_usec() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static double sample(int channel, uint64_t t) {
+	return 1000.0 * sin( (double)t / 100000.0 + channel) + (rand() % 7) - 3;
+}
+
+// the cost of averaging by rescanning the window, as Buffer::average did for every call
+static double scanAverage(FloatBuffer &buf) {
+	int n = buf.length();
+	double total = 0.0;
+	for (int i = 0; i < n; ++i) total += buf.get(i);
+	return (n) ? total / n : 0.0;
+}
+
+struct Result {
+	const char *name;
+	uint64_t elapsed;
+	double check;
+};
+
+static void report(const Result &r, unsigned long samples, double required) {
+	double rate = (r.elapsed) ? samples * 1000000.0 / r.elapsed : 0.0;
+	std::cout << std::setw(36) << std::left << r.name
+		<< std::setw(10) << std::right << r.elapsed / 1000 << "ms "
+		<< std::setw(14) << (unsigned long)rate << " samples/s "
+		<< std::setw(8) << std::setprecision(3) << rate / required << "x realtime"
+		<< "  (" << r.check << ")\n";
+}
+
+int main(int argc, char *argv[]) {
+	int channels = (argc > 1) ? atoi(argv[1]) : 500;
+	int sample_rate = (argc > 2) ? atoi(argv[2]) : 1000;
+	int seconds = (argc > 3) ? atoi(argv[3]) : 5;
+	int window = (argc > 4) ? atoi(argv[4]) : 200;
+	if (channels <= 0 || sample_rate <= 0 || seconds <= 0 || window <= 1) {
+		std::cerr << "usage: " << argv[0] << " [channels] [sample_rate_hz] [seconds] [window]\n";
+		return 1;
+	}
+	unsigned long samples_per_channel = (unsigned long)sample_rate * seconds;
+	unsigned long samples = samples_per_channel * channels;
+	double required = (double)channels * sample_rate;
+	uint64_t period = 1000000 / sample_rate;
+
+	std::cout << channels << " channels at " << sample_rate << "Hz for " << seconds
+		<< "s, window " << window << " (" << samples << " samples, "
+		<< (unsigned long)required << " samples/s needed)\n";
+
+	std::vector<Result> results;
+
+	// average after each sample, rescanning the window
+	{
+		std::vector<FloatBuffer*> bufs;
+		for (int c = 0; c < channels; ++c) bufs.push_back(new FloatBuffer(window));
+		srand(1);
+		double check = 0.0;
+		uint64_t start = now_usec();
+		for (unsigned long i = 0; i < samples_per_channel; ++i)
+			for (int c = 0; c < channels; ++c) {
+				bufs[c]->append(sample(c, i * period));
+				check += scanAverage(*bufs[c]);
+			}
+		Result r = { "average, window scan, locked", now_usec() - start, check / samples };
+		results.push_back(r);
+		for (int c = 0; c < channels; ++c) delete bufs[c];
+	}
+
+	// average after each sample using the running sum
+	for (int single = 0; single < 2; ++single) {
+		std::vector<FloatBuffer*> bufs;
+		for (int c = 0; c < channels; ++c) bufs.push_back(new FloatBuffer(window, single));
+		srand(1);
+		double check = 0.0;
+		uint64_t start = now_usec();
+		for (unsigned long i = 0; i < samples_per_channel; ++i)
+			for (int c = 0; c < channels; ++c) {
+				bufs[c]->append(sample(c, i * period));
+				check += bufs[c]->average(window);
+			}
+		Result r = { (single) ? "average, running sum, single thread" : "average, running sum, locked",
+			now_usec() - start, check / samples };
+		results.push_back(r);
+		for (int c = 0; c < channels; ++c) delete bufs[c];
+	}
+
+	// slope after each sample, rescanning the window
+	{
+		std::vector<FloatBuffer*> bufs;
+		std::vector<LongBuffer*> times;
+		for (int c = 0; c < channels; ++c) {
+			bufs.push_back(new FloatBuffer(window));
+			times.push_back(new LongBuffer(window));
+		}
+		srand(1);
+		double check = 0.0;
+		uint64_t start = now_usec();
+		for (unsigned long i = 0; i < samples_per_channel; ++i)
+			for (int c = 0; c < channels; ++c) {
+				bufs[c]->append(sample(c, i * period));
+				times[c]->append(i * period);
+				check += bufs[c]->slopeFromLeastSquaresFit(*times[c]);
+			}
+		Result r = { "slope, window scan, locked", now_usec() - start, check / samples };
+		results.push_back(r);
+		for (int c = 0; c < channels; ++c) { delete bufs[c]; delete times[c]; }
+	}
+
+	// slope after each sample using running sums
+	for (int single = 0; single < 2; ++single) {
+		std::vector<RegressionBuffer*> bufs;
+		for (int c = 0; c < channels; ++c) bufs.push_back(new RegressionBuffer(window, single));
+		srand(1);
+		double check = 0.0;
+		uint64_t start = now_usec();
+		for (unsigned long i = 0; i < samples_per_channel; ++i)
+			for (int c = 0; c < channels; ++c) {
+				bufs[c]->append(sample(c, i * period), i * period);
+				check += bufs[c]->slope();
+			}
+		Result r = { (single) ? "slope, running sums, single thread" : "slope, running sums, locked",
+			now_usec() - start, check / samples };
+		results.push_back(r);
+		for (int c = 0; c < channels; ++c) delete bufs[c];
+	}
+
+	for (unsigned int i = 0; i < results.size(); ++i) report(results[i], samples, required);
+	return 0;
+}
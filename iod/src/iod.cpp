@@ -67,10 +67,17 @@
 #include "MessageLog.h"
 #include "MessagingInterface.h"
 #include "ecat_thread.h"
+#include "ProcessImageStream.h"
 #include "ProcessingThread.h"
+#include "IOTrace.h"
+#include "CycleTimer.h"
 #include "EtherCATSetup.h"
 #include "Channel.h"
+#ifndef EC_SIMULATOR
 #include "ethercat_xml_parser.h"
+#else
+#include "ECSimulator.h"
+#endif
 
 bool program_done = false;
 bool machine_is_ready = false;
@@ -112,8 +119,9 @@ void load_debug_config()
 	}
 }
 
-std::list<DeviceInfo*>collected_configurations;
 std::map<unsigned int, DeviceInfo*> slave_configuration;
+#ifndef EC_SIMULATOR
+std::list<DeviceInfo*>collected_configurations;
 class ClockworkDeviceConfigurator : public DeviceConfigurator {
 	public:
 
@@ -134,10 +142,15 @@ class ClockworkDeviceConfigurator : public DeviceConfigurator {
 			return true;
 		}
 };
+#endif
 
 
 
 bool setupEtherCatThread() {
+#ifdef EC_SIMULATOR
+	// there is no ETHERCAT_BUS driver to bring the simulated master up
+	if (!ECInterface::instance()->initialised) ECInterface::instance()->init();
+#endif
 	if (!ECInterface::instance()->initialised) {
 		std::cout << "Cannect setup the EtherCAT thread until the interface is initialised\n";
 		return false;
@@ -278,6 +291,8 @@ bool setupEtherCatThread() {
 		ECInterface::instance()->configureModules();
 		ECInterface::instance()->registerModules();
 	}
+#else
+	ECSimulator::instance()->configureModules();
 #endif
 	generateIOComponentModules(slave_configuration);
 #ifndef EC_SIMULATOR
@@ -288,6 +303,9 @@ bool setupEtherCatThread() {
 #endif
 	IOComponent::setupIOMap();
 	initialiseOutputs();
+#ifdef EC_SIMULATOR
+	ECSimulator::instance()->resolveStimuli();
+#endif
 	return true;
 }
 
@@ -347,6 +365,7 @@ std::string thread_name("iod_main");
 	std::list<std::string> source_files;
 	int load_result = loadOptions(argc, argv, source_files);
 	if (load_result) return load_result;
+	if (lock_memory()) lockProcessMemory();
 	load_debug_config();
 
 #if 0
@@ -458,6 +477,11 @@ std::string thread_name("iod_main");
 
 	std::cout << "-------- Starting EtherCAT Interface ---------\n";
 	EtherCATThread ethercat;
+	if (image_port()) {
+		std::cout << "-------- Publishing the process image on port " << image_port() << " ---------\n";
+		ProcessImagePublisher *image_publisher = ProcessImagePublisher::start(image_port(), image_keyframe_interval());
+		new boost::thread(boost::ref(*image_publisher)); // runs until the process exits
+	}
 	boost::thread ecat_thread(boost::ref(ethercat));
 
 	std::cout << "-------- Starting Scheduler ---------\n";
@@ -472,6 +496,8 @@ std::string thread_name("iod_main");
 	ModbusAddress::message("STARTUP");
 	Dispatcher::start();
 
+	if (io_trace() && !IOTraceRecorder::start(io_trace()))
+		std::cerr << "Warning: could not record to " << io_trace() << "\n";
 	processMonitor.setProcessingThreadInstance(&processMonitor);
 	boost::thread process(boost::ref(processMonitor));
 
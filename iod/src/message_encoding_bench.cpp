@@ -0,0 +1,210 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+/*
+	message_encoding_bench encodes and decodes a mix of typical channel and
+	client commands through the cJSON path and the direct writer and reader
+	in MessageEncoding, checks that both produce the same messages and values
+	and reports the time per message for each.
+
+	usage: message_encoding_bench [iterations]
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <list>
+#include <vector>
+#include <string>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "MessageEncoding.h"
+#include "symboltable.h"
+#include "value.h"
+
+static uint64_t now_usec() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+struct Sample {
+	std::string cmd;
+	std::list<Value> params;
+};
+
+static std::vector<Sample> makeSamples() {
+	std::vector<Sample> samples;
+	Sample s;
+	s.cmd = "PROPERTY";
+	s.params.push_back(Value("conveyor_1"));
+	s.params.push_back(Value("speed"));
+	s.params.push_back(Value(1250L));
+	s.params.push_back(Value(3L));
+	samples.push_back(s);
+
+	s.params.clear();
+	s.params.push_back(Value("oven_zone_3"));
+	s.params.push_back(Value("temperature"));
+	s.params.push_back(Value(182.625));
+	samples.push_back(s);
+
+	s.params.clear();
+	s.params.push_back(Value("label_printer"));
+	s.params.push_back(Value("text"));
+	s.params.push_back(Value("Batch \"A\"\tline 2\\n", Value::t_string));
+	samples.push_back(s);
+
+	s.cmd = "SET";
+	s.params.clear();
+	s.params.push_back(Value("valve_12"));
+	s.params.push_back(Value("TO"));
+	s.params.push_back(Value("open"));
+	samples.push_back(s);
+
+	s.cmd = "TOGGLE";
+	s.params.clear();
+	s.params.push_back(Value(true));
+	s.params.push_back(Value(-42L));
+	s.params.push_back(Value(1.5e-9));
+	samples.push_back(s);
+
+	s.cmd = "LIST";
+	s.params.clear();
+	samples.push_back(s);
+	return samples;
+}
+
+static bool sameValues(const std::list<Value> *expected, const std::vector<Value> &actual) {
+	size_t n = (expected) ? expected->size() : 0;
+	if (n != actual.size()) return false;
+	if (!expected) return true;
+	std::list<Value>::const_iterator iter = expected->begin();
+	for (size_t i = 0; i < n; ++i, ++iter) {
+		if (iter->kind != actual[i].kind || *iter != actual[i]) return false;
+	}
+	return true;
+}
+
+static void report(const char *name, uint64_t elapsed, unsigned long messages, uint64_t baseline) {
+	std::cout << std::setw(28) << std::left << name
+		<< std::setw(10) << std::right << std::fixed << std::setprecision(1)
+		<< (double)elapsed * 1000.0 / messages << " ns/msg";
+	if (baseline && elapsed) std::cout << std::setw(8) << std::setprecision(2) << (double)baseline / elapsed << "x";
+	std::cout << "\n";
+}
+
+int main(int argc, char *argv[]) {
+	long iterations = (argc > 1) ? strtol(argv[1], 0, 10) : 200000;
+	if (iterations <= 0) {
+		std::cerr << "usage: " << argv[0] << " [iterations]\n";
+		return 1;
+	}
+	std::vector<Sample> samples = makeSamples();
+
+	// both paths must agree before the timings mean anything
+	std::vector<std::string> messages;
+	for (size_t i = 0; i < samples.size(); ++i) {
+		char *expected = MessageEncoding::encodeCommandWithCJSON(samples[i].cmd, &samples[i].params);
+		std::string direct;
+		MessageEncoding::writeCommand(direct, samples[i].cmd, &samples[i].params);
+		if (direct != expected) {
+			std::cerr << "encoding differs:\n  cJSON:  " << expected << "\n  direct: " << direct << "\n";
+			free(expected);
+			return 1;
+		}
+		messages.push_back(expected);
+		free(expected);
+	}
+	messages.push_back(MessageEncoding::encodeState("conveyor_1", "running", 7));
+	for (size_t i = 0; i < messages.size(); ++i) {
+		std::string cmd1, cmd2;
+		std::list<Value> *expected = 0;
+		std::vector<Value> actual;
+		bool ok1 = MessageEncoding::getCommandWithCJSON(messages[i].c_str(), cmd1, &expected);
+		bool ok2 = MessageEncoding::readCommand(messages[i].c_str(), cmd2, actual);
+		bool same = ok1 == ok2 && cmd1 == cmd2 && sameValues(expected, actual);
+		delete expected;
+		if (!same) {
+			std::cerr << "decoding differs for " << messages[i] << "\n";
+			return 1;
+		}
+	}
+
+	unsigned long count = 0;
+	uint64_t start = now_usec();
+	for (long n = 0; n < iterations; ++n)
+		for (size_t i = 0; i < samples.size(); ++i, ++count)
+			free(MessageEncoding::encodeCommandWithCJSON(samples[i].cmd, &samples[i].params));
+	uint64_t cjson_encode = now_usec() - start;
+
+	std::string buf;
+	start = now_usec();
+	for (long n = 0; n < iterations; ++n)
+		for (size_t i = 0; i < samples.size(); ++i) {
+			buf.clear();
+			MessageEncoding::writeCommand(buf, samples[i].cmd, &samples[i].params);
+		}
+	uint64_t direct_encode = now_usec() - start;
+
+	start = now_usec();
+	for (long n = 0; n < iterations; ++n)
+		for (size_t i = 0; i < samples.size(); ++i)
+			free(MessageEncoding::encodeCommand(samples[i].cmd, &samples[i].params));
+	uint64_t encode_command = now_usec() - start;
+
+	std::string cmd;
+	start = now_usec();
+	for (long n = 0; n < iterations; ++n)
+		for (size_t i = 0; i < messages.size(); ++i) {
+			std::list<Value> *params = 0;
+			MessageEncoding::getCommandWithCJSON(messages[i].c_str(), cmd, &params);
+			delete params;
+		}
+	uint64_t cjson_decode = now_usec() - start;
+
+	std::vector<Value> params;
+	params.reserve(8);
+	start = now_usec();
+	for (long n = 0; n < iterations; ++n)
+		for (size_t i = 0; i < messages.size(); ++i) {
+			params.clear();
+			MessageEncoding::readCommand(messages[i].c_str(), cmd, params);
+		}
+	uint64_t direct_decode = now_usec() - start;
+
+	start = now_usec();
+	for (long n = 0; n < iterations; ++n)
+		for (size_t i = 0; i < messages.size(); ++i) {
+			std::list<Value> *params = 0;
+			MessageEncoding::getCommand(messages[i].c_str(), cmd, &params);
+			delete params;
+		}
+	uint64_t get_command = now_usec() - start;
+
+	unsigned long decoded = (unsigned long)iterations * messages.size();
+	report("encode (cJSON)", cjson_encode, count, 0);
+	report("writeCommand", direct_encode, count, cjson_encode);
+	report("encodeCommand", encode_command, count, cjson_encode);
+	report("decode (cJSON)", cjson_decode, decoded, 0);
+	report("readCommand", direct_decode, decoded, cjson_decode);
+	report("getCommand", get_command, decoded, cjson_decode);
+	return 0;
+}
@@ -0,0 +1,167 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+/*
+	modbus_load_test starts a fleet of libmodbus clients against a running
+	modbusd, each one repeatedly writing and reading back its own block of
+	holding registers and coils, and reports throughput and latency.
+*/
+
+#include <iostream>
+#include <vector>
+#include <errno.h>
+#include <string.h>
+#include <inttypes.h>
+#include <modbus/modbus.h>
+#include <boost/program_options.hpp>
+#include <boost/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include "value.h"
+
+namespace po = boost::program_options;
+
+struct LoadTestResults
+{
+	unsigned long requests;
+	unsigned long errors;
+	unsigned long mismatches;
+	uint64_t total_latency;
+	uint64_t max_latency;
+	LoadTestResults() : requests(0), errors(0), mismatches(0), total_latency(0), max_latency(0) {}
+	void add(const LoadTestResults &other)
+	{
+		requests += other.requests;
+		errors += other.errors;
+		mismatches += other.mismatches;
+		total_latency += other.total_latency;
+		if (other.max_latency > max_latency) max_latency = other.max_latency;
+	}
+};
+
+static boost::mutex results_mutex;
+static LoadTestResults totals;
+static unsigned long failed_connections = 0;
+
+struct LoadTestClient
+{
+	LoadTestClient(const std::string &h, int p, int n, int first, int count, int iterations)
+		: host(h), port(p), id(n), base(first), span(count), rounds(iterations) {}
+
+	void record(LoadTestResults &res, uint64_t start, bool ok)
+	{
+		uint64_t latency = microsecs() - start;
+		++res.requests;
+		res.total_latency += latency;
+		if (latency > res.max_latency) res.max_latency = latency;
+		if (!ok) ++res.errors;
+	}
+
+	void operator()()
+	{
+		LoadTestResults res;
+		modbus_t *ctx = modbus_new_tcp(host.c_str(), port);
+		if (!ctx || modbus_connect(ctx) == -1)
+		{
+			std::cerr << "client " << id << " connection failed: " << modbus_strerror(errno) << "\n";
+			if (ctx) modbus_free(ctx);
+			boost::mutex::scoped_lock lock(results_mutex);
+			++failed_connections;
+			return;
+		}
+		std::vector<uint16_t> regs(span);
+		for (int i = 0; i < rounds; ++i)
+		{
+			int offset = i % span;
+			uint16_t value = (uint16_t)( (id << 8) + i);
+
+			uint64_t start = microsecs();
+			bool ok = modbus_write_register(ctx, base + offset, value) != -1;
+			record(res, start, ok);
+
+			start = microsecs();
+			ok = modbus_write_bit(ctx, base + offset, i & 1) != -1;
+			record(res, start, ok);
+
+			start = microsecs();
+			ok = modbus_read_registers(ctx, base, span, &regs[0]) == span;
+			record(res, start, ok);
+			if (ok && regs[offset] != value) ++res.mismatches;
+		}
+		modbus_close(ctx);
+		modbus_free(ctx);
+
+		boost::mutex::scoped_lock lock(results_mutex);
+		totals.add(res);
+	}
+
+	std::string host;
+	int port;
+	int id;
+	int base;
+	int span;
+	int rounds;
+};
+
+int main(int argc, const char *argv[])
+{
+	std::string host;
+	int port, clients, rounds, base, span;
+
+	po::options_description desc("Allowed options");
+	desc.add_options()
+		("help", "produce help message")
+		("host", po::value<std::string>(&host)->default_value("127.0.0.1"), "modbusd host")
+		("port", po::value<int>(&port)->default_value(1502), "modbusd port")
+		("clients", po::value<int>(&clients)->default_value(50), "number of concurrent clients")
+		("rounds", po::value<int>(&rounds)->default_value(1000), "write/write/read rounds per client")
+		("base", po::value<int>(&base)->default_value(0), "first address used by the test")
+		("span", po::value<int>(&span)->default_value(10), "addresses used by each client")
+		;
+	po::variables_map vm;
+	po::store(po::parse_command_line(argc, argv, desc), vm);
+	po::notify(vm);
+	if (vm.count("help"))
+	{
+		std::cout << desc << "\n";
+		return 1;
+	}
+	if (span <= 0 || span > 125 || clients <= 0 || base < 0)
+	{
+		std::cerr << "span must be between 1 and 125 and clients must be positive\n";
+		return 1;
+	}
+
+	std::cout << "starting " << clients << " clients against " << host << ":" << port << "\n";
+	uint64_t start = microsecs();
+	boost::thread_group fleet;
+	for (int i = 0; i < clients; ++i)
+		fleet.create_thread(LoadTestClient(host, port, i, base + i * span, span, rounds));
+	fleet.join_all();
+	uint64_t elapsed = microsecs() - start;
+
+	std::cout << "clients: " << clients << " (" << failed_connections << " failed to connect)\n"
+		<< "requests: " << totals.requests << " errors: " << totals.errors
+		<< " read back mismatches: " << totals.mismatches << "\n"
+		<< "elapsed: " << elapsed / 1000 << "ms, "
+		<< ( (elapsed) ? totals.requests * 1000000 / elapsed : 0) << " requests/s\n"
+		<< "latency avg: " << ( (totals.requests) ? totals.total_latency / totals.requests : 0)
+		<< "us max: " << totals.max_latency << "us\n";
+	return (totals.errors || failed_connections) ? 2 : 0;
+}
@@ -52,6 +52,11 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <netinet/tcp.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#else
+#include <poll.h>
+#endif
 #include <signal.h>
 #include "MessageEncoding.h"
 #include "MessagingInterface.h"
@@ -99,25 +104,45 @@ time_t now;
 static modbus_mapping_t *modbus_mapping = 0;
 static modbus_t *modbus_context = 0;
 
-static std::set<std::string> active_addresses;
-static std::map<std::string, bool> initialised_address;
+/* address tracking uses one bit per address in each modbus group (0: coils,
+	1: discrete inputs, 3: input registers, 4: holding registers) */
+const int MappingSize = 10000;
+const int NumGroups = 5;
+typedef std::bitset<MappingSize> AddressSet;
+
+static AddressSet active_addresses[NumGroups];
+static AddressSet initialised_address[NumGroups];
 
+static inline bool validAddress(int group, int addr)
+{
+	return group >= 0 && group < NumGroups && addr >= 0 && addr < MappingSize;
+}
 
-void activate_address(std::string& addr_str)
+void activate_address(int group, int addr)
 {
-	if (active_addresses.find(addr_str) == active_addresses.end())
+	if (!active_addresses[group].test(addr))
 	{
-		active_addresses.insert(addr_str);
-		initialised_address[addr_str] = false;
+		active_addresses[group].set(addr);
+		initialised_address[group].reset(addr);
+	}
+}
+
+static void clear_addresses()
+{
+	for (int i = 0; i < NumGroups; ++i)
+	{
+		active_addresses[i].reset();
+		initialised_address[i].reset();
 	}
 }
 
 void insert(int group, int addr, const char *value, size_t len)
 {
 	if (DEBUG_BASIC) std::cout << "g:"<<group<<addr<<" "<<value<<" " << len << "\n";
-	char buf[20];
-	snprintf(buf, 19, "%d.%d", group, addr);
-	std::string addr_str(buf);
+	if (!validAddress(group, addr) || addr + (int)(len/2) >= MappingSize) {
+		std::cerr << "address " << group << "." << addr << " is outside the modbus mapping\n";
+		return;
+	}
 	//if (len % 2 != 0) len++;// pad
 	uint16_t *dest = 0;
 	//	int str_len = strlen(value);
@@ -152,35 +177,36 @@ void insert(int group, int addr, const char *value, size_t len)
 void insert(int group, int addr, int value, size_t len)
 {
 	if (DEBUG_BASIC) std::cout << "g:"<<group<<addr<<" "<<value<<" " << len << "\n";
-	char buf[20];
-	snprintf(buf, 19, "%d.%d", group, addr);
-	std::string addr_str(buf);
+	if (!validAddress(group, addr) || (len == 2 && addr + 1 >= MappingSize)) {
+		std::cerr << "address " << group << "." << addr << " is outside the modbus mapping\n";
+		return;
+	}
 	if (group == 1)
 	{
 		modbus_mapping->tab_input_bits[addr] = value;
 
 		if (DEBUG_BASIC)
 			std::cout << "Updated Modbus memory for input bit " << addr << " to " << value << "\n";
-		activate_address(addr_str);
+		activate_address(group, addr);
 	}
 	else if (group == 0)
 	{
 		modbus_mapping->tab_bits[addr] = value;
 		if (DEBUG_BASIC) std::cout << "Updated Modbus memory for bit " << addr << " to " << value << "\n";
-		activate_address(addr_str);
+		activate_address(group, addr);
 	}
 	else if (group == 3)
 	{
 		if (len == 1)
 		{
 			modbus_mapping->tab_input_registers[addr] = value & 0xffff;
-			activate_address(addr_str);
+			activate_address(group, addr);
 		}
 		else if (len == 2)
 		{
 			int *l = (int32_t*) &modbus_mapping->tab_input_registers[addr];
 			*l = value & 0xffffffff;
-			activate_address(addr_str);
+			activate_address(group, addr);
 		}
 	}
 	else if (group == 4)
@@ -189,14 +215,14 @@ void insert(int group, int addr, int value, size_t len)
 		{
 			modbus_mapping->tab_registers[addr] = value & 0xffff;
 			if (DEBUG_BASIC) std::cout << "Updated Modbus memory for reg " << addr << " to " << (value  & 0xffff) << "\n";
-			activate_address(addr_str);
+			activate_address(group, addr);
 		}
 		else if (len == 2)
 		{
 			if (DEBUG_BASIC) std::cout << "Updated Modbus memory for 32 bit reg " << addr << " to " << (value  & 0xffffffff) << "\n";
 			int *l = (int32_t*) &modbus_mapping->tab_registers[addr];
 			*l = value & 0xffffffff;
-			activate_address(addr_str);
+			activate_address(group, addr);
 		}
 	}
 }
@@ -246,10 +272,119 @@ std::ostream &timestamp(std::ostream &out)
 	return out << (t / 1000) ;
 }
 
-std::string getIODSyncCommand(int group, int addr, bool new_value);
-std::string getIODSyncCommand(int group, int addr, int new_value);
-std::string getIODSyncCommand(int group, int addr, unsigned int new_value);
 
+/*
+	ConnectionPoller waits for activity on the listening socket and on all
+	client connections. On Linux it uses epoll so that the cost of a wait
+	does not grow with the number of connected panels, elsewhere poll() is used.
+*/
+class ConnectionPoller
+{
+public:
+	static const int max_events = 64;
+
+#ifdef __linux__
+	ConnectionPoller() : epfd(epoll_create1(0)) { if (epfd == -1) perror("epoll_create1"); }
+	~ConnectionPoller() { if (epfd != -1) close(epfd); }
+
+	bool add(int fd)
+	{
+		struct epoll_event ev;
+		memset(&ev, 0, sizeof(ev));
+		ev.events = EPOLLIN;
+		ev.data.fd = fd;
+		if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) == -1) { perror("epoll_ctl"); return false; }
+		return true;
+	}
+	void remove(int fd) { epoll_ctl(epfd, EPOLL_CTL_DEL, fd, 0); }
+	void clear() { close(epfd); epfd = epoll_create1(0); }
+
+	int wait(std::vector<int> &ready, int timeout_ms)
+	{
+		struct epoll_event events[max_events];
+		ready.clear();
+		int n = epoll_wait(epfd, events, max_events, timeout_ms);
+		for (int i = 0; i < n; ++i) ready.push_back(events[i].data.fd);
+		return n;
+	}
+private:
+	int epfd;
+#else
+	bool add(int fd)
+	{
+		struct pollfd pfd;
+		pfd.fd = fd; pfd.events = POLLIN; pfd.revents = 0;
+		fds.push_back(pfd);
+		return true;
+	}
+	void remove(int fd)
+	{
+		for (std::vector<struct pollfd>::iterator iter = fds.begin(); iter != fds.end(); ++iter)
+			if ((*iter).fd == fd) { fds.erase(iter); return; }
+	}
+	void clear() { fds.clear(); }
+
+	int wait(std::vector<int> &ready, int timeout_ms)
+	{
+		ready.clear();
+		if (fds.empty()) { usleep(timeout_ms * 1000); return 0; }
+		int n = poll(&fds[0], fds.size(), timeout_ms);
+		if (n <= 0) return n;
+		for (unsigned int i = 0; i < fds.size(); ++i)
+			if (fds[i].revents) ready.push_back(fds[i].fd);
+		return ready.size();
+	}
+private:
+	std::vector<struct pollfd> fds;
+#endif
+};
+
+/*
+	Writes from panels are not forwarded to clockwork as they arrive. Each address that
+	changes is marked dirty and once all connections with activity have been serviced
+	the dirty addresses are sent as a single batch with the latest value of each.
+*/
+class PendingWrites
+{
+public:
+	PendingWrites() : absorbed(0) {}
+
+	void mark(int group, int addr)
+	{
+		if (!validAddress(group, addr)) return;
+		if (dirty[group].test(addr)) { ++absorbed; return; }
+		dirty[group].set(addr);
+		order.push_back( (group << 16) | addr);
+	}
+
+	bool empty() const { return order.empty(); }
+
+	// produce a command to send to clockwork, using the values now in the mapping
+	std::string command()
+	{
+		std::stringstream ss;
+		if (order.size() > 1) ss << "BATCH ";
+		const char *delim = "";
+		for (unsigned int i = 0; i < order.size(); ++i)
+		{
+			int group = order[i] >> 16;
+			int addr = order[i] & 0xffff;
+			dirty[group].reset(addr);
+			int value = 0;
+			if (group == 0) value = (modbus_mapping->tab_bits[addr]) ? 1 : 0;
+			else if (group == 4) value = modbus_mapping->tab_registers[addr];
+			ss << delim << "MODBUS " << group << " " << (addr+1) << " " << value;
+			delim = "; ";
+		}
+		order.clear();
+		return ss.str();
+	}
+
+	unsigned long absorbed; // writes that were merged into an earlier pending write
+private:
+	AddressSet dirty[NumGroups];
+	std::vector<int> order;
+};
 
 struct ModbusServerThread
 {
@@ -260,10 +395,9 @@ struct ModbusServerThread
 		cmd_interface = new zmq::socket_t(*MessagingInterface::getContext(), ZMQ_REQ);
 		cmd_interface->connect(local_commands);
 
-		int function_code_offset = 0; //modbus_get_header_length(modbus_context);
-
 		int paused_counter = 0;
 		int warn_at = 10;
+		std::vector<int> ready;
 		while (modbus_state != ms_finished)
 		{
 			if (modbus_state == ms_pausing) {
@@ -295,333 +429,241 @@ struct ModbusServerThread
 					modbus_set_debug(modbus_context, FALSE);
 
 				std::cout << "starting modbus_tcp_listen\n" << std::flush;
-				socket = modbus_tcp_listen(modbus_context, 3);
+				socket = modbus_tcp_listen(modbus_context, max_pending_connections);
 				std::cout << "finished modbus_tcp_listen " << socket << "\n" << std::flush;
 				if (socket == -1) {
 					perror("modbus listen");
 					continue;
 				}
 				if (debug) std::cout << "Modbus listen socket: " << socket << "\n" << std::flush;
-				FD_ZERO(&connections);
-				FD_SET(socket, &connections);
-				max_fd = socket;
+				poller.clear();
+				poller.add(socket);
 				modbus_state = ms_collecting;
 				continue;
 			}
-			fd_set activity;
-			activity = connections;
-			int nfds;
-			struct timeval timeout;
-			timeout.tv_sec = 0;
-			timeout.tv_usec = 100000;
-			if ( (nfds = select(max_fd +1, &activity, 0, 0, &timeout)) == -1)
+			int nfds = poller.wait(ready, 100);
+			if (nfds == -1)
 			{
-				perror("select");
-				if (errno == EINVAL || errno == ENOENT) { modbus_state = ms_finished; break; }
+				if (errno == EINTR || modbus_state != ms_collecting) continue;
+				perror("poll");
+				if (errno == EINVAL || errno == EBADF) { modbus_state = ms_finished; break; }
 				usleep(100);
 				continue; // TBD
 			}
-			if (nfds == 0) { /*if (debug) std::cout << "idle\n"; */ usleep(1000); continue; }
-			for (int conn = 0; conn <= max_fd; ++conn)
+			if (nfds == 0) continue;
+			for (unsigned int i = 0; i < ready.size() && modbus_state == ms_collecting; ++i)
 			{
-				if (!FD_ISSET(conn, &activity)) continue;
-				if (conn == socket)   // new connection
-				{
-					std::cout << "new modbus connection on socket " << socket << "\n" << std::flush;
-					struct sockaddr_in panel_in;
-					socklen_t addr_size = sizeof(panel_in);
+				int conn = ready[i];
+				if (conn == socket)
+					acceptConnection();
+				else
+					handleRequest(conn);
+			}
+			flushWrites();
+		}
+		modbus_free(modbus_context);
+		modbus_context = 0;
 
-					memset(&panel_in, 0, sizeof(struct sockaddr_in));
-					int panel_fd;
-					if ( (panel_fd = accept(socket, (struct sockaddr *)&panel_in, &addr_size)) == -1)
-					{
-						perror("accept");
-					}
-					else
+	}
+
+	void acceptConnection()
+	{
+		std::cout << "new modbus connection on socket " << socket << "\n" << std::flush;
+		struct sockaddr_in panel_in;
+		socklen_t addr_size = sizeof(panel_in);
+
+		memset(&panel_in, 0, sizeof(struct sockaddr_in));
+		int panel_fd;
+		if ( (panel_fd = accept(socket, (struct sockaddr *)&panel_in, &addr_size)) == -1)
+		{
+			perror("accept");
+			return;
+		}
+		int option = 1;
+		int res = setsockopt(panel_fd, IPPROTO_TCP, TCP_NODELAY, &option, sizeof(int));
+		if (res == -1)
+		{
+			perror("setsockopt");
+		}
+		res = setsockopt(panel_fd, SOL_SOCKET, SO_KEEPALIVE, &option, sizeof(int));
+		if (res == -1)
+		{
+			perror("setsockopt");
+		}
+		if (!poller.add(panel_fd)) { close(panel_fd); return; }
+		connection_list.push_back(panel_fd);
+		std::cout << timestamp << " new connection: " << panel_fd << " (" << connection_list.size() << " connected)\n" << std::flush;
+	}
+
+	void dropConnection(int conn)
+	{
+		std::cout << timestamp << " Error: " << modbus_strerror(errno) << "\n";
+		std::cout << timestamp << " Modbus connection " << conn << " lost\n";
+		poller.remove(conn);
+		close(conn);
+		connection_list.remove(conn);
+	}
+
+	void handleRequest(int conn)
+	{
+		uint8_t query[MODBUS_TCP_MAX_ADU_LENGTH];
+		uint8_t query_backup[MODBUS_TCP_MAX_ADU_LENGTH];
+		int n;
+
+		modbus_set_socket(modbus_context, conn); // tell modbus to use this current connection
+		n = modbus_receive(modbus_context, query);
+		if (n == -1)
+		{
+			/* Connection closed by the client or error */
+			dropConnection(conn);
+			return;
+		}
+		if (n == 0) return; // request for another slave
+
+		memcpy(query_backup, query, n);
+		int addr = getInt( &query[function_code_offset+1]);
+		int fc = query[function_code_offset];
+		// ensure changes to coils are not sent to iod if they are not required
+		bool ignore_coil_change = false;
+		if (fc == 5) // coil write function
+		{
+			ignore_coil_change = !validAddress(0, addr)
+				|| (query_backup[function_code_offset + 3] && modbus_mapping->tab_bits[addr]);
+			if (DEBUG_BASIC && ignore_coil_change) std::cout << "ignoring coil change " << addr
+				<< ((query_backup[function_code_offset + 3]) ? "on" : "off") << "\n";
+		}
+		else if (fc == 15)
+		{
+			int num_coils = getInt( &query[function_code_offset+3]);
+			int num_bytes = query_backup[function_code_offset+5];
+			int curr_coil = 0;
+			int coil = addr;
+			unsigned char *data = query_backup + function_code_offset + 6;
+			for (int b = 0; b<num_bytes; ++b)
+			{
+				for (int bit = 0; bit < 8; ++bit)
+				{
+					if (curr_coil >= num_coils || coil >= MappingSize) break;
+					if (active_addresses[0].test(coil))
 					{
-						connection_list.push_back(panel_fd);
-						int option = 1;
-						int res = setsockopt(panel_fd, IPPROTO_TCP, TCP_NODELAY, &option, sizeof(int));
-						if (res == -1)
+						if (DEBUG_BASIC) std::cout << "updating cw with new discrete: " << coil
+							<< " (" << (int)(modbus_mapping->tab_bits[coil]) <<")"
+								<< " (" << (int)(modbus_mapping->tab_input_bits[coil]) <<")"
+								<< "\n";
+						unsigned char val = (*data) & (1<<bit);
+
+						if ( !initialised_address[0].test(coil) ||  ( val != 0 && modbus_mapping->tab_bits[coil] == 0 )
+								|| (!val && modbus_mapping->tab_bits[coil] ) )
 						{
-							perror("setsockopt");
+							if (DEBUG_BASIC) std::cout << "setting iod address " << coil+1 << " to " << ( (val) ? 1 : 0) << "\n";
+							pending.mark(0, coil);
+							initialised_address[0].set(coil);
 						}
-						res = setsockopt(panel_fd, SOL_SOCKET, SO_KEEPALIVE, &option, sizeof(int));
-						if (res == -1)
-						{
-							perror("setsockopt");
-						}
-						FD_SET(panel_fd, &connections);
-						if (panel_fd > max_fd) max_fd = panel_fd;;
-						std::cout << timestamp << " new connection: " << panel_fd << "\n" << std::flush;
 					}
+					++coil;
+					++curr_coil;
 				}
-				else
+				++data;
+			}
+		}
+		else if (fc == 16)
+		{
+			int num_words = getInt(&query_backup[function_code_offset+3]);
+			unsigned char *data = query_backup + function_code_offset + 6; // interpreted as binary
+			int reg = addr;
+			for (int i = 0; i<num_words && reg < MappingSize; ++i, ++reg)
+			{
+				int val = getInt(data);
+				data += 2;
+				if (active_addresses[4].test(reg)
+						&& (!initialised_address[4].test(reg) || val != modbus_mapping->tab_registers[reg]))
 				{
-					uint8_t query[MODBUS_TCP_MAX_ADU_LENGTH];
-					uint8_t query_backup[MODBUS_TCP_MAX_ADU_LENGTH];
-					int n;
-
-					modbus_set_socket(modbus_context, conn); // tell modbus to use this current connection
-					n = modbus_receive(modbus_context, query);
-					char *previous_value = 0; // used to see if a string value is different between ram and connection
-					if (n != -1)
-					{
-						std::list<std::string>iod_sync_commands;
-						memcpy(query_backup, query, n);
-						int addr = getInt( &query[function_code_offset+1]);
-						//int len = getInt( &query[function_code_offset+3]);
-						int fc = query[function_code_offset];
-						// ensure changes to coils are not sent to iod if they are not required
-						bool ignore_coil_change = false;
-						if (fc == 3) // register read - why are we keeping the previous value?
-						{
-#if 0
-							int num_regs = query[function_code_offset+4];
-							char *src = (char*) &modbus_mapping->tab_registers[addr]; //(char*) &query[function_code_offset+6];
-							previous_value = (char *)malloc(2*num_regs+1);
-							char *dest = previous_value;
-							for (int i=0; i<num_regs; ++i)
-							{
-								*dest++ = *(src+1);
-								*dest++ = *src++;
-								src++;
-							}
-#endif
-						}
-						else if (fc == 5) // coil write function
-						{
-							ignore_coil_change = (query_backup[function_code_offset + 3] && modbus_mapping->tab_bits[addr]);
-							if (DEBUG_BASIC && ignore_coil_change) std::cout << "ignoring coil change " << addr
-								<< ((query_backup[function_code_offset + 3]) ? "on" : "off") << "\n";
-						}
-						else if (fc == 15)
-						{
-							int num_coils = getInt( &query[function_code_offset+3]);
-							int num_bytes = query_backup[function_code_offset+5];
-							int curr_coil = 0;
-							unsigned char *data = query_backup + function_code_offset + 6;
-							for (int b = 0; b<num_bytes; ++b)
-							{
-								for (int bit = 0; bit < 8; ++bit)
-								{
-									if (curr_coil >= num_coils) break;
-									char buf[20];
-									snprintf(buf, 19, "%d.%d", 0, addr);
-									std::string addr_str(buf);
-
-									if (active_addresses.find(addr_str) != active_addresses.end())
-									{
-										if (DEBUG_BASIC) std::cout << "updating cw with new discrete: " << addr
-											<< " (" << (int)(modbus_mapping->tab_bits[addr]) <<")"
-												<< " (" << (int)(modbus_mapping->tab_input_bits[addr]) <<")"
-												<< "\n";
-										unsigned char val = (*data) & (1<<bit);
-
-
-										if ( !initialised_address[addr_str] ||  ( val != 0 && modbus_mapping->tab_bits[addr] == 0 )
-												|| (!val && modbus_mapping->tab_bits[addr] ) )
-										{
-											if (DEBUG_BASIC) std::cout << "setting iod address " << addr+1 << " to " << ( (val) ? 1 : 0) << "\n";
-											iod_sync_commands.push_back( getIODSyncCommand(0, addr+1, (val) ? true : false) );
-											initialised_address[addr_str] = true;
-										}
-									}
-									++addr;
-									++curr_coil;
-								}
-								++data;
-							}
-						}
-						else if (fc == 16)
-						{
-							int num_words = getInt(&query_backup[function_code_offset+3]);
-							//int num_bytes = query_backup[function_code_offset+5];
-							unsigned char *data = query_backup + function_code_offset + 6; // interpreted as binary
-							for (int reg = 0; reg<num_words; ++reg)
-							{
-								char buf[20];
-								snprintf(buf, 19, "%d.%d", 4, addr);
-								std::string addr_str(buf);
-
-								if (active_addresses.find(addr_str) != active_addresses.end())
-								{
-									int val = 0;
-									//if (num_words == 1) {
-										val = getInt(data);
-										data += 2;
-									/*}
-									else if (num_words == 2) {
-										val = getInt32(data);
-										data += 4;
-									}
-									*/
-									if (!initialised_address[addr_str] || val != modbus_mapping->tab_registers[addr])
-									{
-										if (debug & DEBUG_LIB)
-											std::cout << " Updating register " << addr
-											<< " to " << val << " from connection " << conn << "\n";
-										iod_sync_commands.push_back( getIODSyncCommand(4, addr+1, val) );
-										initialised_address[addr_str] = true;
-									}
-								}
-								++addr;
-							}
-						}
-
-						// process the request, updating our ram as appropriate
-						n = modbus_reply(modbus_context, query, n, modbus_mapping);
-
-						// post process - make sure iod is informed of the change
-						if (fc == 2)
-						{
-							//if (DEBUG_VERBOSE_TOPLC)
-							//   std::cout << timestamp << " connection " << conn << " read coil " << addr << "\n";
-						}
-						else if (fc == 1)
-						{
-							int num_coils = getInt( &query[function_code_offset+3]);
-							char buf[20];
-							snprintf(buf, 19, "%d.%d", 1, addr);
-							std::string addr_str(buf);
-							if (active_addresses.find(addr_str) != active_addresses.end() )
-								if (debug & DEBUG_LIB) {
-									std::cout << timestamp << " connection " << conn << " read " << num_coils << " discrete " << addr
-										<< " (";
-									for (int bitn=0; bitn<num_coils; ++bitn)
-										std::cout  << (int)(modbus_mapping->tab_input_bits[addr+bitn])<<" ";
-									std::cout <<")\n";
-								}
-						}
-						else if (fc == 3)
-						{
-#if 0
-							if (DEBUG_VERBOSE_TOPLC)
-								std::cout << timestamp << " connection " << conn << " got rw_register " << addr << "\n";
-							int num_regs = query_backup[function_code_offset+4];
-							char *src = (char*) &modbus_mapping->tab_registers[addr];
-							char *new_value = (char *)malloc(2*num_regs);
-							char *dest = new_value;
-							for (int i=0; i<num_regs; ++i)
-							{
-								*dest++ = *(src+1);
-								*dest++ = *src++;
-								src++;
-							}
-							bool changed = false;
-							for (int i=0; i<num_regs; ++i) {
-								if ( ((uint16_t*)(dest))[i] != modbus_mapping->tab_registers[addr+i])
-									if (DEBUG_BASIC) std::cout << "connection " << conn << " num regs: " << num_regs << " changed rw register " << (addr+i) << "\n";
-							}
-							free(new_value);
-							free(previous_value);
-#endif
-						}
-						else if (fc == 4)
-						{
-							int num_regs = query_backup[function_code_offset+5];
-							if (DEBUG_VERBOSE_TOPLC)
-								if (DEBUG_BASIC) std::cout << timestamp << " connection " << conn
-									<< " code: " << fc << " num regs: " << num_regs << " got register " << addr << "\n";
-						}
-						else if (fc == 15 || fc == 16)
-						{
-							if (fc == 15)
-							{
-								char buf[20];
-								snprintf(buf, 19, "%d.%d", 0, addr);
-								std::string addr_str(buf);
-								if (active_addresses.find(addr_str) != active_addresses.end() )
-									if (DEBUG_BASIC)
-										std::cout << timestamp << " connection " << conn << " write multi discrete "
-											<< addr << "\n"; //<< " n:" << len << "\n";
-							}
-							else if (fc == 16)
-							{
-								if (DEBUG_BASIC)
-									std::cout << timestamp << " write multiple register " << addr  << "\n";
-							}
-							std::list<std::string>::iterator iter = iod_sync_commands.begin();
-							while (iter != iod_sync_commands.end())
-							{
-								std::string cmd = *iter++;
-								std::string response;
-								uint64_t cmd_timeout = 0;
-								if (!sendMessage(cmd.c_str(), *cmd_interface, response, cmd_timeout))
-								{
-									FileLogger fl(program_name);
-									fl.f() << "Message send of " << cmd << " failed\n";
-								}
-								//char *res = sendIODMessage(cmd);
-								//if (res) free(res);
-							}
-							iod_sync_commands.clear();
-						}
-						else if (fc == 5)
-						{
-							if (!ignore_coil_change)
-							{
-								std::string cmd( getIODSyncCommand(0, addr+1, (query_backup[function_code_offset + 3]) ? 1 : 0) );
-								std::string response;
-								uint64_t cmd_timeout = 0;
-								if (!sendMessage(cmd.c_str(), *cmd_interface, response, cmd_timeout))
-								{
-									FileLogger fl(program_name);
-									fl.f() << "Message send of " << cmd << " failed\n";
-								}
-								//char *res = sendIOD(0, addr+1, (query_backup[function_code_offset + 3]) ? 1 : 0);
-								//if (res) free(res);
-								if (DEBUG_BASIC)
-									std::cout << timestamp << " Updating coil " << addr << " from connection " << conn
-										<< ((query_backup[function_code_offset + 3]) ? " on" : " off") << "\n";
-							}
-						}
-						else if (fc == 6)
-						{
-							int val = getInt( &query[function_code_offset+5]);
-							std::string res(getIODSyncCommand(4, addr+1, modbus_mapping->tab_registers[addr]) );
-							std::string response;
-							uint64_t cmd_timeout = 0;
-							if (!sendMessage(res.c_str(), *cmd_interface, response, cmd_timeout))
-							{
-								FileLogger fl(program_name);
-								fl.f() << "Message send of " << res << " failed\n";
-							}
-							//                sendIOD(4, addr+1, modbus_mapping->tab_registers[addr]) );
-							//if (res) free(res);
-							if (DEBUG_BASIC)
-								std::cout << timestamp << " Updating register " << addr << " to " << val << " from connection " << conn << "\n";
-						}
-						else
-							if (DEBUG_BASIC)
-								std::cout << timestamp << " function code: " << (int)query_backup[function_code_offset] << "\n";
-						if (n == -1)
-						{
-							if (DEBUG_BASIC)
-								std::cout << timestamp << " Error: " << modbus_strerror(errno) << "\n";
-						}
-					}
-					else
-					{
-						/* Connection closed by the client or error */
-						std::cout << timestamp << " Error: " << modbus_strerror(errno) << "\n";
-						std::cout << timestamp << " Modbus connection " << conn << " lost\n";
-						close(conn);
-						connection_list.remove(conn);
-						if (conn == max_fd) --max_fd;
-						FD_CLR(conn, &connections);
-					}
+					if (debug & DEBUG_LIB)
+						std::cout << " Updating register " << reg
+						<< " to " << val << " from connection " << conn << "\n";
+					pending.mark(4, reg);
+					initialised_address[4].set(reg);
 				}
 			}
 		}
-		modbus_free(modbus_context);
-		modbus_context = 0;
 
+		// process the request, updating our ram as appropriate
+		n = modbus_reply(modbus_context, query, n, modbus_mapping);
+
+		// post process - make sure iod is informed of the change
+		if (fc == 1)
+		{
+			if (debug & DEBUG_LIB && validAddress(1, addr) && active_addresses[1].test(addr)) {
+				int num_coils = getInt( &query[function_code_offset+3]);
+				std::cout << timestamp << " connection " << conn << " read " << num_coils << " discrete " << addr
+					<< " (";
+				for (int bitn=0; bitn<num_coils && addr+bitn < MappingSize; ++bitn)
+					std::cout  << (int)(modbus_mapping->tab_input_bits[addr+bitn])<<" ";
+				std::cout <<")\n";
+			}
+		}
+		else if (fc == 4)
+		{
+			int num_regs = query_backup[function_code_offset+5];
+			if (DEBUG_VERBOSE_TOPLC)
+				if (DEBUG_BASIC) std::cout << timestamp << " connection " << conn
+					<< " code: " << fc << " num regs: " << num_regs << " got register " << addr << "\n";
+		}
+		else if (fc == 15)
+		{
+			if (DEBUG_BASIC && validAddress(0, addr) && active_addresses[0].test(addr))
+				std::cout << timestamp << " connection " << conn << " write multi discrete "
+					<< addr << "\n";
+		}
+		else if (fc == 16)
+		{
+			if (DEBUG_BASIC)
+				std::cout << timestamp << " write multiple register " << addr  << "\n";
+		}
+		else if (fc == 5)
+		{
+			if (!ignore_coil_change)
+			{
+				pending.mark(0, addr);
+				if (DEBUG_BASIC)
+					std::cout << timestamp << " Updating coil " << addr << " from connection " << conn
+						<< ((query_backup[function_code_offset + 3]) ? " on" : " off") << "\n";
+			}
+		}
+		else if (fc == 6)
+		{
+			pending.mark(4, addr);
+			if (DEBUG_BASIC)
+				std::cout << timestamp << " Updating register " << addr << " to "
+					<< getInt( &query[function_code_offset+3]) << " from connection " << conn << "\n";
+		}
+		else if (fc != 2 && fc != 3)
+			if (DEBUG_BASIC)
+				std::cout << timestamp << " function code: " << (int)query_backup[function_code_offset] << "\n";
+		if (n == -1)
+		{
+			if (DEBUG_BASIC)
+				std::cout << timestamp << " Error: " << modbus_strerror(errno) << "\n";
+		}
 	}
-	ModbusServerThread() : modbus_state(ms_paused), socket(0), cmd_interface(0)
+
+	// send all writes collected during the last poll to clockwork in one message
+	void flushWrites()
 	{
-		FD_ZERO(&connections);
+		if (pending.empty()) return;
+		std::string cmd(pending.command());
+		if (DEBUG_BASIC) std::cout << "IOD command: " << cmd << " (" << pending.absorbed << " writes absorbed so far)\n";
+		std::string response;
+		uint64_t cmd_timeout = 0;
+		if (!sendMessage(cmd.c_str(), *cmd_interface, response, cmd_timeout))
+		{
+			FileLogger fl(program_name);
+			fl.f() << "Message send of " << cmd << " failed\n";
+		}
+	}
 
+	ModbusServerThread() : modbus_state(ms_paused), socket(0), function_code_offset(0), cmd_interface(0)
+	{
 	}
 	~ModbusServerThread()
 	{
@@ -651,10 +693,13 @@ struct ModbusServerThread
 		modbus_state = ms_resuming;
 	}
 
+	static const int max_pending_connections = 32;
+
 	enum ModbusState { ms_starting, ms_collecting, ms_running, ms_pausing, ms_paused, ms_resuming, ms_finished } modbus_state;
-	fd_set connections;
-	int max_fd;
+	ConnectionPoller poller;
+	PendingWrites pending;
 	int socket;
+	int function_code_offset;
 	zmq::socket_t *cmd_interface;
 	std::list<int> connection_list;
 
@@ -662,66 +707,6 @@ struct ModbusServerThread
 
 MessagingInterface *g_iodcmd;
 
-char *sendIOD(int group, int addr, int new_value);
-char *sendIODMessage(const std::string &s);
-
-std::string getIODSyncCommand(int group, int addr, bool which)
-{
-	int new_value = (which) ? 1 : 0;
-	char *msg = MessageEncoding::encodeCommand("MODBUS", group, addr, new_value);
-	//sendIODMessage(msg);
-
-	if (DEBUG_BASIC) std::cout << "IOD command: " << msg << "\n";
-	std::string s(msg);
-	free(msg);
-	return s;
-}
-
-std::string getIODSyncCommand(int group, int addr, int new_value)
-{
-	char *msg = MessageEncoding::encodeCommand("MODBUS", group, addr, new_value);
-	sendIODMessage(msg);
-
-	if (DEBUG_BASIC) std::cout << "IOD command: " << msg << "\n";
-	std::string s(msg);
-	free(msg);
-	return s;
-}
-
-std::string getIODSyncCommand(int group, int addr, unsigned int new_value)
-{
-	char *msg = MessageEncoding::encodeCommand("MODBUS", group, addr, new_value);
-	sendIODMessage(msg);
-
-	if (DEBUG_BASIC) std::cout << "IOD command: " << msg << "\n";
-	std::string s(msg);
-	free(msg);
-	return s;
-}
-
-char *sendIOD(int group, int addr, int new_value)
-{
-	std::string s(getIODSyncCommand(group, addr, new_value));
-	if (g_iodcmd)
-		return g_iodcmd->send(s.c_str());
-	else
-	{
-		if (DEBUG_BASIC) std::cout << "IOD interface not ready\n";
-		return strdup("IOD interface not ready\n");
-	}
-}
-
-char *sendIODMessage(const std::string &s)
-{
-	if (g_iodcmd)
-		return g_iodcmd->send(s.c_str());
-	else
-	{
-		if (DEBUG_BASIC) std::cout << "IOD interface not ready\n";
-		return strdup("IOD interface not ready\n");
-	}
-}
-
 void loadData(const char *initial_settings)
 {
 	cJSON *obj = cJSON_Parse(initial_settings);
@@ -868,8 +853,7 @@ void CollectModbusStatus() {
 	char *initial_settings = 0;
 	do
 	{
-		active_addresses.clear();
-		initialised_address.clear();
+		clear_addresses();
 		initial_settings = g_iodcmd->sendCommand("MODBUS", "REFRESH");
 		if (initial_settings && strncasecmp(initial_settings, "ignored", strlen("ignored")) != 0)
 		{
@@ -947,7 +931,7 @@ int main(int argc, const char * argv[])
 		LogState::instance()->insert(DebugExtra::instance()->DEBUG_MODBUS);
 	}
 
-	modbus_mapping = modbus_mapping_new(10000, 10000, 10000, 10000);
+	modbus_mapping = modbus_mapping_new(MappingSize, MappingSize, MappingSize, MappingSize);
 	if (!modbus_mapping)
 	{
 		std::cerr << "Error setting up modbus mapping regions\n";
@@ -1096,8 +1080,7 @@ int main(int argc, const char * argv[])
 #if 1
 				{FileLogger fl(program_name); fl.f() << " iod startup detected. restarting to reload modbus\n"; }
 				try {
-				active_addresses.clear();
-				initialised_address.clear();
+				clear_addresses();
 				}
 				catch (std::exception ex) {
 					{FileLogger fl(program_name); fl.f() << "exception during restart " << ex.what() << "\n";  }
@@ -1105,8 +1088,7 @@ int main(int argc, const char * argv[])
 				exit(0);
 				break;
 #else
-				active_addresses.clear();
-				initialised_address.clear();
+				clear_addresses();
 				char *initial_settings = g_iodcmd->send("MODBUS REFRESH");
 				loadData(initial_settings);
 				free(initial_settings);
@@ -0,0 +1,161 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+/*
+	mqtt_load_test publishes bursts of values to a tree of topics on a
+	running broker through the MQTT network thread, subscribes to the same
+	tree and checks that the last value received for every topic is the
+	last value published. Intermediate values may be coalesced away, the
+	newest one must always arrive.
+*/
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <poll.h>
+#include <unistd.h>
+#include <mosquitto.h>
+#include <boost/program_options.hpp>
+#include "MQTTNetwork.h"
+#include "value.h"
+
+namespace po = boost::program_options;
+
+int main(int argc, const char *argv[])
+{
+	std::string host, prefix;
+	int port, topics, rounds, qos, timeout;
+
+	po::options_description desc("Allowed options");
+	desc.add_options()
+		("help", "produce help message")
+		("host", po::value<std::string>(&host)->default_value("127.0.0.1"), "broker host")
+		("port", po::value<int>(&port)->default_value(1883), "broker port")
+		("topics", po::value<int>(&topics)->default_value(100), "number of topics")
+		("rounds", po::value<int>(&rounds)->default_value(1000), "values published to each topic")
+		("qos", po::value<int>(&qos)->default_value(0), "quality of service")
+		("prefix", po::value<std::string>(&prefix), "topic prefix (default is unique to this process)")
+		("timeout", po::value<int>(&timeout)->default_value(10), "seconds to wait for the final values")
+		;
+	po::variables_map vm;
+	po::store(po::parse_command_line(argc, argv, desc), vm);
+	po::notify(vm);
+	if (vm.count("help"))
+	{
+		std::cout << desc << "\n";
+		return 1;
+	}
+	if (topics <= 0 || rounds <= 0 || qos < 0 || qos > 2)
+	{
+		std::cerr << "topics and rounds must be positive and qos must be 0, 1 or 2\n";
+		return 1;
+	}
+	if (prefix.empty())
+	{
+		std::stringstream ss;
+		ss << "mqtt_load_test/" << getpid();
+		prefix = ss.str();
+	}
+
+	mosquitto_lib_init();
+	MQTTNetwork *network = MQTTNetwork::instance();
+	MQTTBrokerLink *link = network->addBroker("test", host, port, 0);
+	network->subscribe(link, prefix + "/#", qos);
+	network->start();
+
+	uint64_t deadline = microsecs() + (uint64_t)timeout * 1000000;
+	while (!link->connected && microsecs() < deadline) usleep(10000);
+	if (!link->connected)
+	{
+		std::cerr << "could not connect to " << host << ":" << port << "\n";
+		network->stop();
+		return 2;
+	}
+	usleep(200000); // allow the subscription to be acknowledged
+
+	std::vector<std::string> names;
+	std::vector<std::string> received(topics);
+	for (int i = 0; i < topics; ++i)
+	{
+		std::stringstream ss;
+		ss << prefix << "/" << i;
+		names.push_back(ss.str());
+	}
+	std::map<std::string, int> index;
+	for (int i = 0; i < topics; ++i) index[names[i]] = i;
+
+	unsigned long messages = 0;
+	MQTTInbound msg;
+	uint64_t start = microsecs();
+	for (int r = 1; r <= rounds; ++r)
+	{
+		std::stringstream ss;
+		ss << r;
+		for (int i = 0; i < topics; ++i)
+			network->publish(link, names[i], ss.str(), qos, false);
+		network->flush();
+		while (network->receive(msg))
+		{
+			++messages;
+			std::map<std::string, int>::iterator found = index.find(msg.topic);
+			if (found != index.end()) received[(*found).second] = msg.payload;
+		}
+	}
+	uint64_t published_at = microsecs();
+
+	std::stringstream last;
+	last << rounds;
+	int missing = topics;
+	deadline = microsecs() + (uint64_t)timeout * 1000000;
+	while (missing && microsecs() < deadline)
+	{
+		network->flush();
+		struct pollfd item = { network->notifyFd(), POLLIN, 0 };
+		poll(&item, 1, 100);
+		while (network->receive(msg))
+		{
+			++messages;
+			std::map<std::string, int>::iterator found = index.find(msg.topic);
+			if (found != index.end()) received[(*found).second] = msg.payload;
+		}
+		missing = 0;
+		for (int i = 0; i < topics; ++i)
+			if (received[i] != last.str()) ++missing;
+	}
+	uint64_t elapsed = microsecs() - start;
+	network->stop();
+
+	uint64_t offered = (uint64_t)topics * rounds;
+	std::cout << "offered: " << offered << " in " << (published_at - start) / 1000 << "ms, "
+		<< ( (published_at > start) ? offered * 1000000 / (published_at - start) : 0) << " values/s\n"
+		<< "published: " << link->published << " coalesced: " << link->coalesced
+		<< " received: " << link->received << " dropped: " << link->dropped
+		<< " errors: " << link->errors << " reconnects: " << link->reconnects << "\n"
+		<< "elapsed: " << elapsed / 1000 << "ms, "
+		<< ( (elapsed) ? link->published * 1000000 / elapsed : 0) << " publishes/s, "
+		<< ( (elapsed) ? messages * 1000000 / elapsed : 0) << " receives/s\n";
+	if (missing)
+	{
+		std::cout << missing << " of " << topics << " topics did not receive their final value\n";
+		return 2;
+	}
+	std::cout << "all topics received their final value\n";
+	return 0;
+}
@@ -29,6 +29,10 @@ const char *persistent_store_name  = 0;
 const char *modbus_map_name = 0;
 const char *debug_config_name = 0;
 const char *dependency_graph_name = 0;
+const char *state_table_name = 0;
+const char *simulator_config_name = 0;
+const char *metrics_file_name = 0;
+const char *io_trace_name = 0;
 static int publisher_port_num = 5556;
 static bool publisher_port_num_required = false;
 static int persistent_port_num = 5557;
@@ -40,6 +44,14 @@ static char *dev_name = strdup("CLOCKWORK");
 static bool is_tracing = false;
 static unsigned long cycle_time_ = 1000;
 static bool c_export = false;
+static int ecat_thread_priority = 0;
+static int ecat_thread_cpu = -1;
+static int processing_thread_priority = 0;
+static int processing_thread_cpu = -1;
+static bool lock_process_memory = false;
+static bool rtc_pacing = false;
+static int image_port_num = 0;
+static unsigned int image_keyframe_cycles = 1000;
 
 const char *device_name() { return dev_name; }
 void set_device_name(const char *new_name) {
@@ -165,4 +177,47 @@ void set_export_to_c(bool which) {
 	c_export = which;
 }
 
+void set_state_table(const char *name) {
+	state_table_name = name;
+}
+const char *state_table() {
+	return state_table_name;
+}
+
+void set_simulator_config(const char *name) {
+	simulator_config_name = name;
+}
+const char *simulator_config() {
+	return simulator_config_name;
+}
+
+void set_metrics_file(const char *name) {
+	metrics_file_name = name;
+}
+const char *metrics_file() {
+	return metrics_file_name;
+}
+
+void set_io_trace(const char *name) {
+	io_trace_name = name;
+}
+const char *io_trace() {
+	return io_trace_name;
+}
 
+void set_ecat_priority(int priority) { ecat_thread_priority = priority; }
+int ecat_priority() { return ecat_thread_priority; }
+void set_ecat_cpu(int cpu) { ecat_thread_cpu = cpu; }
+int ecat_cpu() { return ecat_thread_cpu; }
+void set_processing_priority(int priority) { processing_thread_priority = priority; }
+int processing_priority() { return processing_thread_priority; }
+void set_processing_cpu(int cpu) { processing_thread_cpu = cpu; }
+int processing_cpu() { return processing_thread_cpu; }
+void set_lock_memory(bool which) { lock_process_memory = which; }
+bool lock_memory() { return lock_process_memory; }
+void set_use_rtc(bool which) { rtc_pacing = which; }
+bool use_rtc() { return rtc_pacing; }
+void set_image_port(int port) { image_port_num = port; }
+int image_port() { return image_port_num; }
+void set_image_keyframe_interval(unsigned int cycles) { image_keyframe_cycles = cycles; }
+unsigned int image_keyframe_interval() { return image_keyframe_cycles; }
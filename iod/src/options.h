@@ -70,6 +70,37 @@ void set_cycle_time(unsigned long ct);
 bool export_to_c();
 void set_export_to_c(bool c_export);
 
+/* name of the shared memory state table, null if it is not published */
+void set_state_table(const char *name);
+const char *state_table();
+void set_simulator_config(const char *name);
+const char *simulator_config();
+void set_metrics_file(const char *name);
+const char *metrics_file();
+
+/* realtime settings; a priority of 0 and a cpu of -1 leave a thread's settings alone */
+void set_ecat_priority(int priority);
+int ecat_priority();
+void set_ecat_cpu(int cpu);
+int ecat_cpu();
+void set_processing_priority(int priority);
+int processing_priority();
+void set_processing_cpu(int cpu);
+int processing_cpu();
+void set_lock_memory(bool which);
+bool lock_memory();
+/* pace the EtherCAT thread from /dev/rtc instead of the monotonic clock, where supported */
+void set_use_rtc(bool which);
+bool use_rtc();
+/* stream the process image to remote monitors; a port of 0 disables the stream */
+void set_image_port(int port);
+int image_port();
+void set_image_keyframe_interval(unsigned int cycles);
+unsigned int image_keyframe_interval();
+/* record the processing thread's inputs for replay with cw-bench --replay */
+void set_io_trace(const char *name);
+const char *io_trace();
+
     
 #ifdef __cplusplus
 }
@@ -164,6 +164,24 @@ bool loadActiveData(PersistentStore &store, const char *initial_settings)
 }
 
 
+// a PERSIST batch from iod holds the sequence number, the number of changes and
+// (machine, property, value) for each change
+static bool applyBatch(PersistentStore &store, const std::list<Value> &params, long &seq) {
+    if (params.size() < 2) return false;
+    std::list<Value>::const_iterator iter = params.begin();
+    long count = 0;
+    if (!(*iter++).asInteger(seq) || !(*iter++).asInteger(count) || count < 0
+            || params.size() != 2 + 3 * (size_t)count)
+        return false;
+    while (iter != params.end()) {
+        const Value &machine_name = *iter++;
+        const Value &property_name = *iter++;
+        const Value &value = *iter++;
+        store.insert(machine_name.asString(), property_name.asString(), value);
+    }
+    return true;
+}
+
 void CollectPersistentStatus(PersistentStore &store) {
     std::string initial_settings;
 	int tries = 3;
@@ -230,6 +248,7 @@ int main(int argc, const char * argv[]) {
 
     bool verbose = false;
     if (vm.count("verbose")) verbose = true;
+    long last_batch = 0;
     
     setup_signals();
 
@@ -264,18 +283,17 @@ int main(int argc, const char * argv[]) {
             if (errno == EINTR || errno == EAGAIN) continue;
         }
         if ( !(items[1].revents & ZMQ_POLLIN) ) continue;
-        //zmq::message_t update;
-        char data[1000];
-        size_t len = 0;
+        zmq::message_t update;
         try {
-            len = subscription_manager.subscriber().recv(data, 1000, ZMQ_DONTWAIT);
-            if (!len) continue;
+            if (!subscription_manager.subscriber().recv(&update, ZMQ_DONTWAIT)) continue;
         }
         catch (zmq::error_t e) {
-            if (errno == EINTR) continue;
-            
+            continue;
         }
-        data[len] = 0;
+        // messages from the channel's publisher are preceded by a header
+        if (update.more() && update.size() == sizeof(MessageHeader)) continue;
+        std::string text(static_cast<const char *>(update.data()), update.size());
+        const char *data = text.c_str();
 
         if (verbose) std::cout << data << "\n";
 
@@ -283,7 +301,21 @@ int main(int argc, const char * argv[]) {
             std::string cmd;
             std::list<Value> *param_list = 0;
             if (MessageEncoding::getCommand(data, cmd, &param_list)) {
-                if (cmd == "PROPERTY" && param_list && param_list->size() == 3) {
+                long seq = 0;
+                if (cmd == "PERSIST" && param_list && applyBatch(store, *param_list, seq)) {
+                    if (last_batch && seq != last_batch + 1 && seq != 1) {
+                        std::cerr << "missed persistence batches " << last_batch + 1 << " to " << seq - 1
+                            << ", reloading\n";
+                        need_refresh = true;
+                    }
+                    last_batch = seq;
+                    store.save();
+                    char ack[40];
+                    snprintf(ack, 40, "PERSISTENT ACK %ld", seq);
+                    std::string response;
+                    if (cmd_socket) sendMessage(ack, *cmd_socket, response);
+                }
+                else if (cmd == "PROPERTY" && param_list && param_list->size() == 3) {
                     std::string property;
                     std::list<Value>::const_iterator iter = param_list->begin();
                     Value machine_name = *iter++;
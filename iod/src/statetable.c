@@ -0,0 +1,193 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include "statetable.h"
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sched.h>
+#include <signal.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* readers give up after this many attempts to get a consistent copy */
+#define MAX_READ_ATTEMPTS 10000
+/* and wait at most this many yields for a writer to finish an update */
+#define MAX_WAIT_YIELDS 100000
+
+struct cw_state_table {
+	int fd;
+	size_t size;
+	uint32_t layout;
+	struct cw_state_header *header;
+	struct cw_state_entry *entries;
+};
+
+size_t cw_state_segment_size(unsigned int max_entries) {
+	return sizeof(struct cw_state_header) + max_entries * sizeof(struct cw_state_entry);
+}
+
+/* wait for the writer to finish an update. Gives up if the writer has
+   died mid-update or if the update does not finish within MAX_WAIT_YIELDS */
+static int read_begin(struct cw_state_table *table, uint32_t *seq) {
+	int spins = 0;
+	int yields = 0;
+	while ( (*seq = table->header->sequence) & 1) {
+		if (++spins > 100) {
+			pid_t writer = (pid_t)table->header->writer_pid;
+			if (writer && kill(writer, 0) == -1 && errno == ESRCH) return -1;
+			if (++yields > MAX_WAIT_YIELDS) return -1;
+			sched_yield();
+			spins = 0;
+		}
+	}
+	__sync_synchronize();
+	return 0;
+}
+
+static int read_retry(struct cw_state_table *table, uint32_t seq) {
+	__sync_synchronize();
+	return table->header->sequence != seq;
+}
+
+struct cw_state_table *cw_state_open(const char *name) {
+	struct stat st;
+	struct cw_state_table *table;
+	void *mem;
+	int fd = shm_open( (name) ? name : CW_STATE_DEFAULT_NAME, O_RDONLY, 0);
+	if (fd == -1) return 0;
+	if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(struct cw_state_header)) {
+		close(fd);
+		return 0;
+	}
+	mem = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (mem == MAP_FAILED) {
+		close(fd);
+		return 0;
+	}
+	table = (struct cw_state_table *)malloc(sizeof(struct cw_state_table));
+	table->fd = fd;
+	table->size = st.st_size;
+	table->header = (struct cw_state_header *)mem;
+	table->entries = (struct cw_state_entry *)((char*)mem + sizeof(struct cw_state_header));
+	if (table->header->magic != CW_STATE_MAGIC || table->header->version != CW_STATE_VERSION
+			|| table->header->entry_size != sizeof(struct cw_state_entry)
+			|| cw_state_segment_size(table->header->max_entries) > table->size) {
+		cw_state_close(table);
+		return 0;
+	}
+	table->layout = table->header->layout;
+	return table;
+}
+
+void cw_state_close(struct cw_state_table *table) {
+	if (!table) return;
+	munmap(table->header, table->size);
+	close(table->fd);
+	free(table);
+}
+
+int cw_state_stale(struct cw_state_table *table) {
+	return table->header->magic != CW_STATE_MAGIC || table->header->layout != table->layout;
+}
+
+int cw_state_header(struct cw_state_table *table, struct cw_state_header *hdr) {
+	int attempts = 0;
+	uint32_t seq;
+	do {
+		if (++attempts > MAX_READ_ATTEMPTS) return -1;
+		if (read_begin(table, &seq) != 0) return -1;
+		memcpy(hdr, (const void *)table->header, sizeof(struct cw_state_header));
+	} while (read_retry(table, seq));
+	return 0;
+}
+
+int cw_state_snapshot(struct cw_state_table *table, struct cw_state_entry *buf, unsigned int max, uint64_t *cycle) {
+	int attempts = 0;
+	uint32_t seq;
+	unsigned int n;
+	do {
+		if (++attempts > MAX_READ_ATTEMPTS) return -1;
+		if (read_begin(table, &seq) != 0) return -1;
+		n = table->header->num_entries;
+		if (n > table->header->max_entries) continue; /* torn read, try again */
+		if (n > max) n = max;
+		memcpy(buf, table->entries, n * sizeof(struct cw_state_entry));
+		if (cycle) *cycle = table->header->cycle;
+	} while (read_retry(table, seq));
+	return n;
+}
+
+int cw_state_find(struct cw_state_table *table, const char *machine, const char *property) {
+	int attempts = 0;
+	uint32_t seq;
+	unsigned int i, n;
+	int found;
+	if (!property) property = "STATE";
+	do {
+		if (++attempts > MAX_READ_ATTEMPTS) return -1;
+		found = -1;
+		if (read_begin(table, &seq) != 0) return -1;
+		n = table->header->num_entries;
+		if (n > table->header->max_entries) continue;
+		for (i = 0; i < n; ++i) {
+			struct cw_state_entry *e = table->entries + i;
+			if (strncmp(e->machine, machine, CW_STATE_NAME_LEN) == 0
+					&& strncmp(e->property, property, CW_STATE_PROPERTY_LEN) == 0) {
+				found = i;
+				break;
+			}
+		}
+	} while (read_retry(table, seq));
+	return found;
+}
+
+int cw_state_read(struct cw_state_table *table, int index, struct cw_state_entry *entry) {
+	int attempts = 0;
+	uint32_t seq;
+	int ok;
+	if (index < 0) return -1;
+	do {
+		if (++attempts > MAX_READ_ATTEMPTS) return -1;
+		if (read_begin(table, &seq) != 0) return -1;
+		ok = (unsigned int)index < table->header->num_entries && (unsigned int)index < table->header->max_entries;
+		if (ok) memcpy(entry, table->entries + index, sizeof(struct cw_state_entry));
+	} while (read_retry(table, seq));
+	if (!ok) return -1;
+	entry->machine[CW_STATE_NAME_LEN-1] = 0;
+	entry->property[CW_STATE_PROPERTY_LEN-1] = 0;
+	entry->value[CW_STATE_VALUE_LEN-1] = 0;
+	return 0;
+}
+
+int cw_state_value(struct cw_state_table *table, const char *machine, const char *property, char *buf, size_t len) {
+	struct cw_state_entry entry;
+	int idx = cw_state_find(table, machine, property);
+	if (idx == -1 || len == 0) return -1;
+	if (cw_state_read(table, idx, &entry) != 0) return -1;
+	/* the entry may have moved if the layout changed between find and read */
+	if (strcmp(entry.machine, machine) != 0 || strcmp(entry.property, (property) ? property : "STATE") != 0)
+		return -1;
+	strncpy(buf, entry.value, len);
+	buf[len-1] = 0;
+	return 0;
+}
@@ -0,0 +1,108 @@
+/*
+  Copyright (C) 2016 Martin Leadbeater, Michael O'Connor
+
+  This file is part of Latproc
+
+  Latproc is free software; you can redistribute it and/or
+  modify it under the terms of the GNU General Public License
+  as published by the Free Software Foundation; either version 2
+  of the License, or (at your option) any later version.
+  
+  Latproc is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Latproc; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __STATETABLE_H__
+#define __STATETABLE_H__
+
+/*
+	Shared memory table of machine states and exported properties.
+
+	The table is written by clockwork at the end of each processing cycle
+	and may be read by any number of local processes without contacting
+	the driver. Writers bump 'sequence' to an odd number before changing
+	the table and to the next even number afterwards; readers copy what
+	they need and retry if the sequence was odd or changed while copying.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stddef.h>
+
+#define CW_STATE_MAGIC 0x43575354 /* 'CWST' */
+#define CW_STATE_VERSION 1
+#define CW_STATE_DEFAULT_NAME "/clockwork_state"
+
+#define CW_STATE_NAME_LEN 80
+#define CW_STATE_PROPERTY_LEN 40
+#define CW_STATE_VALUE_LEN 64
+
+enum cw_state_kind { cw_state_none, cw_state_state, cw_state_integer, cw_state_float, cw_state_string };
+
+struct cw_state_entry {
+	char machine[CW_STATE_NAME_LEN];
+	char property[CW_STATE_PROPERTY_LEN]; /* "STATE" for the machine state */
+	char value[CW_STATE_VALUE_LEN]; /* always a printable, nul terminated string */
+	int32_t kind; /* enum cw_state_kind */
+	int32_t padding;
+	int64_t ival;
+	double fval;
+	uint64_t changed; /* cycle number when this entry last changed */
+};
+
+struct cw_state_header {
+	uint32_t magic;
+	uint32_t version;
+	volatile uint32_t sequence; /* seqlock, odd while the writer is active */
+	uint32_t layout; /* incremented whenever entries are added or removed */
+	uint32_t max_entries;
+	uint32_t num_entries;
+	uint32_t entry_size;
+	uint32_t writer_pid;
+	uint64_t cycle; /* processing cycle of the last publish */
+	uint64_t update_time; /* microseconds since the epoch of the last publish */
+};
+
+struct cw_state_table;
+
+/* the size of a segment that can hold the given number of entries */
+size_t cw_state_segment_size(unsigned int max_entries);
+
+/* open an existing table for reading, name may be null to use the default */
+struct cw_state_table *cw_state_open(const char *name);
+void cw_state_close(struct cw_state_table *table);
+
+/* returns nonzero if the writer has resized or restarted the table since it was opened;
+	the caller should close and reopen it */
+int cw_state_stale(struct cw_state_table *table);
+
+/* copy a consistent header into *hdr, returns 0 on success */
+int cw_state_header(struct cw_state_table *table, struct cw_state_header *hdr);
+
+/* copy up to max consistent entries into buf, returns the number copied or -1 */
+int cw_state_snapshot(struct cw_state_table *table, struct cw_state_entry *buf, unsigned int max, uint64_t *cycle);
+
+/* find the index of an entry, property may be null for "STATE"; returns -1 if not found.
+	Indexes remain valid until the table layout changes. */
+int cw_state_find(struct cw_state_table *table, const char *machine, const char *property);
+
+/* copy a single entry consistently, returns 0 on success */
+int cw_state_read(struct cw_state_table *table, int index, struct cw_state_entry *entry);
+
+/* copy the value string of a single entry into buf, returns 0 on success */
+int cw_state_value(struct cw_state_table *table, const char *machine, const char *property, char *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
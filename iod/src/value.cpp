@@ -471,6 +471,38 @@ bool Value::operator!=(const Value &other) const {
     return false;
 }
 
+/* Values of different kinds may be equal (1 == "1") and floating point values
+	are equal within ZERO_DISTANCE so only values that compare exactly are given
+	a key; integers and strings that are integers share a key. Values with the same
+	key are not necessarily equal.
+*/
+bool Value::hashKey(std::string &key) const {
+	long x;
+	char buf[24];
+	switch (kind) {
+		case t_empty: key = "e"; return true;
+		case t_bool: key = (bValue) ? "b1" : "b0"; return true;
+		case t_integer:
+			snprintf(buf, 24, "n%ld", iValue);
+			key = buf;
+			return true;
+		case t_string:
+		case t_symbol:
+			if (asInteger(x)) {
+				snprintf(buf, 24, "n%ld", x);
+				key = buf;
+			}
+			else {
+				key = "s";
+				key += sValue;
+			}
+			return true;
+		default:
+			break;
+	}
+	return false;
+}
+
 bool Value::operator&&(const Value &other) const {
     switch (kind) {
         case t_empty: return false;
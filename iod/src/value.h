@@ -100,6 +100,8 @@ public:
 	bool operator>(const Value &other) const { return !operator<=(other); }
     bool operator==(const Value &other) const;
     bool operator!=(const Value &other) const;
+	// a key that is the same for any two equal values, false if there is none
+	bool hashKey(std::string &key) const;
     bool operator&&(const Value &other) const;
     bool operator||(const Value &other) const;
 	bool operator!() const;
@@ -29,9 +29,48 @@
 #include <inttypes.h>
 #include <time.h>
 #include <sys/time.h>
+#include <vector>
+#include "ProcessImageStream.h"
 
 namespace po = boost::program_options;
 
+uint64_t microsecs();
+
+// follows the process image stream of an iod started with --image_port
+static int monitorImage(const std::string &host, int port, bool verbose) {
+	zmq::context_t context(1);
+	ProcessImageSubscriber subscriber(context, host, port);
+	std::vector<uint8_t> last;
+	uint64_t next_report = microsecs() + 1000000;
+	uint64_t last_bytes = 0, last_frames = 0;
+	for (;;) {
+		if (subscriber.next(100)) {
+			const std::vector<uint8_t> &image(subscriber.image());
+			if (verbose && last.size() == image.size()) {
+				std::cout << subscriber.decoder().seq() << " " << subscriber.decoder().cycleTime() << ":";
+				for (size_t i = 0; i < image.size(); ++i)
+					if (image[i] != last[i]) std::cout << " " << i << "=" << (unsigned int)image[i];
+				std::cout << "\n";
+			}
+			last = image;
+		}
+		uint64_t now = microsecs();
+		if (now < next_report) continue;
+		next_report = now + 1000000;
+		const ProcessImageDecoder &decoder(subscriber.decoder());
+		uint64_t frames = decoder.frames - last_frames;
+		uint64_t bytes = subscriber.bytesReceived() - last_bytes;
+		last_frames = decoder.frames;
+		last_bytes = subscriber.bytesReceived();
+		std::cout << "frames/s: " << frames << " bytes/s: " << bytes;
+		if (bytes) std::cout << " compression: " << (double)(frames * last.size()) / bytes << ":1";
+		std::cout << " image: " << last.size() << " keyframes: " << decoder.keyframes
+			<< " missed: " << decoder.missed << " resyncs: " << decoder.resyncs
+			<< (decoder.synchronised() ? "" : " (waiting for a keyframe)") << "\n";
+	}
+	return 0;
+}
+
 int main(int argc, const char * argv[])
 {
     try {
@@ -51,7 +90,18 @@ int main(int argc, const char * argv[])
         }
         if (vm.count("server")) {
 #endif
-		if (argc > 1 && strcmp(argv[1],"--server") == 0) {
+		if (argc > 1 && strcmp(argv[1],"--image") == 0) {
+			std::string host("localhost");
+			int port = 5560;
+			bool verbose = false;
+			for (int i = 2; i < argc; ++i) {
+				if (strcmp(argv[i], "-h") == 0 && i < argc-1) host = argv[++i];
+				else if (strcmp(argv[i], "-p") == 0 && i < argc-1) port = strtol(argv[++i], 0, 10);
+				else if (strcmp(argv[i], "-v") == 0) verbose = true;
+			}
+			return monitorImage(host, port, verbose);
+		}
+		else if (argc > 1 && strcmp(argv[1],"--server") == 0) {
 	        //server
 	        int count = 0;
 	        zmq::context_t context (1);
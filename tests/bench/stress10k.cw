@@ -0,0 +1,10313 @@
+# generated by cw-bench --generate 10000 stress10k
+# 1000 input chains of 9 followers and 100 watched groups, 10200 machines
+
+Follow MACHINE source {
+	on WHEN source IS on;
+	off DEFAULT;
+}
+
+Watch MACHINE group {
+	busy WHEN COUNT on FROM group >= 5;
+	idle DEFAULT;
+}
+
+in00000 FLAG;
+f00000_1 Follow in00000;
+f00000_2 Follow f00000_1;
+f00000_3 Follow f00000_2;
+f00000_4 Follow f00000_3;
+f00000_5 Follow f00000_4;
+f00000_6 Follow f00000_5;
+f00000_7 Follow f00000_6;
+f00000_8 Follow f00000_7;
+f00000_9 Follow f00000_8;
+in00001 FLAG;
+f00001_1 Follow in00001;
+f00001_2 Follow f00001_1;
+f00001_3 Follow f00001_2;
+f00001_4 Follow f00001_3;
+f00001_5 Follow f00001_4;
+f00001_6 Follow f00001_5;
+f00001_7 Follow f00001_6;
+f00001_8 Follow f00001_7;
+f00001_9 Follow f00001_8;
+in00002 FLAG;
+f00002_1 Follow in00002;
+f00002_2 Follow f00002_1;
+f00002_3 Follow f00002_2;
+f00002_4 Follow f00002_3;
+f00002_5 Follow f00002_4;
+f00002_6 Follow f00002_5;
+f00002_7 Follow f00002_6;
+f00002_8 Follow f00002_7;
+f00002_9 Follow f00002_8;
+in00003 FLAG;
+f00003_1 Follow in00003;
+f00003_2 Follow f00003_1;
+f00003_3 Follow f00003_2;
+f00003_4 Follow f00003_3;
+f00003_5 Follow f00003_4;
+f00003_6 Follow f00003_5;
+f00003_7 Follow f00003_6;
+f00003_8 Follow f00003_7;
+f00003_9 Follow f00003_8;
+in00004 FLAG;
+f00004_1 Follow in00004;
+f00004_2 Follow f00004_1;
+f00004_3 Follow f00004_2;
+f00004_4 Follow f00004_3;
+f00004_5 Follow f00004_4;
+f00004_6 Follow f00004_5;
+f00004_7 Follow f00004_6;
+f00004_8 Follow f00004_7;
+f00004_9 Follow f00004_8;
+in00005 FLAG;
+f00005_1 Follow in00005;
+f00005_2 Follow f00005_1;
+f00005_3 Follow f00005_2;
+f00005_4 Follow f00005_3;
+f00005_5 Follow f00005_4;
+f00005_6 Follow f00005_5;
+f00005_7 Follow f00005_6;
+f00005_8 Follow f00005_7;
+f00005_9 Follow f00005_8;
+in00006 FLAG;
+f00006_1 Follow in00006;
+f00006_2 Follow f00006_1;
+f00006_3 Follow f00006_2;
+f00006_4 Follow f00006_3;
+f00006_5 Follow f00006_4;
+f00006_6 Follow f00006_5;
+f00006_7 Follow f00006_6;
+f00006_8 Follow f00006_7;
+f00006_9 Follow f00006_8;
+in00007 FLAG;
+f00007_1 Follow in00007;
+f00007_2 Follow f00007_1;
+f00007_3 Follow f00007_2;
+f00007_4 Follow f00007_3;
+f00007_5 Follow f00007_4;
+f00007_6 Follow f00007_5;
+f00007_7 Follow f00007_6;
+f00007_8 Follow f00007_7;
+f00007_9 Follow f00007_8;
+in00008 FLAG;
+f00008_1 Follow in00008;
+f00008_2 Follow f00008_1;
+f00008_3 Follow f00008_2;
+f00008_4 Follow f00008_3;
+f00008_5 Follow f00008_4;
+f00008_6 Follow f00008_5;
+f00008_7 Follow f00008_6;
+f00008_8 Follow f00008_7;
+f00008_9 Follow f00008_8;
+in00009 FLAG;
+f00009_1 Follow in00009;
+f00009_2 Follow f00009_1;
+f00009_3 Follow f00009_2;
+f00009_4 Follow f00009_3;
+f00009_5 Follow f00009_4;
+f00009_6 Follow f00009_5;
+f00009_7 Follow f00009_6;
+f00009_8 Follow f00009_7;
+f00009_9 Follow f00009_8;
+in00010 FLAG;
+f00010_1 Follow in00010;
+f00010_2 Follow f00010_1;
+f00010_3 Follow f00010_2;
+f00010_4 Follow f00010_3;
+f00010_5 Follow f00010_4;
+f00010_6 Follow f00010_5;
+f00010_7 Follow f00010_6;
+f00010_8 Follow f00010_7;
+f00010_9 Follow f00010_8;
+in00011 FLAG;
+f00011_1 Follow in00011;
+f00011_2 Follow f00011_1;
+f00011_3 Follow f00011_2;
+f00011_4 Follow f00011_3;
+f00011_5 Follow f00011_4;
+f00011_6 Follow f00011_5;
+f00011_7 Follow f00011_6;
+f00011_8 Follow f00011_7;
+f00011_9 Follow f00011_8;
+in00012 FLAG;
+f00012_1 Follow in00012;
+f00012_2 Follow f00012_1;
+f00012_3 Follow f00012_2;
+f00012_4 Follow f00012_3;
+f00012_5 Follow f00012_4;
+f00012_6 Follow f00012_5;
+f00012_7 Follow f00012_6;
+f00012_8 Follow f00012_7;
+f00012_9 Follow f00012_8;
+in00013 FLAG;
+f00013_1 Follow in00013;
+f00013_2 Follow f00013_1;
+f00013_3 Follow f00013_2;
+f00013_4 Follow f00013_3;
+f00013_5 Follow f00013_4;
+f00013_6 Follow f00013_5;
+f00013_7 Follow f00013_6;
+f00013_8 Follow f00013_7;
+f00013_9 Follow f00013_8;
+in00014 FLAG;
+f00014_1 Follow in00014;
+f00014_2 Follow f00014_1;
+f00014_3 Follow f00014_2;
+f00014_4 Follow f00014_3;
+f00014_5 Follow f00014_4;
+f00014_6 Follow f00014_5;
+f00014_7 Follow f00014_6;
+f00014_8 Follow f00014_7;
+f00014_9 Follow f00014_8;
+in00015 FLAG;
+f00015_1 Follow in00015;
+f00015_2 Follow f00015_1;
+f00015_3 Follow f00015_2;
+f00015_4 Follow f00015_3;
+f00015_5 Follow f00015_4;
+f00015_6 Follow f00015_5;
+f00015_7 Follow f00015_6;
+f00015_8 Follow f00015_7;
+f00015_9 Follow f00015_8;
+in00016 FLAG;
+f00016_1 Follow in00016;
+f00016_2 Follow f00016_1;
+f00016_3 Follow f00016_2;
+f00016_4 Follow f00016_3;
+f00016_5 Follow f00016_4;
+f00016_6 Follow f00016_5;
+f00016_7 Follow f00016_6;
+f00016_8 Follow f00016_7;
+f00016_9 Follow f00016_8;
+in00017 FLAG;
+f00017_1 Follow in00017;
+f00017_2 Follow f00017_1;
+f00017_3 Follow f00017_2;
+f00017_4 Follow f00017_3;
+f00017_5 Follow f00017_4;
+f00017_6 Follow f00017_5;
+f00017_7 Follow f00017_6;
+f00017_8 Follow f00017_7;
+f00017_9 Follow f00017_8;
+in00018 FLAG;
+f00018_1 Follow in00018;
+f00018_2 Follow f00018_1;
+f00018_3 Follow f00018_2;
+f00018_4 Follow f00018_3;
+f00018_5 Follow f00018_4;
+f00018_6 Follow f00018_5;
+f00018_7 Follow f00018_6;
+f00018_8 Follow f00018_7;
+f00018_9 Follow f00018_8;
+in00019 FLAG;
+f00019_1 Follow in00019;
+f00019_2 Follow f00019_1;
+f00019_3 Follow f00019_2;
+f00019_4 Follow f00019_3;
+f00019_5 Follow f00019_4;
+f00019_6 Follow f00019_5;
+f00019_7 Follow f00019_6;
+f00019_8 Follow f00019_7;
+f00019_9 Follow f00019_8;
+in00020 FLAG;
+f00020_1 Follow in00020;
+f00020_2 Follow f00020_1;
+f00020_3 Follow f00020_2;
+f00020_4 Follow f00020_3;
+f00020_5 Follow f00020_4;
+f00020_6 Follow f00020_5;
+f00020_7 Follow f00020_6;
+f00020_8 Follow f00020_7;
+f00020_9 Follow f00020_8;
+in00021 FLAG;
+f00021_1 Follow in00021;
+f00021_2 Follow f00021_1;
+f00021_3 Follow f00021_2;
+f00021_4 Follow f00021_3;
+f00021_5 Follow f00021_4;
+f00021_6 Follow f00021_5;
+f00021_7 Follow f00021_6;
+f00021_8 Follow f00021_7;
+f00021_9 Follow f00021_8;
+in00022 FLAG;
+f00022_1 Follow in00022;
+f00022_2 Follow f00022_1;
+f00022_3 Follow f00022_2;
+f00022_4 Follow f00022_3;
+f00022_5 Follow f00022_4;
+f00022_6 Follow f00022_5;
+f00022_7 Follow f00022_6;
+f00022_8 Follow f00022_7;
+f00022_9 Follow f00022_8;
+in00023 FLAG;
+f00023_1 Follow in00023;
+f00023_2 Follow f00023_1;
+f00023_3 Follow f00023_2;
+f00023_4 Follow f00023_3;
+f00023_5 Follow f00023_4;
+f00023_6 Follow f00023_5;
+f00023_7 Follow f00023_6;
+f00023_8 Follow f00023_7;
+f00023_9 Follow f00023_8;
+in00024 FLAG;
+f00024_1 Follow in00024;
+f00024_2 Follow f00024_1;
+f00024_3 Follow f00024_2;
+f00024_4 Follow f00024_3;
+f00024_5 Follow f00024_4;
+f00024_6 Follow f00024_5;
+f00024_7 Follow f00024_6;
+f00024_8 Follow f00024_7;
+f00024_9 Follow f00024_8;
+in00025 FLAG;
+f00025_1 Follow in00025;
+f00025_2 Follow f00025_1;
+f00025_3 Follow f00025_2;
+f00025_4 Follow f00025_3;
+f00025_5 Follow f00025_4;
+f00025_6 Follow f00025_5;
+f00025_7 Follow f00025_6;
+f00025_8 Follow f00025_7;
+f00025_9 Follow f00025_8;
+in00026 FLAG;
+f00026_1 Follow in00026;
+f00026_2 Follow f00026_1;
+f00026_3 Follow f00026_2;
+f00026_4 Follow f00026_3;
+f00026_5 Follow f00026_4;
+f00026_6 Follow f00026_5;
+f00026_7 Follow f00026_6;
+f00026_8 Follow f00026_7;
+f00026_9 Follow f00026_8;
+in00027 FLAG;
+f00027_1 Follow in00027;
+f00027_2 Follow f00027_1;
+f00027_3 Follow f00027_2;
+f00027_4 Follow f00027_3;
+f00027_5 Follow f00027_4;
+f00027_6 Follow f00027_5;
+f00027_7 Follow f00027_6;
+f00027_8 Follow f00027_7;
+f00027_9 Follow f00027_8;
+in00028 FLAG;
+f00028_1 Follow in00028;
+f00028_2 Follow f00028_1;
+f00028_3 Follow f00028_2;
+f00028_4 Follow f00028_3;
+f00028_5 Follow f00028_4;
+f00028_6 Follow f00028_5;
+f00028_7 Follow f00028_6;
+f00028_8 Follow f00028_7;
+f00028_9 Follow f00028_8;
+in00029 FLAG;
+f00029_1 Follow in00029;
+f00029_2 Follow f00029_1;
+f00029_3 Follow f00029_2;
+f00029_4 Follow f00029_3;
+f00029_5 Follow f00029_4;
+f00029_6 Follow f00029_5;
+f00029_7 Follow f00029_6;
+f00029_8 Follow f00029_7;
+f00029_9 Follow f00029_8;
+in00030 FLAG;
+f00030_1 Follow in00030;
+f00030_2 Follow f00030_1;
+f00030_3 Follow f00030_2;
+f00030_4 Follow f00030_3;
+f00030_5 Follow f00030_4;
+f00030_6 Follow f00030_5;
+f00030_7 Follow f00030_6;
+f00030_8 Follow f00030_7;
+f00030_9 Follow f00030_8;
+in00031 FLAG;
+f00031_1 Follow in00031;
+f00031_2 Follow f00031_1;
+f00031_3 Follow f00031_2;
+f00031_4 Follow f00031_3;
+f00031_5 Follow f00031_4;
+f00031_6 Follow f00031_5;
+f00031_7 Follow f00031_6;
+f00031_8 Follow f00031_7;
+f00031_9 Follow f00031_8;
+in00032 FLAG;
+f00032_1 Follow in00032;
+f00032_2 Follow f00032_1;
+f00032_3 Follow f00032_2;
+f00032_4 Follow f00032_3;
+f00032_5 Follow f00032_4;
+f00032_6 Follow f00032_5;
+f00032_7 Follow f00032_6;
+f00032_8 Follow f00032_7;
+f00032_9 Follow f00032_8;
+in00033 FLAG;
+f00033_1 Follow in00033;
+f00033_2 Follow f00033_1;
+f00033_3 Follow f00033_2;
+f00033_4 Follow f00033_3;
+f00033_5 Follow f00033_4;
+f00033_6 Follow f00033_5;
+f00033_7 Follow f00033_6;
+f00033_8 Follow f00033_7;
+f00033_9 Follow f00033_8;
+in00034 FLAG;
+f00034_1 Follow in00034;
+f00034_2 Follow f00034_1;
+f00034_3 Follow f00034_2;
+f00034_4 Follow f00034_3;
+f00034_5 Follow f00034_4;
+f00034_6 Follow f00034_5;
+f00034_7 Follow f00034_6;
+f00034_8 Follow f00034_7;
+f00034_9 Follow f00034_8;
+in00035 FLAG;
+f00035_1 Follow in00035;
+f00035_2 Follow f00035_1;
+f00035_3 Follow f00035_2;
+f00035_4 Follow f00035_3;
+f00035_5 Follow f00035_4;
+f00035_6 Follow f00035_5;
+f00035_7 Follow f00035_6;
+f00035_8 Follow f00035_7;
+f00035_9 Follow f00035_8;
+in00036 FLAG;
+f00036_1 Follow in00036;
+f00036_2 Follow f00036_1;
+f00036_3 Follow f00036_2;
+f00036_4 Follow f00036_3;
+f00036_5 Follow f00036_4;
+f00036_6 Follow f00036_5;
+f00036_7 Follow f00036_6;
+f00036_8 Follow f00036_7;
+f00036_9 Follow f00036_8;
+in00037 FLAG;
+f00037_1 Follow in00037;
+f00037_2 Follow f00037_1;
+f00037_3 Follow f00037_2;
+f00037_4 Follow f00037_3;
+f00037_5 Follow f00037_4;
+f00037_6 Follow f00037_5;
+f00037_7 Follow f00037_6;
+f00037_8 Follow f00037_7;
+f00037_9 Follow f00037_8;
+in00038 FLAG;
+f00038_1 Follow in00038;
+f00038_2 Follow f00038_1;
+f00038_3 Follow f00038_2;
+f00038_4 Follow f00038_3;
+f00038_5 Follow f00038_4;
+f00038_6 Follow f00038_5;
+f00038_7 Follow f00038_6;
+f00038_8 Follow f00038_7;
+f00038_9 Follow f00038_8;
+in00039 FLAG;
+f00039_1 Follow in00039;
+f00039_2 Follow f00039_1;
+f00039_3 Follow f00039_2;
+f00039_4 Follow f00039_3;
+f00039_5 Follow f00039_4;
+f00039_6 Follow f00039_5;
+f00039_7 Follow f00039_6;
+f00039_8 Follow f00039_7;
+f00039_9 Follow f00039_8;
+in00040 FLAG;
+f00040_1 Follow in00040;
+f00040_2 Follow f00040_1;
+f00040_3 Follow f00040_2;
+f00040_4 Follow f00040_3;
+f00040_5 Follow f00040_4;
+f00040_6 Follow f00040_5;
+f00040_7 Follow f00040_6;
+f00040_8 Follow f00040_7;
+f00040_9 Follow f00040_8;
+in00041 FLAG;
+f00041_1 Follow in00041;
+f00041_2 Follow f00041_1;
+f00041_3 Follow f00041_2;
+f00041_4 Follow f00041_3;
+f00041_5 Follow f00041_4;
+f00041_6 Follow f00041_5;
+f00041_7 Follow f00041_6;
+f00041_8 Follow f00041_7;
+f00041_9 Follow f00041_8;
+in00042 FLAG;
+f00042_1 Follow in00042;
+f00042_2 Follow f00042_1;
+f00042_3 Follow f00042_2;
+f00042_4 Follow f00042_3;
+f00042_5 Follow f00042_4;
+f00042_6 Follow f00042_5;
+f00042_7 Follow f00042_6;
+f00042_8 Follow f00042_7;
+f00042_9 Follow f00042_8;
+in00043 FLAG;
+f00043_1 Follow in00043;
+f00043_2 Follow f00043_1;
+f00043_3 Follow f00043_2;
+f00043_4 Follow f00043_3;
+f00043_5 Follow f00043_4;
+f00043_6 Follow f00043_5;
+f00043_7 Follow f00043_6;
+f00043_8 Follow f00043_7;
+f00043_9 Follow f00043_8;
+in00044 FLAG;
+f00044_1 Follow in00044;
+f00044_2 Follow f00044_1;
+f00044_3 Follow f00044_2;
+f00044_4 Follow f00044_3;
+f00044_5 Follow f00044_4;
+f00044_6 Follow f00044_5;
+f00044_7 Follow f00044_6;
+f00044_8 Follow f00044_7;
+f00044_9 Follow f00044_8;
+in00045 FLAG;
+f00045_1 Follow in00045;
+f00045_2 Follow f00045_1;
+f00045_3 Follow f00045_2;
+f00045_4 Follow f00045_3;
+f00045_5 Follow f00045_4;
+f00045_6 Follow f00045_5;
+f00045_7 Follow f00045_6;
+f00045_8 Follow f00045_7;
+f00045_9 Follow f00045_8;
+in00046 FLAG;
+f00046_1 Follow in00046;
+f00046_2 Follow f00046_1;
+f00046_3 Follow f00046_2;
+f00046_4 Follow f00046_3;
+f00046_5 Follow f00046_4;
+f00046_6 Follow f00046_5;
+f00046_7 Follow f00046_6;
+f00046_8 Follow f00046_7;
+f00046_9 Follow f00046_8;
+in00047 FLAG;
+f00047_1 Follow in00047;
+f00047_2 Follow f00047_1;
+f00047_3 Follow f00047_2;
+f00047_4 Follow f00047_3;
+f00047_5 Follow f00047_4;
+f00047_6 Follow f00047_5;
+f00047_7 Follow f00047_6;
+f00047_8 Follow f00047_7;
+f00047_9 Follow f00047_8;
+in00048 FLAG;
+f00048_1 Follow in00048;
+f00048_2 Follow f00048_1;
+f00048_3 Follow f00048_2;
+f00048_4 Follow f00048_3;
+f00048_5 Follow f00048_4;
+f00048_6 Follow f00048_5;
+f00048_7 Follow f00048_6;
+f00048_8 Follow f00048_7;
+f00048_9 Follow f00048_8;
+in00049 FLAG;
+f00049_1 Follow in00049;
+f00049_2 Follow f00049_1;
+f00049_3 Follow f00049_2;
+f00049_4 Follow f00049_3;
+f00049_5 Follow f00049_4;
+f00049_6 Follow f00049_5;
+f00049_7 Follow f00049_6;
+f00049_8 Follow f00049_7;
+f00049_9 Follow f00049_8;
+in00050 FLAG;
+f00050_1 Follow in00050;
+f00050_2 Follow f00050_1;
+f00050_3 Follow f00050_2;
+f00050_4 Follow f00050_3;
+f00050_5 Follow f00050_4;
+f00050_6 Follow f00050_5;
+f00050_7 Follow f00050_6;
+f00050_8 Follow f00050_7;
+f00050_9 Follow f00050_8;
+in00051 FLAG;
+f00051_1 Follow in00051;
+f00051_2 Follow f00051_1;
+f00051_3 Follow f00051_2;
+f00051_4 Follow f00051_3;
+f00051_5 Follow f00051_4;
+f00051_6 Follow f00051_5;
+f00051_7 Follow f00051_6;
+f00051_8 Follow f00051_7;
+f00051_9 Follow f00051_8;
+in00052 FLAG;
+f00052_1 Follow in00052;
+f00052_2 Follow f00052_1;
+f00052_3 Follow f00052_2;
+f00052_4 Follow f00052_3;
+f00052_5 Follow f00052_4;
+f00052_6 Follow f00052_5;
+f00052_7 Follow f00052_6;
+f00052_8 Follow f00052_7;
+f00052_9 Follow f00052_8;
+in00053 FLAG;
+f00053_1 Follow in00053;
+f00053_2 Follow f00053_1;
+f00053_3 Follow f00053_2;
+f00053_4 Follow f00053_3;
+f00053_5 Follow f00053_4;
+f00053_6 Follow f00053_5;
+f00053_7 Follow f00053_6;
+f00053_8 Follow f00053_7;
+f00053_9 Follow f00053_8;
+in00054 FLAG;
+f00054_1 Follow in00054;
+f00054_2 Follow f00054_1;
+f00054_3 Follow f00054_2;
+f00054_4 Follow f00054_3;
+f00054_5 Follow f00054_4;
+f00054_6 Follow f00054_5;
+f00054_7 Follow f00054_6;
+f00054_8 Follow f00054_7;
+f00054_9 Follow f00054_8;
+in00055 FLAG;
+f00055_1 Follow in00055;
+f00055_2 Follow f00055_1;
+f00055_3 Follow f00055_2;
+f00055_4 Follow f00055_3;
+f00055_5 Follow f00055_4;
+f00055_6 Follow f00055_5;
+f00055_7 Follow f00055_6;
+f00055_8 Follow f00055_7;
+f00055_9 Follow f00055_8;
+in00056 FLAG;
+f00056_1 Follow in00056;
+f00056_2 Follow f00056_1;
+f00056_3 Follow f00056_2;
+f00056_4 Follow f00056_3;
+f00056_5 Follow f00056_4;
+f00056_6 Follow f00056_5;
+f00056_7 Follow f00056_6;
+f00056_8 Follow f00056_7;
+f00056_9 Follow f00056_8;
+in00057 FLAG;
+f00057_1 Follow in00057;
+f00057_2 Follow f00057_1;
+f00057_3 Follow f00057_2;
+f00057_4 Follow f00057_3;
+f00057_5 Follow f00057_4;
+f00057_6 Follow f00057_5;
+f00057_7 Follow f00057_6;
+f00057_8 Follow f00057_7;
+f00057_9 Follow f00057_8;
+in00058 FLAG;
+f00058_1 Follow in00058;
+f00058_2 Follow f00058_1;
+f00058_3 Follow f00058_2;
+f00058_4 Follow f00058_3;
+f00058_5 Follow f00058_4;
+f00058_6 Follow f00058_5;
+f00058_7 Follow f00058_6;
+f00058_8 Follow f00058_7;
+f00058_9 Follow f00058_8;
+in00059 FLAG;
+f00059_1 Follow in00059;
+f00059_2 Follow f00059_1;
+f00059_3 Follow f00059_2;
+f00059_4 Follow f00059_3;
+f00059_5 Follow f00059_4;
+f00059_6 Follow f00059_5;
+f00059_7 Follow f00059_6;
+f00059_8 Follow f00059_7;
+f00059_9 Follow f00059_8;
+in00060 FLAG;
+f00060_1 Follow in00060;
+f00060_2 Follow f00060_1;
+f00060_3 Follow f00060_2;
+f00060_4 Follow f00060_3;
+f00060_5 Follow f00060_4;
+f00060_6 Follow f00060_5;
+f00060_7 Follow f00060_6;
+f00060_8 Follow f00060_7;
+f00060_9 Follow f00060_8;
+in00061 FLAG;
+f00061_1 Follow in00061;
+f00061_2 Follow f00061_1;
+f00061_3 Follow f00061_2;
+f00061_4 Follow f00061_3;
+f00061_5 Follow f00061_4;
+f00061_6 Follow f00061_5;
+f00061_7 Follow f00061_6;
+f00061_8 Follow f00061_7;
+f00061_9 Follow f00061_8;
+in00062 FLAG;
+f00062_1 Follow in00062;
+f00062_2 Follow f00062_1;
+f00062_3 Follow f00062_2;
+f00062_4 Follow f00062_3;
+f00062_5 Follow f00062_4;
+f00062_6 Follow f00062_5;
+f00062_7 Follow f00062_6;
+f00062_8 Follow f00062_7;
+f00062_9 Follow f00062_8;
+in00063 FLAG;
+f00063_1 Follow in00063;
+f00063_2 Follow f00063_1;
+f00063_3 Follow f00063_2;
+f00063_4 Follow f00063_3;
+f00063_5 Follow f00063_4;
+f00063_6 Follow f00063_5;
+f00063_7 Follow f00063_6;
+f00063_8 Follow f00063_7;
+f00063_9 Follow f00063_8;
+in00064 FLAG;
+f00064_1 Follow in00064;
+f00064_2 Follow f00064_1;
+f00064_3 Follow f00064_2;
+f00064_4 Follow f00064_3;
+f00064_5 Follow f00064_4;
+f00064_6 Follow f00064_5;
+f00064_7 Follow f00064_6;
+f00064_8 Follow f00064_7;
+f00064_9 Follow f00064_8;
+in00065 FLAG;
+f00065_1 Follow in00065;
+f00065_2 Follow f00065_1;
+f00065_3 Follow f00065_2;
+f00065_4 Follow f00065_3;
+f00065_5 Follow f00065_4;
+f00065_6 Follow f00065_5;
+f00065_7 Follow f00065_6;
+f00065_8 Follow f00065_7;
+f00065_9 Follow f00065_8;
+in00066 FLAG;
+f00066_1 Follow in00066;
+f00066_2 Follow f00066_1;
+f00066_3 Follow f00066_2;
+f00066_4 Follow f00066_3;
+f00066_5 Follow f00066_4;
+f00066_6 Follow f00066_5;
+f00066_7 Follow f00066_6;
+f00066_8 Follow f00066_7;
+f00066_9 Follow f00066_8;
+in00067 FLAG;
+f00067_1 Follow in00067;
+f00067_2 Follow f00067_1;
+f00067_3 Follow f00067_2;
+f00067_4 Follow f00067_3;
+f00067_5 Follow f00067_4;
+f00067_6 Follow f00067_5;
+f00067_7 Follow f00067_6;
+f00067_8 Follow f00067_7;
+f00067_9 Follow f00067_8;
+in00068 FLAG;
+f00068_1 Follow in00068;
+f00068_2 Follow f00068_1;
+f00068_3 Follow f00068_2;
+f00068_4 Follow f00068_3;
+f00068_5 Follow f00068_4;
+f00068_6 Follow f00068_5;
+f00068_7 Follow f00068_6;
+f00068_8 Follow f00068_7;
+f00068_9 Follow f00068_8;
+in00069 FLAG;
+f00069_1 Follow in00069;
+f00069_2 Follow f00069_1;
+f00069_3 Follow f00069_2;
+f00069_4 Follow f00069_3;
+f00069_5 Follow f00069_4;
+f00069_6 Follow f00069_5;
+f00069_7 Follow f00069_6;
+f00069_8 Follow f00069_7;
+f00069_9 Follow f00069_8;
+in00070 FLAG;
+f00070_1 Follow in00070;
+f00070_2 Follow f00070_1;
+f00070_3 Follow f00070_2;
+f00070_4 Follow f00070_3;
+f00070_5 Follow f00070_4;
+f00070_6 Follow f00070_5;
+f00070_7 Follow f00070_6;
+f00070_8 Follow f00070_7;
+f00070_9 Follow f00070_8;
+in00071 FLAG;
+f00071_1 Follow in00071;
+f00071_2 Follow f00071_1;
+f00071_3 Follow f00071_2;
+f00071_4 Follow f00071_3;
+f00071_5 Follow f00071_4;
+f00071_6 Follow f00071_5;
+f00071_7 Follow f00071_6;
+f00071_8 Follow f00071_7;
+f00071_9 Follow f00071_8;
+in00072 FLAG;
+f00072_1 Follow in00072;
+f00072_2 Follow f00072_1;
+f00072_3 Follow f00072_2;
+f00072_4 Follow f00072_3;
+f00072_5 Follow f00072_4;
+f00072_6 Follow f00072_5;
+f00072_7 Follow f00072_6;
+f00072_8 Follow f00072_7;
+f00072_9 Follow f00072_8;
+in00073 FLAG;
+f00073_1 Follow in00073;
+f00073_2 Follow f00073_1;
+f00073_3 Follow f00073_2;
+f00073_4 Follow f00073_3;
+f00073_5 Follow f00073_4;
+f00073_6 Follow f00073_5;
+f00073_7 Follow f00073_6;
+f00073_8 Follow f00073_7;
+f00073_9 Follow f00073_8;
+in00074 FLAG;
+f00074_1 Follow in00074;
+f00074_2 Follow f00074_1;
+f00074_3 Follow f00074_2;
+f00074_4 Follow f00074_3;
+f00074_5 Follow f00074_4;
+f00074_6 Follow f00074_5;
+f00074_7 Follow f00074_6;
+f00074_8 Follow f00074_7;
+f00074_9 Follow f00074_8;
+in00075 FLAG;
+f00075_1 Follow in00075;
+f00075_2 Follow f00075_1;
+f00075_3 Follow f00075_2;
+f00075_4 Follow f00075_3;
+f00075_5 Follow f00075_4;
+f00075_6 Follow f00075_5;
+f00075_7 Follow f00075_6;
+f00075_8 Follow f00075_7;
+f00075_9 Follow f00075_8;
+in00076 FLAG;
+f00076_1 Follow in00076;
+f00076_2 Follow f00076_1;
+f00076_3 Follow f00076_2;
+f00076_4 Follow f00076_3;
+f00076_5 Follow f00076_4;
+f00076_6 Follow f00076_5;
+f00076_7 Follow f00076_6;
+f00076_8 Follow f00076_7;
+f00076_9 Follow f00076_8;
+in00077 FLAG;
+f00077_1 Follow in00077;
+f00077_2 Follow f00077_1;
+f00077_3 Follow f00077_2;
+f00077_4 Follow f00077_3;
+f00077_5 Follow f00077_4;
+f00077_6 Follow f00077_5;
+f00077_7 Follow f00077_6;
+f00077_8 Follow f00077_7;
+f00077_9 Follow f00077_8;
+in00078 FLAG;
+f00078_1 Follow in00078;
+f00078_2 Follow f00078_1;
+f00078_3 Follow f00078_2;
+f00078_4 Follow f00078_3;
+f00078_5 Follow f00078_4;
+f00078_6 Follow f00078_5;
+f00078_7 Follow f00078_6;
+f00078_8 Follow f00078_7;
+f00078_9 Follow f00078_8;
+in00079 FLAG;
+f00079_1 Follow in00079;
+f00079_2 Follow f00079_1;
+f00079_3 Follow f00079_2;
+f00079_4 Follow f00079_3;
+f00079_5 Follow f00079_4;
+f00079_6 Follow f00079_5;
+f00079_7 Follow f00079_6;
+f00079_8 Follow f00079_7;
+f00079_9 Follow f00079_8;
+in00080 FLAG;
+f00080_1 Follow in00080;
+f00080_2 Follow f00080_1;
+f00080_3 Follow f00080_2;
+f00080_4 Follow f00080_3;
+f00080_5 Follow f00080_4;
+f00080_6 Follow f00080_5;
+f00080_7 Follow f00080_6;
+f00080_8 Follow f00080_7;
+f00080_9 Follow f00080_8;
+in00081 FLAG;
+f00081_1 Follow in00081;
+f00081_2 Follow f00081_1;
+f00081_3 Follow f00081_2;
+f00081_4 Follow f00081_3;
+f00081_5 Follow f00081_4;
+f00081_6 Follow f00081_5;
+f00081_7 Follow f00081_6;
+f00081_8 Follow f00081_7;
+f00081_9 Follow f00081_8;
+in00082 FLAG;
+f00082_1 Follow in00082;
+f00082_2 Follow f00082_1;
+f00082_3 Follow f00082_2;
+f00082_4 Follow f00082_3;
+f00082_5 Follow f00082_4;
+f00082_6 Follow f00082_5;
+f00082_7 Follow f00082_6;
+f00082_8 Follow f00082_7;
+f00082_9 Follow f00082_8;
+in00083 FLAG;
+f00083_1 Follow in00083;
+f00083_2 Follow f00083_1;
+f00083_3 Follow f00083_2;
+f00083_4 Follow f00083_3;
+f00083_5 Follow f00083_4;
+f00083_6 Follow f00083_5;
+f00083_7 Follow f00083_6;
+f00083_8 Follow f00083_7;
+f00083_9 Follow f00083_8;
+in00084 FLAG;
+f00084_1 Follow in00084;
+f00084_2 Follow f00084_1;
+f00084_3 Follow f00084_2;
+f00084_4 Follow f00084_3;
+f00084_5 Follow f00084_4;
+f00084_6 Follow f00084_5;
+f00084_7 Follow f00084_6;
+f00084_8 Follow f00084_7;
+f00084_9 Follow f00084_8;
+in00085 FLAG;
+f00085_1 Follow in00085;
+f00085_2 Follow f00085_1;
+f00085_3 Follow f00085_2;
+f00085_4 Follow f00085_3;
+f00085_5 Follow f00085_4;
+f00085_6 Follow f00085_5;
+f00085_7 Follow f00085_6;
+f00085_8 Follow f00085_7;
+f00085_9 Follow f00085_8;
+in00086 FLAG;
+f00086_1 Follow in00086;
+f00086_2 Follow f00086_1;
+f00086_3 Follow f00086_2;
+f00086_4 Follow f00086_3;
+f00086_5 Follow f00086_4;
+f00086_6 Follow f00086_5;
+f00086_7 Follow f00086_6;
+f00086_8 Follow f00086_7;
+f00086_9 Follow f00086_8;
+in00087 FLAG;
+f00087_1 Follow in00087;
+f00087_2 Follow f00087_1;
+f00087_3 Follow f00087_2;
+f00087_4 Follow f00087_3;
+f00087_5 Follow f00087_4;
+f00087_6 Follow f00087_5;
+f00087_7 Follow f00087_6;
+f00087_8 Follow f00087_7;
+f00087_9 Follow f00087_8;
+in00088 FLAG;
+f00088_1 Follow in00088;
+f00088_2 Follow f00088_1;
+f00088_3 Follow f00088_2;
+f00088_4 Follow f00088_3;
+f00088_5 Follow f00088_4;
+f00088_6 Follow f00088_5;
+f00088_7 Follow f00088_6;
+f00088_8 Follow f00088_7;
+f00088_9 Follow f00088_8;
+in00089 FLAG;
+f00089_1 Follow in00089;
+f00089_2 Follow f00089_1;
+f00089_3 Follow f00089_2;
+f00089_4 Follow f00089_3;
+f00089_5 Follow f00089_4;
+f00089_6 Follow f00089_5;
+f00089_7 Follow f00089_6;
+f00089_8 Follow f00089_7;
+f00089_9 Follow f00089_8;
+in00090 FLAG;
+f00090_1 Follow in00090;
+f00090_2 Follow f00090_1;
+f00090_3 Follow f00090_2;
+f00090_4 Follow f00090_3;
+f00090_5 Follow f00090_4;
+f00090_6 Follow f00090_5;
+f00090_7 Follow f00090_6;
+f00090_8 Follow f00090_7;
+f00090_9 Follow f00090_8;
+in00091 FLAG;
+f00091_1 Follow in00091;
+f00091_2 Follow f00091_1;
+f00091_3 Follow f00091_2;
+f00091_4 Follow f00091_3;
+f00091_5 Follow f00091_4;
+f00091_6 Follow f00091_5;
+f00091_7 Follow f00091_6;
+f00091_8 Follow f00091_7;
+f00091_9 Follow f00091_8;
+in00092 FLAG;
+f00092_1 Follow in00092;
+f00092_2 Follow f00092_1;
+f00092_3 Follow f00092_2;
+f00092_4 Follow f00092_3;
+f00092_5 Follow f00092_4;
+f00092_6 Follow f00092_5;
+f00092_7 Follow f00092_6;
+f00092_8 Follow f00092_7;
+f00092_9 Follow f00092_8;
+in00093 FLAG;
+f00093_1 Follow in00093;
+f00093_2 Follow f00093_1;
+f00093_3 Follow f00093_2;
+f00093_4 Follow f00093_3;
+f00093_5 Follow f00093_4;
+f00093_6 Follow f00093_5;
+f00093_7 Follow f00093_6;
+f00093_8 Follow f00093_7;
+f00093_9 Follow f00093_8;
+in00094 FLAG;
+f00094_1 Follow in00094;
+f00094_2 Follow f00094_1;
+f00094_3 Follow f00094_2;
+f00094_4 Follow f00094_3;
+f00094_5 Follow f00094_4;
+f00094_6 Follow f00094_5;
+f00094_7 Follow f00094_6;
+f00094_8 Follow f00094_7;
+f00094_9 Follow f00094_8;
+in00095 FLAG;
+f00095_1 Follow in00095;
+f00095_2 Follow f00095_1;
+f00095_3 Follow f00095_2;
+f00095_4 Follow f00095_3;
+f00095_5 Follow f00095_4;
+f00095_6 Follow f00095_5;
+f00095_7 Follow f00095_6;
+f00095_8 Follow f00095_7;
+f00095_9 Follow f00095_8;
+in00096 FLAG;
+f00096_1 Follow in00096;
+f00096_2 Follow f00096_1;
+f00096_3 Follow f00096_2;
+f00096_4 Follow f00096_3;
+f00096_5 Follow f00096_4;
+f00096_6 Follow f00096_5;
+f00096_7 Follow f00096_6;
+f00096_8 Follow f00096_7;
+f00096_9 Follow f00096_8;
+in00097 FLAG;
+f00097_1 Follow in00097;
+f00097_2 Follow f00097_1;
+f00097_3 Follow f00097_2;
+f00097_4 Follow f00097_3;
+f00097_5 Follow f00097_4;
+f00097_6 Follow f00097_5;
+f00097_7 Follow f00097_6;
+f00097_8 Follow f00097_7;
+f00097_9 Follow f00097_8;
+in00098 FLAG;
+f00098_1 Follow in00098;
+f00098_2 Follow f00098_1;
+f00098_3 Follow f00098_2;
+f00098_4 Follow f00098_3;
+f00098_5 Follow f00098_4;
+f00098_6 Follow f00098_5;
+f00098_7 Follow f00098_6;
+f00098_8 Follow f00098_7;
+f00098_9 Follow f00098_8;
+in00099 FLAG;
+f00099_1 Follow in00099;
+f00099_2 Follow f00099_1;
+f00099_3 Follow f00099_2;
+f00099_4 Follow f00099_3;
+f00099_5 Follow f00099_4;
+f00099_6 Follow f00099_5;
+f00099_7 Follow f00099_6;
+f00099_8 Follow f00099_7;
+f00099_9 Follow f00099_8;
+in00100 FLAG;
+f00100_1 Follow in00100;
+f00100_2 Follow f00100_1;
+f00100_3 Follow f00100_2;
+f00100_4 Follow f00100_3;
+f00100_5 Follow f00100_4;
+f00100_6 Follow f00100_5;
+f00100_7 Follow f00100_6;
+f00100_8 Follow f00100_7;
+f00100_9 Follow f00100_8;
+in00101 FLAG;
+f00101_1 Follow in00101;
+f00101_2 Follow f00101_1;
+f00101_3 Follow f00101_2;
+f00101_4 Follow f00101_3;
+f00101_5 Follow f00101_4;
+f00101_6 Follow f00101_5;
+f00101_7 Follow f00101_6;
+f00101_8 Follow f00101_7;
+f00101_9 Follow f00101_8;
+in00102 FLAG;
+f00102_1 Follow in00102;
+f00102_2 Follow f00102_1;
+f00102_3 Follow f00102_2;
+f00102_4 Follow f00102_3;
+f00102_5 Follow f00102_4;
+f00102_6 Follow f00102_5;
+f00102_7 Follow f00102_6;
+f00102_8 Follow f00102_7;
+f00102_9 Follow f00102_8;
+in00103 FLAG;
+f00103_1 Follow in00103;
+f00103_2 Follow f00103_1;
+f00103_3 Follow f00103_2;
+f00103_4 Follow f00103_3;
+f00103_5 Follow f00103_4;
+f00103_6 Follow f00103_5;
+f00103_7 Follow f00103_6;
+f00103_8 Follow f00103_7;
+f00103_9 Follow f00103_8;
+in00104 FLAG;
+f00104_1 Follow in00104;
+f00104_2 Follow f00104_1;
+f00104_3 Follow f00104_2;
+f00104_4 Follow f00104_3;
+f00104_5 Follow f00104_4;
+f00104_6 Follow f00104_5;
+f00104_7 Follow f00104_6;
+f00104_8 Follow f00104_7;
+f00104_9 Follow f00104_8;
+in00105 FLAG;
+f00105_1 Follow in00105;
+f00105_2 Follow f00105_1;
+f00105_3 Follow f00105_2;
+f00105_4 Follow f00105_3;
+f00105_5 Follow f00105_4;
+f00105_6 Follow f00105_5;
+f00105_7 Follow f00105_6;
+f00105_8 Follow f00105_7;
+f00105_9 Follow f00105_8;
+in00106 FLAG;
+f00106_1 Follow in00106;
+f00106_2 Follow f00106_1;
+f00106_3 Follow f00106_2;
+f00106_4 Follow f00106_3;
+f00106_5 Follow f00106_4;
+f00106_6 Follow f00106_5;
+f00106_7 Follow f00106_6;
+f00106_8 Follow f00106_7;
+f00106_9 Follow f00106_8;
+in00107 FLAG;
+f00107_1 Follow in00107;
+f00107_2 Follow f00107_1;
+f00107_3 Follow f00107_2;
+f00107_4 Follow f00107_3;
+f00107_5 Follow f00107_4;
+f00107_6 Follow f00107_5;
+f00107_7 Follow f00107_6;
+f00107_8 Follow f00107_7;
+f00107_9 Follow f00107_8;
+in00108 FLAG;
+f00108_1 Follow in00108;
+f00108_2 Follow f00108_1;
+f00108_3 Follow f00108_2;
+f00108_4 Follow f00108_3;
+f00108_5 Follow f00108_4;
+f00108_6 Follow f00108_5;
+f00108_7 Follow f00108_6;
+f00108_8 Follow f00108_7;
+f00108_9 Follow f00108_8;
+in00109 FLAG;
+f00109_1 Follow in00109;
+f00109_2 Follow f00109_1;
+f00109_3 Follow f00109_2;
+f00109_4 Follow f00109_3;
+f00109_5 Follow f00109_4;
+f00109_6 Follow f00109_5;
+f00109_7 Follow f00109_6;
+f00109_8 Follow f00109_7;
+f00109_9 Follow f00109_8;
+in00110 FLAG;
+f00110_1 Follow in00110;
+f00110_2 Follow f00110_1;
+f00110_3 Follow f00110_2;
+f00110_4 Follow f00110_3;
+f00110_5 Follow f00110_4;
+f00110_6 Follow f00110_5;
+f00110_7 Follow f00110_6;
+f00110_8 Follow f00110_7;
+f00110_9 Follow f00110_8;
+in00111 FLAG;
+f00111_1 Follow in00111;
+f00111_2 Follow f00111_1;
+f00111_3 Follow f00111_2;
+f00111_4 Follow f00111_3;
+f00111_5 Follow f00111_4;
+f00111_6 Follow f00111_5;
+f00111_7 Follow f00111_6;
+f00111_8 Follow f00111_7;
+f00111_9 Follow f00111_8;
+in00112 FLAG;
+f00112_1 Follow in00112;
+f00112_2 Follow f00112_1;
+f00112_3 Follow f00112_2;
+f00112_4 Follow f00112_3;
+f00112_5 Follow f00112_4;
+f00112_6 Follow f00112_5;
+f00112_7 Follow f00112_6;
+f00112_8 Follow f00112_7;
+f00112_9 Follow f00112_8;
+in00113 FLAG;
+f00113_1 Follow in00113;
+f00113_2 Follow f00113_1;
+f00113_3 Follow f00113_2;
+f00113_4 Follow f00113_3;
+f00113_5 Follow f00113_4;
+f00113_6 Follow f00113_5;
+f00113_7 Follow f00113_6;
+f00113_8 Follow f00113_7;
+f00113_9 Follow f00113_8;
+in00114 FLAG;
+f00114_1 Follow in00114;
+f00114_2 Follow f00114_1;
+f00114_3 Follow f00114_2;
+f00114_4 Follow f00114_3;
+f00114_5 Follow f00114_4;
+f00114_6 Follow f00114_5;
+f00114_7 Follow f00114_6;
+f00114_8 Follow f00114_7;
+f00114_9 Follow f00114_8;
+in00115 FLAG;
+f00115_1 Follow in00115;
+f00115_2 Follow f00115_1;
+f00115_3 Follow f00115_2;
+f00115_4 Follow f00115_3;
+f00115_5 Follow f00115_4;
+f00115_6 Follow f00115_5;
+f00115_7 Follow f00115_6;
+f00115_8 Follow f00115_7;
+f00115_9 Follow f00115_8;
+in00116 FLAG;
+f00116_1 Follow in00116;
+f00116_2 Follow f00116_1;
+f00116_3 Follow f00116_2;
+f00116_4 Follow f00116_3;
+f00116_5 Follow f00116_4;
+f00116_6 Follow f00116_5;
+f00116_7 Follow f00116_6;
+f00116_8 Follow f00116_7;
+f00116_9 Follow f00116_8;
+in00117 FLAG;
+f00117_1 Follow in00117;
+f00117_2 Follow f00117_1;
+f00117_3 Follow f00117_2;
+f00117_4 Follow f00117_3;
+f00117_5 Follow f00117_4;
+f00117_6 Follow f00117_5;
+f00117_7 Follow f00117_6;
+f00117_8 Follow f00117_7;
+f00117_9 Follow f00117_8;
+in00118 FLAG;
+f00118_1 Follow in00118;
+f00118_2 Follow f00118_1;
+f00118_3 Follow f00118_2;
+f00118_4 Follow f00118_3;
+f00118_5 Follow f00118_4;
+f00118_6 Follow f00118_5;
+f00118_7 Follow f00118_6;
+f00118_8 Follow f00118_7;
+f00118_9 Follow f00118_8;
+in00119 FLAG;
+f00119_1 Follow in00119;
+f00119_2 Follow f00119_1;
+f00119_3 Follow f00119_2;
+f00119_4 Follow f00119_3;
+f00119_5 Follow f00119_4;
+f00119_6 Follow f00119_5;
+f00119_7 Follow f00119_6;
+f00119_8 Follow f00119_7;
+f00119_9 Follow f00119_8;
+in00120 FLAG;
+f00120_1 Follow in00120;
+f00120_2 Follow f00120_1;
+f00120_3 Follow f00120_2;
+f00120_4 Follow f00120_3;
+f00120_5 Follow f00120_4;
+f00120_6 Follow f00120_5;
+f00120_7 Follow f00120_6;
+f00120_8 Follow f00120_7;
+f00120_9 Follow f00120_8;
+in00121 FLAG;
+f00121_1 Follow in00121;
+f00121_2 Follow f00121_1;
+f00121_3 Follow f00121_2;
+f00121_4 Follow f00121_3;
+f00121_5 Follow f00121_4;
+f00121_6 Follow f00121_5;
+f00121_7 Follow f00121_6;
+f00121_8 Follow f00121_7;
+f00121_9 Follow f00121_8;
+in00122 FLAG;
+f00122_1 Follow in00122;
+f00122_2 Follow f00122_1;
+f00122_3 Follow f00122_2;
+f00122_4 Follow f00122_3;
+f00122_5 Follow f00122_4;
+f00122_6 Follow f00122_5;
+f00122_7 Follow f00122_6;
+f00122_8 Follow f00122_7;
+f00122_9 Follow f00122_8;
+in00123 FLAG;
+f00123_1 Follow in00123;
+f00123_2 Follow f00123_1;
+f00123_3 Follow f00123_2;
+f00123_4 Follow f00123_3;
+f00123_5 Follow f00123_4;
+f00123_6 Follow f00123_5;
+f00123_7 Follow f00123_6;
+f00123_8 Follow f00123_7;
+f00123_9 Follow f00123_8;
+in00124 FLAG;
+f00124_1 Follow in00124;
+f00124_2 Follow f00124_1;
+f00124_3 Follow f00124_2;
+f00124_4 Follow f00124_3;
+f00124_5 Follow f00124_4;
+f00124_6 Follow f00124_5;
+f00124_7 Follow f00124_6;
+f00124_8 Follow f00124_7;
+f00124_9 Follow f00124_8;
+in00125 FLAG;
+f00125_1 Follow in00125;
+f00125_2 Follow f00125_1;
+f00125_3 Follow f00125_2;
+f00125_4 Follow f00125_3;
+f00125_5 Follow f00125_4;
+f00125_6 Follow f00125_5;
+f00125_7 Follow f00125_6;
+f00125_8 Follow f00125_7;
+f00125_9 Follow f00125_8;
+in00126 FLAG;
+f00126_1 Follow in00126;
+f00126_2 Follow f00126_1;
+f00126_3 Follow f00126_2;
+f00126_4 Follow f00126_3;
+f00126_5 Follow f00126_4;
+f00126_6 Follow f00126_5;
+f00126_7 Follow f00126_6;
+f00126_8 Follow f00126_7;
+f00126_9 Follow f00126_8;
+in00127 FLAG;
+f00127_1 Follow in00127;
+f00127_2 Follow f00127_1;
+f00127_3 Follow f00127_2;
+f00127_4 Follow f00127_3;
+f00127_5 Follow f00127_4;
+f00127_6 Follow f00127_5;
+f00127_7 Follow f00127_6;
+f00127_8 Follow f00127_7;
+f00127_9 Follow f00127_8;
+in00128 FLAG;
+f00128_1 Follow in00128;
+f00128_2 Follow f00128_1;
+f00128_3 Follow f00128_2;
+f00128_4 Follow f00128_3;
+f00128_5 Follow f00128_4;
+f00128_6 Follow f00128_5;
+f00128_7 Follow f00128_6;
+f00128_8 Follow f00128_7;
+f00128_9 Follow f00128_8;
+in00129 FLAG;
+f00129_1 Follow in00129;
+f00129_2 Follow f00129_1;
+f00129_3 Follow f00129_2;
+f00129_4 Follow f00129_3;
+f00129_5 Follow f00129_4;
+f00129_6 Follow f00129_5;
+f00129_7 Follow f00129_6;
+f00129_8 Follow f00129_7;
+f00129_9 Follow f00129_8;
+in00130 FLAG;
+f00130_1 Follow in00130;
+f00130_2 Follow f00130_1;
+f00130_3 Follow f00130_2;
+f00130_4 Follow f00130_3;
+f00130_5 Follow f00130_4;
+f00130_6 Follow f00130_5;
+f00130_7 Follow f00130_6;
+f00130_8 Follow f00130_7;
+f00130_9 Follow f00130_8;
+in00131 FLAG;
+f00131_1 Follow in00131;
+f00131_2 Follow f00131_1;
+f00131_3 Follow f00131_2;
+f00131_4 Follow f00131_3;
+f00131_5 Follow f00131_4;
+f00131_6 Follow f00131_5;
+f00131_7 Follow f00131_6;
+f00131_8 Follow f00131_7;
+f00131_9 Follow f00131_8;
+in00132 FLAG;
+f00132_1 Follow in00132;
+f00132_2 Follow f00132_1;
+f00132_3 Follow f00132_2;
+f00132_4 Follow f00132_3;
+f00132_5 Follow f00132_4;
+f00132_6 Follow f00132_5;
+f00132_7 Follow f00132_6;
+f00132_8 Follow f00132_7;
+f00132_9 Follow f00132_8;
+in00133 FLAG;
+f00133_1 Follow in00133;
+f00133_2 Follow f00133_1;
+f00133_3 Follow f00133_2;
+f00133_4 Follow f00133_3;
+f00133_5 Follow f00133_4;
+f00133_6 Follow f00133_5;
+f00133_7 Follow f00133_6;
+f00133_8 Follow f00133_7;
+f00133_9 Follow f00133_8;
+in00134 FLAG;
+f00134_1 Follow in00134;
+f00134_2 Follow f00134_1;
+f00134_3 Follow f00134_2;
+f00134_4 Follow f00134_3;
+f00134_5 Follow f00134_4;
+f00134_6 Follow f00134_5;
+f00134_7 Follow f00134_6;
+f00134_8 Follow f00134_7;
+f00134_9 Follow f00134_8;
+in00135 FLAG;
+f00135_1 Follow in00135;
+f00135_2 Follow f00135_1;
+f00135_3 Follow f00135_2;
+f00135_4 Follow f00135_3;
+f00135_5 Follow f00135_4;
+f00135_6 Follow f00135_5;
+f00135_7 Follow f00135_6;
+f00135_8 Follow f00135_7;
+f00135_9 Follow f00135_8;
+in00136 FLAG;
+f00136_1 Follow in00136;
+f00136_2 Follow f00136_1;
+f00136_3 Follow f00136_2;
+f00136_4 Follow f00136_3;
+f00136_5 Follow f00136_4;
+f00136_6 Follow f00136_5;
+f00136_7 Follow f00136_6;
+f00136_8 Follow f00136_7;
+f00136_9 Follow f00136_8;
+in00137 FLAG;
+f00137_1 Follow in00137;
+f00137_2 Follow f00137_1;
+f00137_3 Follow f00137_2;
+f00137_4 Follow f00137_3;
+f00137_5 Follow f00137_4;
+f00137_6 Follow f00137_5;
+f00137_7 Follow f00137_6;
+f00137_8 Follow f00137_7;
+f00137_9 Follow f00137_8;
+in00138 FLAG;
+f00138_1 Follow in00138;
+f00138_2 Follow f00138_1;
+f00138_3 Follow f00138_2;
+f00138_4 Follow f00138_3;
+f00138_5 Follow f00138_4;
+f00138_6 Follow f00138_5;
+f00138_7 Follow f00138_6;
+f00138_8 Follow f00138_7;
+f00138_9 Follow f00138_8;
+in00139 FLAG;
+f00139_1 Follow in00139;
+f00139_2 Follow f00139_1;
+f00139_3 Follow f00139_2;
+f00139_4 Follow f00139_3;
+f00139_5 Follow f00139_4;
+f00139_6 Follow f00139_5;
+f00139_7 Follow f00139_6;
+f00139_8 Follow f00139_7;
+f00139_9 Follow f00139_8;
+in00140 FLAG;
+f00140_1 Follow in00140;
+f00140_2 Follow f00140_1;
+f00140_3 Follow f00140_2;
+f00140_4 Follow f00140_3;
+f00140_5 Follow f00140_4;
+f00140_6 Follow f00140_5;
+f00140_7 Follow f00140_6;
+f00140_8 Follow f00140_7;
+f00140_9 Follow f00140_8;
+in00141 FLAG;
+f00141_1 Follow in00141;
+f00141_2 Follow f00141_1;
+f00141_3 Follow f00141_2;
+f00141_4 Follow f00141_3;
+f00141_5 Follow f00141_4;
+f00141_6 Follow f00141_5;
+f00141_7 Follow f00141_6;
+f00141_8 Follow f00141_7;
+f00141_9 Follow f00141_8;
+in00142 FLAG;
+f00142_1 Follow in00142;
+f00142_2 Follow f00142_1;
+f00142_3 Follow f00142_2;
+f00142_4 Follow f00142_3;
+f00142_5 Follow f00142_4;
+f00142_6 Follow f00142_5;
+f00142_7 Follow f00142_6;
+f00142_8 Follow f00142_7;
+f00142_9 Follow f00142_8;
+in00143 FLAG;
+f00143_1 Follow in00143;
+f00143_2 Follow f00143_1;
+f00143_3 Follow f00143_2;
+f00143_4 Follow f00143_3;
+f00143_5 Follow f00143_4;
+f00143_6 Follow f00143_5;
+f00143_7 Follow f00143_6;
+f00143_8 Follow f00143_7;
+f00143_9 Follow f00143_8;
+in00144 FLAG;
+f00144_1 Follow in00144;
+f00144_2 Follow f00144_1;
+f00144_3 Follow f00144_2;
+f00144_4 Follow f00144_3;
+f00144_5 Follow f00144_4;
+f00144_6 Follow f00144_5;
+f00144_7 Follow f00144_6;
+f00144_8 Follow f00144_7;
+f00144_9 Follow f00144_8;
+in00145 FLAG;
+f00145_1 Follow in00145;
+f00145_2 Follow f00145_1;
+f00145_3 Follow f00145_2;
+f00145_4 Follow f00145_3;
+f00145_5 Follow f00145_4;
+f00145_6 Follow f00145_5;
+f00145_7 Follow f00145_6;
+f00145_8 Follow f00145_7;
+f00145_9 Follow f00145_8;
+in00146 FLAG;
+f00146_1 Follow in00146;
+f00146_2 Follow f00146_1;
+f00146_3 Follow f00146_2;
+f00146_4 Follow f00146_3;
+f00146_5 Follow f00146_4;
+f00146_6 Follow f00146_5;
+f00146_7 Follow f00146_6;
+f00146_8 Follow f00146_7;
+f00146_9 Follow f00146_8;
+in00147 FLAG;
+f00147_1 Follow in00147;
+f00147_2 Follow f00147_1;
+f00147_3 Follow f00147_2;
+f00147_4 Follow f00147_3;
+f00147_5 Follow f00147_4;
+f00147_6 Follow f00147_5;
+f00147_7 Follow f00147_6;
+f00147_8 Follow f00147_7;
+f00147_9 Follow f00147_8;
+in00148 FLAG;
+f00148_1 Follow in00148;
+f00148_2 Follow f00148_1;
+f00148_3 Follow f00148_2;
+f00148_4 Follow f00148_3;
+f00148_5 Follow f00148_4;
+f00148_6 Follow f00148_5;
+f00148_7 Follow f00148_6;
+f00148_8 Follow f00148_7;
+f00148_9 Follow f00148_8;
+in00149 FLAG;
+f00149_1 Follow in00149;
+f00149_2 Follow f00149_1;
+f00149_3 Follow f00149_2;
+f00149_4 Follow f00149_3;
+f00149_5 Follow f00149_4;
+f00149_6 Follow f00149_5;
+f00149_7 Follow f00149_6;
+f00149_8 Follow f00149_7;
+f00149_9 Follow f00149_8;
+in00150 FLAG;
+f00150_1 Follow in00150;
+f00150_2 Follow f00150_1;
+f00150_3 Follow f00150_2;
+f00150_4 Follow f00150_3;
+f00150_5 Follow f00150_4;
+f00150_6 Follow f00150_5;
+f00150_7 Follow f00150_6;
+f00150_8 Follow f00150_7;
+f00150_9 Follow f00150_8;
+in00151 FLAG;
+f00151_1 Follow in00151;
+f00151_2 Follow f00151_1;
+f00151_3 Follow f00151_2;
+f00151_4 Follow f00151_3;
+f00151_5 Follow f00151_4;
+f00151_6 Follow f00151_5;
+f00151_7 Follow f00151_6;
+f00151_8 Follow f00151_7;
+f00151_9 Follow f00151_8;
+in00152 FLAG;
+f00152_1 Follow in00152;
+f00152_2 Follow f00152_1;
+f00152_3 Follow f00152_2;
+f00152_4 Follow f00152_3;
+f00152_5 Follow f00152_4;
+f00152_6 Follow f00152_5;
+f00152_7 Follow f00152_6;
+f00152_8 Follow f00152_7;
+f00152_9 Follow f00152_8;
+in00153 FLAG;
+f00153_1 Follow in00153;
+f00153_2 Follow f00153_1;
+f00153_3 Follow f00153_2;
+f00153_4 Follow f00153_3;
+f00153_5 Follow f00153_4;
+f00153_6 Follow f00153_5;
+f00153_7 Follow f00153_6;
+f00153_8 Follow f00153_7;
+f00153_9 Follow f00153_8;
+in00154 FLAG;
+f00154_1 Follow in00154;
+f00154_2 Follow f00154_1;
+f00154_3 Follow f00154_2;
+f00154_4 Follow f00154_3;
+f00154_5 Follow f00154_4;
+f00154_6 Follow f00154_5;
+f00154_7 Follow f00154_6;
+f00154_8 Follow f00154_7;
+f00154_9 Follow f00154_8;
+in00155 FLAG;
+f00155_1 Follow in00155;
+f00155_2 Follow f00155_1;
+f00155_3 Follow f00155_2;
+f00155_4 Follow f00155_3;
+f00155_5 Follow f00155_4;
+f00155_6 Follow f00155_5;
+f00155_7 Follow f00155_6;
+f00155_8 Follow f00155_7;
+f00155_9 Follow f00155_8;
+in00156 FLAG;
+f00156_1 Follow in00156;
+f00156_2 Follow f00156_1;
+f00156_3 Follow f00156_2;
+f00156_4 Follow f00156_3;
+f00156_5 Follow f00156_4;
+f00156_6 Follow f00156_5;
+f00156_7 Follow f00156_6;
+f00156_8 Follow f00156_7;
+f00156_9 Follow f00156_8;
+in00157 FLAG;
+f00157_1 Follow in00157;
+f00157_2 Follow f00157_1;
+f00157_3 Follow f00157_2;
+f00157_4 Follow f00157_3;
+f00157_5 Follow f00157_4;
+f00157_6 Follow f00157_5;
+f00157_7 Follow f00157_6;
+f00157_8 Follow f00157_7;
+f00157_9 Follow f00157_8;
+in00158 FLAG;
+f00158_1 Follow in00158;
+f00158_2 Follow f00158_1;
+f00158_3 Follow f00158_2;
+f00158_4 Follow f00158_3;
+f00158_5 Follow f00158_4;
+f00158_6 Follow f00158_5;
+f00158_7 Follow f00158_6;
+f00158_8 Follow f00158_7;
+f00158_9 Follow f00158_8;
+in00159 FLAG;
+f00159_1 Follow in00159;
+f00159_2 Follow f00159_1;
+f00159_3 Follow f00159_2;
+f00159_4 Follow f00159_3;
+f00159_5 Follow f00159_4;
+f00159_6 Follow f00159_5;
+f00159_7 Follow f00159_6;
+f00159_8 Follow f00159_7;
+f00159_9 Follow f00159_8;
+in00160 FLAG;
+f00160_1 Follow in00160;
+f00160_2 Follow f00160_1;
+f00160_3 Follow f00160_2;
+f00160_4 Follow f00160_3;
+f00160_5 Follow f00160_4;
+f00160_6 Follow f00160_5;
+f00160_7 Follow f00160_6;
+f00160_8 Follow f00160_7;
+f00160_9 Follow f00160_8;
+in00161 FLAG;
+f00161_1 Follow in00161;
+f00161_2 Follow f00161_1;
+f00161_3 Follow f00161_2;
+f00161_4 Follow f00161_3;
+f00161_5 Follow f00161_4;
+f00161_6 Follow f00161_5;
+f00161_7 Follow f00161_6;
+f00161_8 Follow f00161_7;
+f00161_9 Follow f00161_8;
+in00162 FLAG;
+f00162_1 Follow in00162;
+f00162_2 Follow f00162_1;
+f00162_3 Follow f00162_2;
+f00162_4 Follow f00162_3;
+f00162_5 Follow f00162_4;
+f00162_6 Follow f00162_5;
+f00162_7 Follow f00162_6;
+f00162_8 Follow f00162_7;
+f00162_9 Follow f00162_8;
+in00163 FLAG;
+f00163_1 Follow in00163;
+f00163_2 Follow f00163_1;
+f00163_3 Follow f00163_2;
+f00163_4 Follow f00163_3;
+f00163_5 Follow f00163_4;
+f00163_6 Follow f00163_5;
+f00163_7 Follow f00163_6;
+f00163_8 Follow f00163_7;
+f00163_9 Follow f00163_8;
+in00164 FLAG;
+f00164_1 Follow in00164;
+f00164_2 Follow f00164_1;
+f00164_3 Follow f00164_2;
+f00164_4 Follow f00164_3;
+f00164_5 Follow f00164_4;
+f00164_6 Follow f00164_5;
+f00164_7 Follow f00164_6;
+f00164_8 Follow f00164_7;
+f00164_9 Follow f00164_8;
+in00165 FLAG;
+f00165_1 Follow in00165;
+f00165_2 Follow f00165_1;
+f00165_3 Follow f00165_2;
+f00165_4 Follow f00165_3;
+f00165_5 Follow f00165_4;
+f00165_6 Follow f00165_5;
+f00165_7 Follow f00165_6;
+f00165_8 Follow f00165_7;
+f00165_9 Follow f00165_8;
+in00166 FLAG;
+f00166_1 Follow in00166;
+f00166_2 Follow f00166_1;
+f00166_3 Follow f00166_2;
+f00166_4 Follow f00166_3;
+f00166_5 Follow f00166_4;
+f00166_6 Follow f00166_5;
+f00166_7 Follow f00166_6;
+f00166_8 Follow f00166_7;
+f00166_9 Follow f00166_8;
+in00167 FLAG;
+f00167_1 Follow in00167;
+f00167_2 Follow f00167_1;
+f00167_3 Follow f00167_2;
+f00167_4 Follow f00167_3;
+f00167_5 Follow f00167_4;
+f00167_6 Follow f00167_5;
+f00167_7 Follow f00167_6;
+f00167_8 Follow f00167_7;
+f00167_9 Follow f00167_8;
+in00168 FLAG;
+f00168_1 Follow in00168;
+f00168_2 Follow f00168_1;
+f00168_3 Follow f00168_2;
+f00168_4 Follow f00168_3;
+f00168_5 Follow f00168_4;
+f00168_6 Follow f00168_5;
+f00168_7 Follow f00168_6;
+f00168_8 Follow f00168_7;
+f00168_9 Follow f00168_8;
+in00169 FLAG;
+f00169_1 Follow in00169;
+f00169_2 Follow f00169_1;
+f00169_3 Follow f00169_2;
+f00169_4 Follow f00169_3;
+f00169_5 Follow f00169_4;
+f00169_6 Follow f00169_5;
+f00169_7 Follow f00169_6;
+f00169_8 Follow f00169_7;
+f00169_9 Follow f00169_8;
+in00170 FLAG;
+f00170_1 Follow in00170;
+f00170_2 Follow f00170_1;
+f00170_3 Follow f00170_2;
+f00170_4 Follow f00170_3;
+f00170_5 Follow f00170_4;
+f00170_6 Follow f00170_5;
+f00170_7 Follow f00170_6;
+f00170_8 Follow f00170_7;
+f00170_9 Follow f00170_8;
+in00171 FLAG;
+f00171_1 Follow in00171;
+f00171_2 Follow f00171_1;
+f00171_3 Follow f00171_2;
+f00171_4 Follow f00171_3;
+f00171_5 Follow f00171_4;
+f00171_6 Follow f00171_5;
+f00171_7 Follow f00171_6;
+f00171_8 Follow f00171_7;
+f00171_9 Follow f00171_8;
+in00172 FLAG;
+f00172_1 Follow in00172;
+f00172_2 Follow f00172_1;
+f00172_3 Follow f00172_2;
+f00172_4 Follow f00172_3;
+f00172_5 Follow f00172_4;
+f00172_6 Follow f00172_5;
+f00172_7 Follow f00172_6;
+f00172_8 Follow f00172_7;
+f00172_9 Follow f00172_8;
+in00173 FLAG;
+f00173_1 Follow in00173;
+f00173_2 Follow f00173_1;
+f00173_3 Follow f00173_2;
+f00173_4 Follow f00173_3;
+f00173_5 Follow f00173_4;
+f00173_6 Follow f00173_5;
+f00173_7 Follow f00173_6;
+f00173_8 Follow f00173_7;
+f00173_9 Follow f00173_8;
+in00174 FLAG;
+f00174_1 Follow in00174;
+f00174_2 Follow f00174_1;
+f00174_3 Follow f00174_2;
+f00174_4 Follow f00174_3;
+f00174_5 Follow f00174_4;
+f00174_6 Follow f00174_5;
+f00174_7 Follow f00174_6;
+f00174_8 Follow f00174_7;
+f00174_9 Follow f00174_8;
+in00175 FLAG;
+f00175_1 Follow in00175;
+f00175_2 Follow f00175_1;
+f00175_3 Follow f00175_2;
+f00175_4 Follow f00175_3;
+f00175_5 Follow f00175_4;
+f00175_6 Follow f00175_5;
+f00175_7 Follow f00175_6;
+f00175_8 Follow f00175_7;
+f00175_9 Follow f00175_8;
+in00176 FLAG;
+f00176_1 Follow in00176;
+f00176_2 Follow f00176_1;
+f00176_3 Follow f00176_2;
+f00176_4 Follow f00176_3;
+f00176_5 Follow f00176_4;
+f00176_6 Follow f00176_5;
+f00176_7 Follow f00176_6;
+f00176_8 Follow f00176_7;
+f00176_9 Follow f00176_8;
+in00177 FLAG;
+f00177_1 Follow in00177;
+f00177_2 Follow f00177_1;
+f00177_3 Follow f00177_2;
+f00177_4 Follow f00177_3;
+f00177_5 Follow f00177_4;
+f00177_6 Follow f00177_5;
+f00177_7 Follow f00177_6;
+f00177_8 Follow f00177_7;
+f00177_9 Follow f00177_8;
+in00178 FLAG;
+f00178_1 Follow in00178;
+f00178_2 Follow f00178_1;
+f00178_3 Follow f00178_2;
+f00178_4 Follow f00178_3;
+f00178_5 Follow f00178_4;
+f00178_6 Follow f00178_5;
+f00178_7 Follow f00178_6;
+f00178_8 Follow f00178_7;
+f00178_9 Follow f00178_8;
+in00179 FLAG;
+f00179_1 Follow in00179;
+f00179_2 Follow f00179_1;
+f00179_3 Follow f00179_2;
+f00179_4 Follow f00179_3;
+f00179_5 Follow f00179_4;
+f00179_6 Follow f00179_5;
+f00179_7 Follow f00179_6;
+f00179_8 Follow f00179_7;
+f00179_9 Follow f00179_8;
+in00180 FLAG;
+f00180_1 Follow in00180;
+f00180_2 Follow f00180_1;
+f00180_3 Follow f00180_2;
+f00180_4 Follow f00180_3;
+f00180_5 Follow f00180_4;
+f00180_6 Follow f00180_5;
+f00180_7 Follow f00180_6;
+f00180_8 Follow f00180_7;
+f00180_9 Follow f00180_8;
+in00181 FLAG;
+f00181_1 Follow in00181;
+f00181_2 Follow f00181_1;
+f00181_3 Follow f00181_2;
+f00181_4 Follow f00181_3;
+f00181_5 Follow f00181_4;
+f00181_6 Follow f00181_5;
+f00181_7 Follow f00181_6;
+f00181_8 Follow f00181_7;
+f00181_9 Follow f00181_8;
+in00182 FLAG;
+f00182_1 Follow in00182;
+f00182_2 Follow f00182_1;
+f00182_3 Follow f00182_2;
+f00182_4 Follow f00182_3;
+f00182_5 Follow f00182_4;
+f00182_6 Follow f00182_5;
+f00182_7 Follow f00182_6;
+f00182_8 Follow f00182_7;
+f00182_9 Follow f00182_8;
+in00183 FLAG;
+f00183_1 Follow in00183;
+f00183_2 Follow f00183_1;
+f00183_3 Follow f00183_2;
+f00183_4 Follow f00183_3;
+f00183_5 Follow f00183_4;
+f00183_6 Follow f00183_5;
+f00183_7 Follow f00183_6;
+f00183_8 Follow f00183_7;
+f00183_9 Follow f00183_8;
+in00184 FLAG;
+f00184_1 Follow in00184;
+f00184_2 Follow f00184_1;
+f00184_3 Follow f00184_2;
+f00184_4 Follow f00184_3;
+f00184_5 Follow f00184_4;
+f00184_6 Follow f00184_5;
+f00184_7 Follow f00184_6;
+f00184_8 Follow f00184_7;
+f00184_9 Follow f00184_8;
+in00185 FLAG;
+f00185_1 Follow in00185;
+f00185_2 Follow f00185_1;
+f00185_3 Follow f00185_2;
+f00185_4 Follow f00185_3;
+f00185_5 Follow f00185_4;
+f00185_6 Follow f00185_5;
+f00185_7 Follow f00185_6;
+f00185_8 Follow f00185_7;
+f00185_9 Follow f00185_8;
+in00186 FLAG;
+f00186_1 Follow in00186;
+f00186_2 Follow f00186_1;
+f00186_3 Follow f00186_2;
+f00186_4 Follow f00186_3;
+f00186_5 Follow f00186_4;
+f00186_6 Follow f00186_5;
+f00186_7 Follow f00186_6;
+f00186_8 Follow f00186_7;
+f00186_9 Follow f00186_8;
+in00187 FLAG;
+f00187_1 Follow in00187;
+f00187_2 Follow f00187_1;
+f00187_3 Follow f00187_2;
+f00187_4 Follow f00187_3;
+f00187_5 Follow f00187_4;
+f00187_6 Follow f00187_5;
+f00187_7 Follow f00187_6;
+f00187_8 Follow f00187_7;
+f00187_9 Follow f00187_8;
+in00188 FLAG;
+f00188_1 Follow in00188;
+f00188_2 Follow f00188_1;
+f00188_3 Follow f00188_2;
+f00188_4 Follow f00188_3;
+f00188_5 Follow f00188_4;
+f00188_6 Follow f00188_5;
+f00188_7 Follow f00188_6;
+f00188_8 Follow f00188_7;
+f00188_9 Follow f00188_8;
+in00189 FLAG;
+f00189_1 Follow in00189;
+f00189_2 Follow f00189_1;
+f00189_3 Follow f00189_2;
+f00189_4 Follow f00189_3;
+f00189_5 Follow f00189_4;
+f00189_6 Follow f00189_5;
+f00189_7 Follow f00189_6;
+f00189_8 Follow f00189_7;
+f00189_9 Follow f00189_8;
+in00190 FLAG;
+f00190_1 Follow in00190;
+f00190_2 Follow f00190_1;
+f00190_3 Follow f00190_2;
+f00190_4 Follow f00190_3;
+f00190_5 Follow f00190_4;
+f00190_6 Follow f00190_5;
+f00190_7 Follow f00190_6;
+f00190_8 Follow f00190_7;
+f00190_9 Follow f00190_8;
+in00191 FLAG;
+f00191_1 Follow in00191;
+f00191_2 Follow f00191_1;
+f00191_3 Follow f00191_2;
+f00191_4 Follow f00191_3;
+f00191_5 Follow f00191_4;
+f00191_6 Follow f00191_5;
+f00191_7 Follow f00191_6;
+f00191_8 Follow f00191_7;
+f00191_9 Follow f00191_8;
+in00192 FLAG;
+f00192_1 Follow in00192;
+f00192_2 Follow f00192_1;
+f00192_3 Follow f00192_2;
+f00192_4 Follow f00192_3;
+f00192_5 Follow f00192_4;
+f00192_6 Follow f00192_5;
+f00192_7 Follow f00192_6;
+f00192_8 Follow f00192_7;
+f00192_9 Follow f00192_8;
+in00193 FLAG;
+f00193_1 Follow in00193;
+f00193_2 Follow f00193_1;
+f00193_3 Follow f00193_2;
+f00193_4 Follow f00193_3;
+f00193_5 Follow f00193_4;
+f00193_6 Follow f00193_5;
+f00193_7 Follow f00193_6;
+f00193_8 Follow f00193_7;
+f00193_9 Follow f00193_8;
+in00194 FLAG;
+f00194_1 Follow in00194;
+f00194_2 Follow f00194_1;
+f00194_3 Follow f00194_2;
+f00194_4 Follow f00194_3;
+f00194_5 Follow f00194_4;
+f00194_6 Follow f00194_5;
+f00194_7 Follow f00194_6;
+f00194_8 Follow f00194_7;
+f00194_9 Follow f00194_8;
+in00195 FLAG;
+f00195_1 Follow in00195;
+f00195_2 Follow f00195_1;
+f00195_3 Follow f00195_2;
+f00195_4 Follow f00195_3;
+f00195_5 Follow f00195_4;
+f00195_6 Follow f00195_5;
+f00195_7 Follow f00195_6;
+f00195_8 Follow f00195_7;
+f00195_9 Follow f00195_8;
+in00196 FLAG;
+f00196_1 Follow in00196;
+f00196_2 Follow f00196_1;
+f00196_3 Follow f00196_2;
+f00196_4 Follow f00196_3;
+f00196_5 Follow f00196_4;
+f00196_6 Follow f00196_5;
+f00196_7 Follow f00196_6;
+f00196_8 Follow f00196_7;
+f00196_9 Follow f00196_8;
+in00197 FLAG;
+f00197_1 Follow in00197;
+f00197_2 Follow f00197_1;
+f00197_3 Follow f00197_2;
+f00197_4 Follow f00197_3;
+f00197_5 Follow f00197_4;
+f00197_6 Follow f00197_5;
+f00197_7 Follow f00197_6;
+f00197_8 Follow f00197_7;
+f00197_9 Follow f00197_8;
+in00198 FLAG;
+f00198_1 Follow in00198;
+f00198_2 Follow f00198_1;
+f00198_3 Follow f00198_2;
+f00198_4 Follow f00198_3;
+f00198_5 Follow f00198_4;
+f00198_6 Follow f00198_5;
+f00198_7 Follow f00198_6;
+f00198_8 Follow f00198_7;
+f00198_9 Follow f00198_8;
+in00199 FLAG;
+f00199_1 Follow in00199;
+f00199_2 Follow f00199_1;
+f00199_3 Follow f00199_2;
+f00199_4 Follow f00199_3;
+f00199_5 Follow f00199_4;
+f00199_6 Follow f00199_5;
+f00199_7 Follow f00199_6;
+f00199_8 Follow f00199_7;
+f00199_9 Follow f00199_8;
+in00200 FLAG;
+f00200_1 Follow in00200;
+f00200_2 Follow f00200_1;
+f00200_3 Follow f00200_2;
+f00200_4 Follow f00200_3;
+f00200_5 Follow f00200_4;
+f00200_6 Follow f00200_5;
+f00200_7 Follow f00200_6;
+f00200_8 Follow f00200_7;
+f00200_9 Follow f00200_8;
+in00201 FLAG;
+f00201_1 Follow in00201;
+f00201_2 Follow f00201_1;
+f00201_3 Follow f00201_2;
+f00201_4 Follow f00201_3;
+f00201_5 Follow f00201_4;
+f00201_6 Follow f00201_5;
+f00201_7 Follow f00201_6;
+f00201_8 Follow f00201_7;
+f00201_9 Follow f00201_8;
+in00202 FLAG;
+f00202_1 Follow in00202;
+f00202_2 Follow f00202_1;
+f00202_3 Follow f00202_2;
+f00202_4 Follow f00202_3;
+f00202_5 Follow f00202_4;
+f00202_6 Follow f00202_5;
+f00202_7 Follow f00202_6;
+f00202_8 Follow f00202_7;
+f00202_9 Follow f00202_8;
+in00203 FLAG;
+f00203_1 Follow in00203;
+f00203_2 Follow f00203_1;
+f00203_3 Follow f00203_2;
+f00203_4 Follow f00203_3;
+f00203_5 Follow f00203_4;
+f00203_6 Follow f00203_5;
+f00203_7 Follow f00203_6;
+f00203_8 Follow f00203_7;
+f00203_9 Follow f00203_8;
+in00204 FLAG;
+f00204_1 Follow in00204;
+f00204_2 Follow f00204_1;
+f00204_3 Follow f00204_2;
+f00204_4 Follow f00204_3;
+f00204_5 Follow f00204_4;
+f00204_6 Follow f00204_5;
+f00204_7 Follow f00204_6;
+f00204_8 Follow f00204_7;
+f00204_9 Follow f00204_8;
+in00205 FLAG;
+f00205_1 Follow in00205;
+f00205_2 Follow f00205_1;
+f00205_3 Follow f00205_2;
+f00205_4 Follow f00205_3;
+f00205_5 Follow f00205_4;
+f00205_6 Follow f00205_5;
+f00205_7 Follow f00205_6;
+f00205_8 Follow f00205_7;
+f00205_9 Follow f00205_8;
+in00206 FLAG;
+f00206_1 Follow in00206;
+f00206_2 Follow f00206_1;
+f00206_3 Follow f00206_2;
+f00206_4 Follow f00206_3;
+f00206_5 Follow f00206_4;
+f00206_6 Follow f00206_5;
+f00206_7 Follow f00206_6;
+f00206_8 Follow f00206_7;
+f00206_9 Follow f00206_8;
+in00207 FLAG;
+f00207_1 Follow in00207;
+f00207_2 Follow f00207_1;
+f00207_3 Follow f00207_2;
+f00207_4 Follow f00207_3;
+f00207_5 Follow f00207_4;
+f00207_6 Follow f00207_5;
+f00207_7 Follow f00207_6;
+f00207_8 Follow f00207_7;
+f00207_9 Follow f00207_8;
+in00208 FLAG;
+f00208_1 Follow in00208;
+f00208_2 Follow f00208_1;
+f00208_3 Follow f00208_2;
+f00208_4 Follow f00208_3;
+f00208_5 Follow f00208_4;
+f00208_6 Follow f00208_5;
+f00208_7 Follow f00208_6;
+f00208_8 Follow f00208_7;
+f00208_9 Follow f00208_8;
+in00209 FLAG;
+f00209_1 Follow in00209;
+f00209_2 Follow f00209_1;
+f00209_3 Follow f00209_2;
+f00209_4 Follow f00209_3;
+f00209_5 Follow f00209_4;
+f00209_6 Follow f00209_5;
+f00209_7 Follow f00209_6;
+f00209_8 Follow f00209_7;
+f00209_9 Follow f00209_8;
+in00210 FLAG;
+f00210_1 Follow in00210;
+f00210_2 Follow f00210_1;
+f00210_3 Follow f00210_2;
+f00210_4 Follow f00210_3;
+f00210_5 Follow f00210_4;
+f00210_6 Follow f00210_5;
+f00210_7 Follow f00210_6;
+f00210_8 Follow f00210_7;
+f00210_9 Follow f00210_8;
+in00211 FLAG;
+f00211_1 Follow in00211;
+f00211_2 Follow f00211_1;
+f00211_3 Follow f00211_2;
+f00211_4 Follow f00211_3;
+f00211_5 Follow f00211_4;
+f00211_6 Follow f00211_5;
+f00211_7 Follow f00211_6;
+f00211_8 Follow f00211_7;
+f00211_9 Follow f00211_8;
+in00212 FLAG;
+f00212_1 Follow in00212;
+f00212_2 Follow f00212_1;
+f00212_3 Follow f00212_2;
+f00212_4 Follow f00212_3;
+f00212_5 Follow f00212_4;
+f00212_6 Follow f00212_5;
+f00212_7 Follow f00212_6;
+f00212_8 Follow f00212_7;
+f00212_9 Follow f00212_8;
+in00213 FLAG;
+f00213_1 Follow in00213;
+f00213_2 Follow f00213_1;
+f00213_3 Follow f00213_2;
+f00213_4 Follow f00213_3;
+f00213_5 Follow f00213_4;
+f00213_6 Follow f00213_5;
+f00213_7 Follow f00213_6;
+f00213_8 Follow f00213_7;
+f00213_9 Follow f00213_8;
+in00214 FLAG;
+f00214_1 Follow in00214;
+f00214_2 Follow f00214_1;
+f00214_3 Follow f00214_2;
+f00214_4 Follow f00214_3;
+f00214_5 Follow f00214_4;
+f00214_6 Follow f00214_5;
+f00214_7 Follow f00214_6;
+f00214_8 Follow f00214_7;
+f00214_9 Follow f00214_8;
+in00215 FLAG;
+f00215_1 Follow in00215;
+f00215_2 Follow f00215_1;
+f00215_3 Follow f00215_2;
+f00215_4 Follow f00215_3;
+f00215_5 Follow f00215_4;
+f00215_6 Follow f00215_5;
+f00215_7 Follow f00215_6;
+f00215_8 Follow f00215_7;
+f00215_9 Follow f00215_8;
+in00216 FLAG;
+f00216_1 Follow in00216;
+f00216_2 Follow f00216_1;
+f00216_3 Follow f00216_2;
+f00216_4 Follow f00216_3;
+f00216_5 Follow f00216_4;
+f00216_6 Follow f00216_5;
+f00216_7 Follow f00216_6;
+f00216_8 Follow f00216_7;
+f00216_9 Follow f00216_8;
+in00217 FLAG;
+f00217_1 Follow in00217;
+f00217_2 Follow f00217_1;
+f00217_3 Follow f00217_2;
+f00217_4 Follow f00217_3;
+f00217_5 Follow f00217_4;
+f00217_6 Follow f00217_5;
+f00217_7 Follow f00217_6;
+f00217_8 Follow f00217_7;
+f00217_9 Follow f00217_8;
+in00218 FLAG;
+f00218_1 Follow in00218;
+f00218_2 Follow f00218_1;
+f00218_3 Follow f00218_2;
+f00218_4 Follow f00218_3;
+f00218_5 Follow f00218_4;
+f00218_6 Follow f00218_5;
+f00218_7 Follow f00218_6;
+f00218_8 Follow f00218_7;
+f00218_9 Follow f00218_8;
+in00219 FLAG;
+f00219_1 Follow in00219;
+f00219_2 Follow f00219_1;
+f00219_3 Follow f00219_2;
+f00219_4 Follow f00219_3;
+f00219_5 Follow f00219_4;
+f00219_6 Follow f00219_5;
+f00219_7 Follow f00219_6;
+f00219_8 Follow f00219_7;
+f00219_9 Follow f00219_8;
+in00220 FLAG;
+f00220_1 Follow in00220;
+f00220_2 Follow f00220_1;
+f00220_3 Follow f00220_2;
+f00220_4 Follow f00220_3;
+f00220_5 Follow f00220_4;
+f00220_6 Follow f00220_5;
+f00220_7 Follow f00220_6;
+f00220_8 Follow f00220_7;
+f00220_9 Follow f00220_8;
+in00221 FLAG;
+f00221_1 Follow in00221;
+f00221_2 Follow f00221_1;
+f00221_3 Follow f00221_2;
+f00221_4 Follow f00221_3;
+f00221_5 Follow f00221_4;
+f00221_6 Follow f00221_5;
+f00221_7 Follow f00221_6;
+f00221_8 Follow f00221_7;
+f00221_9 Follow f00221_8;
+in00222 FLAG;
+f00222_1 Follow in00222;
+f00222_2 Follow f00222_1;
+f00222_3 Follow f00222_2;
+f00222_4 Follow f00222_3;
+f00222_5 Follow f00222_4;
+f00222_6 Follow f00222_5;
+f00222_7 Follow f00222_6;
+f00222_8 Follow f00222_7;
+f00222_9 Follow f00222_8;
+in00223 FLAG;
+f00223_1 Follow in00223;
+f00223_2 Follow f00223_1;
+f00223_3 Follow f00223_2;
+f00223_4 Follow f00223_3;
+f00223_5 Follow f00223_4;
+f00223_6 Follow f00223_5;
+f00223_7 Follow f00223_6;
+f00223_8 Follow f00223_7;
+f00223_9 Follow f00223_8;
+in00224 FLAG;
+f00224_1 Follow in00224;
+f00224_2 Follow f00224_1;
+f00224_3 Follow f00224_2;
+f00224_4 Follow f00224_3;
+f00224_5 Follow f00224_4;
+f00224_6 Follow f00224_5;
+f00224_7 Follow f00224_6;
+f00224_8 Follow f00224_7;
+f00224_9 Follow f00224_8;
+in00225 FLAG;
+f00225_1 Follow in00225;
+f00225_2 Follow f00225_1;
+f00225_3 Follow f00225_2;
+f00225_4 Follow f00225_3;
+f00225_5 Follow f00225_4;
+f00225_6 Follow f00225_5;
+f00225_7 Follow f00225_6;
+f00225_8 Follow f00225_7;
+f00225_9 Follow f00225_8;
+in00226 FLAG;
+f00226_1 Follow in00226;
+f00226_2 Follow f00226_1;
+f00226_3 Follow f00226_2;
+f00226_4 Follow f00226_3;
+f00226_5 Follow f00226_4;
+f00226_6 Follow f00226_5;
+f00226_7 Follow f00226_6;
+f00226_8 Follow f00226_7;
+f00226_9 Follow f00226_8;
+in00227 FLAG;
+f00227_1 Follow in00227;
+f00227_2 Follow f00227_1;
+f00227_3 Follow f00227_2;
+f00227_4 Follow f00227_3;
+f00227_5 Follow f00227_4;
+f00227_6 Follow f00227_5;
+f00227_7 Follow f00227_6;
+f00227_8 Follow f00227_7;
+f00227_9 Follow f00227_8;
+in00228 FLAG;
+f00228_1 Follow in00228;
+f00228_2 Follow f00228_1;
+f00228_3 Follow f00228_2;
+f00228_4 Follow f00228_3;
+f00228_5 Follow f00228_4;
+f00228_6 Follow f00228_5;
+f00228_7 Follow f00228_6;
+f00228_8 Follow f00228_7;
+f00228_9 Follow f00228_8;
+in00229 FLAG;
+f00229_1 Follow in00229;
+f00229_2 Follow f00229_1;
+f00229_3 Follow f00229_2;
+f00229_4 Follow f00229_3;
+f00229_5 Follow f00229_4;
+f00229_6 Follow f00229_5;
+f00229_7 Follow f00229_6;
+f00229_8 Follow f00229_7;
+f00229_9 Follow f00229_8;
+in00230 FLAG;
+f00230_1 Follow in00230;
+f00230_2 Follow f00230_1;
+f00230_3 Follow f00230_2;
+f00230_4 Follow f00230_3;
+f00230_5 Follow f00230_4;
+f00230_6 Follow f00230_5;
+f00230_7 Follow f00230_6;
+f00230_8 Follow f00230_7;
+f00230_9 Follow f00230_8;
+in00231 FLAG;
+f00231_1 Follow in00231;
+f00231_2 Follow f00231_1;
+f00231_3 Follow f00231_2;
+f00231_4 Follow f00231_3;
+f00231_5 Follow f00231_4;
+f00231_6 Follow f00231_5;
+f00231_7 Follow f00231_6;
+f00231_8 Follow f00231_7;
+f00231_9 Follow f00231_8;
+in00232 FLAG;
+f00232_1 Follow in00232;
+f00232_2 Follow f00232_1;
+f00232_3 Follow f00232_2;
+f00232_4 Follow f00232_3;
+f00232_5 Follow f00232_4;
+f00232_6 Follow f00232_5;
+f00232_7 Follow f00232_6;
+f00232_8 Follow f00232_7;
+f00232_9 Follow f00232_8;
+in00233 FLAG;
+f00233_1 Follow in00233;
+f00233_2 Follow f00233_1;
+f00233_3 Follow f00233_2;
+f00233_4 Follow f00233_3;
+f00233_5 Follow f00233_4;
+f00233_6 Follow f00233_5;
+f00233_7 Follow f00233_6;
+f00233_8 Follow f00233_7;
+f00233_9 Follow f00233_8;
+in00234 FLAG;
+f00234_1 Follow in00234;
+f00234_2 Follow f00234_1;
+f00234_3 Follow f00234_2;
+f00234_4 Follow f00234_3;
+f00234_5 Follow f00234_4;
+f00234_6 Follow f00234_5;
+f00234_7 Follow f00234_6;
+f00234_8 Follow f00234_7;
+f00234_9 Follow f00234_8;
+in00235 FLAG;
+f00235_1 Follow in00235;
+f00235_2 Follow f00235_1;
+f00235_3 Follow f00235_2;
+f00235_4 Follow f00235_3;
+f00235_5 Follow f00235_4;
+f00235_6 Follow f00235_5;
+f00235_7 Follow f00235_6;
+f00235_8 Follow f00235_7;
+f00235_9 Follow f00235_8;
+in00236 FLAG;
+f00236_1 Follow in00236;
+f00236_2 Follow f00236_1;
+f00236_3 Follow f00236_2;
+f00236_4 Follow f00236_3;
+f00236_5 Follow f00236_4;
+f00236_6 Follow f00236_5;
+f00236_7 Follow f00236_6;
+f00236_8 Follow f00236_7;
+f00236_9 Follow f00236_8;
+in00237 FLAG;
+f00237_1 Follow in00237;
+f00237_2 Follow f00237_1;
+f00237_3 Follow f00237_2;
+f00237_4 Follow f00237_3;
+f00237_5 Follow f00237_4;
+f00237_6 Follow f00237_5;
+f00237_7 Follow f00237_6;
+f00237_8 Follow f00237_7;
+f00237_9 Follow f00237_8;
+in00238 FLAG;
+f00238_1 Follow in00238;
+f00238_2 Follow f00238_1;
+f00238_3 Follow f00238_2;
+f00238_4 Follow f00238_3;
+f00238_5 Follow f00238_4;
+f00238_6 Follow f00238_5;
+f00238_7 Follow f00238_6;
+f00238_8 Follow f00238_7;
+f00238_9 Follow f00238_8;
+in00239 FLAG;
+f00239_1 Follow in00239;
+f00239_2 Follow f00239_1;
+f00239_3 Follow f00239_2;
+f00239_4 Follow f00239_3;
+f00239_5 Follow f00239_4;
+f00239_6 Follow f00239_5;
+f00239_7 Follow f00239_6;
+f00239_8 Follow f00239_7;
+f00239_9 Follow f00239_8;
+in00240 FLAG;
+f00240_1 Follow in00240;
+f00240_2 Follow f00240_1;
+f00240_3 Follow f00240_2;
+f00240_4 Follow f00240_3;
+f00240_5 Follow f00240_4;
+f00240_6 Follow f00240_5;
+f00240_7 Follow f00240_6;
+f00240_8 Follow f00240_7;
+f00240_9 Follow f00240_8;
+in00241 FLAG;
+f00241_1 Follow in00241;
+f00241_2 Follow f00241_1;
+f00241_3 Follow f00241_2;
+f00241_4 Follow f00241_3;
+f00241_5 Follow f00241_4;
+f00241_6 Follow f00241_5;
+f00241_7 Follow f00241_6;
+f00241_8 Follow f00241_7;
+f00241_9 Follow f00241_8;
+in00242 FLAG;
+f00242_1 Follow in00242;
+f00242_2 Follow f00242_1;
+f00242_3 Follow f00242_2;
+f00242_4 Follow f00242_3;
+f00242_5 Follow f00242_4;
+f00242_6 Follow f00242_5;
+f00242_7 Follow f00242_6;
+f00242_8 Follow f00242_7;
+f00242_9 Follow f00242_8;
+in00243 FLAG;
+f00243_1 Follow in00243;
+f00243_2 Follow f00243_1;
+f00243_3 Follow f00243_2;
+f00243_4 Follow f00243_3;
+f00243_5 Follow f00243_4;
+f00243_6 Follow f00243_5;
+f00243_7 Follow f00243_6;
+f00243_8 Follow f00243_7;
+f00243_9 Follow f00243_8;
+in00244 FLAG;
+f00244_1 Follow in00244;
+f00244_2 Follow f00244_1;
+f00244_3 Follow f00244_2;
+f00244_4 Follow f00244_3;
+f00244_5 Follow f00244_4;
+f00244_6 Follow f00244_5;
+f00244_7 Follow f00244_6;
+f00244_8 Follow f00244_7;
+f00244_9 Follow f00244_8;
+in00245 FLAG;
+f00245_1 Follow in00245;
+f00245_2 Follow f00245_1;
+f00245_3 Follow f00245_2;
+f00245_4 Follow f00245_3;
+f00245_5 Follow f00245_4;
+f00245_6 Follow f00245_5;
+f00245_7 Follow f00245_6;
+f00245_8 Follow f00245_7;
+f00245_9 Follow f00245_8;
+in00246 FLAG;
+f00246_1 Follow in00246;
+f00246_2 Follow f00246_1;
+f00246_3 Follow f00246_2;
+f00246_4 Follow f00246_3;
+f00246_5 Follow f00246_4;
+f00246_6 Follow f00246_5;
+f00246_7 Follow f00246_6;
+f00246_8 Follow f00246_7;
+f00246_9 Follow f00246_8;
+in00247 FLAG;
+f00247_1 Follow in00247;
+f00247_2 Follow f00247_1;
+f00247_3 Follow f00247_2;
+f00247_4 Follow f00247_3;
+f00247_5 Follow f00247_4;
+f00247_6 Follow f00247_5;
+f00247_7 Follow f00247_6;
+f00247_8 Follow f00247_7;
+f00247_9 Follow f00247_8;
+in00248 FLAG;
+f00248_1 Follow in00248;
+f00248_2 Follow f00248_1;
+f00248_3 Follow f00248_2;
+f00248_4 Follow f00248_3;
+f00248_5 Follow f00248_4;
+f00248_6 Follow f00248_5;
+f00248_7 Follow f00248_6;
+f00248_8 Follow f00248_7;
+f00248_9 Follow f00248_8;
+in00249 FLAG;
+f00249_1 Follow in00249;
+f00249_2 Follow f00249_1;
+f00249_3 Follow f00249_2;
+f00249_4 Follow f00249_3;
+f00249_5 Follow f00249_4;
+f00249_6 Follow f00249_5;
+f00249_7 Follow f00249_6;
+f00249_8 Follow f00249_7;
+f00249_9 Follow f00249_8;
+in00250 FLAG;
+f00250_1 Follow in00250;
+f00250_2 Follow f00250_1;
+f00250_3 Follow f00250_2;
+f00250_4 Follow f00250_3;
+f00250_5 Follow f00250_4;
+f00250_6 Follow f00250_5;
+f00250_7 Follow f00250_6;
+f00250_8 Follow f00250_7;
+f00250_9 Follow f00250_8;
+in00251 FLAG;
+f00251_1 Follow in00251;
+f00251_2 Follow f00251_1;
+f00251_3 Follow f00251_2;
+f00251_4 Follow f00251_3;
+f00251_5 Follow f00251_4;
+f00251_6 Follow f00251_5;
+f00251_7 Follow f00251_6;
+f00251_8 Follow f00251_7;
+f00251_9 Follow f00251_8;
+in00252 FLAG;
+f00252_1 Follow in00252;
+f00252_2 Follow f00252_1;
+f00252_3 Follow f00252_2;
+f00252_4 Follow f00252_3;
+f00252_5 Follow f00252_4;
+f00252_6 Follow f00252_5;
+f00252_7 Follow f00252_6;
+f00252_8 Follow f00252_7;
+f00252_9 Follow f00252_8;
+in00253 FLAG;
+f00253_1 Follow in00253;
+f00253_2 Follow f00253_1;
+f00253_3 Follow f00253_2;
+f00253_4 Follow f00253_3;
+f00253_5 Follow f00253_4;
+f00253_6 Follow f00253_5;
+f00253_7 Follow f00253_6;
+f00253_8 Follow f00253_7;
+f00253_9 Follow f00253_8;
+in00254 FLAG;
+f00254_1 Follow in00254;
+f00254_2 Follow f00254_1;
+f00254_3 Follow f00254_2;
+f00254_4 Follow f00254_3;
+f00254_5 Follow f00254_4;
+f00254_6 Follow f00254_5;
+f00254_7 Follow f00254_6;
+f00254_8 Follow f00254_7;
+f00254_9 Follow f00254_8;
+in00255 FLAG;
+f00255_1 Follow in00255;
+f00255_2 Follow f00255_1;
+f00255_3 Follow f00255_2;
+f00255_4 Follow f00255_3;
+f00255_5 Follow f00255_4;
+f00255_6 Follow f00255_5;
+f00255_7 Follow f00255_6;
+f00255_8 Follow f00255_7;
+f00255_9 Follow f00255_8;
+in00256 FLAG;
+f00256_1 Follow in00256;
+f00256_2 Follow f00256_1;
+f00256_3 Follow f00256_2;
+f00256_4 Follow f00256_3;
+f00256_5 Follow f00256_4;
+f00256_6 Follow f00256_5;
+f00256_7 Follow f00256_6;
+f00256_8 Follow f00256_7;
+f00256_9 Follow f00256_8;
+in00257 FLAG;
+f00257_1 Follow in00257;
+f00257_2 Follow f00257_1;
+f00257_3 Follow f00257_2;
+f00257_4 Follow f00257_3;
+f00257_5 Follow f00257_4;
+f00257_6 Follow f00257_5;
+f00257_7 Follow f00257_6;
+f00257_8 Follow f00257_7;
+f00257_9 Follow f00257_8;
+in00258 FLAG;
+f00258_1 Follow in00258;
+f00258_2 Follow f00258_1;
+f00258_3 Follow f00258_2;
+f00258_4 Follow f00258_3;
+f00258_5 Follow f00258_4;
+f00258_6 Follow f00258_5;
+f00258_7 Follow f00258_6;
+f00258_8 Follow f00258_7;
+f00258_9 Follow f00258_8;
+in00259 FLAG;
+f00259_1 Follow in00259;
+f00259_2 Follow f00259_1;
+f00259_3 Follow f00259_2;
+f00259_4 Follow f00259_3;
+f00259_5 Follow f00259_4;
+f00259_6 Follow f00259_5;
+f00259_7 Follow f00259_6;
+f00259_8 Follow f00259_7;
+f00259_9 Follow f00259_8;
+in00260 FLAG;
+f00260_1 Follow in00260;
+f00260_2 Follow f00260_1;
+f00260_3 Follow f00260_2;
+f00260_4 Follow f00260_3;
+f00260_5 Follow f00260_4;
+f00260_6 Follow f00260_5;
+f00260_7 Follow f00260_6;
+f00260_8 Follow f00260_7;
+f00260_9 Follow f00260_8;
+in00261 FLAG;
+f00261_1 Follow in00261;
+f00261_2 Follow f00261_1;
+f00261_3 Follow f00261_2;
+f00261_4 Follow f00261_3;
+f00261_5 Follow f00261_4;
+f00261_6 Follow f00261_5;
+f00261_7 Follow f00261_6;
+f00261_8 Follow f00261_7;
+f00261_9 Follow f00261_8;
+in00262 FLAG;
+f00262_1 Follow in00262;
+f00262_2 Follow f00262_1;
+f00262_3 Follow f00262_2;
+f00262_4 Follow f00262_3;
+f00262_5 Follow f00262_4;
+f00262_6 Follow f00262_5;
+f00262_7 Follow f00262_6;
+f00262_8 Follow f00262_7;
+f00262_9 Follow f00262_8;
+in00263 FLAG;
+f00263_1 Follow in00263;
+f00263_2 Follow f00263_1;
+f00263_3 Follow f00263_2;
+f00263_4 Follow f00263_3;
+f00263_5 Follow f00263_4;
+f00263_6 Follow f00263_5;
+f00263_7 Follow f00263_6;
+f00263_8 Follow f00263_7;
+f00263_9 Follow f00263_8;
+in00264 FLAG;
+f00264_1 Follow in00264;
+f00264_2 Follow f00264_1;
+f00264_3 Follow f00264_2;
+f00264_4 Follow f00264_3;
+f00264_5 Follow f00264_4;
+f00264_6 Follow f00264_5;
+f00264_7 Follow f00264_6;
+f00264_8 Follow f00264_7;
+f00264_9 Follow f00264_8;
+in00265 FLAG;
+f00265_1 Follow in00265;
+f00265_2 Follow f00265_1;
+f00265_3 Follow f00265_2;
+f00265_4 Follow f00265_3;
+f00265_5 Follow f00265_4;
+f00265_6 Follow f00265_5;
+f00265_7 Follow f00265_6;
+f00265_8 Follow f00265_7;
+f00265_9 Follow f00265_8;
+in00266 FLAG;
+f00266_1 Follow in00266;
+f00266_2 Follow f00266_1;
+f00266_3 Follow f00266_2;
+f00266_4 Follow f00266_3;
+f00266_5 Follow f00266_4;
+f00266_6 Follow f00266_5;
+f00266_7 Follow f00266_6;
+f00266_8 Follow f00266_7;
+f00266_9 Follow f00266_8;
+in00267 FLAG;
+f00267_1 Follow in00267;
+f00267_2 Follow f00267_1;
+f00267_3 Follow f00267_2;
+f00267_4 Follow f00267_3;
+f00267_5 Follow f00267_4;
+f00267_6 Follow f00267_5;
+f00267_7 Follow f00267_6;
+f00267_8 Follow f00267_7;
+f00267_9 Follow f00267_8;
+in00268 FLAG;
+f00268_1 Follow in00268;
+f00268_2 Follow f00268_1;
+f00268_3 Follow f00268_2;
+f00268_4 Follow f00268_3;
+f00268_5 Follow f00268_4;
+f00268_6 Follow f00268_5;
+f00268_7 Follow f00268_6;
+f00268_8 Follow f00268_7;
+f00268_9 Follow f00268_8;
+in00269 FLAG;
+f00269_1 Follow in00269;
+f00269_2 Follow f00269_1;
+f00269_3 Follow f00269_2;
+f00269_4 Follow f00269_3;
+f00269_5 Follow f00269_4;
+f00269_6 Follow f00269_5;
+f00269_7 Follow f00269_6;
+f00269_8 Follow f00269_7;
+f00269_9 Follow f00269_8;
+in00270 FLAG;
+f00270_1 Follow in00270;
+f00270_2 Follow f00270_1;
+f00270_3 Follow f00270_2;
+f00270_4 Follow f00270_3;
+f00270_5 Follow f00270_4;
+f00270_6 Follow f00270_5;
+f00270_7 Follow f00270_6;
+f00270_8 Follow f00270_7;
+f00270_9 Follow f00270_8;
+in00271 FLAG;
+f00271_1 Follow in00271;
+f00271_2 Follow f00271_1;
+f00271_3 Follow f00271_2;
+f00271_4 Follow f00271_3;
+f00271_5 Follow f00271_4;
+f00271_6 Follow f00271_5;
+f00271_7 Follow f00271_6;
+f00271_8 Follow f00271_7;
+f00271_9 Follow f00271_8;
+in00272 FLAG;
+f00272_1 Follow in00272;
+f00272_2 Follow f00272_1;
+f00272_3 Follow f00272_2;
+f00272_4 Follow f00272_3;
+f00272_5 Follow f00272_4;
+f00272_6 Follow f00272_5;
+f00272_7 Follow f00272_6;
+f00272_8 Follow f00272_7;
+f00272_9 Follow f00272_8;
+in00273 FLAG;
+f00273_1 Follow in00273;
+f00273_2 Follow f00273_1;
+f00273_3 Follow f00273_2;
+f00273_4 Follow f00273_3;
+f00273_5 Follow f00273_4;
+f00273_6 Follow f00273_5;
+f00273_7 Follow f00273_6;
+f00273_8 Follow f00273_7;
+f00273_9 Follow f00273_8;
+in00274 FLAG;
+f00274_1 Follow in00274;
+f00274_2 Follow f00274_1;
+f00274_3 Follow f00274_2;
+f00274_4 Follow f00274_3;
+f00274_5 Follow f00274_4;
+f00274_6 Follow f00274_5;
+f00274_7 Follow f00274_6;
+f00274_8 Follow f00274_7;
+f00274_9 Follow f00274_8;
+in00275 FLAG;
+f00275_1 Follow in00275;
+f00275_2 Follow f00275_1;
+f00275_3 Follow f00275_2;
+f00275_4 Follow f00275_3;
+f00275_5 Follow f00275_4;
+f00275_6 Follow f00275_5;
+f00275_7 Follow f00275_6;
+f00275_8 Follow f00275_7;
+f00275_9 Follow f00275_8;
+in00276 FLAG;
+f00276_1 Follow in00276;
+f00276_2 Follow f00276_1;
+f00276_3 Follow f00276_2;
+f00276_4 Follow f00276_3;
+f00276_5 Follow f00276_4;
+f00276_6 Follow f00276_5;
+f00276_7 Follow f00276_6;
+f00276_8 Follow f00276_7;
+f00276_9 Follow f00276_8;
+in00277 FLAG;
+f00277_1 Follow in00277;
+f00277_2 Follow f00277_1;
+f00277_3 Follow f00277_2;
+f00277_4 Follow f00277_3;
+f00277_5 Follow f00277_4;
+f00277_6 Follow f00277_5;
+f00277_7 Follow f00277_6;
+f00277_8 Follow f00277_7;
+f00277_9 Follow f00277_8;
+in00278 FLAG;
+f00278_1 Follow in00278;
+f00278_2 Follow f00278_1;
+f00278_3 Follow f00278_2;
+f00278_4 Follow f00278_3;
+f00278_5 Follow f00278_4;
+f00278_6 Follow f00278_5;
+f00278_7 Follow f00278_6;
+f00278_8 Follow f00278_7;
+f00278_9 Follow f00278_8;
+in00279 FLAG;
+f00279_1 Follow in00279;
+f00279_2 Follow f00279_1;
+f00279_3 Follow f00279_2;
+f00279_4 Follow f00279_3;
+f00279_5 Follow f00279_4;
+f00279_6 Follow f00279_5;
+f00279_7 Follow f00279_6;
+f00279_8 Follow f00279_7;
+f00279_9 Follow f00279_8;
+in00280 FLAG;
+f00280_1 Follow in00280;
+f00280_2 Follow f00280_1;
+f00280_3 Follow f00280_2;
+f00280_4 Follow f00280_3;
+f00280_5 Follow f00280_4;
+f00280_6 Follow f00280_5;
+f00280_7 Follow f00280_6;
+f00280_8 Follow f00280_7;
+f00280_9 Follow f00280_8;
+in00281 FLAG;
+f00281_1 Follow in00281;
+f00281_2 Follow f00281_1;
+f00281_3 Follow f00281_2;
+f00281_4 Follow f00281_3;
+f00281_5 Follow f00281_4;
+f00281_6 Follow f00281_5;
+f00281_7 Follow f00281_6;
+f00281_8 Follow f00281_7;
+f00281_9 Follow f00281_8;
+in00282 FLAG;
+f00282_1 Follow in00282;
+f00282_2 Follow f00282_1;
+f00282_3 Follow f00282_2;
+f00282_4 Follow f00282_3;
+f00282_5 Follow f00282_4;
+f00282_6 Follow f00282_5;
+f00282_7 Follow f00282_6;
+f00282_8 Follow f00282_7;
+f00282_9 Follow f00282_8;
+in00283 FLAG;
+f00283_1 Follow in00283;
+f00283_2 Follow f00283_1;
+f00283_3 Follow f00283_2;
+f00283_4 Follow f00283_3;
+f00283_5 Follow f00283_4;
+f00283_6 Follow f00283_5;
+f00283_7 Follow f00283_6;
+f00283_8 Follow f00283_7;
+f00283_9 Follow f00283_8;
+in00284 FLAG;
+f00284_1 Follow in00284;
+f00284_2 Follow f00284_1;
+f00284_3 Follow f00284_2;
+f00284_4 Follow f00284_3;
+f00284_5 Follow f00284_4;
+f00284_6 Follow f00284_5;
+f00284_7 Follow f00284_6;
+f00284_8 Follow f00284_7;
+f00284_9 Follow f00284_8;
+in00285 FLAG;
+f00285_1 Follow in00285;
+f00285_2 Follow f00285_1;
+f00285_3 Follow f00285_2;
+f00285_4 Follow f00285_3;
+f00285_5 Follow f00285_4;
+f00285_6 Follow f00285_5;
+f00285_7 Follow f00285_6;
+f00285_8 Follow f00285_7;
+f00285_9 Follow f00285_8;
+in00286 FLAG;
+f00286_1 Follow in00286;
+f00286_2 Follow f00286_1;
+f00286_3 Follow f00286_2;
+f00286_4 Follow f00286_3;
+f00286_5 Follow f00286_4;
+f00286_6 Follow f00286_5;
+f00286_7 Follow f00286_6;
+f00286_8 Follow f00286_7;
+f00286_9 Follow f00286_8;
+in00287 FLAG;
+f00287_1 Follow in00287;
+f00287_2 Follow f00287_1;
+f00287_3 Follow f00287_2;
+f00287_4 Follow f00287_3;
+f00287_5 Follow f00287_4;
+f00287_6 Follow f00287_5;
+f00287_7 Follow f00287_6;
+f00287_8 Follow f00287_7;
+f00287_9 Follow f00287_8;
+in00288 FLAG;
+f00288_1 Follow in00288;
+f00288_2 Follow f00288_1;
+f00288_3 Follow f00288_2;
+f00288_4 Follow f00288_3;
+f00288_5 Follow f00288_4;
+f00288_6 Follow f00288_5;
+f00288_7 Follow f00288_6;
+f00288_8 Follow f00288_7;
+f00288_9 Follow f00288_8;
+in00289 FLAG;
+f00289_1 Follow in00289;
+f00289_2 Follow f00289_1;
+f00289_3 Follow f00289_2;
+f00289_4 Follow f00289_3;
+f00289_5 Follow f00289_4;
+f00289_6 Follow f00289_5;
+f00289_7 Follow f00289_6;
+f00289_8 Follow f00289_7;
+f00289_9 Follow f00289_8;
+in00290 FLAG;
+f00290_1 Follow in00290;
+f00290_2 Follow f00290_1;
+f00290_3 Follow f00290_2;
+f00290_4 Follow f00290_3;
+f00290_5 Follow f00290_4;
+f00290_6 Follow f00290_5;
+f00290_7 Follow f00290_6;
+f00290_8 Follow f00290_7;
+f00290_9 Follow f00290_8;
+in00291 FLAG;
+f00291_1 Follow in00291;
+f00291_2 Follow f00291_1;
+f00291_3 Follow f00291_2;
+f00291_4 Follow f00291_3;
+f00291_5 Follow f00291_4;
+f00291_6 Follow f00291_5;
+f00291_7 Follow f00291_6;
+f00291_8 Follow f00291_7;
+f00291_9 Follow f00291_8;
+in00292 FLAG;
+f00292_1 Follow in00292;
+f00292_2 Follow f00292_1;
+f00292_3 Follow f00292_2;
+f00292_4 Follow f00292_3;
+f00292_5 Follow f00292_4;
+f00292_6 Follow f00292_5;
+f00292_7 Follow f00292_6;
+f00292_8 Follow f00292_7;
+f00292_9 Follow f00292_8;
+in00293 FLAG;
+f00293_1 Follow in00293;
+f00293_2 Follow f00293_1;
+f00293_3 Follow f00293_2;
+f00293_4 Follow f00293_3;
+f00293_5 Follow f00293_4;
+f00293_6 Follow f00293_5;
+f00293_7 Follow f00293_6;
+f00293_8 Follow f00293_7;
+f00293_9 Follow f00293_8;
+in00294 FLAG;
+f00294_1 Follow in00294;
+f00294_2 Follow f00294_1;
+f00294_3 Follow f00294_2;
+f00294_4 Follow f00294_3;
+f00294_5 Follow f00294_4;
+f00294_6 Follow f00294_5;
+f00294_7 Follow f00294_6;
+f00294_8 Follow f00294_7;
+f00294_9 Follow f00294_8;
+in00295 FLAG;
+f00295_1 Follow in00295;
+f00295_2 Follow f00295_1;
+f00295_3 Follow f00295_2;
+f00295_4 Follow f00295_3;
+f00295_5 Follow f00295_4;
+f00295_6 Follow f00295_5;
+f00295_7 Follow f00295_6;
+f00295_8 Follow f00295_7;
+f00295_9 Follow f00295_8;
+in00296 FLAG;
+f00296_1 Follow in00296;
+f00296_2 Follow f00296_1;
+f00296_3 Follow f00296_2;
+f00296_4 Follow f00296_3;
+f00296_5 Follow f00296_4;
+f00296_6 Follow f00296_5;
+f00296_7 Follow f00296_6;
+f00296_8 Follow f00296_7;
+f00296_9 Follow f00296_8;
+in00297 FLAG;
+f00297_1 Follow in00297;
+f00297_2 Follow f00297_1;
+f00297_3 Follow f00297_2;
+f00297_4 Follow f00297_3;
+f00297_5 Follow f00297_4;
+f00297_6 Follow f00297_5;
+f00297_7 Follow f00297_6;
+f00297_8 Follow f00297_7;
+f00297_9 Follow f00297_8;
+in00298 FLAG;
+f00298_1 Follow in00298;
+f00298_2 Follow f00298_1;
+f00298_3 Follow f00298_2;
+f00298_4 Follow f00298_3;
+f00298_5 Follow f00298_4;
+f00298_6 Follow f00298_5;
+f00298_7 Follow f00298_6;
+f00298_8 Follow f00298_7;
+f00298_9 Follow f00298_8;
+in00299 FLAG;
+f00299_1 Follow in00299;
+f00299_2 Follow f00299_1;
+f00299_3 Follow f00299_2;
+f00299_4 Follow f00299_3;
+f00299_5 Follow f00299_4;
+f00299_6 Follow f00299_5;
+f00299_7 Follow f00299_6;
+f00299_8 Follow f00299_7;
+f00299_9 Follow f00299_8;
+in00300 FLAG;
+f00300_1 Follow in00300;
+f00300_2 Follow f00300_1;
+f00300_3 Follow f00300_2;
+f00300_4 Follow f00300_3;
+f00300_5 Follow f00300_4;
+f00300_6 Follow f00300_5;
+f00300_7 Follow f00300_6;
+f00300_8 Follow f00300_7;
+f00300_9 Follow f00300_8;
+in00301 FLAG;
+f00301_1 Follow in00301;
+f00301_2 Follow f00301_1;
+f00301_3 Follow f00301_2;
+f00301_4 Follow f00301_3;
+f00301_5 Follow f00301_4;
+f00301_6 Follow f00301_5;
+f00301_7 Follow f00301_6;
+f00301_8 Follow f00301_7;
+f00301_9 Follow f00301_8;
+in00302 FLAG;
+f00302_1 Follow in00302;
+f00302_2 Follow f00302_1;
+f00302_3 Follow f00302_2;
+f00302_4 Follow f00302_3;
+f00302_5 Follow f00302_4;
+f00302_6 Follow f00302_5;
+f00302_7 Follow f00302_6;
+f00302_8 Follow f00302_7;
+f00302_9 Follow f00302_8;
+in00303 FLAG;
+f00303_1 Follow in00303;
+f00303_2 Follow f00303_1;
+f00303_3 Follow f00303_2;
+f00303_4 Follow f00303_3;
+f00303_5 Follow f00303_4;
+f00303_6 Follow f00303_5;
+f00303_7 Follow f00303_6;
+f00303_8 Follow f00303_7;
+f00303_9 Follow f00303_8;
+in00304 FLAG;
+f00304_1 Follow in00304;
+f00304_2 Follow f00304_1;
+f00304_3 Follow f00304_2;
+f00304_4 Follow f00304_3;
+f00304_5 Follow f00304_4;
+f00304_6 Follow f00304_5;
+f00304_7 Follow f00304_6;
+f00304_8 Follow f00304_7;
+f00304_9 Follow f00304_8;
+in00305 FLAG;
+f00305_1 Follow in00305;
+f00305_2 Follow f00305_1;
+f00305_3 Follow f00305_2;
+f00305_4 Follow f00305_3;
+f00305_5 Follow f00305_4;
+f00305_6 Follow f00305_5;
+f00305_7 Follow f00305_6;
+f00305_8 Follow f00305_7;
+f00305_9 Follow f00305_8;
+in00306 FLAG;
+f00306_1 Follow in00306;
+f00306_2 Follow f00306_1;
+f00306_3 Follow f00306_2;
+f00306_4 Follow f00306_3;
+f00306_5 Follow f00306_4;
+f00306_6 Follow f00306_5;
+f00306_7 Follow f00306_6;
+f00306_8 Follow f00306_7;
+f00306_9 Follow f00306_8;
+in00307 FLAG;
+f00307_1 Follow in00307;
+f00307_2 Follow f00307_1;
+f00307_3 Follow f00307_2;
+f00307_4 Follow f00307_3;
+f00307_5 Follow f00307_4;
+f00307_6 Follow f00307_5;
+f00307_7 Follow f00307_6;
+f00307_8 Follow f00307_7;
+f00307_9 Follow f00307_8;
+in00308 FLAG;
+f00308_1 Follow in00308;
+f00308_2 Follow f00308_1;
+f00308_3 Follow f00308_2;
+f00308_4 Follow f00308_3;
+f00308_5 Follow f00308_4;
+f00308_6 Follow f00308_5;
+f00308_7 Follow f00308_6;
+f00308_8 Follow f00308_7;
+f00308_9 Follow f00308_8;
+in00309 FLAG;
+f00309_1 Follow in00309;
+f00309_2 Follow f00309_1;
+f00309_3 Follow f00309_2;
+f00309_4 Follow f00309_3;
+f00309_5 Follow f00309_4;
+f00309_6 Follow f00309_5;
+f00309_7 Follow f00309_6;
+f00309_8 Follow f00309_7;
+f00309_9 Follow f00309_8;
+in00310 FLAG;
+f00310_1 Follow in00310;
+f00310_2 Follow f00310_1;
+f00310_3 Follow f00310_2;
+f00310_4 Follow f00310_3;
+f00310_5 Follow f00310_4;
+f00310_6 Follow f00310_5;
+f00310_7 Follow f00310_6;
+f00310_8 Follow f00310_7;
+f00310_9 Follow f00310_8;
+in00311 FLAG;
+f00311_1 Follow in00311;
+f00311_2 Follow f00311_1;
+f00311_3 Follow f00311_2;
+f00311_4 Follow f00311_3;
+f00311_5 Follow f00311_4;
+f00311_6 Follow f00311_5;
+f00311_7 Follow f00311_6;
+f00311_8 Follow f00311_7;
+f00311_9 Follow f00311_8;
+in00312 FLAG;
+f00312_1 Follow in00312;
+f00312_2 Follow f00312_1;
+f00312_3 Follow f00312_2;
+f00312_4 Follow f00312_3;
+f00312_5 Follow f00312_4;
+f00312_6 Follow f00312_5;
+f00312_7 Follow f00312_6;
+f00312_8 Follow f00312_7;
+f00312_9 Follow f00312_8;
+in00313 FLAG;
+f00313_1 Follow in00313;
+f00313_2 Follow f00313_1;
+f00313_3 Follow f00313_2;
+f00313_4 Follow f00313_3;
+f00313_5 Follow f00313_4;
+f00313_6 Follow f00313_5;
+f00313_7 Follow f00313_6;
+f00313_8 Follow f00313_7;
+f00313_9 Follow f00313_8;
+in00314 FLAG;
+f00314_1 Follow in00314;
+f00314_2 Follow f00314_1;
+f00314_3 Follow f00314_2;
+f00314_4 Follow f00314_3;
+f00314_5 Follow f00314_4;
+f00314_6 Follow f00314_5;
+f00314_7 Follow f00314_6;
+f00314_8 Follow f00314_7;
+f00314_9 Follow f00314_8;
+in00315 FLAG;
+f00315_1 Follow in00315;
+f00315_2 Follow f00315_1;
+f00315_3 Follow f00315_2;
+f00315_4 Follow f00315_3;
+f00315_5 Follow f00315_4;
+f00315_6 Follow f00315_5;
+f00315_7 Follow f00315_6;
+f00315_8 Follow f00315_7;
+f00315_9 Follow f00315_8;
+in00316 FLAG;
+f00316_1 Follow in00316;
+f00316_2 Follow f00316_1;
+f00316_3 Follow f00316_2;
+f00316_4 Follow f00316_3;
+f00316_5 Follow f00316_4;
+f00316_6 Follow f00316_5;
+f00316_7 Follow f00316_6;
+f00316_8 Follow f00316_7;
+f00316_9 Follow f00316_8;
+in00317 FLAG;
+f00317_1 Follow in00317;
+f00317_2 Follow f00317_1;
+f00317_3 Follow f00317_2;
+f00317_4 Follow f00317_3;
+f00317_5 Follow f00317_4;
+f00317_6 Follow f00317_5;
+f00317_7 Follow f00317_6;
+f00317_8 Follow f00317_7;
+f00317_9 Follow f00317_8;
+in00318 FLAG;
+f00318_1 Follow in00318;
+f00318_2 Follow f00318_1;
+f00318_3 Follow f00318_2;
+f00318_4 Follow f00318_3;
+f00318_5 Follow f00318_4;
+f00318_6 Follow f00318_5;
+f00318_7 Follow f00318_6;
+f00318_8 Follow f00318_7;
+f00318_9 Follow f00318_8;
+in00319 FLAG;
+f00319_1 Follow in00319;
+f00319_2 Follow f00319_1;
+f00319_3 Follow f00319_2;
+f00319_4 Follow f00319_3;
+f00319_5 Follow f00319_4;
+f00319_6 Follow f00319_5;
+f00319_7 Follow f00319_6;
+f00319_8 Follow f00319_7;
+f00319_9 Follow f00319_8;
+in00320 FLAG;
+f00320_1 Follow in00320;
+f00320_2 Follow f00320_1;
+f00320_3 Follow f00320_2;
+f00320_4 Follow f00320_3;
+f00320_5 Follow f00320_4;
+f00320_6 Follow f00320_5;
+f00320_7 Follow f00320_6;
+f00320_8 Follow f00320_7;
+f00320_9 Follow f00320_8;
+in00321 FLAG;
+f00321_1 Follow in00321;
+f00321_2 Follow f00321_1;
+f00321_3 Follow f00321_2;
+f00321_4 Follow f00321_3;
+f00321_5 Follow f00321_4;
+f00321_6 Follow f00321_5;
+f00321_7 Follow f00321_6;
+f00321_8 Follow f00321_7;
+f00321_9 Follow f00321_8;
+in00322 FLAG;
+f00322_1 Follow in00322;
+f00322_2 Follow f00322_1;
+f00322_3 Follow f00322_2;
+f00322_4 Follow f00322_3;
+f00322_5 Follow f00322_4;
+f00322_6 Follow f00322_5;
+f00322_7 Follow f00322_6;
+f00322_8 Follow f00322_7;
+f00322_9 Follow f00322_8;
+in00323 FLAG;
+f00323_1 Follow in00323;
+f00323_2 Follow f00323_1;
+f00323_3 Follow f00323_2;
+f00323_4 Follow f00323_3;
+f00323_5 Follow f00323_4;
+f00323_6 Follow f00323_5;
+f00323_7 Follow f00323_6;
+f00323_8 Follow f00323_7;
+f00323_9 Follow f00323_8;
+in00324 FLAG;
+f00324_1 Follow in00324;
+f00324_2 Follow f00324_1;
+f00324_3 Follow f00324_2;
+f00324_4 Follow f00324_3;
+f00324_5 Follow f00324_4;
+f00324_6 Follow f00324_5;
+f00324_7 Follow f00324_6;
+f00324_8 Follow f00324_7;
+f00324_9 Follow f00324_8;
+in00325 FLAG;
+f00325_1 Follow in00325;
+f00325_2 Follow f00325_1;
+f00325_3 Follow f00325_2;
+f00325_4 Follow f00325_3;
+f00325_5 Follow f00325_4;
+f00325_6 Follow f00325_5;
+f00325_7 Follow f00325_6;
+f00325_8 Follow f00325_7;
+f00325_9 Follow f00325_8;
+in00326 FLAG;
+f00326_1 Follow in00326;
+f00326_2 Follow f00326_1;
+f00326_3 Follow f00326_2;
+f00326_4 Follow f00326_3;
+f00326_5 Follow f00326_4;
+f00326_6 Follow f00326_5;
+f00326_7 Follow f00326_6;
+f00326_8 Follow f00326_7;
+f00326_9 Follow f00326_8;
+in00327 FLAG;
+f00327_1 Follow in00327;
+f00327_2 Follow f00327_1;
+f00327_3 Follow f00327_2;
+f00327_4 Follow f00327_3;
+f00327_5 Follow f00327_4;
+f00327_6 Follow f00327_5;
+f00327_7 Follow f00327_6;
+f00327_8 Follow f00327_7;
+f00327_9 Follow f00327_8;
+in00328 FLAG;
+f00328_1 Follow in00328;
+f00328_2 Follow f00328_1;
+f00328_3 Follow f00328_2;
+f00328_4 Follow f00328_3;
+f00328_5 Follow f00328_4;
+f00328_6 Follow f00328_5;
+f00328_7 Follow f00328_6;
+f00328_8 Follow f00328_7;
+f00328_9 Follow f00328_8;
+in00329 FLAG;
+f00329_1 Follow in00329;
+f00329_2 Follow f00329_1;
+f00329_3 Follow f00329_2;
+f00329_4 Follow f00329_3;
+f00329_5 Follow f00329_4;
+f00329_6 Follow f00329_5;
+f00329_7 Follow f00329_6;
+f00329_8 Follow f00329_7;
+f00329_9 Follow f00329_8;
+in00330 FLAG;
+f00330_1 Follow in00330;
+f00330_2 Follow f00330_1;
+f00330_3 Follow f00330_2;
+f00330_4 Follow f00330_3;
+f00330_5 Follow f00330_4;
+f00330_6 Follow f00330_5;
+f00330_7 Follow f00330_6;
+f00330_8 Follow f00330_7;
+f00330_9 Follow f00330_8;
+in00331 FLAG;
+f00331_1 Follow in00331;
+f00331_2 Follow f00331_1;
+f00331_3 Follow f00331_2;
+f00331_4 Follow f00331_3;
+f00331_5 Follow f00331_4;
+f00331_6 Follow f00331_5;
+f00331_7 Follow f00331_6;
+f00331_8 Follow f00331_7;
+f00331_9 Follow f00331_8;
+in00332 FLAG;
+f00332_1 Follow in00332;
+f00332_2 Follow f00332_1;
+f00332_3 Follow f00332_2;
+f00332_4 Follow f00332_3;
+f00332_5 Follow f00332_4;
+f00332_6 Follow f00332_5;
+f00332_7 Follow f00332_6;
+f00332_8 Follow f00332_7;
+f00332_9 Follow f00332_8;
+in00333 FLAG;
+f00333_1 Follow in00333;
+f00333_2 Follow f00333_1;
+f00333_3 Follow f00333_2;
+f00333_4 Follow f00333_3;
+f00333_5 Follow f00333_4;
+f00333_6 Follow f00333_5;
+f00333_7 Follow f00333_6;
+f00333_8 Follow f00333_7;
+f00333_9 Follow f00333_8;
+in00334 FLAG;
+f00334_1 Follow in00334;
+f00334_2 Follow f00334_1;
+f00334_3 Follow f00334_2;
+f00334_4 Follow f00334_3;
+f00334_5 Follow f00334_4;
+f00334_6 Follow f00334_5;
+f00334_7 Follow f00334_6;
+f00334_8 Follow f00334_7;
+f00334_9 Follow f00334_8;
+in00335 FLAG;
+f00335_1 Follow in00335;
+f00335_2 Follow f00335_1;
+f00335_3 Follow f00335_2;
+f00335_4 Follow f00335_3;
+f00335_5 Follow f00335_4;
+f00335_6 Follow f00335_5;
+f00335_7 Follow f00335_6;
+f00335_8 Follow f00335_7;
+f00335_9 Follow f00335_8;
+in00336 FLAG;
+f00336_1 Follow in00336;
+f00336_2 Follow f00336_1;
+f00336_3 Follow f00336_2;
+f00336_4 Follow f00336_3;
+f00336_5 Follow f00336_4;
+f00336_6 Follow f00336_5;
+f00336_7 Follow f00336_6;
+f00336_8 Follow f00336_7;
+f00336_9 Follow f00336_8;
+in00337 FLAG;
+f00337_1 Follow in00337;
+f00337_2 Follow f00337_1;
+f00337_3 Follow f00337_2;
+f00337_4 Follow f00337_3;
+f00337_5 Follow f00337_4;
+f00337_6 Follow f00337_5;
+f00337_7 Follow f00337_6;
+f00337_8 Follow f00337_7;
+f00337_9 Follow f00337_8;
+in00338 FLAG;
+f00338_1 Follow in00338;
+f00338_2 Follow f00338_1;
+f00338_3 Follow f00338_2;
+f00338_4 Follow f00338_3;
+f00338_5 Follow f00338_4;
+f00338_6 Follow f00338_5;
+f00338_7 Follow f00338_6;
+f00338_8 Follow f00338_7;
+f00338_9 Follow f00338_8;
+in00339 FLAG;
+f00339_1 Follow in00339;
+f00339_2 Follow f00339_1;
+f00339_3 Follow f00339_2;
+f00339_4 Follow f00339_3;
+f00339_5 Follow f00339_4;
+f00339_6 Follow f00339_5;
+f00339_7 Follow f00339_6;
+f00339_8 Follow f00339_7;
+f00339_9 Follow f00339_8;
+in00340 FLAG;
+f00340_1 Follow in00340;
+f00340_2 Follow f00340_1;
+f00340_3 Follow f00340_2;
+f00340_4 Follow f00340_3;
+f00340_5 Follow f00340_4;
+f00340_6 Follow f00340_5;
+f00340_7 Follow f00340_6;
+f00340_8 Follow f00340_7;
+f00340_9 Follow f00340_8;
+in00341 FLAG;
+f00341_1 Follow in00341;
+f00341_2 Follow f00341_1;
+f00341_3 Follow f00341_2;
+f00341_4 Follow f00341_3;
+f00341_5 Follow f00341_4;
+f00341_6 Follow f00341_5;
+f00341_7 Follow f00341_6;
+f00341_8 Follow f00341_7;
+f00341_9 Follow f00341_8;
+in00342 FLAG;
+f00342_1 Follow in00342;
+f00342_2 Follow f00342_1;
+f00342_3 Follow f00342_2;
+f00342_4 Follow f00342_3;
+f00342_5 Follow f00342_4;
+f00342_6 Follow f00342_5;
+f00342_7 Follow f00342_6;
+f00342_8 Follow f00342_7;
+f00342_9 Follow f00342_8;
+in00343 FLAG;
+f00343_1 Follow in00343;
+f00343_2 Follow f00343_1;
+f00343_3 Follow f00343_2;
+f00343_4 Follow f00343_3;
+f00343_5 Follow f00343_4;
+f00343_6 Follow f00343_5;
+f00343_7 Follow f00343_6;
+f00343_8 Follow f00343_7;
+f00343_9 Follow f00343_8;
+in00344 FLAG;
+f00344_1 Follow in00344;
+f00344_2 Follow f00344_1;
+f00344_3 Follow f00344_2;
+f00344_4 Follow f00344_3;
+f00344_5 Follow f00344_4;
+f00344_6 Follow f00344_5;
+f00344_7 Follow f00344_6;
+f00344_8 Follow f00344_7;
+f00344_9 Follow f00344_8;
+in00345 FLAG;
+f00345_1 Follow in00345;
+f00345_2 Follow f00345_1;
+f00345_3 Follow f00345_2;
+f00345_4 Follow f00345_3;
+f00345_5 Follow f00345_4;
+f00345_6 Follow f00345_5;
+f00345_7 Follow f00345_6;
+f00345_8 Follow f00345_7;
+f00345_9 Follow f00345_8;
+in00346 FLAG;
+f00346_1 Follow in00346;
+f00346_2 Follow f00346_1;
+f00346_3 Follow f00346_2;
+f00346_4 Follow f00346_3;
+f00346_5 Follow f00346_4;
+f00346_6 Follow f00346_5;
+f00346_7 Follow f00346_6;
+f00346_8 Follow f00346_7;
+f00346_9 Follow f00346_8;
+in00347 FLAG;
+f00347_1 Follow in00347;
+f00347_2 Follow f00347_1;
+f00347_3 Follow f00347_2;
+f00347_4 Follow f00347_3;
+f00347_5 Follow f00347_4;
+f00347_6 Follow f00347_5;
+f00347_7 Follow f00347_6;
+f00347_8 Follow f00347_7;
+f00347_9 Follow f00347_8;
+in00348 FLAG;
+f00348_1 Follow in00348;
+f00348_2 Follow f00348_1;
+f00348_3 Follow f00348_2;
+f00348_4 Follow f00348_3;
+f00348_5 Follow f00348_4;
+f00348_6 Follow f00348_5;
+f00348_7 Follow f00348_6;
+f00348_8 Follow f00348_7;
+f00348_9 Follow f00348_8;
+in00349 FLAG;
+f00349_1 Follow in00349;
+f00349_2 Follow f00349_1;
+f00349_3 Follow f00349_2;
+f00349_4 Follow f00349_3;
+f00349_5 Follow f00349_4;
+f00349_6 Follow f00349_5;
+f00349_7 Follow f00349_6;
+f00349_8 Follow f00349_7;
+f00349_9 Follow f00349_8;
+in00350 FLAG;
+f00350_1 Follow in00350;
+f00350_2 Follow f00350_1;
+f00350_3 Follow f00350_2;
+f00350_4 Follow f00350_3;
+f00350_5 Follow f00350_4;
+f00350_6 Follow f00350_5;
+f00350_7 Follow f00350_6;
+f00350_8 Follow f00350_7;
+f00350_9 Follow f00350_8;
+in00351 FLAG;
+f00351_1 Follow in00351;
+f00351_2 Follow f00351_1;
+f00351_3 Follow f00351_2;
+f00351_4 Follow f00351_3;
+f00351_5 Follow f00351_4;
+f00351_6 Follow f00351_5;
+f00351_7 Follow f00351_6;
+f00351_8 Follow f00351_7;
+f00351_9 Follow f00351_8;
+in00352 FLAG;
+f00352_1 Follow in00352;
+f00352_2 Follow f00352_1;
+f00352_3 Follow f00352_2;
+f00352_4 Follow f00352_3;
+f00352_5 Follow f00352_4;
+f00352_6 Follow f00352_5;
+f00352_7 Follow f00352_6;
+f00352_8 Follow f00352_7;
+f00352_9 Follow f00352_8;
+in00353 FLAG;
+f00353_1 Follow in00353;
+f00353_2 Follow f00353_1;
+f00353_3 Follow f00353_2;
+f00353_4 Follow f00353_3;
+f00353_5 Follow f00353_4;
+f00353_6 Follow f00353_5;
+f00353_7 Follow f00353_6;
+f00353_8 Follow f00353_7;
+f00353_9 Follow f00353_8;
+in00354 FLAG;
+f00354_1 Follow in00354;
+f00354_2 Follow f00354_1;
+f00354_3 Follow f00354_2;
+f00354_4 Follow f00354_3;
+f00354_5 Follow f00354_4;
+f00354_6 Follow f00354_5;
+f00354_7 Follow f00354_6;
+f00354_8 Follow f00354_7;
+f00354_9 Follow f00354_8;
+in00355 FLAG;
+f00355_1 Follow in00355;
+f00355_2 Follow f00355_1;
+f00355_3 Follow f00355_2;
+f00355_4 Follow f00355_3;
+f00355_5 Follow f00355_4;
+f00355_6 Follow f00355_5;
+f00355_7 Follow f00355_6;
+f00355_8 Follow f00355_7;
+f00355_9 Follow f00355_8;
+in00356 FLAG;
+f00356_1 Follow in00356;
+f00356_2 Follow f00356_1;
+f00356_3 Follow f00356_2;
+f00356_4 Follow f00356_3;
+f00356_5 Follow f00356_4;
+f00356_6 Follow f00356_5;
+f00356_7 Follow f00356_6;
+f00356_8 Follow f00356_7;
+f00356_9 Follow f00356_8;
+in00357 FLAG;
+f00357_1 Follow in00357;
+f00357_2 Follow f00357_1;
+f00357_3 Follow f00357_2;
+f00357_4 Follow f00357_3;
+f00357_5 Follow f00357_4;
+f00357_6 Follow f00357_5;
+f00357_7 Follow f00357_6;
+f00357_8 Follow f00357_7;
+f00357_9 Follow f00357_8;
+in00358 FLAG;
+f00358_1 Follow in00358;
+f00358_2 Follow f00358_1;
+f00358_3 Follow f00358_2;
+f00358_4 Follow f00358_3;
+f00358_5 Follow f00358_4;
+f00358_6 Follow f00358_5;
+f00358_7 Follow f00358_6;
+f00358_8 Follow f00358_7;
+f00358_9 Follow f00358_8;
+in00359 FLAG;
+f00359_1 Follow in00359;
+f00359_2 Follow f00359_1;
+f00359_3 Follow f00359_2;
+f00359_4 Follow f00359_3;
+f00359_5 Follow f00359_4;
+f00359_6 Follow f00359_5;
+f00359_7 Follow f00359_6;
+f00359_8 Follow f00359_7;
+f00359_9 Follow f00359_8;
+in00360 FLAG;
+f00360_1 Follow in00360;
+f00360_2 Follow f00360_1;
+f00360_3 Follow f00360_2;
+f00360_4 Follow f00360_3;
+f00360_5 Follow f00360_4;
+f00360_6 Follow f00360_5;
+f00360_7 Follow f00360_6;
+f00360_8 Follow f00360_7;
+f00360_9 Follow f00360_8;
+in00361 FLAG;
+f00361_1 Follow in00361;
+f00361_2 Follow f00361_1;
+f00361_3 Follow f00361_2;
+f00361_4 Follow f00361_3;
+f00361_5 Follow f00361_4;
+f00361_6 Follow f00361_5;
+f00361_7 Follow f00361_6;
+f00361_8 Follow f00361_7;
+f00361_9 Follow f00361_8;
+in00362 FLAG;
+f00362_1 Follow in00362;
+f00362_2 Follow f00362_1;
+f00362_3 Follow f00362_2;
+f00362_4 Follow f00362_3;
+f00362_5 Follow f00362_4;
+f00362_6 Follow f00362_5;
+f00362_7 Follow f00362_6;
+f00362_8 Follow f00362_7;
+f00362_9 Follow f00362_8;
+in00363 FLAG;
+f00363_1 Follow in00363;
+f00363_2 Follow f00363_1;
+f00363_3 Follow f00363_2;
+f00363_4 Follow f00363_3;
+f00363_5 Follow f00363_4;
+f00363_6 Follow f00363_5;
+f00363_7 Follow f00363_6;
+f00363_8 Follow f00363_7;
+f00363_9 Follow f00363_8;
+in00364 FLAG;
+f00364_1 Follow in00364;
+f00364_2 Follow f00364_1;
+f00364_3 Follow f00364_2;
+f00364_4 Follow f00364_3;
+f00364_5 Follow f00364_4;
+f00364_6 Follow f00364_5;
+f00364_7 Follow f00364_6;
+f00364_8 Follow f00364_7;
+f00364_9 Follow f00364_8;
+in00365 FLAG;
+f00365_1 Follow in00365;
+f00365_2 Follow f00365_1;
+f00365_3 Follow f00365_2;
+f00365_4 Follow f00365_3;
+f00365_5 Follow f00365_4;
+f00365_6 Follow f00365_5;
+f00365_7 Follow f00365_6;
+f00365_8 Follow f00365_7;
+f00365_9 Follow f00365_8;
+in00366 FLAG;
+f00366_1 Follow in00366;
+f00366_2 Follow f00366_1;
+f00366_3 Follow f00366_2;
+f00366_4 Follow f00366_3;
+f00366_5 Follow f00366_4;
+f00366_6 Follow f00366_5;
+f00366_7 Follow f00366_6;
+f00366_8 Follow f00366_7;
+f00366_9 Follow f00366_8;
+in00367 FLAG;
+f00367_1 Follow in00367;
+f00367_2 Follow f00367_1;
+f00367_3 Follow f00367_2;
+f00367_4 Follow f00367_3;
+f00367_5 Follow f00367_4;
+f00367_6 Follow f00367_5;
+f00367_7 Follow f00367_6;
+f00367_8 Follow f00367_7;
+f00367_9 Follow f00367_8;
+in00368 FLAG;
+f00368_1 Follow in00368;
+f00368_2 Follow f00368_1;
+f00368_3 Follow f00368_2;
+f00368_4 Follow f00368_3;
+f00368_5 Follow f00368_4;
+f00368_6 Follow f00368_5;
+f00368_7 Follow f00368_6;
+f00368_8 Follow f00368_7;
+f00368_9 Follow f00368_8;
+in00369 FLAG;
+f00369_1 Follow in00369;
+f00369_2 Follow f00369_1;
+f00369_3 Follow f00369_2;
+f00369_4 Follow f00369_3;
+f00369_5 Follow f00369_4;
+f00369_6 Follow f00369_5;
+f00369_7 Follow f00369_6;
+f00369_8 Follow f00369_7;
+f00369_9 Follow f00369_8;
+in00370 FLAG;
+f00370_1 Follow in00370;
+f00370_2 Follow f00370_1;
+f00370_3 Follow f00370_2;
+f00370_4 Follow f00370_3;
+f00370_5 Follow f00370_4;
+f00370_6 Follow f00370_5;
+f00370_7 Follow f00370_6;
+f00370_8 Follow f00370_7;
+f00370_9 Follow f00370_8;
+in00371 FLAG;
+f00371_1 Follow in00371;
+f00371_2 Follow f00371_1;
+f00371_3 Follow f00371_2;
+f00371_4 Follow f00371_3;
+f00371_5 Follow f00371_4;
+f00371_6 Follow f00371_5;
+f00371_7 Follow f00371_6;
+f00371_8 Follow f00371_7;
+f00371_9 Follow f00371_8;
+in00372 FLAG;
+f00372_1 Follow in00372;
+f00372_2 Follow f00372_1;
+f00372_3 Follow f00372_2;
+f00372_4 Follow f00372_3;
+f00372_5 Follow f00372_4;
+f00372_6 Follow f00372_5;
+f00372_7 Follow f00372_6;
+f00372_8 Follow f00372_7;
+f00372_9 Follow f00372_8;
+in00373 FLAG;
+f00373_1 Follow in00373;
+f00373_2 Follow f00373_1;
+f00373_3 Follow f00373_2;
+f00373_4 Follow f00373_3;
+f00373_5 Follow f00373_4;
+f00373_6 Follow f00373_5;
+f00373_7 Follow f00373_6;
+f00373_8 Follow f00373_7;
+f00373_9 Follow f00373_8;
+in00374 FLAG;
+f00374_1 Follow in00374;
+f00374_2 Follow f00374_1;
+f00374_3 Follow f00374_2;
+f00374_4 Follow f00374_3;
+f00374_5 Follow f00374_4;
+f00374_6 Follow f00374_5;
+f00374_7 Follow f00374_6;
+f00374_8 Follow f00374_7;
+f00374_9 Follow f00374_8;
+in00375 FLAG;
+f00375_1 Follow in00375;
+f00375_2 Follow f00375_1;
+f00375_3 Follow f00375_2;
+f00375_4 Follow f00375_3;
+f00375_5 Follow f00375_4;
+f00375_6 Follow f00375_5;
+f00375_7 Follow f00375_6;
+f00375_8 Follow f00375_7;
+f00375_9 Follow f00375_8;
+in00376 FLAG;
+f00376_1 Follow in00376;
+f00376_2 Follow f00376_1;
+f00376_3 Follow f00376_2;
+f00376_4 Follow f00376_3;
+f00376_5 Follow f00376_4;
+f00376_6 Follow f00376_5;
+f00376_7 Follow f00376_6;
+f00376_8 Follow f00376_7;
+f00376_9 Follow f00376_8;
+in00377 FLAG;
+f00377_1 Follow in00377;
+f00377_2 Follow f00377_1;
+f00377_3 Follow f00377_2;
+f00377_4 Follow f00377_3;
+f00377_5 Follow f00377_4;
+f00377_6 Follow f00377_5;
+f00377_7 Follow f00377_6;
+f00377_8 Follow f00377_7;
+f00377_9 Follow f00377_8;
+in00378 FLAG;
+f00378_1 Follow in00378;
+f00378_2 Follow f00378_1;
+f00378_3 Follow f00378_2;
+f00378_4 Follow f00378_3;
+f00378_5 Follow f00378_4;
+f00378_6 Follow f00378_5;
+f00378_7 Follow f00378_6;
+f00378_8 Follow f00378_7;
+f00378_9 Follow f00378_8;
+in00379 FLAG;
+f00379_1 Follow in00379;
+f00379_2 Follow f00379_1;
+f00379_3 Follow f00379_2;
+f00379_4 Follow f00379_3;
+f00379_5 Follow f00379_4;
+f00379_6 Follow f00379_5;
+f00379_7 Follow f00379_6;
+f00379_8 Follow f00379_7;
+f00379_9 Follow f00379_8;
+in00380 FLAG;
+f00380_1 Follow in00380;
+f00380_2 Follow f00380_1;
+f00380_3 Follow f00380_2;
+f00380_4 Follow f00380_3;
+f00380_5 Follow f00380_4;
+f00380_6 Follow f00380_5;
+f00380_7 Follow f00380_6;
+f00380_8 Follow f00380_7;
+f00380_9 Follow f00380_8;
+in00381 FLAG;
+f00381_1 Follow in00381;
+f00381_2 Follow f00381_1;
+f00381_3 Follow f00381_2;
+f00381_4 Follow f00381_3;
+f00381_5 Follow f00381_4;
+f00381_6 Follow f00381_5;
+f00381_7 Follow f00381_6;
+f00381_8 Follow f00381_7;
+f00381_9 Follow f00381_8;
+in00382 FLAG;
+f00382_1 Follow in00382;
+f00382_2 Follow f00382_1;
+f00382_3 Follow f00382_2;
+f00382_4 Follow f00382_3;
+f00382_5 Follow f00382_4;
+f00382_6 Follow f00382_5;
+f00382_7 Follow f00382_6;
+f00382_8 Follow f00382_7;
+f00382_9 Follow f00382_8;
+in00383 FLAG;
+f00383_1 Follow in00383;
+f00383_2 Follow f00383_1;
+f00383_3 Follow f00383_2;
+f00383_4 Follow f00383_3;
+f00383_5 Follow f00383_4;
+f00383_6 Follow f00383_5;
+f00383_7 Follow f00383_6;
+f00383_8 Follow f00383_7;
+f00383_9 Follow f00383_8;
+in00384 FLAG;
+f00384_1 Follow in00384;
+f00384_2 Follow f00384_1;
+f00384_3 Follow f00384_2;
+f00384_4 Follow f00384_3;
+f00384_5 Follow f00384_4;
+f00384_6 Follow f00384_5;
+f00384_7 Follow f00384_6;
+f00384_8 Follow f00384_7;
+f00384_9 Follow f00384_8;
+in00385 FLAG;
+f00385_1 Follow in00385;
+f00385_2 Follow f00385_1;
+f00385_3 Follow f00385_2;
+f00385_4 Follow f00385_3;
+f00385_5 Follow f00385_4;
+f00385_6 Follow f00385_5;
+f00385_7 Follow f00385_6;
+f00385_8 Follow f00385_7;
+f00385_9 Follow f00385_8;
+in00386 FLAG;
+f00386_1 Follow in00386;
+f00386_2 Follow f00386_1;
+f00386_3 Follow f00386_2;
+f00386_4 Follow f00386_3;
+f00386_5 Follow f00386_4;
+f00386_6 Follow f00386_5;
+f00386_7 Follow f00386_6;
+f00386_8 Follow f00386_7;
+f00386_9 Follow f00386_8;
+in00387 FLAG;
+f00387_1 Follow in00387;
+f00387_2 Follow f00387_1;
+f00387_3 Follow f00387_2;
+f00387_4 Follow f00387_3;
+f00387_5 Follow f00387_4;
+f00387_6 Follow f00387_5;
+f00387_7 Follow f00387_6;
+f00387_8 Follow f00387_7;
+f00387_9 Follow f00387_8;
+in00388 FLAG;
+f00388_1 Follow in00388;
+f00388_2 Follow f00388_1;
+f00388_3 Follow f00388_2;
+f00388_4 Follow f00388_3;
+f00388_5 Follow f00388_4;
+f00388_6 Follow f00388_5;
+f00388_7 Follow f00388_6;
+f00388_8 Follow f00388_7;
+f00388_9 Follow f00388_8;
+in00389 FLAG;
+f00389_1 Follow in00389;
+f00389_2 Follow f00389_1;
+f00389_3 Follow f00389_2;
+f00389_4 Follow f00389_3;
+f00389_5 Follow f00389_4;
+f00389_6 Follow f00389_5;
+f00389_7 Follow f00389_6;
+f00389_8 Follow f00389_7;
+f00389_9 Follow f00389_8;
+in00390 FLAG;
+f00390_1 Follow in00390;
+f00390_2 Follow f00390_1;
+f00390_3 Follow f00390_2;
+f00390_4 Follow f00390_3;
+f00390_5 Follow f00390_4;
+f00390_6 Follow f00390_5;
+f00390_7 Follow f00390_6;
+f00390_8 Follow f00390_7;
+f00390_9 Follow f00390_8;
+in00391 FLAG;
+f00391_1 Follow in00391;
+f00391_2 Follow f00391_1;
+f00391_3 Follow f00391_2;
+f00391_4 Follow f00391_3;
+f00391_5 Follow f00391_4;
+f00391_6 Follow f00391_5;
+f00391_7 Follow f00391_6;
+f00391_8 Follow f00391_7;
+f00391_9 Follow f00391_8;
+in00392 FLAG;
+f00392_1 Follow in00392;
+f00392_2 Follow f00392_1;
+f00392_3 Follow f00392_2;
+f00392_4 Follow f00392_3;
+f00392_5 Follow f00392_4;
+f00392_6 Follow f00392_5;
+f00392_7 Follow f00392_6;
+f00392_8 Follow f00392_7;
+f00392_9 Follow f00392_8;
+in00393 FLAG;
+f00393_1 Follow in00393;
+f00393_2 Follow f00393_1;
+f00393_3 Follow f00393_2;
+f00393_4 Follow f00393_3;
+f00393_5 Follow f00393_4;
+f00393_6 Follow f00393_5;
+f00393_7 Follow f00393_6;
+f00393_8 Follow f00393_7;
+f00393_9 Follow f00393_8;
+in00394 FLAG;
+f00394_1 Follow in00394;
+f00394_2 Follow f00394_1;
+f00394_3 Follow f00394_2;
+f00394_4 Follow f00394_3;
+f00394_5 Follow f00394_4;
+f00394_6 Follow f00394_5;
+f00394_7 Follow f00394_6;
+f00394_8 Follow f00394_7;
+f00394_9 Follow f00394_8;
+in00395 FLAG;
+f00395_1 Follow in00395;
+f00395_2 Follow f00395_1;
+f00395_3 Follow f00395_2;
+f00395_4 Follow f00395_3;
+f00395_5 Follow f00395_4;
+f00395_6 Follow f00395_5;
+f00395_7 Follow f00395_6;
+f00395_8 Follow f00395_7;
+f00395_9 Follow f00395_8;
+in00396 FLAG;
+f00396_1 Follow in00396;
+f00396_2 Follow f00396_1;
+f00396_3 Follow f00396_2;
+f00396_4 Follow f00396_3;
+f00396_5 Follow f00396_4;
+f00396_6 Follow f00396_5;
+f00396_7 Follow f00396_6;
+f00396_8 Follow f00396_7;
+f00396_9 Follow f00396_8;
+in00397 FLAG;
+f00397_1 Follow in00397;
+f00397_2 Follow f00397_1;
+f00397_3 Follow f00397_2;
+f00397_4 Follow f00397_3;
+f00397_5 Follow f00397_4;
+f00397_6 Follow f00397_5;
+f00397_7 Follow f00397_6;
+f00397_8 Follow f00397_7;
+f00397_9 Follow f00397_8;
+in00398 FLAG;
+f00398_1 Follow in00398;
+f00398_2 Follow f00398_1;
+f00398_3 Follow f00398_2;
+f00398_4 Follow f00398_3;
+f00398_5 Follow f00398_4;
+f00398_6 Follow f00398_5;
+f00398_7 Follow f00398_6;
+f00398_8 Follow f00398_7;
+f00398_9 Follow f00398_8;
+in00399 FLAG;
+f00399_1 Follow in00399;
+f00399_2 Follow f00399_1;
+f00399_3 Follow f00399_2;
+f00399_4 Follow f00399_3;
+f00399_5 Follow f00399_4;
+f00399_6 Follow f00399_5;
+f00399_7 Follow f00399_6;
+f00399_8 Follow f00399_7;
+f00399_9 Follow f00399_8;
+in00400 FLAG;
+f00400_1 Follow in00400;
+f00400_2 Follow f00400_1;
+f00400_3 Follow f00400_2;
+f00400_4 Follow f00400_3;
+f00400_5 Follow f00400_4;
+f00400_6 Follow f00400_5;
+f00400_7 Follow f00400_6;
+f00400_8 Follow f00400_7;
+f00400_9 Follow f00400_8;
+in00401 FLAG;
+f00401_1 Follow in00401;
+f00401_2 Follow f00401_1;
+f00401_3 Follow f00401_2;
+f00401_4 Follow f00401_3;
+f00401_5 Follow f00401_4;
+f00401_6 Follow f00401_5;
+f00401_7 Follow f00401_6;
+f00401_8 Follow f00401_7;
+f00401_9 Follow f00401_8;
+in00402 FLAG;
+f00402_1 Follow in00402;
+f00402_2 Follow f00402_1;
+f00402_3 Follow f00402_2;
+f00402_4 Follow f00402_3;
+f00402_5 Follow f00402_4;
+f00402_6 Follow f00402_5;
+f00402_7 Follow f00402_6;
+f00402_8 Follow f00402_7;
+f00402_9 Follow f00402_8;
+in00403 FLAG;
+f00403_1 Follow in00403;
+f00403_2 Follow f00403_1;
+f00403_3 Follow f00403_2;
+f00403_4 Follow f00403_3;
+f00403_5 Follow f00403_4;
+f00403_6 Follow f00403_5;
+f00403_7 Follow f00403_6;
+f00403_8 Follow f00403_7;
+f00403_9 Follow f00403_8;
+in00404 FLAG;
+f00404_1 Follow in00404;
+f00404_2 Follow f00404_1;
+f00404_3 Follow f00404_2;
+f00404_4 Follow f00404_3;
+f00404_5 Follow f00404_4;
+f00404_6 Follow f00404_5;
+f00404_7 Follow f00404_6;
+f00404_8 Follow f00404_7;
+f00404_9 Follow f00404_8;
+in00405 FLAG;
+f00405_1 Follow in00405;
+f00405_2 Follow f00405_1;
+f00405_3 Follow f00405_2;
+f00405_4 Follow f00405_3;
+f00405_5 Follow f00405_4;
+f00405_6 Follow f00405_5;
+f00405_7 Follow f00405_6;
+f00405_8 Follow f00405_7;
+f00405_9 Follow f00405_8;
+in00406 FLAG;
+f00406_1 Follow in00406;
+f00406_2 Follow f00406_1;
+f00406_3 Follow f00406_2;
+f00406_4 Follow f00406_3;
+f00406_5 Follow f00406_4;
+f00406_6 Follow f00406_5;
+f00406_7 Follow f00406_6;
+f00406_8 Follow f00406_7;
+f00406_9 Follow f00406_8;
+in00407 FLAG;
+f00407_1 Follow in00407;
+f00407_2 Follow f00407_1;
+f00407_3 Follow f00407_2;
+f00407_4 Follow f00407_3;
+f00407_5 Follow f00407_4;
+f00407_6 Follow f00407_5;
+f00407_7 Follow f00407_6;
+f00407_8 Follow f00407_7;
+f00407_9 Follow f00407_8;
+in00408 FLAG;
+f00408_1 Follow in00408;
+f00408_2 Follow f00408_1;
+f00408_3 Follow f00408_2;
+f00408_4 Follow f00408_3;
+f00408_5 Follow f00408_4;
+f00408_6 Follow f00408_5;
+f00408_7 Follow f00408_6;
+f00408_8 Follow f00408_7;
+f00408_9 Follow f00408_8;
+in00409 FLAG;
+f00409_1 Follow in00409;
+f00409_2 Follow f00409_1;
+f00409_3 Follow f00409_2;
+f00409_4 Follow f00409_3;
+f00409_5 Follow f00409_4;
+f00409_6 Follow f00409_5;
+f00409_7 Follow f00409_6;
+f00409_8 Follow f00409_7;
+f00409_9 Follow f00409_8;
+in00410 FLAG;
+f00410_1 Follow in00410;
+f00410_2 Follow f00410_1;
+f00410_3 Follow f00410_2;
+f00410_4 Follow f00410_3;
+f00410_5 Follow f00410_4;
+f00410_6 Follow f00410_5;
+f00410_7 Follow f00410_6;
+f00410_8 Follow f00410_7;
+f00410_9 Follow f00410_8;
+in00411 FLAG;
+f00411_1 Follow in00411;
+f00411_2 Follow f00411_1;
+f00411_3 Follow f00411_2;
+f00411_4 Follow f00411_3;
+f00411_5 Follow f00411_4;
+f00411_6 Follow f00411_5;
+f00411_7 Follow f00411_6;
+f00411_8 Follow f00411_7;
+f00411_9 Follow f00411_8;
+in00412 FLAG;
+f00412_1 Follow in00412;
+f00412_2 Follow f00412_1;
+f00412_3 Follow f00412_2;
+f00412_4 Follow f00412_3;
+f00412_5 Follow f00412_4;
+f00412_6 Follow f00412_5;
+f00412_7 Follow f00412_6;
+f00412_8 Follow f00412_7;
+f00412_9 Follow f00412_8;
+in00413 FLAG;
+f00413_1 Follow in00413;
+f00413_2 Follow f00413_1;
+f00413_3 Follow f00413_2;
+f00413_4 Follow f00413_3;
+f00413_5 Follow f00413_4;
+f00413_6 Follow f00413_5;
+f00413_7 Follow f00413_6;
+f00413_8 Follow f00413_7;
+f00413_9 Follow f00413_8;
+in00414 FLAG;
+f00414_1 Follow in00414;
+f00414_2 Follow f00414_1;
+f00414_3 Follow f00414_2;
+f00414_4 Follow f00414_3;
+f00414_5 Follow f00414_4;
+f00414_6 Follow f00414_5;
+f00414_7 Follow f00414_6;
+f00414_8 Follow f00414_7;
+f00414_9 Follow f00414_8;
+in00415 FLAG;
+f00415_1 Follow in00415;
+f00415_2 Follow f00415_1;
+f00415_3 Follow f00415_2;
+f00415_4 Follow f00415_3;
+f00415_5 Follow f00415_4;
+f00415_6 Follow f00415_5;
+f00415_7 Follow f00415_6;
+f00415_8 Follow f00415_7;
+f00415_9 Follow f00415_8;
+in00416 FLAG;
+f00416_1 Follow in00416;
+f00416_2 Follow f00416_1;
+f00416_3 Follow f00416_2;
+f00416_4 Follow f00416_3;
+f00416_5 Follow f00416_4;
+f00416_6 Follow f00416_5;
+f00416_7 Follow f00416_6;
+f00416_8 Follow f00416_7;
+f00416_9 Follow f00416_8;
+in00417 FLAG;
+f00417_1 Follow in00417;
+f00417_2 Follow f00417_1;
+f00417_3 Follow f00417_2;
+f00417_4 Follow f00417_3;
+f00417_5 Follow f00417_4;
+f00417_6 Follow f00417_5;
+f00417_7 Follow f00417_6;
+f00417_8 Follow f00417_7;
+f00417_9 Follow f00417_8;
+in00418 FLAG;
+f00418_1 Follow in00418;
+f00418_2 Follow f00418_1;
+f00418_3 Follow f00418_2;
+f00418_4 Follow f00418_3;
+f00418_5 Follow f00418_4;
+f00418_6 Follow f00418_5;
+f00418_7 Follow f00418_6;
+f00418_8 Follow f00418_7;
+f00418_9 Follow f00418_8;
+in00419 FLAG;
+f00419_1 Follow in00419;
+f00419_2 Follow f00419_1;
+f00419_3 Follow f00419_2;
+f00419_4 Follow f00419_3;
+f00419_5 Follow f00419_4;
+f00419_6 Follow f00419_5;
+f00419_7 Follow f00419_6;
+f00419_8 Follow f00419_7;
+f00419_9 Follow f00419_8;
+in00420 FLAG;
+f00420_1 Follow in00420;
+f00420_2 Follow f00420_1;
+f00420_3 Follow f00420_2;
+f00420_4 Follow f00420_3;
+f00420_5 Follow f00420_4;
+f00420_6 Follow f00420_5;
+f00420_7 Follow f00420_6;
+f00420_8 Follow f00420_7;
+f00420_9 Follow f00420_8;
+in00421 FLAG;
+f00421_1 Follow in00421;
+f00421_2 Follow f00421_1;
+f00421_3 Follow f00421_2;
+f00421_4 Follow f00421_3;
+f00421_5 Follow f00421_4;
+f00421_6 Follow f00421_5;
+f00421_7 Follow f00421_6;
+f00421_8 Follow f00421_7;
+f00421_9 Follow f00421_8;
+in00422 FLAG;
+f00422_1 Follow in00422;
+f00422_2 Follow f00422_1;
+f00422_3 Follow f00422_2;
+f00422_4 Follow f00422_3;
+f00422_5 Follow f00422_4;
+f00422_6 Follow f00422_5;
+f00422_7 Follow f00422_6;
+f00422_8 Follow f00422_7;
+f00422_9 Follow f00422_8;
+in00423 FLAG;
+f00423_1 Follow in00423;
+f00423_2 Follow f00423_1;
+f00423_3 Follow f00423_2;
+f00423_4 Follow f00423_3;
+f00423_5 Follow f00423_4;
+f00423_6 Follow f00423_5;
+f00423_7 Follow f00423_6;
+f00423_8 Follow f00423_7;
+f00423_9 Follow f00423_8;
+in00424 FLAG;
+f00424_1 Follow in00424;
+f00424_2 Follow f00424_1;
+f00424_3 Follow f00424_2;
+f00424_4 Follow f00424_3;
+f00424_5 Follow f00424_4;
+f00424_6 Follow f00424_5;
+f00424_7 Follow f00424_6;
+f00424_8 Follow f00424_7;
+f00424_9 Follow f00424_8;
+in00425 FLAG;
+f00425_1 Follow in00425;
+f00425_2 Follow f00425_1;
+f00425_3 Follow f00425_2;
+f00425_4 Follow f00425_3;
+f00425_5 Follow f00425_4;
+f00425_6 Follow f00425_5;
+f00425_7 Follow f00425_6;
+f00425_8 Follow f00425_7;
+f00425_9 Follow f00425_8;
+in00426 FLAG;
+f00426_1 Follow in00426;
+f00426_2 Follow f00426_1;
+f00426_3 Follow f00426_2;
+f00426_4 Follow f00426_3;
+f00426_5 Follow f00426_4;
+f00426_6 Follow f00426_5;
+f00426_7 Follow f00426_6;
+f00426_8 Follow f00426_7;
+f00426_9 Follow f00426_8;
+in00427 FLAG;
+f00427_1 Follow in00427;
+f00427_2 Follow f00427_1;
+f00427_3 Follow f00427_2;
+f00427_4 Follow f00427_3;
+f00427_5 Follow f00427_4;
+f00427_6 Follow f00427_5;
+f00427_7 Follow f00427_6;
+f00427_8 Follow f00427_7;
+f00427_9 Follow f00427_8;
+in00428 FLAG;
+f00428_1 Follow in00428;
+f00428_2 Follow f00428_1;
+f00428_3 Follow f00428_2;
+f00428_4 Follow f00428_3;
+f00428_5 Follow f00428_4;
+f00428_6 Follow f00428_5;
+f00428_7 Follow f00428_6;
+f00428_8 Follow f00428_7;
+f00428_9 Follow f00428_8;
+in00429 FLAG;
+f00429_1 Follow in00429;
+f00429_2 Follow f00429_1;
+f00429_3 Follow f00429_2;
+f00429_4 Follow f00429_3;
+f00429_5 Follow f00429_4;
+f00429_6 Follow f00429_5;
+f00429_7 Follow f00429_6;
+f00429_8 Follow f00429_7;
+f00429_9 Follow f00429_8;
+in00430 FLAG;
+f00430_1 Follow in00430;
+f00430_2 Follow f00430_1;
+f00430_3 Follow f00430_2;
+f00430_4 Follow f00430_3;
+f00430_5 Follow f00430_4;
+f00430_6 Follow f00430_5;
+f00430_7 Follow f00430_6;
+f00430_8 Follow f00430_7;
+f00430_9 Follow f00430_8;
+in00431 FLAG;
+f00431_1 Follow in00431;
+f00431_2 Follow f00431_1;
+f00431_3 Follow f00431_2;
+f00431_4 Follow f00431_3;
+f00431_5 Follow f00431_4;
+f00431_6 Follow f00431_5;
+f00431_7 Follow f00431_6;
+f00431_8 Follow f00431_7;
+f00431_9 Follow f00431_8;
+in00432 FLAG;
+f00432_1 Follow in00432;
+f00432_2 Follow f00432_1;
+f00432_3 Follow f00432_2;
+f00432_4 Follow f00432_3;
+f00432_5 Follow f00432_4;
+f00432_6 Follow f00432_5;
+f00432_7 Follow f00432_6;
+f00432_8 Follow f00432_7;
+f00432_9 Follow f00432_8;
+in00433 FLAG;
+f00433_1 Follow in00433;
+f00433_2 Follow f00433_1;
+f00433_3 Follow f00433_2;
+f00433_4 Follow f00433_3;
+f00433_5 Follow f00433_4;
+f00433_6 Follow f00433_5;
+f00433_7 Follow f00433_6;
+f00433_8 Follow f00433_7;
+f00433_9 Follow f00433_8;
+in00434 FLAG;
+f00434_1 Follow in00434;
+f00434_2 Follow f00434_1;
+f00434_3 Follow f00434_2;
+f00434_4 Follow f00434_3;
+f00434_5 Follow f00434_4;
+f00434_6 Follow f00434_5;
+f00434_7 Follow f00434_6;
+f00434_8 Follow f00434_7;
+f00434_9 Follow f00434_8;
+in00435 FLAG;
+f00435_1 Follow in00435;
+f00435_2 Follow f00435_1;
+f00435_3 Follow f00435_2;
+f00435_4 Follow f00435_3;
+f00435_5 Follow f00435_4;
+f00435_6 Follow f00435_5;
+f00435_7 Follow f00435_6;
+f00435_8 Follow f00435_7;
+f00435_9 Follow f00435_8;
+in00436 FLAG;
+f00436_1 Follow in00436;
+f00436_2 Follow f00436_1;
+f00436_3 Follow f00436_2;
+f00436_4 Follow f00436_3;
+f00436_5 Follow f00436_4;
+f00436_6 Follow f00436_5;
+f00436_7 Follow f00436_6;
+f00436_8 Follow f00436_7;
+f00436_9 Follow f00436_8;
+in00437 FLAG;
+f00437_1 Follow in00437;
+f00437_2 Follow f00437_1;
+f00437_3 Follow f00437_2;
+f00437_4 Follow f00437_3;
+f00437_5 Follow f00437_4;
+f00437_6 Follow f00437_5;
+f00437_7 Follow f00437_6;
+f00437_8 Follow f00437_7;
+f00437_9 Follow f00437_8;
+in00438 FLAG;
+f00438_1 Follow in00438;
+f00438_2 Follow f00438_1;
+f00438_3 Follow f00438_2;
+f00438_4 Follow f00438_3;
+f00438_5 Follow f00438_4;
+f00438_6 Follow f00438_5;
+f00438_7 Follow f00438_6;
+f00438_8 Follow f00438_7;
+f00438_9 Follow f00438_8;
+in00439 FLAG;
+f00439_1 Follow in00439;
+f00439_2 Follow f00439_1;
+f00439_3 Follow f00439_2;
+f00439_4 Follow f00439_3;
+f00439_5 Follow f00439_4;
+f00439_6 Follow f00439_5;
+f00439_7 Follow f00439_6;
+f00439_8 Follow f00439_7;
+f00439_9 Follow f00439_8;
+in00440 FLAG;
+f00440_1 Follow in00440;
+f00440_2 Follow f00440_1;
+f00440_3 Follow f00440_2;
+f00440_4 Follow f00440_3;
+f00440_5 Follow f00440_4;
+f00440_6 Follow f00440_5;
+f00440_7 Follow f00440_6;
+f00440_8 Follow f00440_7;
+f00440_9 Follow f00440_8;
+in00441 FLAG;
+f00441_1 Follow in00441;
+f00441_2 Follow f00441_1;
+f00441_3 Follow f00441_2;
+f00441_4 Follow f00441_3;
+f00441_5 Follow f00441_4;
+f00441_6 Follow f00441_5;
+f00441_7 Follow f00441_6;
+f00441_8 Follow f00441_7;
+f00441_9 Follow f00441_8;
+in00442 FLAG;
+f00442_1 Follow in00442;
+f00442_2 Follow f00442_1;
+f00442_3 Follow f00442_2;
+f00442_4 Follow f00442_3;
+f00442_5 Follow f00442_4;
+f00442_6 Follow f00442_5;
+f00442_7 Follow f00442_6;
+f00442_8 Follow f00442_7;
+f00442_9 Follow f00442_8;
+in00443 FLAG;
+f00443_1 Follow in00443;
+f00443_2 Follow f00443_1;
+f00443_3 Follow f00443_2;
+f00443_4 Follow f00443_3;
+f00443_5 Follow f00443_4;
+f00443_6 Follow f00443_5;
+f00443_7 Follow f00443_6;
+f00443_8 Follow f00443_7;
+f00443_9 Follow f00443_8;
+in00444 FLAG;
+f00444_1 Follow in00444;
+f00444_2 Follow f00444_1;
+f00444_3 Follow f00444_2;
+f00444_4 Follow f00444_3;
+f00444_5 Follow f00444_4;
+f00444_6 Follow f00444_5;
+f00444_7 Follow f00444_6;
+f00444_8 Follow f00444_7;
+f00444_9 Follow f00444_8;
+in00445 FLAG;
+f00445_1 Follow in00445;
+f00445_2 Follow f00445_1;
+f00445_3 Follow f00445_2;
+f00445_4 Follow f00445_3;
+f00445_5 Follow f00445_4;
+f00445_6 Follow f00445_5;
+f00445_7 Follow f00445_6;
+f00445_8 Follow f00445_7;
+f00445_9 Follow f00445_8;
+in00446 FLAG;
+f00446_1 Follow in00446;
+f00446_2 Follow f00446_1;
+f00446_3 Follow f00446_2;
+f00446_4 Follow f00446_3;
+f00446_5 Follow f00446_4;
+f00446_6 Follow f00446_5;
+f00446_7 Follow f00446_6;
+f00446_8 Follow f00446_7;
+f00446_9 Follow f00446_8;
+in00447 FLAG;
+f00447_1 Follow in00447;
+f00447_2 Follow f00447_1;
+f00447_3 Follow f00447_2;
+f00447_4 Follow f00447_3;
+f00447_5 Follow f00447_4;
+f00447_6 Follow f00447_5;
+f00447_7 Follow f00447_6;
+f00447_8 Follow f00447_7;
+f00447_9 Follow f00447_8;
+in00448 FLAG;
+f00448_1 Follow in00448;
+f00448_2 Follow f00448_1;
+f00448_3 Follow f00448_2;
+f00448_4 Follow f00448_3;
+f00448_5 Follow f00448_4;
+f00448_6 Follow f00448_5;
+f00448_7 Follow f00448_6;
+f00448_8 Follow f00448_7;
+f00448_9 Follow f00448_8;
+in00449 FLAG;
+f00449_1 Follow in00449;
+f00449_2 Follow f00449_1;
+f00449_3 Follow f00449_2;
+f00449_4 Follow f00449_3;
+f00449_5 Follow f00449_4;
+f00449_6 Follow f00449_5;
+f00449_7 Follow f00449_6;
+f00449_8 Follow f00449_7;
+f00449_9 Follow f00449_8;
+in00450 FLAG;
+f00450_1 Follow in00450;
+f00450_2 Follow f00450_1;
+f00450_3 Follow f00450_2;
+f00450_4 Follow f00450_3;
+f00450_5 Follow f00450_4;
+f00450_6 Follow f00450_5;
+f00450_7 Follow f00450_6;
+f00450_8 Follow f00450_7;
+f00450_9 Follow f00450_8;
+in00451 FLAG;
+f00451_1 Follow in00451;
+f00451_2 Follow f00451_1;
+f00451_3 Follow f00451_2;
+f00451_4 Follow f00451_3;
+f00451_5 Follow f00451_4;
+f00451_6 Follow f00451_5;
+f00451_7 Follow f00451_6;
+f00451_8 Follow f00451_7;
+f00451_9 Follow f00451_8;
+in00452 FLAG;
+f00452_1 Follow in00452;
+f00452_2 Follow f00452_1;
+f00452_3 Follow f00452_2;
+f00452_4 Follow f00452_3;
+f00452_5 Follow f00452_4;
+f00452_6 Follow f00452_5;
+f00452_7 Follow f00452_6;
+f00452_8 Follow f00452_7;
+f00452_9 Follow f00452_8;
+in00453 FLAG;
+f00453_1 Follow in00453;
+f00453_2 Follow f00453_1;
+f00453_3 Follow f00453_2;
+f00453_4 Follow f00453_3;
+f00453_5 Follow f00453_4;
+f00453_6 Follow f00453_5;
+f00453_7 Follow f00453_6;
+f00453_8 Follow f00453_7;
+f00453_9 Follow f00453_8;
+in00454 FLAG;
+f00454_1 Follow in00454;
+f00454_2 Follow f00454_1;
+f00454_3 Follow f00454_2;
+f00454_4 Follow f00454_3;
+f00454_5 Follow f00454_4;
+f00454_6 Follow f00454_5;
+f00454_7 Follow f00454_6;
+f00454_8 Follow f00454_7;
+f00454_9 Follow f00454_8;
+in00455 FLAG;
+f00455_1 Follow in00455;
+f00455_2 Follow f00455_1;
+f00455_3 Follow f00455_2;
+f00455_4 Follow f00455_3;
+f00455_5 Follow f00455_4;
+f00455_6 Follow f00455_5;
+f00455_7 Follow f00455_6;
+f00455_8 Follow f00455_7;
+f00455_9 Follow f00455_8;
+in00456 FLAG;
+f00456_1 Follow in00456;
+f00456_2 Follow f00456_1;
+f00456_3 Follow f00456_2;
+f00456_4 Follow f00456_3;
+f00456_5 Follow f00456_4;
+f00456_6 Follow f00456_5;
+f00456_7 Follow f00456_6;
+f00456_8 Follow f00456_7;
+f00456_9 Follow f00456_8;
+in00457 FLAG;
+f00457_1 Follow in00457;
+f00457_2 Follow f00457_1;
+f00457_3 Follow f00457_2;
+f00457_4 Follow f00457_3;
+f00457_5 Follow f00457_4;
+f00457_6 Follow f00457_5;
+f00457_7 Follow f00457_6;
+f00457_8 Follow f00457_7;
+f00457_9 Follow f00457_8;
+in00458 FLAG;
+f00458_1 Follow in00458;
+f00458_2 Follow f00458_1;
+f00458_3 Follow f00458_2;
+f00458_4 Follow f00458_3;
+f00458_5 Follow f00458_4;
+f00458_6 Follow f00458_5;
+f00458_7 Follow f00458_6;
+f00458_8 Follow f00458_7;
+f00458_9 Follow f00458_8;
+in00459 FLAG;
+f00459_1 Follow in00459;
+f00459_2 Follow f00459_1;
+f00459_3 Follow f00459_2;
+f00459_4 Follow f00459_3;
+f00459_5 Follow f00459_4;
+f00459_6 Follow f00459_5;
+f00459_7 Follow f00459_6;
+f00459_8 Follow f00459_7;
+f00459_9 Follow f00459_8;
+in00460 FLAG;
+f00460_1 Follow in00460;
+f00460_2 Follow f00460_1;
+f00460_3 Follow f00460_2;
+f00460_4 Follow f00460_3;
+f00460_5 Follow f00460_4;
+f00460_6 Follow f00460_5;
+f00460_7 Follow f00460_6;
+f00460_8 Follow f00460_7;
+f00460_9 Follow f00460_8;
+in00461 FLAG;
+f00461_1 Follow in00461;
+f00461_2 Follow f00461_1;
+f00461_3 Follow f00461_2;
+f00461_4 Follow f00461_3;
+f00461_5 Follow f00461_4;
+f00461_6 Follow f00461_5;
+f00461_7 Follow f00461_6;
+f00461_8 Follow f00461_7;
+f00461_9 Follow f00461_8;
+in00462 FLAG;
+f00462_1 Follow in00462;
+f00462_2 Follow f00462_1;
+f00462_3 Follow f00462_2;
+f00462_4 Follow f00462_3;
+f00462_5 Follow f00462_4;
+f00462_6 Follow f00462_5;
+f00462_7 Follow f00462_6;
+f00462_8 Follow f00462_7;
+f00462_9 Follow f00462_8;
+in00463 FLAG;
+f00463_1 Follow in00463;
+f00463_2 Follow f00463_1;
+f00463_3 Follow f00463_2;
+f00463_4 Follow f00463_3;
+f00463_5 Follow f00463_4;
+f00463_6 Follow f00463_5;
+f00463_7 Follow f00463_6;
+f00463_8 Follow f00463_7;
+f00463_9 Follow f00463_8;
+in00464 FLAG;
+f00464_1 Follow in00464;
+f00464_2 Follow f00464_1;
+f00464_3 Follow f00464_2;
+f00464_4 Follow f00464_3;
+f00464_5 Follow f00464_4;
+f00464_6 Follow f00464_5;
+f00464_7 Follow f00464_6;
+f00464_8 Follow f00464_7;
+f00464_9 Follow f00464_8;
+in00465 FLAG;
+f00465_1 Follow in00465;
+f00465_2 Follow f00465_1;
+f00465_3 Follow f00465_2;
+f00465_4 Follow f00465_3;
+f00465_5 Follow f00465_4;
+f00465_6 Follow f00465_5;
+f00465_7 Follow f00465_6;
+f00465_8 Follow f00465_7;
+f00465_9 Follow f00465_8;
+in00466 FLAG;
+f00466_1 Follow in00466;
+f00466_2 Follow f00466_1;
+f00466_3 Follow f00466_2;
+f00466_4 Follow f00466_3;
+f00466_5 Follow f00466_4;
+f00466_6 Follow f00466_5;
+f00466_7 Follow f00466_6;
+f00466_8 Follow f00466_7;
+f00466_9 Follow f00466_8;
+in00467 FLAG;
+f00467_1 Follow in00467;
+f00467_2 Follow f00467_1;
+f00467_3 Follow f00467_2;
+f00467_4 Follow f00467_3;
+f00467_5 Follow f00467_4;
+f00467_6 Follow f00467_5;
+f00467_7 Follow f00467_6;
+f00467_8 Follow f00467_7;
+f00467_9 Follow f00467_8;
+in00468 FLAG;
+f00468_1 Follow in00468;
+f00468_2 Follow f00468_1;
+f00468_3 Follow f00468_2;
+f00468_4 Follow f00468_3;
+f00468_5 Follow f00468_4;
+f00468_6 Follow f00468_5;
+f00468_7 Follow f00468_6;
+f00468_8 Follow f00468_7;
+f00468_9 Follow f00468_8;
+in00469 FLAG;
+f00469_1 Follow in00469;
+f00469_2 Follow f00469_1;
+f00469_3 Follow f00469_2;
+f00469_4 Follow f00469_3;
+f00469_5 Follow f00469_4;
+f00469_6 Follow f00469_5;
+f00469_7 Follow f00469_6;
+f00469_8 Follow f00469_7;
+f00469_9 Follow f00469_8;
+in00470 FLAG;
+f00470_1 Follow in00470;
+f00470_2 Follow f00470_1;
+f00470_3 Follow f00470_2;
+f00470_4 Follow f00470_3;
+f00470_5 Follow f00470_4;
+f00470_6 Follow f00470_5;
+f00470_7 Follow f00470_6;
+f00470_8 Follow f00470_7;
+f00470_9 Follow f00470_8;
+in00471 FLAG;
+f00471_1 Follow in00471;
+f00471_2 Follow f00471_1;
+f00471_3 Follow f00471_2;
+f00471_4 Follow f00471_3;
+f00471_5 Follow f00471_4;
+f00471_6 Follow f00471_5;
+f00471_7 Follow f00471_6;
+f00471_8 Follow f00471_7;
+f00471_9 Follow f00471_8;
+in00472 FLAG;
+f00472_1 Follow in00472;
+f00472_2 Follow f00472_1;
+f00472_3 Follow f00472_2;
+f00472_4 Follow f00472_3;
+f00472_5 Follow f00472_4;
+f00472_6 Follow f00472_5;
+f00472_7 Follow f00472_6;
+f00472_8 Follow f00472_7;
+f00472_9 Follow f00472_8;
+in00473 FLAG;
+f00473_1 Follow in00473;
+f00473_2 Follow f00473_1;
+f00473_3 Follow f00473_2;
+f00473_4 Follow f00473_3;
+f00473_5 Follow f00473_4;
+f00473_6 Follow f00473_5;
+f00473_7 Follow f00473_6;
+f00473_8 Follow f00473_7;
+f00473_9 Follow f00473_8;
+in00474 FLAG;
+f00474_1 Follow in00474;
+f00474_2 Follow f00474_1;
+f00474_3 Follow f00474_2;
+f00474_4 Follow f00474_3;
+f00474_5 Follow f00474_4;
+f00474_6 Follow f00474_5;
+f00474_7 Follow f00474_6;
+f00474_8 Follow f00474_7;
+f00474_9 Follow f00474_8;
+in00475 FLAG;
+f00475_1 Follow in00475;
+f00475_2 Follow f00475_1;
+f00475_3 Follow f00475_2;
+f00475_4 Follow f00475_3;
+f00475_5 Follow f00475_4;
+f00475_6 Follow f00475_5;
+f00475_7 Follow f00475_6;
+f00475_8 Follow f00475_7;
+f00475_9 Follow f00475_8;
+in00476 FLAG;
+f00476_1 Follow in00476;
+f00476_2 Follow f00476_1;
+f00476_3 Follow f00476_2;
+f00476_4 Follow f00476_3;
+f00476_5 Follow f00476_4;
+f00476_6 Follow f00476_5;
+f00476_7 Follow f00476_6;
+f00476_8 Follow f00476_7;
+f00476_9 Follow f00476_8;
+in00477 FLAG;
+f00477_1 Follow in00477;
+f00477_2 Follow f00477_1;
+f00477_3 Follow f00477_2;
+f00477_4 Follow f00477_3;
+f00477_5 Follow f00477_4;
+f00477_6 Follow f00477_5;
+f00477_7 Follow f00477_6;
+f00477_8 Follow f00477_7;
+f00477_9 Follow f00477_8;
+in00478 FLAG;
+f00478_1 Follow in00478;
+f00478_2 Follow f00478_1;
+f00478_3 Follow f00478_2;
+f00478_4 Follow f00478_3;
+f00478_5 Follow f00478_4;
+f00478_6 Follow f00478_5;
+f00478_7 Follow f00478_6;
+f00478_8 Follow f00478_7;
+f00478_9 Follow f00478_8;
+in00479 FLAG;
+f00479_1 Follow in00479;
+f00479_2 Follow f00479_1;
+f00479_3 Follow f00479_2;
+f00479_4 Follow f00479_3;
+f00479_5 Follow f00479_4;
+f00479_6 Follow f00479_5;
+f00479_7 Follow f00479_6;
+f00479_8 Follow f00479_7;
+f00479_9 Follow f00479_8;
+in00480 FLAG;
+f00480_1 Follow in00480;
+f00480_2 Follow f00480_1;
+f00480_3 Follow f00480_2;
+f00480_4 Follow f00480_3;
+f00480_5 Follow f00480_4;
+f00480_6 Follow f00480_5;
+f00480_7 Follow f00480_6;
+f00480_8 Follow f00480_7;
+f00480_9 Follow f00480_8;
+in00481 FLAG;
+f00481_1 Follow in00481;
+f00481_2 Follow f00481_1;
+f00481_3 Follow f00481_2;
+f00481_4 Follow f00481_3;
+f00481_5 Follow f00481_4;
+f00481_6 Follow f00481_5;
+f00481_7 Follow f00481_6;
+f00481_8 Follow f00481_7;
+f00481_9 Follow f00481_8;
+in00482 FLAG;
+f00482_1 Follow in00482;
+f00482_2 Follow f00482_1;
+f00482_3 Follow f00482_2;
+f00482_4 Follow f00482_3;
+f00482_5 Follow f00482_4;
+f00482_6 Follow f00482_5;
+f00482_7 Follow f00482_6;
+f00482_8 Follow f00482_7;
+f00482_9 Follow f00482_8;
+in00483 FLAG;
+f00483_1 Follow in00483;
+f00483_2 Follow f00483_1;
+f00483_3 Follow f00483_2;
+f00483_4 Follow f00483_3;
+f00483_5 Follow f00483_4;
+f00483_6 Follow f00483_5;
+f00483_7 Follow f00483_6;
+f00483_8 Follow f00483_7;
+f00483_9 Follow f00483_8;
+in00484 FLAG;
+f00484_1 Follow in00484;
+f00484_2 Follow f00484_1;
+f00484_3 Follow f00484_2;
+f00484_4 Follow f00484_3;
+f00484_5 Follow f00484_4;
+f00484_6 Follow f00484_5;
+f00484_7 Follow f00484_6;
+f00484_8 Follow f00484_7;
+f00484_9 Follow f00484_8;
+in00485 FLAG;
+f00485_1 Follow in00485;
+f00485_2 Follow f00485_1;
+f00485_3 Follow f00485_2;
+f00485_4 Follow f00485_3;
+f00485_5 Follow f00485_4;
+f00485_6 Follow f00485_5;
+f00485_7 Follow f00485_6;
+f00485_8 Follow f00485_7;
+f00485_9 Follow f00485_8;
+in00486 FLAG;
+f00486_1 Follow in00486;
+f00486_2 Follow f00486_1;
+f00486_3 Follow f00486_2;
+f00486_4 Follow f00486_3;
+f00486_5 Follow f00486_4;
+f00486_6 Follow f00486_5;
+f00486_7 Follow f00486_6;
+f00486_8 Follow f00486_7;
+f00486_9 Follow f00486_8;
+in00487 FLAG;
+f00487_1 Follow in00487;
+f00487_2 Follow f00487_1;
+f00487_3 Follow f00487_2;
+f00487_4 Follow f00487_3;
+f00487_5 Follow f00487_4;
+f00487_6 Follow f00487_5;
+f00487_7 Follow f00487_6;
+f00487_8 Follow f00487_7;
+f00487_9 Follow f00487_8;
+in00488 FLAG;
+f00488_1 Follow in00488;
+f00488_2 Follow f00488_1;
+f00488_3 Follow f00488_2;
+f00488_4 Follow f00488_3;
+f00488_5 Follow f00488_4;
+f00488_6 Follow f00488_5;
+f00488_7 Follow f00488_6;
+f00488_8 Follow f00488_7;
+f00488_9 Follow f00488_8;
+in00489 FLAG;
+f00489_1 Follow in00489;
+f00489_2 Follow f00489_1;
+f00489_3 Follow f00489_2;
+f00489_4 Follow f00489_3;
+f00489_5 Follow f00489_4;
+f00489_6 Follow f00489_5;
+f00489_7 Follow f00489_6;
+f00489_8 Follow f00489_7;
+f00489_9 Follow f00489_8;
+in00490 FLAG;
+f00490_1 Follow in00490;
+f00490_2 Follow f00490_1;
+f00490_3 Follow f00490_2;
+f00490_4 Follow f00490_3;
+f00490_5 Follow f00490_4;
+f00490_6 Follow f00490_5;
+f00490_7 Follow f00490_6;
+f00490_8 Follow f00490_7;
+f00490_9 Follow f00490_8;
+in00491 FLAG;
+f00491_1 Follow in00491;
+f00491_2 Follow f00491_1;
+f00491_3 Follow f00491_2;
+f00491_4 Follow f00491_3;
+f00491_5 Follow f00491_4;
+f00491_6 Follow f00491_5;
+f00491_7 Follow f00491_6;
+f00491_8 Follow f00491_7;
+f00491_9 Follow f00491_8;
+in00492 FLAG;
+f00492_1 Follow in00492;
+f00492_2 Follow f00492_1;
+f00492_3 Follow f00492_2;
+f00492_4 Follow f00492_3;
+f00492_5 Follow f00492_4;
+f00492_6 Follow f00492_5;
+f00492_7 Follow f00492_6;
+f00492_8 Follow f00492_7;
+f00492_9 Follow f00492_8;
+in00493 FLAG;
+f00493_1 Follow in00493;
+f00493_2 Follow f00493_1;
+f00493_3 Follow f00493_2;
+f00493_4 Follow f00493_3;
+f00493_5 Follow f00493_4;
+f00493_6 Follow f00493_5;
+f00493_7 Follow f00493_6;
+f00493_8 Follow f00493_7;
+f00493_9 Follow f00493_8;
+in00494 FLAG;
+f00494_1 Follow in00494;
+f00494_2 Follow f00494_1;
+f00494_3 Follow f00494_2;
+f00494_4 Follow f00494_3;
+f00494_5 Follow f00494_4;
+f00494_6 Follow f00494_5;
+f00494_7 Follow f00494_6;
+f00494_8 Follow f00494_7;
+f00494_9 Follow f00494_8;
+in00495 FLAG;
+f00495_1 Follow in00495;
+f00495_2 Follow f00495_1;
+f00495_3 Follow f00495_2;
+f00495_4 Follow f00495_3;
+f00495_5 Follow f00495_4;
+f00495_6 Follow f00495_5;
+f00495_7 Follow f00495_6;
+f00495_8 Follow f00495_7;
+f00495_9 Follow f00495_8;
+in00496 FLAG;
+f00496_1 Follow in00496;
+f00496_2 Follow f00496_1;
+f00496_3 Follow f00496_2;
+f00496_4 Follow f00496_3;
+f00496_5 Follow f00496_4;
+f00496_6 Follow f00496_5;
+f00496_7 Follow f00496_6;
+f00496_8 Follow f00496_7;
+f00496_9 Follow f00496_8;
+in00497 FLAG;
+f00497_1 Follow in00497;
+f00497_2 Follow f00497_1;
+f00497_3 Follow f00497_2;
+f00497_4 Follow f00497_3;
+f00497_5 Follow f00497_4;
+f00497_6 Follow f00497_5;
+f00497_7 Follow f00497_6;
+f00497_8 Follow f00497_7;
+f00497_9 Follow f00497_8;
+in00498 FLAG;
+f00498_1 Follow in00498;
+f00498_2 Follow f00498_1;
+f00498_3 Follow f00498_2;
+f00498_4 Follow f00498_3;
+f00498_5 Follow f00498_4;
+f00498_6 Follow f00498_5;
+f00498_7 Follow f00498_6;
+f00498_8 Follow f00498_7;
+f00498_9 Follow f00498_8;
+in00499 FLAG;
+f00499_1 Follow in00499;
+f00499_2 Follow f00499_1;
+f00499_3 Follow f00499_2;
+f00499_4 Follow f00499_3;
+f00499_5 Follow f00499_4;
+f00499_6 Follow f00499_5;
+f00499_7 Follow f00499_6;
+f00499_8 Follow f00499_7;
+f00499_9 Follow f00499_8;
+in00500 FLAG;
+f00500_1 Follow in00500;
+f00500_2 Follow f00500_1;
+f00500_3 Follow f00500_2;
+f00500_4 Follow f00500_3;
+f00500_5 Follow f00500_4;
+f00500_6 Follow f00500_5;
+f00500_7 Follow f00500_6;
+f00500_8 Follow f00500_7;
+f00500_9 Follow f00500_8;
+in00501 FLAG;
+f00501_1 Follow in00501;
+f00501_2 Follow f00501_1;
+f00501_3 Follow f00501_2;
+f00501_4 Follow f00501_3;
+f00501_5 Follow f00501_4;
+f00501_6 Follow f00501_5;
+f00501_7 Follow f00501_6;
+f00501_8 Follow f00501_7;
+f00501_9 Follow f00501_8;
+in00502 FLAG;
+f00502_1 Follow in00502;
+f00502_2 Follow f00502_1;
+f00502_3 Follow f00502_2;
+f00502_4 Follow f00502_3;
+f00502_5 Follow f00502_4;
+f00502_6 Follow f00502_5;
+f00502_7 Follow f00502_6;
+f00502_8 Follow f00502_7;
+f00502_9 Follow f00502_8;
+in00503 FLAG;
+f00503_1 Follow in00503;
+f00503_2 Follow f00503_1;
+f00503_3 Follow f00503_2;
+f00503_4 Follow f00503_3;
+f00503_5 Follow f00503_4;
+f00503_6 Follow f00503_5;
+f00503_7 Follow f00503_6;
+f00503_8 Follow f00503_7;
+f00503_9 Follow f00503_8;
+in00504 FLAG;
+f00504_1 Follow in00504;
+f00504_2 Follow f00504_1;
+f00504_3 Follow f00504_2;
+f00504_4 Follow f00504_3;
+f00504_5 Follow f00504_4;
+f00504_6 Follow f00504_5;
+f00504_7 Follow f00504_6;
+f00504_8 Follow f00504_7;
+f00504_9 Follow f00504_8;
+in00505 FLAG;
+f00505_1 Follow in00505;
+f00505_2 Follow f00505_1;
+f00505_3 Follow f00505_2;
+f00505_4 Follow f00505_3;
+f00505_5 Follow f00505_4;
+f00505_6 Follow f00505_5;
+f00505_7 Follow f00505_6;
+f00505_8 Follow f00505_7;
+f00505_9 Follow f00505_8;
+in00506 FLAG;
+f00506_1 Follow in00506;
+f00506_2 Follow f00506_1;
+f00506_3 Follow f00506_2;
+f00506_4 Follow f00506_3;
+f00506_5 Follow f00506_4;
+f00506_6 Follow f00506_5;
+f00506_7 Follow f00506_6;
+f00506_8 Follow f00506_7;
+f00506_9 Follow f00506_8;
+in00507 FLAG;
+f00507_1 Follow in00507;
+f00507_2 Follow f00507_1;
+f00507_3 Follow f00507_2;
+f00507_4 Follow f00507_3;
+f00507_5 Follow f00507_4;
+f00507_6 Follow f00507_5;
+f00507_7 Follow f00507_6;
+f00507_8 Follow f00507_7;
+f00507_9 Follow f00507_8;
+in00508 FLAG;
+f00508_1 Follow in00508;
+f00508_2 Follow f00508_1;
+f00508_3 Follow f00508_2;
+f00508_4 Follow f00508_3;
+f00508_5 Follow f00508_4;
+f00508_6 Follow f00508_5;
+f00508_7 Follow f00508_6;
+f00508_8 Follow f00508_7;
+f00508_9 Follow f00508_8;
+in00509 FLAG;
+f00509_1 Follow in00509;
+f00509_2 Follow f00509_1;
+f00509_3 Follow f00509_2;
+f00509_4 Follow f00509_3;
+f00509_5 Follow f00509_4;
+f00509_6 Follow f00509_5;
+f00509_7 Follow f00509_6;
+f00509_8 Follow f00509_7;
+f00509_9 Follow f00509_8;
+in00510 FLAG;
+f00510_1 Follow in00510;
+f00510_2 Follow f00510_1;
+f00510_3 Follow f00510_2;
+f00510_4 Follow f00510_3;
+f00510_5 Follow f00510_4;
+f00510_6 Follow f00510_5;
+f00510_7 Follow f00510_6;
+f00510_8 Follow f00510_7;
+f00510_9 Follow f00510_8;
+in00511 FLAG;
+f00511_1 Follow in00511;
+f00511_2 Follow f00511_1;
+f00511_3 Follow f00511_2;
+f00511_4 Follow f00511_3;
+f00511_5 Follow f00511_4;
+f00511_6 Follow f00511_5;
+f00511_7 Follow f00511_6;
+f00511_8 Follow f00511_7;
+f00511_9 Follow f00511_8;
+in00512 FLAG;
+f00512_1 Follow in00512;
+f00512_2 Follow f00512_1;
+f00512_3 Follow f00512_2;
+f00512_4 Follow f00512_3;
+f00512_5 Follow f00512_4;
+f00512_6 Follow f00512_5;
+f00512_7 Follow f00512_6;
+f00512_8 Follow f00512_7;
+f00512_9 Follow f00512_8;
+in00513 FLAG;
+f00513_1 Follow in00513;
+f00513_2 Follow f00513_1;
+f00513_3 Follow f00513_2;
+f00513_4 Follow f00513_3;
+f00513_5 Follow f00513_4;
+f00513_6 Follow f00513_5;
+f00513_7 Follow f00513_6;
+f00513_8 Follow f00513_7;
+f00513_9 Follow f00513_8;
+in00514 FLAG;
+f00514_1 Follow in00514;
+f00514_2 Follow f00514_1;
+f00514_3 Follow f00514_2;
+f00514_4 Follow f00514_3;
+f00514_5 Follow f00514_4;
+f00514_6 Follow f00514_5;
+f00514_7 Follow f00514_6;
+f00514_8 Follow f00514_7;
+f00514_9 Follow f00514_8;
+in00515 FLAG;
+f00515_1 Follow in00515;
+f00515_2 Follow f00515_1;
+f00515_3 Follow f00515_2;
+f00515_4 Follow f00515_3;
+f00515_5 Follow f00515_4;
+f00515_6 Follow f00515_5;
+f00515_7 Follow f00515_6;
+f00515_8 Follow f00515_7;
+f00515_9 Follow f00515_8;
+in00516 FLAG;
+f00516_1 Follow in00516;
+f00516_2 Follow f00516_1;
+f00516_3 Follow f00516_2;
+f00516_4 Follow f00516_3;
+f00516_5 Follow f00516_4;
+f00516_6 Follow f00516_5;
+f00516_7 Follow f00516_6;
+f00516_8 Follow f00516_7;
+f00516_9 Follow f00516_8;
+in00517 FLAG;
+f00517_1 Follow in00517;
+f00517_2 Follow f00517_1;
+f00517_3 Follow f00517_2;
+f00517_4 Follow f00517_3;
+f00517_5 Follow f00517_4;
+f00517_6 Follow f00517_5;
+f00517_7 Follow f00517_6;
+f00517_8 Follow f00517_7;
+f00517_9 Follow f00517_8;
+in00518 FLAG;
+f00518_1 Follow in00518;
+f00518_2 Follow f00518_1;
+f00518_3 Follow f00518_2;
+f00518_4 Follow f00518_3;
+f00518_5 Follow f00518_4;
+f00518_6 Follow f00518_5;
+f00518_7 Follow f00518_6;
+f00518_8 Follow f00518_7;
+f00518_9 Follow f00518_8;
+in00519 FLAG;
+f00519_1 Follow in00519;
+f00519_2 Follow f00519_1;
+f00519_3 Follow f00519_2;
+f00519_4 Follow f00519_3;
+f00519_5 Follow f00519_4;
+f00519_6 Follow f00519_5;
+f00519_7 Follow f00519_6;
+f00519_8 Follow f00519_7;
+f00519_9 Follow f00519_8;
+in00520 FLAG;
+f00520_1 Follow in00520;
+f00520_2 Follow f00520_1;
+f00520_3 Follow f00520_2;
+f00520_4 Follow f00520_3;
+f00520_5 Follow f00520_4;
+f00520_6 Follow f00520_5;
+f00520_7 Follow f00520_6;
+f00520_8 Follow f00520_7;
+f00520_9 Follow f00520_8;
+in00521 FLAG;
+f00521_1 Follow in00521;
+f00521_2 Follow f00521_1;
+f00521_3 Follow f00521_2;
+f00521_4 Follow f00521_3;
+f00521_5 Follow f00521_4;
+f00521_6 Follow f00521_5;
+f00521_7 Follow f00521_6;
+f00521_8 Follow f00521_7;
+f00521_9 Follow f00521_8;
+in00522 FLAG;
+f00522_1 Follow in00522;
+f00522_2 Follow f00522_1;
+f00522_3 Follow f00522_2;
+f00522_4 Follow f00522_3;
+f00522_5 Follow f00522_4;
+f00522_6 Follow f00522_5;
+f00522_7 Follow f00522_6;
+f00522_8 Follow f00522_7;
+f00522_9 Follow f00522_8;
+in00523 FLAG;
+f00523_1 Follow in00523;
+f00523_2 Follow f00523_1;
+f00523_3 Follow f00523_2;
+f00523_4 Follow f00523_3;
+f00523_5 Follow f00523_4;
+f00523_6 Follow f00523_5;
+f00523_7 Follow f00523_6;
+f00523_8 Follow f00523_7;
+f00523_9 Follow f00523_8;
+in00524 FLAG;
+f00524_1 Follow in00524;
+f00524_2 Follow f00524_1;
+f00524_3 Follow f00524_2;
+f00524_4 Follow f00524_3;
+f00524_5 Follow f00524_4;
+f00524_6 Follow f00524_5;
+f00524_7 Follow f00524_6;
+f00524_8 Follow f00524_7;
+f00524_9 Follow f00524_8;
+in00525 FLAG;
+f00525_1 Follow in00525;
+f00525_2 Follow f00525_1;
+f00525_3 Follow f00525_2;
+f00525_4 Follow f00525_3;
+f00525_5 Follow f00525_4;
+f00525_6 Follow f00525_5;
+f00525_7 Follow f00525_6;
+f00525_8 Follow f00525_7;
+f00525_9 Follow f00525_8;
+in00526 FLAG;
+f00526_1 Follow in00526;
+f00526_2 Follow f00526_1;
+f00526_3 Follow f00526_2;
+f00526_4 Follow f00526_3;
+f00526_5 Follow f00526_4;
+f00526_6 Follow f00526_5;
+f00526_7 Follow f00526_6;
+f00526_8 Follow f00526_7;
+f00526_9 Follow f00526_8;
+in00527 FLAG;
+f00527_1 Follow in00527;
+f00527_2 Follow f00527_1;
+f00527_3 Follow f00527_2;
+f00527_4 Follow f00527_3;
+f00527_5 Follow f00527_4;
+f00527_6 Follow f00527_5;
+f00527_7 Follow f00527_6;
+f00527_8 Follow f00527_7;
+f00527_9 Follow f00527_8;
+in00528 FLAG;
+f00528_1 Follow in00528;
+f00528_2 Follow f00528_1;
+f00528_3 Follow f00528_2;
+f00528_4 Follow f00528_3;
+f00528_5 Follow f00528_4;
+f00528_6 Follow f00528_5;
+f00528_7 Follow f00528_6;
+f00528_8 Follow f00528_7;
+f00528_9 Follow f00528_8;
+in00529 FLAG;
+f00529_1 Follow in00529;
+f00529_2 Follow f00529_1;
+f00529_3 Follow f00529_2;
+f00529_4 Follow f00529_3;
+f00529_5 Follow f00529_4;
+f00529_6 Follow f00529_5;
+f00529_7 Follow f00529_6;
+f00529_8 Follow f00529_7;
+f00529_9 Follow f00529_8;
+in00530 FLAG;
+f00530_1 Follow in00530;
+f00530_2 Follow f00530_1;
+f00530_3 Follow f00530_2;
+f00530_4 Follow f00530_3;
+f00530_5 Follow f00530_4;
+f00530_6 Follow f00530_5;
+f00530_7 Follow f00530_6;
+f00530_8 Follow f00530_7;
+f00530_9 Follow f00530_8;
+in00531 FLAG;
+f00531_1 Follow in00531;
+f00531_2 Follow f00531_1;
+f00531_3 Follow f00531_2;
+f00531_4 Follow f00531_3;
+f00531_5 Follow f00531_4;
+f00531_6 Follow f00531_5;
+f00531_7 Follow f00531_6;
+f00531_8 Follow f00531_7;
+f00531_9 Follow f00531_8;
+in00532 FLAG;
+f00532_1 Follow in00532;
+f00532_2 Follow f00532_1;
+f00532_3 Follow f00532_2;
+f00532_4 Follow f00532_3;
+f00532_5 Follow f00532_4;
+f00532_6 Follow f00532_5;
+f00532_7 Follow f00532_6;
+f00532_8 Follow f00532_7;
+f00532_9 Follow f00532_8;
+in00533 FLAG;
+f00533_1 Follow in00533;
+f00533_2 Follow f00533_1;
+f00533_3 Follow f00533_2;
+f00533_4 Follow f00533_3;
+f00533_5 Follow f00533_4;
+f00533_6 Follow f00533_5;
+f00533_7 Follow f00533_6;
+f00533_8 Follow f00533_7;
+f00533_9 Follow f00533_8;
+in00534 FLAG;
+f00534_1 Follow in00534;
+f00534_2 Follow f00534_1;
+f00534_3 Follow f00534_2;
+f00534_4 Follow f00534_3;
+f00534_5 Follow f00534_4;
+f00534_6 Follow f00534_5;
+f00534_7 Follow f00534_6;
+f00534_8 Follow f00534_7;
+f00534_9 Follow f00534_8;
+in00535 FLAG;
+f00535_1 Follow in00535;
+f00535_2 Follow f00535_1;
+f00535_3 Follow f00535_2;
+f00535_4 Follow f00535_3;
+f00535_5 Follow f00535_4;
+f00535_6 Follow f00535_5;
+f00535_7 Follow f00535_6;
+f00535_8 Follow f00535_7;
+f00535_9 Follow f00535_8;
+in00536 FLAG;
+f00536_1 Follow in00536;
+f00536_2 Follow f00536_1;
+f00536_3 Follow f00536_2;
+f00536_4 Follow f00536_3;
+f00536_5 Follow f00536_4;
+f00536_6 Follow f00536_5;
+f00536_7 Follow f00536_6;
+f00536_8 Follow f00536_7;
+f00536_9 Follow f00536_8;
+in00537 FLAG;
+f00537_1 Follow in00537;
+f00537_2 Follow f00537_1;
+f00537_3 Follow f00537_2;
+f00537_4 Follow f00537_3;
+f00537_5 Follow f00537_4;
+f00537_6 Follow f00537_5;
+f00537_7 Follow f00537_6;
+f00537_8 Follow f00537_7;
+f00537_9 Follow f00537_8;
+in00538 FLAG;
+f00538_1 Follow in00538;
+f00538_2 Follow f00538_1;
+f00538_3 Follow f00538_2;
+f00538_4 Follow f00538_3;
+f00538_5 Follow f00538_4;
+f00538_6 Follow f00538_5;
+f00538_7 Follow f00538_6;
+f00538_8 Follow f00538_7;
+f00538_9 Follow f00538_8;
+in00539 FLAG;
+f00539_1 Follow in00539;
+f00539_2 Follow f00539_1;
+f00539_3 Follow f00539_2;
+f00539_4 Follow f00539_3;
+f00539_5 Follow f00539_4;
+f00539_6 Follow f00539_5;
+f00539_7 Follow f00539_6;
+f00539_8 Follow f00539_7;
+f00539_9 Follow f00539_8;
+in00540 FLAG;
+f00540_1 Follow in00540;
+f00540_2 Follow f00540_1;
+f00540_3 Follow f00540_2;
+f00540_4 Follow f00540_3;
+f00540_5 Follow f00540_4;
+f00540_6 Follow f00540_5;
+f00540_7 Follow f00540_6;
+f00540_8 Follow f00540_7;
+f00540_9 Follow f00540_8;
+in00541 FLAG;
+f00541_1 Follow in00541;
+f00541_2 Follow f00541_1;
+f00541_3 Follow f00541_2;
+f00541_4 Follow f00541_3;
+f00541_5 Follow f00541_4;
+f00541_6 Follow f00541_5;
+f00541_7 Follow f00541_6;
+f00541_8 Follow f00541_7;
+f00541_9 Follow f00541_8;
+in00542 FLAG;
+f00542_1 Follow in00542;
+f00542_2 Follow f00542_1;
+f00542_3 Follow f00542_2;
+f00542_4 Follow f00542_3;
+f00542_5 Follow f00542_4;
+f00542_6 Follow f00542_5;
+f00542_7 Follow f00542_6;
+f00542_8 Follow f00542_7;
+f00542_9 Follow f00542_8;
+in00543 FLAG;
+f00543_1 Follow in00543;
+f00543_2 Follow f00543_1;
+f00543_3 Follow f00543_2;
+f00543_4 Follow f00543_3;
+f00543_5 Follow f00543_4;
+f00543_6 Follow f00543_5;
+f00543_7 Follow f00543_6;
+f00543_8 Follow f00543_7;
+f00543_9 Follow f00543_8;
+in00544 FLAG;
+f00544_1 Follow in00544;
+f00544_2 Follow f00544_1;
+f00544_3 Follow f00544_2;
+f00544_4 Follow f00544_3;
+f00544_5 Follow f00544_4;
+f00544_6 Follow f00544_5;
+f00544_7 Follow f00544_6;
+f00544_8 Follow f00544_7;
+f00544_9 Follow f00544_8;
+in00545 FLAG;
+f00545_1 Follow in00545;
+f00545_2 Follow f00545_1;
+f00545_3 Follow f00545_2;
+f00545_4 Follow f00545_3;
+f00545_5 Follow f00545_4;
+f00545_6 Follow f00545_5;
+f00545_7 Follow f00545_6;
+f00545_8 Follow f00545_7;
+f00545_9 Follow f00545_8;
+in00546 FLAG;
+f00546_1 Follow in00546;
+f00546_2 Follow f00546_1;
+f00546_3 Follow f00546_2;
+f00546_4 Follow f00546_3;
+f00546_5 Follow f00546_4;
+f00546_6 Follow f00546_5;
+f00546_7 Follow f00546_6;
+f00546_8 Follow f00546_7;
+f00546_9 Follow f00546_8;
+in00547 FLAG;
+f00547_1 Follow in00547;
+f00547_2 Follow f00547_1;
+f00547_3 Follow f00547_2;
+f00547_4 Follow f00547_3;
+f00547_5 Follow f00547_4;
+f00547_6 Follow f00547_5;
+f00547_7 Follow f00547_6;
+f00547_8 Follow f00547_7;
+f00547_9 Follow f00547_8;
+in00548 FLAG;
+f00548_1 Follow in00548;
+f00548_2 Follow f00548_1;
+f00548_3 Follow f00548_2;
+f00548_4 Follow f00548_3;
+f00548_5 Follow f00548_4;
+f00548_6 Follow f00548_5;
+f00548_7 Follow f00548_6;
+f00548_8 Follow f00548_7;
+f00548_9 Follow f00548_8;
+in00549 FLAG;
+f00549_1 Follow in00549;
+f00549_2 Follow f00549_1;
+f00549_3 Follow f00549_2;
+f00549_4 Follow f00549_3;
+f00549_5 Follow f00549_4;
+f00549_6 Follow f00549_5;
+f00549_7 Follow f00549_6;
+f00549_8 Follow f00549_7;
+f00549_9 Follow f00549_8;
+in00550 FLAG;
+f00550_1 Follow in00550;
+f00550_2 Follow f00550_1;
+f00550_3 Follow f00550_2;
+f00550_4 Follow f00550_3;
+f00550_5 Follow f00550_4;
+f00550_6 Follow f00550_5;
+f00550_7 Follow f00550_6;
+f00550_8 Follow f00550_7;
+f00550_9 Follow f00550_8;
+in00551 FLAG;
+f00551_1 Follow in00551;
+f00551_2 Follow f00551_1;
+f00551_3 Follow f00551_2;
+f00551_4 Follow f00551_3;
+f00551_5 Follow f00551_4;
+f00551_6 Follow f00551_5;
+f00551_7 Follow f00551_6;
+f00551_8 Follow f00551_7;
+f00551_9 Follow f00551_8;
+in00552 FLAG;
+f00552_1 Follow in00552;
+f00552_2 Follow f00552_1;
+f00552_3 Follow f00552_2;
+f00552_4 Follow f00552_3;
+f00552_5 Follow f00552_4;
+f00552_6 Follow f00552_5;
+f00552_7 Follow f00552_6;
+f00552_8 Follow f00552_7;
+f00552_9 Follow f00552_8;
+in00553 FLAG;
+f00553_1 Follow in00553;
+f00553_2 Follow f00553_1;
+f00553_3 Follow f00553_2;
+f00553_4 Follow f00553_3;
+f00553_5 Follow f00553_4;
+f00553_6 Follow f00553_5;
+f00553_7 Follow f00553_6;
+f00553_8 Follow f00553_7;
+f00553_9 Follow f00553_8;
+in00554 FLAG;
+f00554_1 Follow in00554;
+f00554_2 Follow f00554_1;
+f00554_3 Follow f00554_2;
+f00554_4 Follow f00554_3;
+f00554_5 Follow f00554_4;
+f00554_6 Follow f00554_5;
+f00554_7 Follow f00554_6;
+f00554_8 Follow f00554_7;
+f00554_9 Follow f00554_8;
+in00555 FLAG;
+f00555_1 Follow in00555;
+f00555_2 Follow f00555_1;
+f00555_3 Follow f00555_2;
+f00555_4 Follow f00555_3;
+f00555_5 Follow f00555_4;
+f00555_6 Follow f00555_5;
+f00555_7 Follow f00555_6;
+f00555_8 Follow f00555_7;
+f00555_9 Follow f00555_8;
+in00556 FLAG;
+f00556_1 Follow in00556;
+f00556_2 Follow f00556_1;
+f00556_3 Follow f00556_2;
+f00556_4 Follow f00556_3;
+f00556_5 Follow f00556_4;
+f00556_6 Follow f00556_5;
+f00556_7 Follow f00556_6;
+f00556_8 Follow f00556_7;
+f00556_9 Follow f00556_8;
+in00557 FLAG;
+f00557_1 Follow in00557;
+f00557_2 Follow f00557_1;
+f00557_3 Follow f00557_2;
+f00557_4 Follow f00557_3;
+f00557_5 Follow f00557_4;
+f00557_6 Follow f00557_5;
+f00557_7 Follow f00557_6;
+f00557_8 Follow f00557_7;
+f00557_9 Follow f00557_8;
+in00558 FLAG;
+f00558_1 Follow in00558;
+f00558_2 Follow f00558_1;
+f00558_3 Follow f00558_2;
+f00558_4 Follow f00558_3;
+f00558_5 Follow f00558_4;
+f00558_6 Follow f00558_5;
+f00558_7 Follow f00558_6;
+f00558_8 Follow f00558_7;
+f00558_9 Follow f00558_8;
+in00559 FLAG;
+f00559_1 Follow in00559;
+f00559_2 Follow f00559_1;
+f00559_3 Follow f00559_2;
+f00559_4 Follow f00559_3;
+f00559_5 Follow f00559_4;
+f00559_6 Follow f00559_5;
+f00559_7 Follow f00559_6;
+f00559_8 Follow f00559_7;
+f00559_9 Follow f00559_8;
+in00560 FLAG;
+f00560_1 Follow in00560;
+f00560_2 Follow f00560_1;
+f00560_3 Follow f00560_2;
+f00560_4 Follow f00560_3;
+f00560_5 Follow f00560_4;
+f00560_6 Follow f00560_5;
+f00560_7 Follow f00560_6;
+f00560_8 Follow f00560_7;
+f00560_9 Follow f00560_8;
+in00561 FLAG;
+f00561_1 Follow in00561;
+f00561_2 Follow f00561_1;
+f00561_3 Follow f00561_2;
+f00561_4 Follow f00561_3;
+f00561_5 Follow f00561_4;
+f00561_6 Follow f00561_5;
+f00561_7 Follow f00561_6;
+f00561_8 Follow f00561_7;
+f00561_9 Follow f00561_8;
+in00562 FLAG;
+f00562_1 Follow in00562;
+f00562_2 Follow f00562_1;
+f00562_3 Follow f00562_2;
+f00562_4 Follow f00562_3;
+f00562_5 Follow f00562_4;
+f00562_6 Follow f00562_5;
+f00562_7 Follow f00562_6;
+f00562_8 Follow f00562_7;
+f00562_9 Follow f00562_8;
+in00563 FLAG;
+f00563_1 Follow in00563;
+f00563_2 Follow f00563_1;
+f00563_3 Follow f00563_2;
+f00563_4 Follow f00563_3;
+f00563_5 Follow f00563_4;
+f00563_6 Follow f00563_5;
+f00563_7 Follow f00563_6;
+f00563_8 Follow f00563_7;
+f00563_9 Follow f00563_8;
+in00564 FLAG;
+f00564_1 Follow in00564;
+f00564_2 Follow f00564_1;
+f00564_3 Follow f00564_2;
+f00564_4 Follow f00564_3;
+f00564_5 Follow f00564_4;
+f00564_6 Follow f00564_5;
+f00564_7 Follow f00564_6;
+f00564_8 Follow f00564_7;
+f00564_9 Follow f00564_8;
+in00565 FLAG;
+f00565_1 Follow in00565;
+f00565_2 Follow f00565_1;
+f00565_3 Follow f00565_2;
+f00565_4 Follow f00565_3;
+f00565_5 Follow f00565_4;
+f00565_6 Follow f00565_5;
+f00565_7 Follow f00565_6;
+f00565_8 Follow f00565_7;
+f00565_9 Follow f00565_8;
+in00566 FLAG;
+f00566_1 Follow in00566;
+f00566_2 Follow f00566_1;
+f00566_3 Follow f00566_2;
+f00566_4 Follow f00566_3;
+f00566_5 Follow f00566_4;
+f00566_6 Follow f00566_5;
+f00566_7 Follow f00566_6;
+f00566_8 Follow f00566_7;
+f00566_9 Follow f00566_8;
+in00567 FLAG;
+f00567_1 Follow in00567;
+f00567_2 Follow f00567_1;
+f00567_3 Follow f00567_2;
+f00567_4 Follow f00567_3;
+f00567_5 Follow f00567_4;
+f00567_6 Follow f00567_5;
+f00567_7 Follow f00567_6;
+f00567_8 Follow f00567_7;
+f00567_9 Follow f00567_8;
+in00568 FLAG;
+f00568_1 Follow in00568;
+f00568_2 Follow f00568_1;
+f00568_3 Follow f00568_2;
+f00568_4 Follow f00568_3;
+f00568_5 Follow f00568_4;
+f00568_6 Follow f00568_5;
+f00568_7 Follow f00568_6;
+f00568_8 Follow f00568_7;
+f00568_9 Follow f00568_8;
+in00569 FLAG;
+f00569_1 Follow in00569;
+f00569_2 Follow f00569_1;
+f00569_3 Follow f00569_2;
+f00569_4 Follow f00569_3;
+f00569_5 Follow f00569_4;
+f00569_6 Follow f00569_5;
+f00569_7 Follow f00569_6;
+f00569_8 Follow f00569_7;
+f00569_9 Follow f00569_8;
+in00570 FLAG;
+f00570_1 Follow in00570;
+f00570_2 Follow f00570_1;
+f00570_3 Follow f00570_2;
+f00570_4 Follow f00570_3;
+f00570_5 Follow f00570_4;
+f00570_6 Follow f00570_5;
+f00570_7 Follow f00570_6;
+f00570_8 Follow f00570_7;
+f00570_9 Follow f00570_8;
+in00571 FLAG;
+f00571_1 Follow in00571;
+f00571_2 Follow f00571_1;
+f00571_3 Follow f00571_2;
+f00571_4 Follow f00571_3;
+f00571_5 Follow f00571_4;
+f00571_6 Follow f00571_5;
+f00571_7 Follow f00571_6;
+f00571_8 Follow f00571_7;
+f00571_9 Follow f00571_8;
+in00572 FLAG;
+f00572_1 Follow in00572;
+f00572_2 Follow f00572_1;
+f00572_3 Follow f00572_2;
+f00572_4 Follow f00572_3;
+f00572_5 Follow f00572_4;
+f00572_6 Follow f00572_5;
+f00572_7 Follow f00572_6;
+f00572_8 Follow f00572_7;
+f00572_9 Follow f00572_8;
+in00573 FLAG;
+f00573_1 Follow in00573;
+f00573_2 Follow f00573_1;
+f00573_3 Follow f00573_2;
+f00573_4 Follow f00573_3;
+f00573_5 Follow f00573_4;
+f00573_6 Follow f00573_5;
+f00573_7 Follow f00573_6;
+f00573_8 Follow f00573_7;
+f00573_9 Follow f00573_8;
+in00574 FLAG;
+f00574_1 Follow in00574;
+f00574_2 Follow f00574_1;
+f00574_3 Follow f00574_2;
+f00574_4 Follow f00574_3;
+f00574_5 Follow f00574_4;
+f00574_6 Follow f00574_5;
+f00574_7 Follow f00574_6;
+f00574_8 Follow f00574_7;
+f00574_9 Follow f00574_8;
+in00575 FLAG;
+f00575_1 Follow in00575;
+f00575_2 Follow f00575_1;
+f00575_3 Follow f00575_2;
+f00575_4 Follow f00575_3;
+f00575_5 Follow f00575_4;
+f00575_6 Follow f00575_5;
+f00575_7 Follow f00575_6;
+f00575_8 Follow f00575_7;
+f00575_9 Follow f00575_8;
+in00576 FLAG;
+f00576_1 Follow in00576;
+f00576_2 Follow f00576_1;
+f00576_3 Follow f00576_2;
+f00576_4 Follow f00576_3;
+f00576_5 Follow f00576_4;
+f00576_6 Follow f00576_5;
+f00576_7 Follow f00576_6;
+f00576_8 Follow f00576_7;
+f00576_9 Follow f00576_8;
+in00577 FLAG;
+f00577_1 Follow in00577;
+f00577_2 Follow f00577_1;
+f00577_3 Follow f00577_2;
+f00577_4 Follow f00577_3;
+f00577_5 Follow f00577_4;
+f00577_6 Follow f00577_5;
+f00577_7 Follow f00577_6;
+f00577_8 Follow f00577_7;
+f00577_9 Follow f00577_8;
+in00578 FLAG;
+f00578_1 Follow in00578;
+f00578_2 Follow f00578_1;
+f00578_3 Follow f00578_2;
+f00578_4 Follow f00578_3;
+f00578_5 Follow f00578_4;
+f00578_6 Follow f00578_5;
+f00578_7 Follow f00578_6;
+f00578_8 Follow f00578_7;
+f00578_9 Follow f00578_8;
+in00579 FLAG;
+f00579_1 Follow in00579;
+f00579_2 Follow f00579_1;
+f00579_3 Follow f00579_2;
+f00579_4 Follow f00579_3;
+f00579_5 Follow f00579_4;
+f00579_6 Follow f00579_5;
+f00579_7 Follow f00579_6;
+f00579_8 Follow f00579_7;
+f00579_9 Follow f00579_8;
+in00580 FLAG;
+f00580_1 Follow in00580;
+f00580_2 Follow f00580_1;
+f00580_3 Follow f00580_2;
+f00580_4 Follow f00580_3;
+f00580_5 Follow f00580_4;
+f00580_6 Follow f00580_5;
+f00580_7 Follow f00580_6;
+f00580_8 Follow f00580_7;
+f00580_9 Follow f00580_8;
+in00581 FLAG;
+f00581_1 Follow in00581;
+f00581_2 Follow f00581_1;
+f00581_3 Follow f00581_2;
+f00581_4 Follow f00581_3;
+f00581_5 Follow f00581_4;
+f00581_6 Follow f00581_5;
+f00581_7 Follow f00581_6;
+f00581_8 Follow f00581_7;
+f00581_9 Follow f00581_8;
+in00582 FLAG;
+f00582_1 Follow in00582;
+f00582_2 Follow f00582_1;
+f00582_3 Follow f00582_2;
+f00582_4 Follow f00582_3;
+f00582_5 Follow f00582_4;
+f00582_6 Follow f00582_5;
+f00582_7 Follow f00582_6;
+f00582_8 Follow f00582_7;
+f00582_9 Follow f00582_8;
+in00583 FLAG;
+f00583_1 Follow in00583;
+f00583_2 Follow f00583_1;
+f00583_3 Follow f00583_2;
+f00583_4 Follow f00583_3;
+f00583_5 Follow f00583_4;
+f00583_6 Follow f00583_5;
+f00583_7 Follow f00583_6;
+f00583_8 Follow f00583_7;
+f00583_9 Follow f00583_8;
+in00584 FLAG;
+f00584_1 Follow in00584;
+f00584_2 Follow f00584_1;
+f00584_3 Follow f00584_2;
+f00584_4 Follow f00584_3;
+f00584_5 Follow f00584_4;
+f00584_6 Follow f00584_5;
+f00584_7 Follow f00584_6;
+f00584_8 Follow f00584_7;
+f00584_9 Follow f00584_8;
+in00585 FLAG;
+f00585_1 Follow in00585;
+f00585_2 Follow f00585_1;
+f00585_3 Follow f00585_2;
+f00585_4 Follow f00585_3;
+f00585_5 Follow f00585_4;
+f00585_6 Follow f00585_5;
+f00585_7 Follow f00585_6;
+f00585_8 Follow f00585_7;
+f00585_9 Follow f00585_8;
+in00586 FLAG;
+f00586_1 Follow in00586;
+f00586_2 Follow f00586_1;
+f00586_3 Follow f00586_2;
+f00586_4 Follow f00586_3;
+f00586_5 Follow f00586_4;
+f00586_6 Follow f00586_5;
+f00586_7 Follow f00586_6;
+f00586_8 Follow f00586_7;
+f00586_9 Follow f00586_8;
+in00587 FLAG;
+f00587_1 Follow in00587;
+f00587_2 Follow f00587_1;
+f00587_3 Follow f00587_2;
+f00587_4 Follow f00587_3;
+f00587_5 Follow f00587_4;
+f00587_6 Follow f00587_5;
+f00587_7 Follow f00587_6;
+f00587_8 Follow f00587_7;
+f00587_9 Follow f00587_8;
+in00588 FLAG;
+f00588_1 Follow in00588;
+f00588_2 Follow f00588_1;
+f00588_3 Follow f00588_2;
+f00588_4 Follow f00588_3;
+f00588_5 Follow f00588_4;
+f00588_6 Follow f00588_5;
+f00588_7 Follow f00588_6;
+f00588_8 Follow f00588_7;
+f00588_9 Follow f00588_8;
+in00589 FLAG;
+f00589_1 Follow in00589;
+f00589_2 Follow f00589_1;
+f00589_3 Follow f00589_2;
+f00589_4 Follow f00589_3;
+f00589_5 Follow f00589_4;
+f00589_6 Follow f00589_5;
+f00589_7 Follow f00589_6;
+f00589_8 Follow f00589_7;
+f00589_9 Follow f00589_8;
+in00590 FLAG;
+f00590_1 Follow in00590;
+f00590_2 Follow f00590_1;
+f00590_3 Follow f00590_2;
+f00590_4 Follow f00590_3;
+f00590_5 Follow f00590_4;
+f00590_6 Follow f00590_5;
+f00590_7 Follow f00590_6;
+f00590_8 Follow f00590_7;
+f00590_9 Follow f00590_8;
+in00591 FLAG;
+f00591_1 Follow in00591;
+f00591_2 Follow f00591_1;
+f00591_3 Follow f00591_2;
+f00591_4 Follow f00591_3;
+f00591_5 Follow f00591_4;
+f00591_6 Follow f00591_5;
+f00591_7 Follow f00591_6;
+f00591_8 Follow f00591_7;
+f00591_9 Follow f00591_8;
+in00592 FLAG;
+f00592_1 Follow in00592;
+f00592_2 Follow f00592_1;
+f00592_3 Follow f00592_2;
+f00592_4 Follow f00592_3;
+f00592_5 Follow f00592_4;
+f00592_6 Follow f00592_5;
+f00592_7 Follow f00592_6;
+f00592_8 Follow f00592_7;
+f00592_9 Follow f00592_8;
+in00593 FLAG;
+f00593_1 Follow in00593;
+f00593_2 Follow f00593_1;
+f00593_3 Follow f00593_2;
+f00593_4 Follow f00593_3;
+f00593_5 Follow f00593_4;
+f00593_6 Follow f00593_5;
+f00593_7 Follow f00593_6;
+f00593_8 Follow f00593_7;
+f00593_9 Follow f00593_8;
+in00594 FLAG;
+f00594_1 Follow in00594;
+f00594_2 Follow f00594_1;
+f00594_3 Follow f00594_2;
+f00594_4 Follow f00594_3;
+f00594_5 Follow f00594_4;
+f00594_6 Follow f00594_5;
+f00594_7 Follow f00594_6;
+f00594_8 Follow f00594_7;
+f00594_9 Follow f00594_8;
+in00595 FLAG;
+f00595_1 Follow in00595;
+f00595_2 Follow f00595_1;
+f00595_3 Follow f00595_2;
+f00595_4 Follow f00595_3;
+f00595_5 Follow f00595_4;
+f00595_6 Follow f00595_5;
+f00595_7 Follow f00595_6;
+f00595_8 Follow f00595_7;
+f00595_9 Follow f00595_8;
+in00596 FLAG;
+f00596_1 Follow in00596;
+f00596_2 Follow f00596_1;
+f00596_3 Follow f00596_2;
+f00596_4 Follow f00596_3;
+f00596_5 Follow f00596_4;
+f00596_6 Follow f00596_5;
+f00596_7 Follow f00596_6;
+f00596_8 Follow f00596_7;
+f00596_9 Follow f00596_8;
+in00597 FLAG;
+f00597_1 Follow in00597;
+f00597_2 Follow f00597_1;
+f00597_3 Follow f00597_2;
+f00597_4 Follow f00597_3;
+f00597_5 Follow f00597_4;
+f00597_6 Follow f00597_5;
+f00597_7 Follow f00597_6;
+f00597_8 Follow f00597_7;
+f00597_9 Follow f00597_8;
+in00598 FLAG;
+f00598_1 Follow in00598;
+f00598_2 Follow f00598_1;
+f00598_3 Follow f00598_2;
+f00598_4 Follow f00598_3;
+f00598_5 Follow f00598_4;
+f00598_6 Follow f00598_5;
+f00598_7 Follow f00598_6;
+f00598_8 Follow f00598_7;
+f00598_9 Follow f00598_8;
+in00599 FLAG;
+f00599_1 Follow in00599;
+f00599_2 Follow f00599_1;
+f00599_3 Follow f00599_2;
+f00599_4 Follow f00599_3;
+f00599_5 Follow f00599_4;
+f00599_6 Follow f00599_5;
+f00599_7 Follow f00599_6;
+f00599_8 Follow f00599_7;
+f00599_9 Follow f00599_8;
+in00600 FLAG;
+f00600_1 Follow in00600;
+f00600_2 Follow f00600_1;
+f00600_3 Follow f00600_2;
+f00600_4 Follow f00600_3;
+f00600_5 Follow f00600_4;
+f00600_6 Follow f00600_5;
+f00600_7 Follow f00600_6;
+f00600_8 Follow f00600_7;
+f00600_9 Follow f00600_8;
+in00601 FLAG;
+f00601_1 Follow in00601;
+f00601_2 Follow f00601_1;
+f00601_3 Follow f00601_2;
+f00601_4 Follow f00601_3;
+f00601_5 Follow f00601_4;
+f00601_6 Follow f00601_5;
+f00601_7 Follow f00601_6;
+f00601_8 Follow f00601_7;
+f00601_9 Follow f00601_8;
+in00602 FLAG;
+f00602_1 Follow in00602;
+f00602_2 Follow f00602_1;
+f00602_3 Follow f00602_2;
+f00602_4 Follow f00602_3;
+f00602_5 Follow f00602_4;
+f00602_6 Follow f00602_5;
+f00602_7 Follow f00602_6;
+f00602_8 Follow f00602_7;
+f00602_9 Follow f00602_8;
+in00603 FLAG;
+f00603_1 Follow in00603;
+f00603_2 Follow f00603_1;
+f00603_3 Follow f00603_2;
+f00603_4 Follow f00603_3;
+f00603_5 Follow f00603_4;
+f00603_6 Follow f00603_5;
+f00603_7 Follow f00603_6;
+f00603_8 Follow f00603_7;
+f00603_9 Follow f00603_8;
+in00604 FLAG;
+f00604_1 Follow in00604;
+f00604_2 Follow f00604_1;
+f00604_3 Follow f00604_2;
+f00604_4 Follow f00604_3;
+f00604_5 Follow f00604_4;
+f00604_6 Follow f00604_5;
+f00604_7 Follow f00604_6;
+f00604_8 Follow f00604_7;
+f00604_9 Follow f00604_8;
+in00605 FLAG;
+f00605_1 Follow in00605;
+f00605_2 Follow f00605_1;
+f00605_3 Follow f00605_2;
+f00605_4 Follow f00605_3;
+f00605_5 Follow f00605_4;
+f00605_6 Follow f00605_5;
+f00605_7 Follow f00605_6;
+f00605_8 Follow f00605_7;
+f00605_9 Follow f00605_8;
+in00606 FLAG;
+f00606_1 Follow in00606;
+f00606_2 Follow f00606_1;
+f00606_3 Follow f00606_2;
+f00606_4 Follow f00606_3;
+f00606_5 Follow f00606_4;
+f00606_6 Follow f00606_5;
+f00606_7 Follow f00606_6;
+f00606_8 Follow f00606_7;
+f00606_9 Follow f00606_8;
+in00607 FLAG;
+f00607_1 Follow in00607;
+f00607_2 Follow f00607_1;
+f00607_3 Follow f00607_2;
+f00607_4 Follow f00607_3;
+f00607_5 Follow f00607_4;
+f00607_6 Follow f00607_5;
+f00607_7 Follow f00607_6;
+f00607_8 Follow f00607_7;
+f00607_9 Follow f00607_8;
+in00608 FLAG;
+f00608_1 Follow in00608;
+f00608_2 Follow f00608_1;
+f00608_3 Follow f00608_2;
+f00608_4 Follow f00608_3;
+f00608_5 Follow f00608_4;
+f00608_6 Follow f00608_5;
+f00608_7 Follow f00608_6;
+f00608_8 Follow f00608_7;
+f00608_9 Follow f00608_8;
+in00609 FLAG;
+f00609_1 Follow in00609;
+f00609_2 Follow f00609_1;
+f00609_3 Follow f00609_2;
+f00609_4 Follow f00609_3;
+f00609_5 Follow f00609_4;
+f00609_6 Follow f00609_5;
+f00609_7 Follow f00609_6;
+f00609_8 Follow f00609_7;
+f00609_9 Follow f00609_8;
+in00610 FLAG;
+f00610_1 Follow in00610;
+f00610_2 Follow f00610_1;
+f00610_3 Follow f00610_2;
+f00610_4 Follow f00610_3;
+f00610_5 Follow f00610_4;
+f00610_6 Follow f00610_5;
+f00610_7 Follow f00610_6;
+f00610_8 Follow f00610_7;
+f00610_9 Follow f00610_8;
+in00611 FLAG;
+f00611_1 Follow in00611;
+f00611_2 Follow f00611_1;
+f00611_3 Follow f00611_2;
+f00611_4 Follow f00611_3;
+f00611_5 Follow f00611_4;
+f00611_6 Follow f00611_5;
+f00611_7 Follow f00611_6;
+f00611_8 Follow f00611_7;
+f00611_9 Follow f00611_8;
+in00612 FLAG;
+f00612_1 Follow in00612;
+f00612_2 Follow f00612_1;
+f00612_3 Follow f00612_2;
+f00612_4 Follow f00612_3;
+f00612_5 Follow f00612_4;
+f00612_6 Follow f00612_5;
+f00612_7 Follow f00612_6;
+f00612_8 Follow f00612_7;
+f00612_9 Follow f00612_8;
+in00613 FLAG;
+f00613_1 Follow in00613;
+f00613_2 Follow f00613_1;
+f00613_3 Follow f00613_2;
+f00613_4 Follow f00613_3;
+f00613_5 Follow f00613_4;
+f00613_6 Follow f00613_5;
+f00613_7 Follow f00613_6;
+f00613_8 Follow f00613_7;
+f00613_9 Follow f00613_8;
+in00614 FLAG;
+f00614_1 Follow in00614;
+f00614_2 Follow f00614_1;
+f00614_3 Follow f00614_2;
+f00614_4 Follow f00614_3;
+f00614_5 Follow f00614_4;
+f00614_6 Follow f00614_5;
+f00614_7 Follow f00614_6;
+f00614_8 Follow f00614_7;
+f00614_9 Follow f00614_8;
+in00615 FLAG;
+f00615_1 Follow in00615;
+f00615_2 Follow f00615_1;
+f00615_3 Follow f00615_2;
+f00615_4 Follow f00615_3;
+f00615_5 Follow f00615_4;
+f00615_6 Follow f00615_5;
+f00615_7 Follow f00615_6;
+f00615_8 Follow f00615_7;
+f00615_9 Follow f00615_8;
+in00616 FLAG;
+f00616_1 Follow in00616;
+f00616_2 Follow f00616_1;
+f00616_3 Follow f00616_2;
+f00616_4 Follow f00616_3;
+f00616_5 Follow f00616_4;
+f00616_6 Follow f00616_5;
+f00616_7 Follow f00616_6;
+f00616_8 Follow f00616_7;
+f00616_9 Follow f00616_8;
+in00617 FLAG;
+f00617_1 Follow in00617;
+f00617_2 Follow f00617_1;
+f00617_3 Follow f00617_2;
+f00617_4 Follow f00617_3;
+f00617_5 Follow f00617_4;
+f00617_6 Follow f00617_5;
+f00617_7 Follow f00617_6;
+f00617_8 Follow f00617_7;
+f00617_9 Follow f00617_8;
+in00618 FLAG;
+f00618_1 Follow in00618;
+f00618_2 Follow f00618_1;
+f00618_3 Follow f00618_2;
+f00618_4 Follow f00618_3;
+f00618_5 Follow f00618_4;
+f00618_6 Follow f00618_5;
+f00618_7 Follow f00618_6;
+f00618_8 Follow f00618_7;
+f00618_9 Follow f00618_8;
+in00619 FLAG;
+f00619_1 Follow in00619;
+f00619_2 Follow f00619_1;
+f00619_3 Follow f00619_2;
+f00619_4 Follow f00619_3;
+f00619_5 Follow f00619_4;
+f00619_6 Follow f00619_5;
+f00619_7 Follow f00619_6;
+f00619_8 Follow f00619_7;
+f00619_9 Follow f00619_8;
+in00620 FLAG;
+f00620_1 Follow in00620;
+f00620_2 Follow f00620_1;
+f00620_3 Follow f00620_2;
+f00620_4 Follow f00620_3;
+f00620_5 Follow f00620_4;
+f00620_6 Follow f00620_5;
+f00620_7 Follow f00620_6;
+f00620_8 Follow f00620_7;
+f00620_9 Follow f00620_8;
+in00621 FLAG;
+f00621_1 Follow in00621;
+f00621_2 Follow f00621_1;
+f00621_3 Follow f00621_2;
+f00621_4 Follow f00621_3;
+f00621_5 Follow f00621_4;
+f00621_6 Follow f00621_5;
+f00621_7 Follow f00621_6;
+f00621_8 Follow f00621_7;
+f00621_9 Follow f00621_8;
+in00622 FLAG;
+f00622_1 Follow in00622;
+f00622_2 Follow f00622_1;
+f00622_3 Follow f00622_2;
+f00622_4 Follow f00622_3;
+f00622_5 Follow f00622_4;
+f00622_6 Follow f00622_5;
+f00622_7 Follow f00622_6;
+f00622_8 Follow f00622_7;
+f00622_9 Follow f00622_8;
+in00623 FLAG;
+f00623_1 Follow in00623;
+f00623_2 Follow f00623_1;
+f00623_3 Follow f00623_2;
+f00623_4 Follow f00623_3;
+f00623_5 Follow f00623_4;
+f00623_6 Follow f00623_5;
+f00623_7 Follow f00623_6;
+f00623_8 Follow f00623_7;
+f00623_9 Follow f00623_8;
+in00624 FLAG;
+f00624_1 Follow in00624;
+f00624_2 Follow f00624_1;
+f00624_3 Follow f00624_2;
+f00624_4 Follow f00624_3;
+f00624_5 Follow f00624_4;
+f00624_6 Follow f00624_5;
+f00624_7 Follow f00624_6;
+f00624_8 Follow f00624_7;
+f00624_9 Follow f00624_8;
+in00625 FLAG;
+f00625_1 Follow in00625;
+f00625_2 Follow f00625_1;
+f00625_3 Follow f00625_2;
+f00625_4 Follow f00625_3;
+f00625_5 Follow f00625_4;
+f00625_6 Follow f00625_5;
+f00625_7 Follow f00625_6;
+f00625_8 Follow f00625_7;
+f00625_9 Follow f00625_8;
+in00626 FLAG;
+f00626_1 Follow in00626;
+f00626_2 Follow f00626_1;
+f00626_3 Follow f00626_2;
+f00626_4 Follow f00626_3;
+f00626_5 Follow f00626_4;
+f00626_6 Follow f00626_5;
+f00626_7 Follow f00626_6;
+f00626_8 Follow f00626_7;
+f00626_9 Follow f00626_8;
+in00627 FLAG;
+f00627_1 Follow in00627;
+f00627_2 Follow f00627_1;
+f00627_3 Follow f00627_2;
+f00627_4 Follow f00627_3;
+f00627_5 Follow f00627_4;
+f00627_6 Follow f00627_5;
+f00627_7 Follow f00627_6;
+f00627_8 Follow f00627_7;
+f00627_9 Follow f00627_8;
+in00628 FLAG;
+f00628_1 Follow in00628;
+f00628_2 Follow f00628_1;
+f00628_3 Follow f00628_2;
+f00628_4 Follow f00628_3;
+f00628_5 Follow f00628_4;
+f00628_6 Follow f00628_5;
+f00628_7 Follow f00628_6;
+f00628_8 Follow f00628_7;
+f00628_9 Follow f00628_8;
+in00629 FLAG;
+f00629_1 Follow in00629;
+f00629_2 Follow f00629_1;
+f00629_3 Follow f00629_2;
+f00629_4 Follow f00629_3;
+f00629_5 Follow f00629_4;
+f00629_6 Follow f00629_5;
+f00629_7 Follow f00629_6;
+f00629_8 Follow f00629_7;
+f00629_9 Follow f00629_8;
+in00630 FLAG;
+f00630_1 Follow in00630;
+f00630_2 Follow f00630_1;
+f00630_3 Follow f00630_2;
+f00630_4 Follow f00630_3;
+f00630_5 Follow f00630_4;
+f00630_6 Follow f00630_5;
+f00630_7 Follow f00630_6;
+f00630_8 Follow f00630_7;
+f00630_9 Follow f00630_8;
+in00631 FLAG;
+f00631_1 Follow in00631;
+f00631_2 Follow f00631_1;
+f00631_3 Follow f00631_2;
+f00631_4 Follow f00631_3;
+f00631_5 Follow f00631_4;
+f00631_6 Follow f00631_5;
+f00631_7 Follow f00631_6;
+f00631_8 Follow f00631_7;
+f00631_9 Follow f00631_8;
+in00632 FLAG;
+f00632_1 Follow in00632;
+f00632_2 Follow f00632_1;
+f00632_3 Follow f00632_2;
+f00632_4 Follow f00632_3;
+f00632_5 Follow f00632_4;
+f00632_6 Follow f00632_5;
+f00632_7 Follow f00632_6;
+f00632_8 Follow f00632_7;
+f00632_9 Follow f00632_8;
+in00633 FLAG;
+f00633_1 Follow in00633;
+f00633_2 Follow f00633_1;
+f00633_3 Follow f00633_2;
+f00633_4 Follow f00633_3;
+f00633_5 Follow f00633_4;
+f00633_6 Follow f00633_5;
+f00633_7 Follow f00633_6;
+f00633_8 Follow f00633_7;
+f00633_9 Follow f00633_8;
+in00634 FLAG;
+f00634_1 Follow in00634;
+f00634_2 Follow f00634_1;
+f00634_3 Follow f00634_2;
+f00634_4 Follow f00634_3;
+f00634_5 Follow f00634_4;
+f00634_6 Follow f00634_5;
+f00634_7 Follow f00634_6;
+f00634_8 Follow f00634_7;
+f00634_9 Follow f00634_8;
+in00635 FLAG;
+f00635_1 Follow in00635;
+f00635_2 Follow f00635_1;
+f00635_3 Follow f00635_2;
+f00635_4 Follow f00635_3;
+f00635_5 Follow f00635_4;
+f00635_6 Follow f00635_5;
+f00635_7 Follow f00635_6;
+f00635_8 Follow f00635_7;
+f00635_9 Follow f00635_8;
+in00636 FLAG;
+f00636_1 Follow in00636;
+f00636_2 Follow f00636_1;
+f00636_3 Follow f00636_2;
+f00636_4 Follow f00636_3;
+f00636_5 Follow f00636_4;
+f00636_6 Follow f00636_5;
+f00636_7 Follow f00636_6;
+f00636_8 Follow f00636_7;
+f00636_9 Follow f00636_8;
+in00637 FLAG;
+f00637_1 Follow in00637;
+f00637_2 Follow f00637_1;
+f00637_3 Follow f00637_2;
+f00637_4 Follow f00637_3;
+f00637_5 Follow f00637_4;
+f00637_6 Follow f00637_5;
+f00637_7 Follow f00637_6;
+f00637_8 Follow f00637_7;
+f00637_9 Follow f00637_8;
+in00638 FLAG;
+f00638_1 Follow in00638;
+f00638_2 Follow f00638_1;
+f00638_3 Follow f00638_2;
+f00638_4 Follow f00638_3;
+f00638_5 Follow f00638_4;
+f00638_6 Follow f00638_5;
+f00638_7 Follow f00638_6;
+f00638_8 Follow f00638_7;
+f00638_9 Follow f00638_8;
+in00639 FLAG;
+f00639_1 Follow in00639;
+f00639_2 Follow f00639_1;
+f00639_3 Follow f00639_2;
+f00639_4 Follow f00639_3;
+f00639_5 Follow f00639_4;
+f00639_6 Follow f00639_5;
+f00639_7 Follow f00639_6;
+f00639_8 Follow f00639_7;
+f00639_9 Follow f00639_8;
+in00640 FLAG;
+f00640_1 Follow in00640;
+f00640_2 Follow f00640_1;
+f00640_3 Follow f00640_2;
+f00640_4 Follow f00640_3;
+f00640_5 Follow f00640_4;
+f00640_6 Follow f00640_5;
+f00640_7 Follow f00640_6;
+f00640_8 Follow f00640_7;
+f00640_9 Follow f00640_8;
+in00641 FLAG;
+f00641_1 Follow in00641;
+f00641_2 Follow f00641_1;
+f00641_3 Follow f00641_2;
+f00641_4 Follow f00641_3;
+f00641_5 Follow f00641_4;
+f00641_6 Follow f00641_5;
+f00641_7 Follow f00641_6;
+f00641_8 Follow f00641_7;
+f00641_9 Follow f00641_8;
+in00642 FLAG;
+f00642_1 Follow in00642;
+f00642_2 Follow f00642_1;
+f00642_3 Follow f00642_2;
+f00642_4 Follow f00642_3;
+f00642_5 Follow f00642_4;
+f00642_6 Follow f00642_5;
+f00642_7 Follow f00642_6;
+f00642_8 Follow f00642_7;
+f00642_9 Follow f00642_8;
+in00643 FLAG;
+f00643_1 Follow in00643;
+f00643_2 Follow f00643_1;
+f00643_3 Follow f00643_2;
+f00643_4 Follow f00643_3;
+f00643_5 Follow f00643_4;
+f00643_6 Follow f00643_5;
+f00643_7 Follow f00643_6;
+f00643_8 Follow f00643_7;
+f00643_9 Follow f00643_8;
+in00644 FLAG;
+f00644_1 Follow in00644;
+f00644_2 Follow f00644_1;
+f00644_3 Follow f00644_2;
+f00644_4 Follow f00644_3;
+f00644_5 Follow f00644_4;
+f00644_6 Follow f00644_5;
+f00644_7 Follow f00644_6;
+f00644_8 Follow f00644_7;
+f00644_9 Follow f00644_8;
+in00645 FLAG;
+f00645_1 Follow in00645;
+f00645_2 Follow f00645_1;
+f00645_3 Follow f00645_2;
+f00645_4 Follow f00645_3;
+f00645_5 Follow f00645_4;
+f00645_6 Follow f00645_5;
+f00645_7 Follow f00645_6;
+f00645_8 Follow f00645_7;
+f00645_9 Follow f00645_8;
+in00646 FLAG;
+f00646_1 Follow in00646;
+f00646_2 Follow f00646_1;
+f00646_3 Follow f00646_2;
+f00646_4 Follow f00646_3;
+f00646_5 Follow f00646_4;
+f00646_6 Follow f00646_5;
+f00646_7 Follow f00646_6;
+f00646_8 Follow f00646_7;
+f00646_9 Follow f00646_8;
+in00647 FLAG;
+f00647_1 Follow in00647;
+f00647_2 Follow f00647_1;
+f00647_3 Follow f00647_2;
+f00647_4 Follow f00647_3;
+f00647_5 Follow f00647_4;
+f00647_6 Follow f00647_5;
+f00647_7 Follow f00647_6;
+f00647_8 Follow f00647_7;
+f00647_9 Follow f00647_8;
+in00648 FLAG;
+f00648_1 Follow in00648;
+f00648_2 Follow f00648_1;
+f00648_3 Follow f00648_2;
+f00648_4 Follow f00648_3;
+f00648_5 Follow f00648_4;
+f00648_6 Follow f00648_5;
+f00648_7 Follow f00648_6;
+f00648_8 Follow f00648_7;
+f00648_9 Follow f00648_8;
+in00649 FLAG;
+f00649_1 Follow in00649;
+f00649_2 Follow f00649_1;
+f00649_3 Follow f00649_2;
+f00649_4 Follow f00649_3;
+f00649_5 Follow f00649_4;
+f00649_6 Follow f00649_5;
+f00649_7 Follow f00649_6;
+f00649_8 Follow f00649_7;
+f00649_9 Follow f00649_8;
+in00650 FLAG;
+f00650_1 Follow in00650;
+f00650_2 Follow f00650_1;
+f00650_3 Follow f00650_2;
+f00650_4 Follow f00650_3;
+f00650_5 Follow f00650_4;
+f00650_6 Follow f00650_5;
+f00650_7 Follow f00650_6;
+f00650_8 Follow f00650_7;
+f00650_9 Follow f00650_8;
+in00651 FLAG;
+f00651_1 Follow in00651;
+f00651_2 Follow f00651_1;
+f00651_3 Follow f00651_2;
+f00651_4 Follow f00651_3;
+f00651_5 Follow f00651_4;
+f00651_6 Follow f00651_5;
+f00651_7 Follow f00651_6;
+f00651_8 Follow f00651_7;
+f00651_9 Follow f00651_8;
+in00652 FLAG;
+f00652_1 Follow in00652;
+f00652_2 Follow f00652_1;
+f00652_3 Follow f00652_2;
+f00652_4 Follow f00652_3;
+f00652_5 Follow f00652_4;
+f00652_6 Follow f00652_5;
+f00652_7 Follow f00652_6;
+f00652_8 Follow f00652_7;
+f00652_9 Follow f00652_8;
+in00653 FLAG;
+f00653_1 Follow in00653;
+f00653_2 Follow f00653_1;
+f00653_3 Follow f00653_2;
+f00653_4 Follow f00653_3;
+f00653_5 Follow f00653_4;
+f00653_6 Follow f00653_5;
+f00653_7 Follow f00653_6;
+f00653_8 Follow f00653_7;
+f00653_9 Follow f00653_8;
+in00654 FLAG;
+f00654_1 Follow in00654;
+f00654_2 Follow f00654_1;
+f00654_3 Follow f00654_2;
+f00654_4 Follow f00654_3;
+f00654_5 Follow f00654_4;
+f00654_6 Follow f00654_5;
+f00654_7 Follow f00654_6;
+f00654_8 Follow f00654_7;
+f00654_9 Follow f00654_8;
+in00655 FLAG;
+f00655_1 Follow in00655;
+f00655_2 Follow f00655_1;
+f00655_3 Follow f00655_2;
+f00655_4 Follow f00655_3;
+f00655_5 Follow f00655_4;
+f00655_6 Follow f00655_5;
+f00655_7 Follow f00655_6;
+f00655_8 Follow f00655_7;
+f00655_9 Follow f00655_8;
+in00656 FLAG;
+f00656_1 Follow in00656;
+f00656_2 Follow f00656_1;
+f00656_3 Follow f00656_2;
+f00656_4 Follow f00656_3;
+f00656_5 Follow f00656_4;
+f00656_6 Follow f00656_5;
+f00656_7 Follow f00656_6;
+f00656_8 Follow f00656_7;
+f00656_9 Follow f00656_8;
+in00657 FLAG;
+f00657_1 Follow in00657;
+f00657_2 Follow f00657_1;
+f00657_3 Follow f00657_2;
+f00657_4 Follow f00657_3;
+f00657_5 Follow f00657_4;
+f00657_6 Follow f00657_5;
+f00657_7 Follow f00657_6;
+f00657_8 Follow f00657_7;
+f00657_9 Follow f00657_8;
+in00658 FLAG;
+f00658_1 Follow in00658;
+f00658_2 Follow f00658_1;
+f00658_3 Follow f00658_2;
+f00658_4 Follow f00658_3;
+f00658_5 Follow f00658_4;
+f00658_6 Follow f00658_5;
+f00658_7 Follow f00658_6;
+f00658_8 Follow f00658_7;
+f00658_9 Follow f00658_8;
+in00659 FLAG;
+f00659_1 Follow in00659;
+f00659_2 Follow f00659_1;
+f00659_3 Follow f00659_2;
+f00659_4 Follow f00659_3;
+f00659_5 Follow f00659_4;
+f00659_6 Follow f00659_5;
+f00659_7 Follow f00659_6;
+f00659_8 Follow f00659_7;
+f00659_9 Follow f00659_8;
+in00660 FLAG;
+f00660_1 Follow in00660;
+f00660_2 Follow f00660_1;
+f00660_3 Follow f00660_2;
+f00660_4 Follow f00660_3;
+f00660_5 Follow f00660_4;
+f00660_6 Follow f00660_5;
+f00660_7 Follow f00660_6;
+f00660_8 Follow f00660_7;
+f00660_9 Follow f00660_8;
+in00661 FLAG;
+f00661_1 Follow in00661;
+f00661_2 Follow f00661_1;
+f00661_3 Follow f00661_2;
+f00661_4 Follow f00661_3;
+f00661_5 Follow f00661_4;
+f00661_6 Follow f00661_5;
+f00661_7 Follow f00661_6;
+f00661_8 Follow f00661_7;
+f00661_9 Follow f00661_8;
+in00662 FLAG;
+f00662_1 Follow in00662;
+f00662_2 Follow f00662_1;
+f00662_3 Follow f00662_2;
+f00662_4 Follow f00662_3;
+f00662_5 Follow f00662_4;
+f00662_6 Follow f00662_5;
+f00662_7 Follow f00662_6;
+f00662_8 Follow f00662_7;
+f00662_9 Follow f00662_8;
+in00663 FLAG;
+f00663_1 Follow in00663;
+f00663_2 Follow f00663_1;
+f00663_3 Follow f00663_2;
+f00663_4 Follow f00663_3;
+f00663_5 Follow f00663_4;
+f00663_6 Follow f00663_5;
+f00663_7 Follow f00663_6;
+f00663_8 Follow f00663_7;
+f00663_9 Follow f00663_8;
+in00664 FLAG;
+f00664_1 Follow in00664;
+f00664_2 Follow f00664_1;
+f00664_3 Follow f00664_2;
+f00664_4 Follow f00664_3;
+f00664_5 Follow f00664_4;
+f00664_6 Follow f00664_5;
+f00664_7 Follow f00664_6;
+f00664_8 Follow f00664_7;
+f00664_9 Follow f00664_8;
+in00665 FLAG;
+f00665_1 Follow in00665;
+f00665_2 Follow f00665_1;
+f00665_3 Follow f00665_2;
+f00665_4 Follow f00665_3;
+f00665_5 Follow f00665_4;
+f00665_6 Follow f00665_5;
+f00665_7 Follow f00665_6;
+f00665_8 Follow f00665_7;
+f00665_9 Follow f00665_8;
+in00666 FLAG;
+f00666_1 Follow in00666;
+f00666_2 Follow f00666_1;
+f00666_3 Follow f00666_2;
+f00666_4 Follow f00666_3;
+f00666_5 Follow f00666_4;
+f00666_6 Follow f00666_5;
+f00666_7 Follow f00666_6;
+f00666_8 Follow f00666_7;
+f00666_9 Follow f00666_8;
+in00667 FLAG;
+f00667_1 Follow in00667;
+f00667_2 Follow f00667_1;
+f00667_3 Follow f00667_2;
+f00667_4 Follow f00667_3;
+f00667_5 Follow f00667_4;
+f00667_6 Follow f00667_5;
+f00667_7 Follow f00667_6;
+f00667_8 Follow f00667_7;
+f00667_9 Follow f00667_8;
+in00668 FLAG;
+f00668_1 Follow in00668;
+f00668_2 Follow f00668_1;
+f00668_3 Follow f00668_2;
+f00668_4 Follow f00668_3;
+f00668_5 Follow f00668_4;
+f00668_6 Follow f00668_5;
+f00668_7 Follow f00668_6;
+f00668_8 Follow f00668_7;
+f00668_9 Follow f00668_8;
+in00669 FLAG;
+f00669_1 Follow in00669;
+f00669_2 Follow f00669_1;
+f00669_3 Follow f00669_2;
+f00669_4 Follow f00669_3;
+f00669_5 Follow f00669_4;
+f00669_6 Follow f00669_5;
+f00669_7 Follow f00669_6;
+f00669_8 Follow f00669_7;
+f00669_9 Follow f00669_8;
+in00670 FLAG;
+f00670_1 Follow in00670;
+f00670_2 Follow f00670_1;
+f00670_3 Follow f00670_2;
+f00670_4 Follow f00670_3;
+f00670_5 Follow f00670_4;
+f00670_6 Follow f00670_5;
+f00670_7 Follow f00670_6;
+f00670_8 Follow f00670_7;
+f00670_9 Follow f00670_8;
+in00671 FLAG;
+f00671_1 Follow in00671;
+f00671_2 Follow f00671_1;
+f00671_3 Follow f00671_2;
+f00671_4 Follow f00671_3;
+f00671_5 Follow f00671_4;
+f00671_6 Follow f00671_5;
+f00671_7 Follow f00671_6;
+f00671_8 Follow f00671_7;
+f00671_9 Follow f00671_8;
+in00672 FLAG;
+f00672_1 Follow in00672;
+f00672_2 Follow f00672_1;
+f00672_3 Follow f00672_2;
+f00672_4 Follow f00672_3;
+f00672_5 Follow f00672_4;
+f00672_6 Follow f00672_5;
+f00672_7 Follow f00672_6;
+f00672_8 Follow f00672_7;
+f00672_9 Follow f00672_8;
+in00673 FLAG;
+f00673_1 Follow in00673;
+f00673_2 Follow f00673_1;
+f00673_3 Follow f00673_2;
+f00673_4 Follow f00673_3;
+f00673_5 Follow f00673_4;
+f00673_6 Follow f00673_5;
+f00673_7 Follow f00673_6;
+f00673_8 Follow f00673_7;
+f00673_9 Follow f00673_8;
+in00674 FLAG;
+f00674_1 Follow in00674;
+f00674_2 Follow f00674_1;
+f00674_3 Follow f00674_2;
+f00674_4 Follow f00674_3;
+f00674_5 Follow f00674_4;
+f00674_6 Follow f00674_5;
+f00674_7 Follow f00674_6;
+f00674_8 Follow f00674_7;
+f00674_9 Follow f00674_8;
+in00675 FLAG;
+f00675_1 Follow in00675;
+f00675_2 Follow f00675_1;
+f00675_3 Follow f00675_2;
+f00675_4 Follow f00675_3;
+f00675_5 Follow f00675_4;
+f00675_6 Follow f00675_5;
+f00675_7 Follow f00675_6;
+f00675_8 Follow f00675_7;
+f00675_9 Follow f00675_8;
+in00676 FLAG;
+f00676_1 Follow in00676;
+f00676_2 Follow f00676_1;
+f00676_3 Follow f00676_2;
+f00676_4 Follow f00676_3;
+f00676_5 Follow f00676_4;
+f00676_6 Follow f00676_5;
+f00676_7 Follow f00676_6;
+f00676_8 Follow f00676_7;
+f00676_9 Follow f00676_8;
+in00677 FLAG;
+f00677_1 Follow in00677;
+f00677_2 Follow f00677_1;
+f00677_3 Follow f00677_2;
+f00677_4 Follow f00677_3;
+f00677_5 Follow f00677_4;
+f00677_6 Follow f00677_5;
+f00677_7 Follow f00677_6;
+f00677_8 Follow f00677_7;
+f00677_9 Follow f00677_8;
+in00678 FLAG;
+f00678_1 Follow in00678;
+f00678_2 Follow f00678_1;
+f00678_3 Follow f00678_2;
+f00678_4 Follow f00678_3;
+f00678_5 Follow f00678_4;
+f00678_6 Follow f00678_5;
+f00678_7 Follow f00678_6;
+f00678_8 Follow f00678_7;
+f00678_9 Follow f00678_8;
+in00679 FLAG;
+f00679_1 Follow in00679;
+f00679_2 Follow f00679_1;
+f00679_3 Follow f00679_2;
+f00679_4 Follow f00679_3;
+f00679_5 Follow f00679_4;
+f00679_6 Follow f00679_5;
+f00679_7 Follow f00679_6;
+f00679_8 Follow f00679_7;
+f00679_9 Follow f00679_8;
+in00680 FLAG;
+f00680_1 Follow in00680;
+f00680_2 Follow f00680_1;
+f00680_3 Follow f00680_2;
+f00680_4 Follow f00680_3;
+f00680_5 Follow f00680_4;
+f00680_6 Follow f00680_5;
+f00680_7 Follow f00680_6;
+f00680_8 Follow f00680_7;
+f00680_9 Follow f00680_8;
+in00681 FLAG;
+f00681_1 Follow in00681;
+f00681_2 Follow f00681_1;
+f00681_3 Follow f00681_2;
+f00681_4 Follow f00681_3;
+f00681_5 Follow f00681_4;
+f00681_6 Follow f00681_5;
+f00681_7 Follow f00681_6;
+f00681_8 Follow f00681_7;
+f00681_9 Follow f00681_8;
+in00682 FLAG;
+f00682_1 Follow in00682;
+f00682_2 Follow f00682_1;
+f00682_3 Follow f00682_2;
+f00682_4 Follow f00682_3;
+f00682_5 Follow f00682_4;
+f00682_6 Follow f00682_5;
+f00682_7 Follow f00682_6;
+f00682_8 Follow f00682_7;
+f00682_9 Follow f00682_8;
+in00683 FLAG;
+f00683_1 Follow in00683;
+f00683_2 Follow f00683_1;
+f00683_3 Follow f00683_2;
+f00683_4 Follow f00683_3;
+f00683_5 Follow f00683_4;
+f00683_6 Follow f00683_5;
+f00683_7 Follow f00683_6;
+f00683_8 Follow f00683_7;
+f00683_9 Follow f00683_8;
+in00684 FLAG;
+f00684_1 Follow in00684;
+f00684_2 Follow f00684_1;
+f00684_3 Follow f00684_2;
+f00684_4 Follow f00684_3;
+f00684_5 Follow f00684_4;
+f00684_6 Follow f00684_5;
+f00684_7 Follow f00684_6;
+f00684_8 Follow f00684_7;
+f00684_9 Follow f00684_8;
+in00685 FLAG;
+f00685_1 Follow in00685;
+f00685_2 Follow f00685_1;
+f00685_3 Follow f00685_2;
+f00685_4 Follow f00685_3;
+f00685_5 Follow f00685_4;
+f00685_6 Follow f00685_5;
+f00685_7 Follow f00685_6;
+f00685_8 Follow f00685_7;
+f00685_9 Follow f00685_8;
+in00686 FLAG;
+f00686_1 Follow in00686;
+f00686_2 Follow f00686_1;
+f00686_3 Follow f00686_2;
+f00686_4 Follow f00686_3;
+f00686_5 Follow f00686_4;
+f00686_6 Follow f00686_5;
+f00686_7 Follow f00686_6;
+f00686_8 Follow f00686_7;
+f00686_9 Follow f00686_8;
+in00687 FLAG;
+f00687_1 Follow in00687;
+f00687_2 Follow f00687_1;
+f00687_3 Follow f00687_2;
+f00687_4 Follow f00687_3;
+f00687_5 Follow f00687_4;
+f00687_6 Follow f00687_5;
+f00687_7 Follow f00687_6;
+f00687_8 Follow f00687_7;
+f00687_9 Follow f00687_8;
+in00688 FLAG;
+f00688_1 Follow in00688;
+f00688_2 Follow f00688_1;
+f00688_3 Follow f00688_2;
+f00688_4 Follow f00688_3;
+f00688_5 Follow f00688_4;
+f00688_6 Follow f00688_5;
+f00688_7 Follow f00688_6;
+f00688_8 Follow f00688_7;
+f00688_9 Follow f00688_8;
+in00689 FLAG;
+f00689_1 Follow in00689;
+f00689_2 Follow f00689_1;
+f00689_3 Follow f00689_2;
+f00689_4 Follow f00689_3;
+f00689_5 Follow f00689_4;
+f00689_6 Follow f00689_5;
+f00689_7 Follow f00689_6;
+f00689_8 Follow f00689_7;
+f00689_9 Follow f00689_8;
+in00690 FLAG;
+f00690_1 Follow in00690;
+f00690_2 Follow f00690_1;
+f00690_3 Follow f00690_2;
+f00690_4 Follow f00690_3;
+f00690_5 Follow f00690_4;
+f00690_6 Follow f00690_5;
+f00690_7 Follow f00690_6;
+f00690_8 Follow f00690_7;
+f00690_9 Follow f00690_8;
+in00691 FLAG;
+f00691_1 Follow in00691;
+f00691_2 Follow f00691_1;
+f00691_3 Follow f00691_2;
+f00691_4 Follow f00691_3;
+f00691_5 Follow f00691_4;
+f00691_6 Follow f00691_5;
+f00691_7 Follow f00691_6;
+f00691_8 Follow f00691_7;
+f00691_9 Follow f00691_8;
+in00692 FLAG;
+f00692_1 Follow in00692;
+f00692_2 Follow f00692_1;
+f00692_3 Follow f00692_2;
+f00692_4 Follow f00692_3;
+f00692_5 Follow f00692_4;
+f00692_6 Follow f00692_5;
+f00692_7 Follow f00692_6;
+f00692_8 Follow f00692_7;
+f00692_9 Follow f00692_8;
+in00693 FLAG;
+f00693_1 Follow in00693;
+f00693_2 Follow f00693_1;
+f00693_3 Follow f00693_2;
+f00693_4 Follow f00693_3;
+f00693_5 Follow f00693_4;
+f00693_6 Follow f00693_5;
+f00693_7 Follow f00693_6;
+f00693_8 Follow f00693_7;
+f00693_9 Follow f00693_8;
+in00694 FLAG;
+f00694_1 Follow in00694;
+f00694_2 Follow f00694_1;
+f00694_3 Follow f00694_2;
+f00694_4 Follow f00694_3;
+f00694_5 Follow f00694_4;
+f00694_6 Follow f00694_5;
+f00694_7 Follow f00694_6;
+f00694_8 Follow f00694_7;
+f00694_9 Follow f00694_8;
+in00695 FLAG;
+f00695_1 Follow in00695;
+f00695_2 Follow f00695_1;
+f00695_3 Follow f00695_2;
+f00695_4 Follow f00695_3;
+f00695_5 Follow f00695_4;
+f00695_6 Follow f00695_5;
+f00695_7 Follow f00695_6;
+f00695_8 Follow f00695_7;
+f00695_9 Follow f00695_8;
+in00696 FLAG;
+f00696_1 Follow in00696;
+f00696_2 Follow f00696_1;
+f00696_3 Follow f00696_2;
+f00696_4 Follow f00696_3;
+f00696_5 Follow f00696_4;
+f00696_6 Follow f00696_5;
+f00696_7 Follow f00696_6;
+f00696_8 Follow f00696_7;
+f00696_9 Follow f00696_8;
+in00697 FLAG;
+f00697_1 Follow in00697;
+f00697_2 Follow f00697_1;
+f00697_3 Follow f00697_2;
+f00697_4 Follow f00697_3;
+f00697_5 Follow f00697_4;
+f00697_6 Follow f00697_5;
+f00697_7 Follow f00697_6;
+f00697_8 Follow f00697_7;
+f00697_9 Follow f00697_8;
+in00698 FLAG;
+f00698_1 Follow in00698;
+f00698_2 Follow f00698_1;
+f00698_3 Follow f00698_2;
+f00698_4 Follow f00698_3;
+f00698_5 Follow f00698_4;
+f00698_6 Follow f00698_5;
+f00698_7 Follow f00698_6;
+f00698_8 Follow f00698_7;
+f00698_9 Follow f00698_8;
+in00699 FLAG;
+f00699_1 Follow in00699;
+f00699_2 Follow f00699_1;
+f00699_3 Follow f00699_2;
+f00699_4 Follow f00699_3;
+f00699_5 Follow f00699_4;
+f00699_6 Follow f00699_5;
+f00699_7 Follow f00699_6;
+f00699_8 Follow f00699_7;
+f00699_9 Follow f00699_8;
+in00700 FLAG;
+f00700_1 Follow in00700;
+f00700_2 Follow f00700_1;
+f00700_3 Follow f00700_2;
+f00700_4 Follow f00700_3;
+f00700_5 Follow f00700_4;
+f00700_6 Follow f00700_5;
+f00700_7 Follow f00700_6;
+f00700_8 Follow f00700_7;
+f00700_9 Follow f00700_8;
+in00701 FLAG;
+f00701_1 Follow in00701;
+f00701_2 Follow f00701_1;
+f00701_3 Follow f00701_2;
+f00701_4 Follow f00701_3;
+f00701_5 Follow f00701_4;
+f00701_6 Follow f00701_5;
+f00701_7 Follow f00701_6;
+f00701_8 Follow f00701_7;
+f00701_9 Follow f00701_8;
+in00702 FLAG;
+f00702_1 Follow in00702;
+f00702_2 Follow f00702_1;
+f00702_3 Follow f00702_2;
+f00702_4 Follow f00702_3;
+f00702_5 Follow f00702_4;
+f00702_6 Follow f00702_5;
+f00702_7 Follow f00702_6;
+f00702_8 Follow f00702_7;
+f00702_9 Follow f00702_8;
+in00703 FLAG;
+f00703_1 Follow in00703;
+f00703_2 Follow f00703_1;
+f00703_3 Follow f00703_2;
+f00703_4 Follow f00703_3;
+f00703_5 Follow f00703_4;
+f00703_6 Follow f00703_5;
+f00703_7 Follow f00703_6;
+f00703_8 Follow f00703_7;
+f00703_9 Follow f00703_8;
+in00704 FLAG;
+f00704_1 Follow in00704;
+f00704_2 Follow f00704_1;
+f00704_3 Follow f00704_2;
+f00704_4 Follow f00704_3;
+f00704_5 Follow f00704_4;
+f00704_6 Follow f00704_5;
+f00704_7 Follow f00704_6;
+f00704_8 Follow f00704_7;
+f00704_9 Follow f00704_8;
+in00705 FLAG;
+f00705_1 Follow in00705;
+f00705_2 Follow f00705_1;
+f00705_3 Follow f00705_2;
+f00705_4 Follow f00705_3;
+f00705_5 Follow f00705_4;
+f00705_6 Follow f00705_5;
+f00705_7 Follow f00705_6;
+f00705_8 Follow f00705_7;
+f00705_9 Follow f00705_8;
+in00706 FLAG;
+f00706_1 Follow in00706;
+f00706_2 Follow f00706_1;
+f00706_3 Follow f00706_2;
+f00706_4 Follow f00706_3;
+f00706_5 Follow f00706_4;
+f00706_6 Follow f00706_5;
+f00706_7 Follow f00706_6;
+f00706_8 Follow f00706_7;
+f00706_9 Follow f00706_8;
+in00707 FLAG;
+f00707_1 Follow in00707;
+f00707_2 Follow f00707_1;
+f00707_3 Follow f00707_2;
+f00707_4 Follow f00707_3;
+f00707_5 Follow f00707_4;
+f00707_6 Follow f00707_5;
+f00707_7 Follow f00707_6;
+f00707_8 Follow f00707_7;
+f00707_9 Follow f00707_8;
+in00708 FLAG;
+f00708_1 Follow in00708;
+f00708_2 Follow f00708_1;
+f00708_3 Follow f00708_2;
+f00708_4 Follow f00708_3;
+f00708_5 Follow f00708_4;
+f00708_6 Follow f00708_5;
+f00708_7 Follow f00708_6;
+f00708_8 Follow f00708_7;
+f00708_9 Follow f00708_8;
+in00709 FLAG;
+f00709_1 Follow in00709;
+f00709_2 Follow f00709_1;
+f00709_3 Follow f00709_2;
+f00709_4 Follow f00709_3;
+f00709_5 Follow f00709_4;
+f00709_6 Follow f00709_5;
+f00709_7 Follow f00709_6;
+f00709_8 Follow f00709_7;
+f00709_9 Follow f00709_8;
+in00710 FLAG;
+f00710_1 Follow in00710;
+f00710_2 Follow f00710_1;
+f00710_3 Follow f00710_2;
+f00710_4 Follow f00710_3;
+f00710_5 Follow f00710_4;
+f00710_6 Follow f00710_5;
+f00710_7 Follow f00710_6;
+f00710_8 Follow f00710_7;
+f00710_9 Follow f00710_8;
+in00711 FLAG;
+f00711_1 Follow in00711;
+f00711_2 Follow f00711_1;
+f00711_3 Follow f00711_2;
+f00711_4 Follow f00711_3;
+f00711_5 Follow f00711_4;
+f00711_6 Follow f00711_5;
+f00711_7 Follow f00711_6;
+f00711_8 Follow f00711_7;
+f00711_9 Follow f00711_8;
+in00712 FLAG;
+f00712_1 Follow in00712;
+f00712_2 Follow f00712_1;
+f00712_3 Follow f00712_2;
+f00712_4 Follow f00712_3;
+f00712_5 Follow f00712_4;
+f00712_6 Follow f00712_5;
+f00712_7 Follow f00712_6;
+f00712_8 Follow f00712_7;
+f00712_9 Follow f00712_8;
+in00713 FLAG;
+f00713_1 Follow in00713;
+f00713_2 Follow f00713_1;
+f00713_3 Follow f00713_2;
+f00713_4 Follow f00713_3;
+f00713_5 Follow f00713_4;
+f00713_6 Follow f00713_5;
+f00713_7 Follow f00713_6;
+f00713_8 Follow f00713_7;
+f00713_9 Follow f00713_8;
+in00714 FLAG;
+f00714_1 Follow in00714;
+f00714_2 Follow f00714_1;
+f00714_3 Follow f00714_2;
+f00714_4 Follow f00714_3;
+f00714_5 Follow f00714_4;
+f00714_6 Follow f00714_5;
+f00714_7 Follow f00714_6;
+f00714_8 Follow f00714_7;
+f00714_9 Follow f00714_8;
+in00715 FLAG;
+f00715_1 Follow in00715;
+f00715_2 Follow f00715_1;
+f00715_3 Follow f00715_2;
+f00715_4 Follow f00715_3;
+f00715_5 Follow f00715_4;
+f00715_6 Follow f00715_5;
+f00715_7 Follow f00715_6;
+f00715_8 Follow f00715_7;
+f00715_9 Follow f00715_8;
+in00716 FLAG;
+f00716_1 Follow in00716;
+f00716_2 Follow f00716_1;
+f00716_3 Follow f00716_2;
+f00716_4 Follow f00716_3;
+f00716_5 Follow f00716_4;
+f00716_6 Follow f00716_5;
+f00716_7 Follow f00716_6;
+f00716_8 Follow f00716_7;
+f00716_9 Follow f00716_8;
+in00717 FLAG;
+f00717_1 Follow in00717;
+f00717_2 Follow f00717_1;
+f00717_3 Follow f00717_2;
+f00717_4 Follow f00717_3;
+f00717_5 Follow f00717_4;
+f00717_6 Follow f00717_5;
+f00717_7 Follow f00717_6;
+f00717_8 Follow f00717_7;
+f00717_9 Follow f00717_8;
+in00718 FLAG;
+f00718_1 Follow in00718;
+f00718_2 Follow f00718_1;
+f00718_3 Follow f00718_2;
+f00718_4 Follow f00718_3;
+f00718_5 Follow f00718_4;
+f00718_6 Follow f00718_5;
+f00718_7 Follow f00718_6;
+f00718_8 Follow f00718_7;
+f00718_9 Follow f00718_8;
+in00719 FLAG;
+f00719_1 Follow in00719;
+f00719_2 Follow f00719_1;
+f00719_3 Follow f00719_2;
+f00719_4 Follow f00719_3;
+f00719_5 Follow f00719_4;
+f00719_6 Follow f00719_5;
+f00719_7 Follow f00719_6;
+f00719_8 Follow f00719_7;
+f00719_9 Follow f00719_8;
+in00720 FLAG;
+f00720_1 Follow in00720;
+f00720_2 Follow f00720_1;
+f00720_3 Follow f00720_2;
+f00720_4 Follow f00720_3;
+f00720_5 Follow f00720_4;
+f00720_6 Follow f00720_5;
+f00720_7 Follow f00720_6;
+f00720_8 Follow f00720_7;
+f00720_9 Follow f00720_8;
+in00721 FLAG;
+f00721_1 Follow in00721;
+f00721_2 Follow f00721_1;
+f00721_3 Follow f00721_2;
+f00721_4 Follow f00721_3;
+f00721_5 Follow f00721_4;
+f00721_6 Follow f00721_5;
+f00721_7 Follow f00721_6;
+f00721_8 Follow f00721_7;
+f00721_9 Follow f00721_8;
+in00722 FLAG;
+f00722_1 Follow in00722;
+f00722_2 Follow f00722_1;
+f00722_3 Follow f00722_2;
+f00722_4 Follow f00722_3;
+f00722_5 Follow f00722_4;
+f00722_6 Follow f00722_5;
+f00722_7 Follow f00722_6;
+f00722_8 Follow f00722_7;
+f00722_9 Follow f00722_8;
+in00723 FLAG;
+f00723_1 Follow in00723;
+f00723_2 Follow f00723_1;
+f00723_3 Follow f00723_2;
+f00723_4 Follow f00723_3;
+f00723_5 Follow f00723_4;
+f00723_6 Follow f00723_5;
+f00723_7 Follow f00723_6;
+f00723_8 Follow f00723_7;
+f00723_9 Follow f00723_8;
+in00724 FLAG;
+f00724_1 Follow in00724;
+f00724_2 Follow f00724_1;
+f00724_3 Follow f00724_2;
+f00724_4 Follow f00724_3;
+f00724_5 Follow f00724_4;
+f00724_6 Follow f00724_5;
+f00724_7 Follow f00724_6;
+f00724_8 Follow f00724_7;
+f00724_9 Follow f00724_8;
+in00725 FLAG;
+f00725_1 Follow in00725;
+f00725_2 Follow f00725_1;
+f00725_3 Follow f00725_2;
+f00725_4 Follow f00725_3;
+f00725_5 Follow f00725_4;
+f00725_6 Follow f00725_5;
+f00725_7 Follow f00725_6;
+f00725_8 Follow f00725_7;
+f00725_9 Follow f00725_8;
+in00726 FLAG;
+f00726_1 Follow in00726;
+f00726_2 Follow f00726_1;
+f00726_3 Follow f00726_2;
+f00726_4 Follow f00726_3;
+f00726_5 Follow f00726_4;
+f00726_6 Follow f00726_5;
+f00726_7 Follow f00726_6;
+f00726_8 Follow f00726_7;
+f00726_9 Follow f00726_8;
+in00727 FLAG;
+f00727_1 Follow in00727;
+f00727_2 Follow f00727_1;
+f00727_3 Follow f00727_2;
+f00727_4 Follow f00727_3;
+f00727_5 Follow f00727_4;
+f00727_6 Follow f00727_5;
+f00727_7 Follow f00727_6;
+f00727_8 Follow f00727_7;
+f00727_9 Follow f00727_8;
+in00728 FLAG;
+f00728_1 Follow in00728;
+f00728_2 Follow f00728_1;
+f00728_3 Follow f00728_2;
+f00728_4 Follow f00728_3;
+f00728_5 Follow f00728_4;
+f00728_6 Follow f00728_5;
+f00728_7 Follow f00728_6;
+f00728_8 Follow f00728_7;
+f00728_9 Follow f00728_8;
+in00729 FLAG;
+f00729_1 Follow in00729;
+f00729_2 Follow f00729_1;
+f00729_3 Follow f00729_2;
+f00729_4 Follow f00729_3;
+f00729_5 Follow f00729_4;
+f00729_6 Follow f00729_5;
+f00729_7 Follow f00729_6;
+f00729_8 Follow f00729_7;
+f00729_9 Follow f00729_8;
+in00730 FLAG;
+f00730_1 Follow in00730;
+f00730_2 Follow f00730_1;
+f00730_3 Follow f00730_2;
+f00730_4 Follow f00730_3;
+f00730_5 Follow f00730_4;
+f00730_6 Follow f00730_5;
+f00730_7 Follow f00730_6;
+f00730_8 Follow f00730_7;
+f00730_9 Follow f00730_8;
+in00731 FLAG;
+f00731_1 Follow in00731;
+f00731_2 Follow f00731_1;
+f00731_3 Follow f00731_2;
+f00731_4 Follow f00731_3;
+f00731_5 Follow f00731_4;
+f00731_6 Follow f00731_5;
+f00731_7 Follow f00731_6;
+f00731_8 Follow f00731_7;
+f00731_9 Follow f00731_8;
+in00732 FLAG;
+f00732_1 Follow in00732;
+f00732_2 Follow f00732_1;
+f00732_3 Follow f00732_2;
+f00732_4 Follow f00732_3;
+f00732_5 Follow f00732_4;
+f00732_6 Follow f00732_5;
+f00732_7 Follow f00732_6;
+f00732_8 Follow f00732_7;
+f00732_9 Follow f00732_8;
+in00733 FLAG;
+f00733_1 Follow in00733;
+f00733_2 Follow f00733_1;
+f00733_3 Follow f00733_2;
+f00733_4 Follow f00733_3;
+f00733_5 Follow f00733_4;
+f00733_6 Follow f00733_5;
+f00733_7 Follow f00733_6;
+f00733_8 Follow f00733_7;
+f00733_9 Follow f00733_8;
+in00734 FLAG;
+f00734_1 Follow in00734;
+f00734_2 Follow f00734_1;
+f00734_3 Follow f00734_2;
+f00734_4 Follow f00734_3;
+f00734_5 Follow f00734_4;
+f00734_6 Follow f00734_5;
+f00734_7 Follow f00734_6;
+f00734_8 Follow f00734_7;
+f00734_9 Follow f00734_8;
+in00735 FLAG;
+f00735_1 Follow in00735;
+f00735_2 Follow f00735_1;
+f00735_3 Follow f00735_2;
+f00735_4 Follow f00735_3;
+f00735_5 Follow f00735_4;
+f00735_6 Follow f00735_5;
+f00735_7 Follow f00735_6;
+f00735_8 Follow f00735_7;
+f00735_9 Follow f00735_8;
+in00736 FLAG;
+f00736_1 Follow in00736;
+f00736_2 Follow f00736_1;
+f00736_3 Follow f00736_2;
+f00736_4 Follow f00736_3;
+f00736_5 Follow f00736_4;
+f00736_6 Follow f00736_5;
+f00736_7 Follow f00736_6;
+f00736_8 Follow f00736_7;
+f00736_9 Follow f00736_8;
+in00737 FLAG;
+f00737_1 Follow in00737;
+f00737_2 Follow f00737_1;
+f00737_3 Follow f00737_2;
+f00737_4 Follow f00737_3;
+f00737_5 Follow f00737_4;
+f00737_6 Follow f00737_5;
+f00737_7 Follow f00737_6;
+f00737_8 Follow f00737_7;
+f00737_9 Follow f00737_8;
+in00738 FLAG;
+f00738_1 Follow in00738;
+f00738_2 Follow f00738_1;
+f00738_3 Follow f00738_2;
+f00738_4 Follow f00738_3;
+f00738_5 Follow f00738_4;
+f00738_6 Follow f00738_5;
+f00738_7 Follow f00738_6;
+f00738_8 Follow f00738_7;
+f00738_9 Follow f00738_8;
+in00739 FLAG;
+f00739_1 Follow in00739;
+f00739_2 Follow f00739_1;
+f00739_3 Follow f00739_2;
+f00739_4 Follow f00739_3;
+f00739_5 Follow f00739_4;
+f00739_6 Follow f00739_5;
+f00739_7 Follow f00739_6;
+f00739_8 Follow f00739_7;
+f00739_9 Follow f00739_8;
+in00740 FLAG;
+f00740_1 Follow in00740;
+f00740_2 Follow f00740_1;
+f00740_3 Follow f00740_2;
+f00740_4 Follow f00740_3;
+f00740_5 Follow f00740_4;
+f00740_6 Follow f00740_5;
+f00740_7 Follow f00740_6;
+f00740_8 Follow f00740_7;
+f00740_9 Follow f00740_8;
+in00741 FLAG;
+f00741_1 Follow in00741;
+f00741_2 Follow f00741_1;
+f00741_3 Follow f00741_2;
+f00741_4 Follow f00741_3;
+f00741_5 Follow f00741_4;
+f00741_6 Follow f00741_5;
+f00741_7 Follow f00741_6;
+f00741_8 Follow f00741_7;
+f00741_9 Follow f00741_8;
+in00742 FLAG;
+f00742_1 Follow in00742;
+f00742_2 Follow f00742_1;
+f00742_3 Follow f00742_2;
+f00742_4 Follow f00742_3;
+f00742_5 Follow f00742_4;
+f00742_6 Follow f00742_5;
+f00742_7 Follow f00742_6;
+f00742_8 Follow f00742_7;
+f00742_9 Follow f00742_8;
+in00743 FLAG;
+f00743_1 Follow in00743;
+f00743_2 Follow f00743_1;
+f00743_3 Follow f00743_2;
+f00743_4 Follow f00743_3;
+f00743_5 Follow f00743_4;
+f00743_6 Follow f00743_5;
+f00743_7 Follow f00743_6;
+f00743_8 Follow f00743_7;
+f00743_9 Follow f00743_8;
+in00744 FLAG;
+f00744_1 Follow in00744;
+f00744_2 Follow f00744_1;
+f00744_3 Follow f00744_2;
+f00744_4 Follow f00744_3;
+f00744_5 Follow f00744_4;
+f00744_6 Follow f00744_5;
+f00744_7 Follow f00744_6;
+f00744_8 Follow f00744_7;
+f00744_9 Follow f00744_8;
+in00745 FLAG;
+f00745_1 Follow in00745;
+f00745_2 Follow f00745_1;
+f00745_3 Follow f00745_2;
+f00745_4 Follow f00745_3;
+f00745_5 Follow f00745_4;
+f00745_6 Follow f00745_5;
+f00745_7 Follow f00745_6;
+f00745_8 Follow f00745_7;
+f00745_9 Follow f00745_8;
+in00746 FLAG;
+f00746_1 Follow in00746;
+f00746_2 Follow f00746_1;
+f00746_3 Follow f00746_2;
+f00746_4 Follow f00746_3;
+f00746_5 Follow f00746_4;
+f00746_6 Follow f00746_5;
+f00746_7 Follow f00746_6;
+f00746_8 Follow f00746_7;
+f00746_9 Follow f00746_8;
+in00747 FLAG;
+f00747_1 Follow in00747;
+f00747_2 Follow f00747_1;
+f00747_3 Follow f00747_2;
+f00747_4 Follow f00747_3;
+f00747_5 Follow f00747_4;
+f00747_6 Follow f00747_5;
+f00747_7 Follow f00747_6;
+f00747_8 Follow f00747_7;
+f00747_9 Follow f00747_8;
+in00748 FLAG;
+f00748_1 Follow in00748;
+f00748_2 Follow f00748_1;
+f00748_3 Follow f00748_2;
+f00748_4 Follow f00748_3;
+f00748_5 Follow f00748_4;
+f00748_6 Follow f00748_5;
+f00748_7 Follow f00748_6;
+f00748_8 Follow f00748_7;
+f00748_9 Follow f00748_8;
+in00749 FLAG;
+f00749_1 Follow in00749;
+f00749_2 Follow f00749_1;
+f00749_3 Follow f00749_2;
+f00749_4 Follow f00749_3;
+f00749_5 Follow f00749_4;
+f00749_6 Follow f00749_5;
+f00749_7 Follow f00749_6;
+f00749_8 Follow f00749_7;
+f00749_9 Follow f00749_8;
+in00750 FLAG;
+f00750_1 Follow in00750;
+f00750_2 Follow f00750_1;
+f00750_3 Follow f00750_2;
+f00750_4 Follow f00750_3;
+f00750_5 Follow f00750_4;
+f00750_6 Follow f00750_5;
+f00750_7 Follow f00750_6;
+f00750_8 Follow f00750_7;
+f00750_9 Follow f00750_8;
+in00751 FLAG;
+f00751_1 Follow in00751;
+f00751_2 Follow f00751_1;
+f00751_3 Follow f00751_2;
+f00751_4 Follow f00751_3;
+f00751_5 Follow f00751_4;
+f00751_6 Follow f00751_5;
+f00751_7 Follow f00751_6;
+f00751_8 Follow f00751_7;
+f00751_9 Follow f00751_8;
+in00752 FLAG;
+f00752_1 Follow in00752;
+f00752_2 Follow f00752_1;
+f00752_3 Follow f00752_2;
+f00752_4 Follow f00752_3;
+f00752_5 Follow f00752_4;
+f00752_6 Follow f00752_5;
+f00752_7 Follow f00752_6;
+f00752_8 Follow f00752_7;
+f00752_9 Follow f00752_8;
+in00753 FLAG;
+f00753_1 Follow in00753;
+f00753_2 Follow f00753_1;
+f00753_3 Follow f00753_2;
+f00753_4 Follow f00753_3;
+f00753_5 Follow f00753_4;
+f00753_6 Follow f00753_5;
+f00753_7 Follow f00753_6;
+f00753_8 Follow f00753_7;
+f00753_9 Follow f00753_8;
+in00754 FLAG;
+f00754_1 Follow in00754;
+f00754_2 Follow f00754_1;
+f00754_3 Follow f00754_2;
+f00754_4 Follow f00754_3;
+f00754_5 Follow f00754_4;
+f00754_6 Follow f00754_5;
+f00754_7 Follow f00754_6;
+f00754_8 Follow f00754_7;
+f00754_9 Follow f00754_8;
+in00755 FLAG;
+f00755_1 Follow in00755;
+f00755_2 Follow f00755_1;
+f00755_3 Follow f00755_2;
+f00755_4 Follow f00755_3;
+f00755_5 Follow f00755_4;
+f00755_6 Follow f00755_5;
+f00755_7 Follow f00755_6;
+f00755_8 Follow f00755_7;
+f00755_9 Follow f00755_8;
+in00756 FLAG;
+f00756_1 Follow in00756;
+f00756_2 Follow f00756_1;
+f00756_3 Follow f00756_2;
+f00756_4 Follow f00756_3;
+f00756_5 Follow f00756_4;
+f00756_6 Follow f00756_5;
+f00756_7 Follow f00756_6;
+f00756_8 Follow f00756_7;
+f00756_9 Follow f00756_8;
+in00757 FLAG;
+f00757_1 Follow in00757;
+f00757_2 Follow f00757_1;
+f00757_3 Follow f00757_2;
+f00757_4 Follow f00757_3;
+f00757_5 Follow f00757_4;
+f00757_6 Follow f00757_5;
+f00757_7 Follow f00757_6;
+f00757_8 Follow f00757_7;
+f00757_9 Follow f00757_8;
+in00758 FLAG;
+f00758_1 Follow in00758;
+f00758_2 Follow f00758_1;
+f00758_3 Follow f00758_2;
+f00758_4 Follow f00758_3;
+f00758_5 Follow f00758_4;
+f00758_6 Follow f00758_5;
+f00758_7 Follow f00758_6;
+f00758_8 Follow f00758_7;
+f00758_9 Follow f00758_8;
+in00759 FLAG;
+f00759_1 Follow in00759;
+f00759_2 Follow f00759_1;
+f00759_3 Follow f00759_2;
+f00759_4 Follow f00759_3;
+f00759_5 Follow f00759_4;
+f00759_6 Follow f00759_5;
+f00759_7 Follow f00759_6;
+f00759_8 Follow f00759_7;
+f00759_9 Follow f00759_8;
+in00760 FLAG;
+f00760_1 Follow in00760;
+f00760_2 Follow f00760_1;
+f00760_3 Follow f00760_2;
+f00760_4 Follow f00760_3;
+f00760_5 Follow f00760_4;
+f00760_6 Follow f00760_5;
+f00760_7 Follow f00760_6;
+f00760_8 Follow f00760_7;
+f00760_9 Follow f00760_8;
+in00761 FLAG;
+f00761_1 Follow in00761;
+f00761_2 Follow f00761_1;
+f00761_3 Follow f00761_2;
+f00761_4 Follow f00761_3;
+f00761_5 Follow f00761_4;
+f00761_6 Follow f00761_5;
+f00761_7 Follow f00761_6;
+f00761_8 Follow f00761_7;
+f00761_9 Follow f00761_8;
+in00762 FLAG;
+f00762_1 Follow in00762;
+f00762_2 Follow f00762_1;
+f00762_3 Follow f00762_2;
+f00762_4 Follow f00762_3;
+f00762_5 Follow f00762_4;
+f00762_6 Follow f00762_5;
+f00762_7 Follow f00762_6;
+f00762_8 Follow f00762_7;
+f00762_9 Follow f00762_8;
+in00763 FLAG;
+f00763_1 Follow in00763;
+f00763_2 Follow f00763_1;
+f00763_3 Follow f00763_2;
+f00763_4 Follow f00763_3;
+f00763_5 Follow f00763_4;
+f00763_6 Follow f00763_5;
+f00763_7 Follow f00763_6;
+f00763_8 Follow f00763_7;
+f00763_9 Follow f00763_8;
+in00764 FLAG;
+f00764_1 Follow in00764;
+f00764_2 Follow f00764_1;
+f00764_3 Follow f00764_2;
+f00764_4 Follow f00764_3;
+f00764_5 Follow f00764_4;
+f00764_6 Follow f00764_5;
+f00764_7 Follow f00764_6;
+f00764_8 Follow f00764_7;
+f00764_9 Follow f00764_8;
+in00765 FLAG;
+f00765_1 Follow in00765;
+f00765_2 Follow f00765_1;
+f00765_3 Follow f00765_2;
+f00765_4 Follow f00765_3;
+f00765_5 Follow f00765_4;
+f00765_6 Follow f00765_5;
+f00765_7 Follow f00765_6;
+f00765_8 Follow f00765_7;
+f00765_9 Follow f00765_8;
+in00766 FLAG;
+f00766_1 Follow in00766;
+f00766_2 Follow f00766_1;
+f00766_3 Follow f00766_2;
+f00766_4 Follow f00766_3;
+f00766_5 Follow f00766_4;
+f00766_6 Follow f00766_5;
+f00766_7 Follow f00766_6;
+f00766_8 Follow f00766_7;
+f00766_9 Follow f00766_8;
+in00767 FLAG;
+f00767_1 Follow in00767;
+f00767_2 Follow f00767_1;
+f00767_3 Follow f00767_2;
+f00767_4 Follow f00767_3;
+f00767_5 Follow f00767_4;
+f00767_6 Follow f00767_5;
+f00767_7 Follow f00767_6;
+f00767_8 Follow f00767_7;
+f00767_9 Follow f00767_8;
+in00768 FLAG;
+f00768_1 Follow in00768;
+f00768_2 Follow f00768_1;
+f00768_3 Follow f00768_2;
+f00768_4 Follow f00768_3;
+f00768_5 Follow f00768_4;
+f00768_6 Follow f00768_5;
+f00768_7 Follow f00768_6;
+f00768_8 Follow f00768_7;
+f00768_9 Follow f00768_8;
+in00769 FLAG;
+f00769_1 Follow in00769;
+f00769_2 Follow f00769_1;
+f00769_3 Follow f00769_2;
+f00769_4 Follow f00769_3;
+f00769_5 Follow f00769_4;
+f00769_6 Follow f00769_5;
+f00769_7 Follow f00769_6;
+f00769_8 Follow f00769_7;
+f00769_9 Follow f00769_8;
+in00770 FLAG;
+f00770_1 Follow in00770;
+f00770_2 Follow f00770_1;
+f00770_3 Follow f00770_2;
+f00770_4 Follow f00770_3;
+f00770_5 Follow f00770_4;
+f00770_6 Follow f00770_5;
+f00770_7 Follow f00770_6;
+f00770_8 Follow f00770_7;
+f00770_9 Follow f00770_8;
+in00771 FLAG;
+f00771_1 Follow in00771;
+f00771_2 Follow f00771_1;
+f00771_3 Follow f00771_2;
+f00771_4 Follow f00771_3;
+f00771_5 Follow f00771_4;
+f00771_6 Follow f00771_5;
+f00771_7 Follow f00771_6;
+f00771_8 Follow f00771_7;
+f00771_9 Follow f00771_8;
+in00772 FLAG;
+f00772_1 Follow in00772;
+f00772_2 Follow f00772_1;
+f00772_3 Follow f00772_2;
+f00772_4 Follow f00772_3;
+f00772_5 Follow f00772_4;
+f00772_6 Follow f00772_5;
+f00772_7 Follow f00772_6;
+f00772_8 Follow f00772_7;
+f00772_9 Follow f00772_8;
+in00773 FLAG;
+f00773_1 Follow in00773;
+f00773_2 Follow f00773_1;
+f00773_3 Follow f00773_2;
+f00773_4 Follow f00773_3;
+f00773_5 Follow f00773_4;
+f00773_6 Follow f00773_5;
+f00773_7 Follow f00773_6;
+f00773_8 Follow f00773_7;
+f00773_9 Follow f00773_8;
+in00774 FLAG;
+f00774_1 Follow in00774;
+f00774_2 Follow f00774_1;
+f00774_3 Follow f00774_2;
+f00774_4 Follow f00774_3;
+f00774_5 Follow f00774_4;
+f00774_6 Follow f00774_5;
+f00774_7 Follow f00774_6;
+f00774_8 Follow f00774_7;
+f00774_9 Follow f00774_8;
+in00775 FLAG;
+f00775_1 Follow in00775;
+f00775_2 Follow f00775_1;
+f00775_3 Follow f00775_2;
+f00775_4 Follow f00775_3;
+f00775_5 Follow f00775_4;
+f00775_6 Follow f00775_5;
+f00775_7 Follow f00775_6;
+f00775_8 Follow f00775_7;
+f00775_9 Follow f00775_8;
+in00776 FLAG;
+f00776_1 Follow in00776;
+f00776_2 Follow f00776_1;
+f00776_3 Follow f00776_2;
+f00776_4 Follow f00776_3;
+f00776_5 Follow f00776_4;
+f00776_6 Follow f00776_5;
+f00776_7 Follow f00776_6;
+f00776_8 Follow f00776_7;
+f00776_9 Follow f00776_8;
+in00777 FLAG;
+f00777_1 Follow in00777;
+f00777_2 Follow f00777_1;
+f00777_3 Follow f00777_2;
+f00777_4 Follow f00777_3;
+f00777_5 Follow f00777_4;
+f00777_6 Follow f00777_5;
+f00777_7 Follow f00777_6;
+f00777_8 Follow f00777_7;
+f00777_9 Follow f00777_8;
+in00778 FLAG;
+f00778_1 Follow in00778;
+f00778_2 Follow f00778_1;
+f00778_3 Follow f00778_2;
+f00778_4 Follow f00778_3;
+f00778_5 Follow f00778_4;
+f00778_6 Follow f00778_5;
+f00778_7 Follow f00778_6;
+f00778_8 Follow f00778_7;
+f00778_9 Follow f00778_8;
+in00779 FLAG;
+f00779_1 Follow in00779;
+f00779_2 Follow f00779_1;
+f00779_3 Follow f00779_2;
+f00779_4 Follow f00779_3;
+f00779_5 Follow f00779_4;
+f00779_6 Follow f00779_5;
+f00779_7 Follow f00779_6;
+f00779_8 Follow f00779_7;
+f00779_9 Follow f00779_8;
+in00780 FLAG;
+f00780_1 Follow in00780;
+f00780_2 Follow f00780_1;
+f00780_3 Follow f00780_2;
+f00780_4 Follow f00780_3;
+f00780_5 Follow f00780_4;
+f00780_6 Follow f00780_5;
+f00780_7 Follow f00780_6;
+f00780_8 Follow f00780_7;
+f00780_9 Follow f00780_8;
+in00781 FLAG;
+f00781_1 Follow in00781;
+f00781_2 Follow f00781_1;
+f00781_3 Follow f00781_2;
+f00781_4 Follow f00781_3;
+f00781_5 Follow f00781_4;
+f00781_6 Follow f00781_5;
+f00781_7 Follow f00781_6;
+f00781_8 Follow f00781_7;
+f00781_9 Follow f00781_8;
+in00782 FLAG;
+f00782_1 Follow in00782;
+f00782_2 Follow f00782_1;
+f00782_3 Follow f00782_2;
+f00782_4 Follow f00782_3;
+f00782_5 Follow f00782_4;
+f00782_6 Follow f00782_5;
+f00782_7 Follow f00782_6;
+f00782_8 Follow f00782_7;
+f00782_9 Follow f00782_8;
+in00783 FLAG;
+f00783_1 Follow in00783;
+f00783_2 Follow f00783_1;
+f00783_3 Follow f00783_2;
+f00783_4 Follow f00783_3;
+f00783_5 Follow f00783_4;
+f00783_6 Follow f00783_5;
+f00783_7 Follow f00783_6;
+f00783_8 Follow f00783_7;
+f00783_9 Follow f00783_8;
+in00784 FLAG;
+f00784_1 Follow in00784;
+f00784_2 Follow f00784_1;
+f00784_3 Follow f00784_2;
+f00784_4 Follow f00784_3;
+f00784_5 Follow f00784_4;
+f00784_6 Follow f00784_5;
+f00784_7 Follow f00784_6;
+f00784_8 Follow f00784_7;
+f00784_9 Follow f00784_8;
+in00785 FLAG;
+f00785_1 Follow in00785;
+f00785_2 Follow f00785_1;
+f00785_3 Follow f00785_2;
+f00785_4 Follow f00785_3;
+f00785_5 Follow f00785_4;
+f00785_6 Follow f00785_5;
+f00785_7 Follow f00785_6;
+f00785_8 Follow f00785_7;
+f00785_9 Follow f00785_8;
+in00786 FLAG;
+f00786_1 Follow in00786;
+f00786_2 Follow f00786_1;
+f00786_3 Follow f00786_2;
+f00786_4 Follow f00786_3;
+f00786_5 Follow f00786_4;
+f00786_6 Follow f00786_5;
+f00786_7 Follow f00786_6;
+f00786_8 Follow f00786_7;
+f00786_9 Follow f00786_8;
+in00787 FLAG;
+f00787_1 Follow in00787;
+f00787_2 Follow f00787_1;
+f00787_3 Follow f00787_2;
+f00787_4 Follow f00787_3;
+f00787_5 Follow f00787_4;
+f00787_6 Follow f00787_5;
+f00787_7 Follow f00787_6;
+f00787_8 Follow f00787_7;
+f00787_9 Follow f00787_8;
+in00788 FLAG;
+f00788_1 Follow in00788;
+f00788_2 Follow f00788_1;
+f00788_3 Follow f00788_2;
+f00788_4 Follow f00788_3;
+f00788_5 Follow f00788_4;
+f00788_6 Follow f00788_5;
+f00788_7 Follow f00788_6;
+f00788_8 Follow f00788_7;
+f00788_9 Follow f00788_8;
+in00789 FLAG;
+f00789_1 Follow in00789;
+f00789_2 Follow f00789_1;
+f00789_3 Follow f00789_2;
+f00789_4 Follow f00789_3;
+f00789_5 Follow f00789_4;
+f00789_6 Follow f00789_5;
+f00789_7 Follow f00789_6;
+f00789_8 Follow f00789_7;
+f00789_9 Follow f00789_8;
+in00790 FLAG;
+f00790_1 Follow in00790;
+f00790_2 Follow f00790_1;
+f00790_3 Follow f00790_2;
+f00790_4 Follow f00790_3;
+f00790_5 Follow f00790_4;
+f00790_6 Follow f00790_5;
+f00790_7 Follow f00790_6;
+f00790_8 Follow f00790_7;
+f00790_9 Follow f00790_8;
+in00791 FLAG;
+f00791_1 Follow in00791;
+f00791_2 Follow f00791_1;
+f00791_3 Follow f00791_2;
+f00791_4 Follow f00791_3;
+f00791_5 Follow f00791_4;
+f00791_6 Follow f00791_5;
+f00791_7 Follow f00791_6;
+f00791_8 Follow f00791_7;
+f00791_9 Follow f00791_8;
+in00792 FLAG;
+f00792_1 Follow in00792;
+f00792_2 Follow f00792_1;
+f00792_3 Follow f00792_2;
+f00792_4 Follow f00792_3;
+f00792_5 Follow f00792_4;
+f00792_6 Follow f00792_5;
+f00792_7 Follow f00792_6;
+f00792_8 Follow f00792_7;
+f00792_9 Follow f00792_8;
+in00793 FLAG;
+f00793_1 Follow in00793;
+f00793_2 Follow f00793_1;
+f00793_3 Follow f00793_2;
+f00793_4 Follow f00793_3;
+f00793_5 Follow f00793_4;
+f00793_6 Follow f00793_5;
+f00793_7 Follow f00793_6;
+f00793_8 Follow f00793_7;
+f00793_9 Follow f00793_8;
+in00794 FLAG;
+f00794_1 Follow in00794;
+f00794_2 Follow f00794_1;
+f00794_3 Follow f00794_2;
+f00794_4 Follow f00794_3;
+f00794_5 Follow f00794_4;
+f00794_6 Follow f00794_5;
+f00794_7 Follow f00794_6;
+f00794_8 Follow f00794_7;
+f00794_9 Follow f00794_8;
+in00795 FLAG;
+f00795_1 Follow in00795;
+f00795_2 Follow f00795_1;
+f00795_3 Follow f00795_2;
+f00795_4 Follow f00795_3;
+f00795_5 Follow f00795_4;
+f00795_6 Follow f00795_5;
+f00795_7 Follow f00795_6;
+f00795_8 Follow f00795_7;
+f00795_9 Follow f00795_8;
+in00796 FLAG;
+f00796_1 Follow in00796;
+f00796_2 Follow f00796_1;
+f00796_3 Follow f00796_2;
+f00796_4 Follow f00796_3;
+f00796_5 Follow f00796_4;
+f00796_6 Follow f00796_5;
+f00796_7 Follow f00796_6;
+f00796_8 Follow f00796_7;
+f00796_9 Follow f00796_8;
+in00797 FLAG;
+f00797_1 Follow in00797;
+f00797_2 Follow f00797_1;
+f00797_3 Follow f00797_2;
+f00797_4 Follow f00797_3;
+f00797_5 Follow f00797_4;
+f00797_6 Follow f00797_5;
+f00797_7 Follow f00797_6;
+f00797_8 Follow f00797_7;
+f00797_9 Follow f00797_8;
+in00798 FLAG;
+f00798_1 Follow in00798;
+f00798_2 Follow f00798_1;
+f00798_3 Follow f00798_2;
+f00798_4 Follow f00798_3;
+f00798_5 Follow f00798_4;
+f00798_6 Follow f00798_5;
+f00798_7 Follow f00798_6;
+f00798_8 Follow f00798_7;
+f00798_9 Follow f00798_8;
+in00799 FLAG;
+f00799_1 Follow in00799;
+f00799_2 Follow f00799_1;
+f00799_3 Follow f00799_2;
+f00799_4 Follow f00799_3;
+f00799_5 Follow f00799_4;
+f00799_6 Follow f00799_5;
+f00799_7 Follow f00799_6;
+f00799_8 Follow f00799_7;
+f00799_9 Follow f00799_8;
+in00800 FLAG;
+f00800_1 Follow in00800;
+f00800_2 Follow f00800_1;
+f00800_3 Follow f00800_2;
+f00800_4 Follow f00800_3;
+f00800_5 Follow f00800_4;
+f00800_6 Follow f00800_5;
+f00800_7 Follow f00800_6;
+f00800_8 Follow f00800_7;
+f00800_9 Follow f00800_8;
+in00801 FLAG;
+f00801_1 Follow in00801;
+f00801_2 Follow f00801_1;
+f00801_3 Follow f00801_2;
+f00801_4 Follow f00801_3;
+f00801_5 Follow f00801_4;
+f00801_6 Follow f00801_5;
+f00801_7 Follow f00801_6;
+f00801_8 Follow f00801_7;
+f00801_9 Follow f00801_8;
+in00802 FLAG;
+f00802_1 Follow in00802;
+f00802_2 Follow f00802_1;
+f00802_3 Follow f00802_2;
+f00802_4 Follow f00802_3;
+f00802_5 Follow f00802_4;
+f00802_6 Follow f00802_5;
+f00802_7 Follow f00802_6;
+f00802_8 Follow f00802_7;
+f00802_9 Follow f00802_8;
+in00803 FLAG;
+f00803_1 Follow in00803;
+f00803_2 Follow f00803_1;
+f00803_3 Follow f00803_2;
+f00803_4 Follow f00803_3;
+f00803_5 Follow f00803_4;
+f00803_6 Follow f00803_5;
+f00803_7 Follow f00803_6;
+f00803_8 Follow f00803_7;
+f00803_9 Follow f00803_8;
+in00804 FLAG;
+f00804_1 Follow in00804;
+f00804_2 Follow f00804_1;
+f00804_3 Follow f00804_2;
+f00804_4 Follow f00804_3;
+f00804_5 Follow f00804_4;
+f00804_6 Follow f00804_5;
+f00804_7 Follow f00804_6;
+f00804_8 Follow f00804_7;
+f00804_9 Follow f00804_8;
+in00805 FLAG;
+f00805_1 Follow in00805;
+f00805_2 Follow f00805_1;
+f00805_3 Follow f00805_2;
+f00805_4 Follow f00805_3;
+f00805_5 Follow f00805_4;
+f00805_6 Follow f00805_5;
+f00805_7 Follow f00805_6;
+f00805_8 Follow f00805_7;
+f00805_9 Follow f00805_8;
+in00806 FLAG;
+f00806_1 Follow in00806;
+f00806_2 Follow f00806_1;
+f00806_3 Follow f00806_2;
+f00806_4 Follow f00806_3;
+f00806_5 Follow f00806_4;
+f00806_6 Follow f00806_5;
+f00806_7 Follow f00806_6;
+f00806_8 Follow f00806_7;
+f00806_9 Follow f00806_8;
+in00807 FLAG;
+f00807_1 Follow in00807;
+f00807_2 Follow f00807_1;
+f00807_3 Follow f00807_2;
+f00807_4 Follow f00807_3;
+f00807_5 Follow f00807_4;
+f00807_6 Follow f00807_5;
+f00807_7 Follow f00807_6;
+f00807_8 Follow f00807_7;
+f00807_9 Follow f00807_8;
+in00808 FLAG;
+f00808_1 Follow in00808;
+f00808_2 Follow f00808_1;
+f00808_3 Follow f00808_2;
+f00808_4 Follow f00808_3;
+f00808_5 Follow f00808_4;
+f00808_6 Follow f00808_5;
+f00808_7 Follow f00808_6;
+f00808_8 Follow f00808_7;
+f00808_9 Follow f00808_8;
+in00809 FLAG;
+f00809_1 Follow in00809;
+f00809_2 Follow f00809_1;
+f00809_3 Follow f00809_2;
+f00809_4 Follow f00809_3;
+f00809_5 Follow f00809_4;
+f00809_6 Follow f00809_5;
+f00809_7 Follow f00809_6;
+f00809_8 Follow f00809_7;
+f00809_9 Follow f00809_8;
+in00810 FLAG;
+f00810_1 Follow in00810;
+f00810_2 Follow f00810_1;
+f00810_3 Follow f00810_2;
+f00810_4 Follow f00810_3;
+f00810_5 Follow f00810_4;
+f00810_6 Follow f00810_5;
+f00810_7 Follow f00810_6;
+f00810_8 Follow f00810_7;
+f00810_9 Follow f00810_8;
+in00811 FLAG;
+f00811_1 Follow in00811;
+f00811_2 Follow f00811_1;
+f00811_3 Follow f00811_2;
+f00811_4 Follow f00811_3;
+f00811_5 Follow f00811_4;
+f00811_6 Follow f00811_5;
+f00811_7 Follow f00811_6;
+f00811_8 Follow f00811_7;
+f00811_9 Follow f00811_8;
+in00812 FLAG;
+f00812_1 Follow in00812;
+f00812_2 Follow f00812_1;
+f00812_3 Follow f00812_2;
+f00812_4 Follow f00812_3;
+f00812_5 Follow f00812_4;
+f00812_6 Follow f00812_5;
+f00812_7 Follow f00812_6;
+f00812_8 Follow f00812_7;
+f00812_9 Follow f00812_8;
+in00813 FLAG;
+f00813_1 Follow in00813;
+f00813_2 Follow f00813_1;
+f00813_3 Follow f00813_2;
+f00813_4 Follow f00813_3;
+f00813_5 Follow f00813_4;
+f00813_6 Follow f00813_5;
+f00813_7 Follow f00813_6;
+f00813_8 Follow f00813_7;
+f00813_9 Follow f00813_8;
+in00814 FLAG;
+f00814_1 Follow in00814;
+f00814_2 Follow f00814_1;
+f00814_3 Follow f00814_2;
+f00814_4 Follow f00814_3;
+f00814_5 Follow f00814_4;
+f00814_6 Follow f00814_5;
+f00814_7 Follow f00814_6;
+f00814_8 Follow f00814_7;
+f00814_9 Follow f00814_8;
+in00815 FLAG;
+f00815_1 Follow in00815;
+f00815_2 Follow f00815_1;
+f00815_3 Follow f00815_2;
+f00815_4 Follow f00815_3;
+f00815_5 Follow f00815_4;
+f00815_6 Follow f00815_5;
+f00815_7 Follow f00815_6;
+f00815_8 Follow f00815_7;
+f00815_9 Follow f00815_8;
+in00816 FLAG;
+f00816_1 Follow in00816;
+f00816_2 Follow f00816_1;
+f00816_3 Follow f00816_2;
+f00816_4 Follow f00816_3;
+f00816_5 Follow f00816_4;
+f00816_6 Follow f00816_5;
+f00816_7 Follow f00816_6;
+f00816_8 Follow f00816_7;
+f00816_9 Follow f00816_8;
+in00817 FLAG;
+f00817_1 Follow in00817;
+f00817_2 Follow f00817_1;
+f00817_3 Follow f00817_2;
+f00817_4 Follow f00817_3;
+f00817_5 Follow f00817_4;
+f00817_6 Follow f00817_5;
+f00817_7 Follow f00817_6;
+f00817_8 Follow f00817_7;
+f00817_9 Follow f00817_8;
+in00818 FLAG;
+f00818_1 Follow in00818;
+f00818_2 Follow f00818_1;
+f00818_3 Follow f00818_2;
+f00818_4 Follow f00818_3;
+f00818_5 Follow f00818_4;
+f00818_6 Follow f00818_5;
+f00818_7 Follow f00818_6;
+f00818_8 Follow f00818_7;
+f00818_9 Follow f00818_8;
+in00819 FLAG;
+f00819_1 Follow in00819;
+f00819_2 Follow f00819_1;
+f00819_3 Follow f00819_2;
+f00819_4 Follow f00819_3;
+f00819_5 Follow f00819_4;
+f00819_6 Follow f00819_5;
+f00819_7 Follow f00819_6;
+f00819_8 Follow f00819_7;
+f00819_9 Follow f00819_8;
+in00820 FLAG;
+f00820_1 Follow in00820;
+f00820_2 Follow f00820_1;
+f00820_3 Follow f00820_2;
+f00820_4 Follow f00820_3;
+f00820_5 Follow f00820_4;
+f00820_6 Follow f00820_5;
+f00820_7 Follow f00820_6;
+f00820_8 Follow f00820_7;
+f00820_9 Follow f00820_8;
+in00821 FLAG;
+f00821_1 Follow in00821;
+f00821_2 Follow f00821_1;
+f00821_3 Follow f00821_2;
+f00821_4 Follow f00821_3;
+f00821_5 Follow f00821_4;
+f00821_6 Follow f00821_5;
+f00821_7 Follow f00821_6;
+f00821_8 Follow f00821_7;
+f00821_9 Follow f00821_8;
+in00822 FLAG;
+f00822_1 Follow in00822;
+f00822_2 Follow f00822_1;
+f00822_3 Follow f00822_2;
+f00822_4 Follow f00822_3;
+f00822_5 Follow f00822_4;
+f00822_6 Follow f00822_5;
+f00822_7 Follow f00822_6;
+f00822_8 Follow f00822_7;
+f00822_9 Follow f00822_8;
+in00823 FLAG;
+f00823_1 Follow in00823;
+f00823_2 Follow f00823_1;
+f00823_3 Follow f00823_2;
+f00823_4 Follow f00823_3;
+f00823_5 Follow f00823_4;
+f00823_6 Follow f00823_5;
+f00823_7 Follow f00823_6;
+f00823_8 Follow f00823_7;
+f00823_9 Follow f00823_8;
+in00824 FLAG;
+f00824_1 Follow in00824;
+f00824_2 Follow f00824_1;
+f00824_3 Follow f00824_2;
+f00824_4 Follow f00824_3;
+f00824_5 Follow f00824_4;
+f00824_6 Follow f00824_5;
+f00824_7 Follow f00824_6;
+f00824_8 Follow f00824_7;
+f00824_9 Follow f00824_8;
+in00825 FLAG;
+f00825_1 Follow in00825;
+f00825_2 Follow f00825_1;
+f00825_3 Follow f00825_2;
+f00825_4 Follow f00825_3;
+f00825_5 Follow f00825_4;
+f00825_6 Follow f00825_5;
+f00825_7 Follow f00825_6;
+f00825_8 Follow f00825_7;
+f00825_9 Follow f00825_8;
+in00826 FLAG;
+f00826_1 Follow in00826;
+f00826_2 Follow f00826_1;
+f00826_3 Follow f00826_2;
+f00826_4 Follow f00826_3;
+f00826_5 Follow f00826_4;
+f00826_6 Follow f00826_5;
+f00826_7 Follow f00826_6;
+f00826_8 Follow f00826_7;
+f00826_9 Follow f00826_8;
+in00827 FLAG;
+f00827_1 Follow in00827;
+f00827_2 Follow f00827_1;
+f00827_3 Follow f00827_2;
+f00827_4 Follow f00827_3;
+f00827_5 Follow f00827_4;
+f00827_6 Follow f00827_5;
+f00827_7 Follow f00827_6;
+f00827_8 Follow f00827_7;
+f00827_9 Follow f00827_8;
+in00828 FLAG;
+f00828_1 Follow in00828;
+f00828_2 Follow f00828_1;
+f00828_3 Follow f00828_2;
+f00828_4 Follow f00828_3;
+f00828_5 Follow f00828_4;
+f00828_6 Follow f00828_5;
+f00828_7 Follow f00828_6;
+f00828_8 Follow f00828_7;
+f00828_9 Follow f00828_8;
+in00829 FLAG;
+f00829_1 Follow in00829;
+f00829_2 Follow f00829_1;
+f00829_3 Follow f00829_2;
+f00829_4 Follow f00829_3;
+f00829_5 Follow f00829_4;
+f00829_6 Follow f00829_5;
+f00829_7 Follow f00829_6;
+f00829_8 Follow f00829_7;
+f00829_9 Follow f00829_8;
+in00830 FLAG;
+f00830_1 Follow in00830;
+f00830_2 Follow f00830_1;
+f00830_3 Follow f00830_2;
+f00830_4 Follow f00830_3;
+f00830_5 Follow f00830_4;
+f00830_6 Follow f00830_5;
+f00830_7 Follow f00830_6;
+f00830_8 Follow f00830_7;
+f00830_9 Follow f00830_8;
+in00831 FLAG;
+f00831_1 Follow in00831;
+f00831_2 Follow f00831_1;
+f00831_3 Follow f00831_2;
+f00831_4 Follow f00831_3;
+f00831_5 Follow f00831_4;
+f00831_6 Follow f00831_5;
+f00831_7 Follow f00831_6;
+f00831_8 Follow f00831_7;
+f00831_9 Follow f00831_8;
+in00832 FLAG;
+f00832_1 Follow in00832;
+f00832_2 Follow f00832_1;
+f00832_3 Follow f00832_2;
+f00832_4 Follow f00832_3;
+f00832_5 Follow f00832_4;
+f00832_6 Follow f00832_5;
+f00832_7 Follow f00832_6;
+f00832_8 Follow f00832_7;
+f00832_9 Follow f00832_8;
+in00833 FLAG;
+f00833_1 Follow in00833;
+f00833_2 Follow f00833_1;
+f00833_3 Follow f00833_2;
+f00833_4 Follow f00833_3;
+f00833_5 Follow f00833_4;
+f00833_6 Follow f00833_5;
+f00833_7 Follow f00833_6;
+f00833_8 Follow f00833_7;
+f00833_9 Follow f00833_8;
+in00834 FLAG;
+f00834_1 Follow in00834;
+f00834_2 Follow f00834_1;
+f00834_3 Follow f00834_2;
+f00834_4 Follow f00834_3;
+f00834_5 Follow f00834_4;
+f00834_6 Follow f00834_5;
+f00834_7 Follow f00834_6;
+f00834_8 Follow f00834_7;
+f00834_9 Follow f00834_8;
+in00835 FLAG;
+f00835_1 Follow in00835;
+f00835_2 Follow f00835_1;
+f00835_3 Follow f00835_2;
+f00835_4 Follow f00835_3;
+f00835_5 Follow f00835_4;
+f00835_6 Follow f00835_5;
+f00835_7 Follow f00835_6;
+f00835_8 Follow f00835_7;
+f00835_9 Follow f00835_8;
+in00836 FLAG;
+f00836_1 Follow in00836;
+f00836_2 Follow f00836_1;
+f00836_3 Follow f00836_2;
+f00836_4 Follow f00836_3;
+f00836_5 Follow f00836_4;
+f00836_6 Follow f00836_5;
+f00836_7 Follow f00836_6;
+f00836_8 Follow f00836_7;
+f00836_9 Follow f00836_8;
+in00837 FLAG;
+f00837_1 Follow in00837;
+f00837_2 Follow f00837_1;
+f00837_3 Follow f00837_2;
+f00837_4 Follow f00837_3;
+f00837_5 Follow f00837_4;
+f00837_6 Follow f00837_5;
+f00837_7 Follow f00837_6;
+f00837_8 Follow f00837_7;
+f00837_9 Follow f00837_8;
+in00838 FLAG;
+f00838_1 Follow in00838;
+f00838_2 Follow f00838_1;
+f00838_3 Follow f00838_2;
+f00838_4 Follow f00838_3;
+f00838_5 Follow f00838_4;
+f00838_6 Follow f00838_5;
+f00838_7 Follow f00838_6;
+f00838_8 Follow f00838_7;
+f00838_9 Follow f00838_8;
+in00839 FLAG;
+f00839_1 Follow in00839;
+f00839_2 Follow f00839_1;
+f00839_3 Follow f00839_2;
+f00839_4 Follow f00839_3;
+f00839_5 Follow f00839_4;
+f00839_6 Follow f00839_5;
+f00839_7 Follow f00839_6;
+f00839_8 Follow f00839_7;
+f00839_9 Follow f00839_8;
+in00840 FLAG;
+f00840_1 Follow in00840;
+f00840_2 Follow f00840_1;
+f00840_3 Follow f00840_2;
+f00840_4 Follow f00840_3;
+f00840_5 Follow f00840_4;
+f00840_6 Follow f00840_5;
+f00840_7 Follow f00840_6;
+f00840_8 Follow f00840_7;
+f00840_9 Follow f00840_8;
+in00841 FLAG;
+f00841_1 Follow in00841;
+f00841_2 Follow f00841_1;
+f00841_3 Follow f00841_2;
+f00841_4 Follow f00841_3;
+f00841_5 Follow f00841_4;
+f00841_6 Follow f00841_5;
+f00841_7 Follow f00841_6;
+f00841_8 Follow f00841_7;
+f00841_9 Follow f00841_8;
+in00842 FLAG;
+f00842_1 Follow in00842;
+f00842_2 Follow f00842_1;
+f00842_3 Follow f00842_2;
+f00842_4 Follow f00842_3;
+f00842_5 Follow f00842_4;
+f00842_6 Follow f00842_5;
+f00842_7 Follow f00842_6;
+f00842_8 Follow f00842_7;
+f00842_9 Follow f00842_8;
+in00843 FLAG;
+f00843_1 Follow in00843;
+f00843_2 Follow f00843_1;
+f00843_3 Follow f00843_2;
+f00843_4 Follow f00843_3;
+f00843_5 Follow f00843_4;
+f00843_6 Follow f00843_5;
+f00843_7 Follow f00843_6;
+f00843_8 Follow f00843_7;
+f00843_9 Follow f00843_8;
+in00844 FLAG;
+f00844_1 Follow in00844;
+f00844_2 Follow f00844_1;
+f00844_3 Follow f00844_2;
+f00844_4 Follow f00844_3;
+f00844_5 Follow f00844_4;
+f00844_6 Follow f00844_5;
+f00844_7 Follow f00844_6;
+f00844_8 Follow f00844_7;
+f00844_9 Follow f00844_8;
+in00845 FLAG;
+f00845_1 Follow in00845;
+f00845_2 Follow f00845_1;
+f00845_3 Follow f00845_2;
+f00845_4 Follow f00845_3;
+f00845_5 Follow f00845_4;
+f00845_6 Follow f00845_5;
+f00845_7 Follow f00845_6;
+f00845_8 Follow f00845_7;
+f00845_9 Follow f00845_8;
+in00846 FLAG;
+f00846_1 Follow in00846;
+f00846_2 Follow f00846_1;
+f00846_3 Follow f00846_2;
+f00846_4 Follow f00846_3;
+f00846_5 Follow f00846_4;
+f00846_6 Follow f00846_5;
+f00846_7 Follow f00846_6;
+f00846_8 Follow f00846_7;
+f00846_9 Follow f00846_8;
+in00847 FLAG;
+f00847_1 Follow in00847;
+f00847_2 Follow f00847_1;
+f00847_3 Follow f00847_2;
+f00847_4 Follow f00847_3;
+f00847_5 Follow f00847_4;
+f00847_6 Follow f00847_5;
+f00847_7 Follow f00847_6;
+f00847_8 Follow f00847_7;
+f00847_9 Follow f00847_8;
+in00848 FLAG;
+f00848_1 Follow in00848;
+f00848_2 Follow f00848_1;
+f00848_3 Follow f00848_2;
+f00848_4 Follow f00848_3;
+f00848_5 Follow f00848_4;
+f00848_6 Follow f00848_5;
+f00848_7 Follow f00848_6;
+f00848_8 Follow f00848_7;
+f00848_9 Follow f00848_8;
+in00849 FLAG;
+f00849_1 Follow in00849;
+f00849_2 Follow f00849_1;
+f00849_3 Follow f00849_2;
+f00849_4 Follow f00849_3;
+f00849_5 Follow f00849_4;
+f00849_6 Follow f00849_5;
+f00849_7 Follow f00849_6;
+f00849_8 Follow f00849_7;
+f00849_9 Follow f00849_8;
+in00850 FLAG;
+f00850_1 Follow in00850;
+f00850_2 Follow f00850_1;
+f00850_3 Follow f00850_2;
+f00850_4 Follow f00850_3;
+f00850_5 Follow f00850_4;
+f00850_6 Follow f00850_5;
+f00850_7 Follow f00850_6;
+f00850_8 Follow f00850_7;
+f00850_9 Follow f00850_8;
+in00851 FLAG;
+f00851_1 Follow in00851;
+f00851_2 Follow f00851_1;
+f00851_3 Follow f00851_2;
+f00851_4 Follow f00851_3;
+f00851_5 Follow f00851_4;
+f00851_6 Follow f00851_5;
+f00851_7 Follow f00851_6;
+f00851_8 Follow f00851_7;
+f00851_9 Follow f00851_8;
+in00852 FLAG;
+f00852_1 Follow in00852;
+f00852_2 Follow f00852_1;
+f00852_3 Follow f00852_2;
+f00852_4 Follow f00852_3;
+f00852_5 Follow f00852_4;
+f00852_6 Follow f00852_5;
+f00852_7 Follow f00852_6;
+f00852_8 Follow f00852_7;
+f00852_9 Follow f00852_8;
+in00853 FLAG;
+f00853_1 Follow in00853;
+f00853_2 Follow f00853_1;
+f00853_3 Follow f00853_2;
+f00853_4 Follow f00853_3;
+f00853_5 Follow f00853_4;
+f00853_6 Follow f00853_5;
+f00853_7 Follow f00853_6;
+f00853_8 Follow f00853_7;
+f00853_9 Follow f00853_8;
+in00854 FLAG;
+f00854_1 Follow in00854;
+f00854_2 Follow f00854_1;
+f00854_3 Follow f00854_2;
+f00854_4 Follow f00854_3;
+f00854_5 Follow f00854_4;
+f00854_6 Follow f00854_5;
+f00854_7 Follow f00854_6;
+f00854_8 Follow f00854_7;
+f00854_9 Follow f00854_8;
+in00855 FLAG;
+f00855_1 Follow in00855;
+f00855_2 Follow f00855_1;
+f00855_3 Follow f00855_2;
+f00855_4 Follow f00855_3;
+f00855_5 Follow f00855_4;
+f00855_6 Follow f00855_5;
+f00855_7 Follow f00855_6;
+f00855_8 Follow f00855_7;
+f00855_9 Follow f00855_8;
+in00856 FLAG;
+f00856_1 Follow in00856;
+f00856_2 Follow f00856_1;
+f00856_3 Follow f00856_2;
+f00856_4 Follow f00856_3;
+f00856_5 Follow f00856_4;
+f00856_6 Follow f00856_5;
+f00856_7 Follow f00856_6;
+f00856_8 Follow f00856_7;
+f00856_9 Follow f00856_8;
+in00857 FLAG;
+f00857_1 Follow in00857;
+f00857_2 Follow f00857_1;
+f00857_3 Follow f00857_2;
+f00857_4 Follow f00857_3;
+f00857_5 Follow f00857_4;
+f00857_6 Follow f00857_5;
+f00857_7 Follow f00857_6;
+f00857_8 Follow f00857_7;
+f00857_9 Follow f00857_8;
+in00858 FLAG;
+f00858_1 Follow in00858;
+f00858_2 Follow f00858_1;
+f00858_3 Follow f00858_2;
+f00858_4 Follow f00858_3;
+f00858_5 Follow f00858_4;
+f00858_6 Follow f00858_5;
+f00858_7 Follow f00858_6;
+f00858_8 Follow f00858_7;
+f00858_9 Follow f00858_8;
+in00859 FLAG;
+f00859_1 Follow in00859;
+f00859_2 Follow f00859_1;
+f00859_3 Follow f00859_2;
+f00859_4 Follow f00859_3;
+f00859_5 Follow f00859_4;
+f00859_6 Follow f00859_5;
+f00859_7 Follow f00859_6;
+f00859_8 Follow f00859_7;
+f00859_9 Follow f00859_8;
+in00860 FLAG;
+f00860_1 Follow in00860;
+f00860_2 Follow f00860_1;
+f00860_3 Follow f00860_2;
+f00860_4 Follow f00860_3;
+f00860_5 Follow f00860_4;
+f00860_6 Follow f00860_5;
+f00860_7 Follow f00860_6;
+f00860_8 Follow f00860_7;
+f00860_9 Follow f00860_8;
+in00861 FLAG;
+f00861_1 Follow in00861;
+f00861_2 Follow f00861_1;
+f00861_3 Follow f00861_2;
+f00861_4 Follow f00861_3;
+f00861_5 Follow f00861_4;
+f00861_6 Follow f00861_5;
+f00861_7 Follow f00861_6;
+f00861_8 Follow f00861_7;
+f00861_9 Follow f00861_8;
+in00862 FLAG;
+f00862_1 Follow in00862;
+f00862_2 Follow f00862_1;
+f00862_3 Follow f00862_2;
+f00862_4 Follow f00862_3;
+f00862_5 Follow f00862_4;
+f00862_6 Follow f00862_5;
+f00862_7 Follow f00862_6;
+f00862_8 Follow f00862_7;
+f00862_9 Follow f00862_8;
+in00863 FLAG;
+f00863_1 Follow in00863;
+f00863_2 Follow f00863_1;
+f00863_3 Follow f00863_2;
+f00863_4 Follow f00863_3;
+f00863_5 Follow f00863_4;
+f00863_6 Follow f00863_5;
+f00863_7 Follow f00863_6;
+f00863_8 Follow f00863_7;
+f00863_9 Follow f00863_8;
+in00864 FLAG;
+f00864_1 Follow in00864;
+f00864_2 Follow f00864_1;
+f00864_3 Follow f00864_2;
+f00864_4 Follow f00864_3;
+f00864_5 Follow f00864_4;
+f00864_6 Follow f00864_5;
+f00864_7 Follow f00864_6;
+f00864_8 Follow f00864_7;
+f00864_9 Follow f00864_8;
+in00865 FLAG;
+f00865_1 Follow in00865;
+f00865_2 Follow f00865_1;
+f00865_3 Follow f00865_2;
+f00865_4 Follow f00865_3;
+f00865_5 Follow f00865_4;
+f00865_6 Follow f00865_5;
+f00865_7 Follow f00865_6;
+f00865_8 Follow f00865_7;
+f00865_9 Follow f00865_8;
+in00866 FLAG;
+f00866_1 Follow in00866;
+f00866_2 Follow f00866_1;
+f00866_3 Follow f00866_2;
+f00866_4 Follow f00866_3;
+f00866_5 Follow f00866_4;
+f00866_6 Follow f00866_5;
+f00866_7 Follow f00866_6;
+f00866_8 Follow f00866_7;
+f00866_9 Follow f00866_8;
+in00867 FLAG;
+f00867_1 Follow in00867;
+f00867_2 Follow f00867_1;
+f00867_3 Follow f00867_2;
+f00867_4 Follow f00867_3;
+f00867_5 Follow f00867_4;
+f00867_6 Follow f00867_5;
+f00867_7 Follow f00867_6;
+f00867_8 Follow f00867_7;
+f00867_9 Follow f00867_8;
+in00868 FLAG;
+f00868_1 Follow in00868;
+f00868_2 Follow f00868_1;
+f00868_3 Follow f00868_2;
+f00868_4 Follow f00868_3;
+f00868_5 Follow f00868_4;
+f00868_6 Follow f00868_5;
+f00868_7 Follow f00868_6;
+f00868_8 Follow f00868_7;
+f00868_9 Follow f00868_8;
+in00869 FLAG;
+f00869_1 Follow in00869;
+f00869_2 Follow f00869_1;
+f00869_3 Follow f00869_2;
+f00869_4 Follow f00869_3;
+f00869_5 Follow f00869_4;
+f00869_6 Follow f00869_5;
+f00869_7 Follow f00869_6;
+f00869_8 Follow f00869_7;
+f00869_9 Follow f00869_8;
+in00870 FLAG;
+f00870_1 Follow in00870;
+f00870_2 Follow f00870_1;
+f00870_3 Follow f00870_2;
+f00870_4 Follow f00870_3;
+f00870_5 Follow f00870_4;
+f00870_6 Follow f00870_5;
+f00870_7 Follow f00870_6;
+f00870_8 Follow f00870_7;
+f00870_9 Follow f00870_8;
+in00871 FLAG;
+f00871_1 Follow in00871;
+f00871_2 Follow f00871_1;
+f00871_3 Follow f00871_2;
+f00871_4 Follow f00871_3;
+f00871_5 Follow f00871_4;
+f00871_6 Follow f00871_5;
+f00871_7 Follow f00871_6;
+f00871_8 Follow f00871_7;
+f00871_9 Follow f00871_8;
+in00872 FLAG;
+f00872_1 Follow in00872;
+f00872_2 Follow f00872_1;
+f00872_3 Follow f00872_2;
+f00872_4 Follow f00872_3;
+f00872_5 Follow f00872_4;
+f00872_6 Follow f00872_5;
+f00872_7 Follow f00872_6;
+f00872_8 Follow f00872_7;
+f00872_9 Follow f00872_8;
+in00873 FLAG;
+f00873_1 Follow in00873;
+f00873_2 Follow f00873_1;
+f00873_3 Follow f00873_2;
+f00873_4 Follow f00873_3;
+f00873_5 Follow f00873_4;
+f00873_6 Follow f00873_5;
+f00873_7 Follow f00873_6;
+f00873_8 Follow f00873_7;
+f00873_9 Follow f00873_8;
+in00874 FLAG;
+f00874_1 Follow in00874;
+f00874_2 Follow f00874_1;
+f00874_3 Follow f00874_2;
+f00874_4 Follow f00874_3;
+f00874_5 Follow f00874_4;
+f00874_6 Follow f00874_5;
+f00874_7 Follow f00874_6;
+f00874_8 Follow f00874_7;
+f00874_9 Follow f00874_8;
+in00875 FLAG;
+f00875_1 Follow in00875;
+f00875_2 Follow f00875_1;
+f00875_3 Follow f00875_2;
+f00875_4 Follow f00875_3;
+f00875_5 Follow f00875_4;
+f00875_6 Follow f00875_5;
+f00875_7 Follow f00875_6;
+f00875_8 Follow f00875_7;
+f00875_9 Follow f00875_8;
+in00876 FLAG;
+f00876_1 Follow in00876;
+f00876_2 Follow f00876_1;
+f00876_3 Follow f00876_2;
+f00876_4 Follow f00876_3;
+f00876_5 Follow f00876_4;
+f00876_6 Follow f00876_5;
+f00876_7 Follow f00876_6;
+f00876_8 Follow f00876_7;
+f00876_9 Follow f00876_8;
+in00877 FLAG;
+f00877_1 Follow in00877;
+f00877_2 Follow f00877_1;
+f00877_3 Follow f00877_2;
+f00877_4 Follow f00877_3;
+f00877_5 Follow f00877_4;
+f00877_6 Follow f00877_5;
+f00877_7 Follow f00877_6;
+f00877_8 Follow f00877_7;
+f00877_9 Follow f00877_8;
+in00878 FLAG;
+f00878_1 Follow in00878;
+f00878_2 Follow f00878_1;
+f00878_3 Follow f00878_2;
+f00878_4 Follow f00878_3;
+f00878_5 Follow f00878_4;
+f00878_6 Follow f00878_5;
+f00878_7 Follow f00878_6;
+f00878_8 Follow f00878_7;
+f00878_9 Follow f00878_8;
+in00879 FLAG;
+f00879_1 Follow in00879;
+f00879_2 Follow f00879_1;
+f00879_3 Follow f00879_2;
+f00879_4 Follow f00879_3;
+f00879_5 Follow f00879_4;
+f00879_6 Follow f00879_5;
+f00879_7 Follow f00879_6;
+f00879_8 Follow f00879_7;
+f00879_9 Follow f00879_8;
+in00880 FLAG;
+f00880_1 Follow in00880;
+f00880_2 Follow f00880_1;
+f00880_3 Follow f00880_2;
+f00880_4 Follow f00880_3;
+f00880_5 Follow f00880_4;
+f00880_6 Follow f00880_5;
+f00880_7 Follow f00880_6;
+f00880_8 Follow f00880_7;
+f00880_9 Follow f00880_8;
+in00881 FLAG;
+f00881_1 Follow in00881;
+f00881_2 Follow f00881_1;
+f00881_3 Follow f00881_2;
+f00881_4 Follow f00881_3;
+f00881_5 Follow f00881_4;
+f00881_6 Follow f00881_5;
+f00881_7 Follow f00881_6;
+f00881_8 Follow f00881_7;
+f00881_9 Follow f00881_8;
+in00882 FLAG;
+f00882_1 Follow in00882;
+f00882_2 Follow f00882_1;
+f00882_3 Follow f00882_2;
+f00882_4 Follow f00882_3;
+f00882_5 Follow f00882_4;
+f00882_6 Follow f00882_5;
+f00882_7 Follow f00882_6;
+f00882_8 Follow f00882_7;
+f00882_9 Follow f00882_8;
+in00883 FLAG;
+f00883_1 Follow in00883;
+f00883_2 Follow f00883_1;
+f00883_3 Follow f00883_2;
+f00883_4 Follow f00883_3;
+f00883_5 Follow f00883_4;
+f00883_6 Follow f00883_5;
+f00883_7 Follow f00883_6;
+f00883_8 Follow f00883_7;
+f00883_9 Follow f00883_8;
+in00884 FLAG;
+f00884_1 Follow in00884;
+f00884_2 Follow f00884_1;
+f00884_3 Follow f00884_2;
+f00884_4 Follow f00884_3;
+f00884_5 Follow f00884_4;
+f00884_6 Follow f00884_5;
+f00884_7 Follow f00884_6;
+f00884_8 Follow f00884_7;
+f00884_9 Follow f00884_8;
+in00885 FLAG;
+f00885_1 Follow in00885;
+f00885_2 Follow f00885_1;
+f00885_3 Follow f00885_2;
+f00885_4 Follow f00885_3;
+f00885_5 Follow f00885_4;
+f00885_6 Follow f00885_5;
+f00885_7 Follow f00885_6;
+f00885_8 Follow f00885_7;
+f00885_9 Follow f00885_8;
+in00886 FLAG;
+f00886_1 Follow in00886;
+f00886_2 Follow f00886_1;
+f00886_3 Follow f00886_2;
+f00886_4 Follow f00886_3;
+f00886_5 Follow f00886_4;
+f00886_6 Follow f00886_5;
+f00886_7 Follow f00886_6;
+f00886_8 Follow f00886_7;
+f00886_9 Follow f00886_8;
+in00887 FLAG;
+f00887_1 Follow in00887;
+f00887_2 Follow f00887_1;
+f00887_3 Follow f00887_2;
+f00887_4 Follow f00887_3;
+f00887_5 Follow f00887_4;
+f00887_6 Follow f00887_5;
+f00887_7 Follow f00887_6;
+f00887_8 Follow f00887_7;
+f00887_9 Follow f00887_8;
+in00888 FLAG;
+f00888_1 Follow in00888;
+f00888_2 Follow f00888_1;
+f00888_3 Follow f00888_2;
+f00888_4 Follow f00888_3;
+f00888_5 Follow f00888_4;
+f00888_6 Follow f00888_5;
+f00888_7 Follow f00888_6;
+f00888_8 Follow f00888_7;
+f00888_9 Follow f00888_8;
+in00889 FLAG;
+f00889_1 Follow in00889;
+f00889_2 Follow f00889_1;
+f00889_3 Follow f00889_2;
+f00889_4 Follow f00889_3;
+f00889_5 Follow f00889_4;
+f00889_6 Follow f00889_5;
+f00889_7 Follow f00889_6;
+f00889_8 Follow f00889_7;
+f00889_9 Follow f00889_8;
+in00890 FLAG;
+f00890_1 Follow in00890;
+f00890_2 Follow f00890_1;
+f00890_3 Follow f00890_2;
+f00890_4 Follow f00890_3;
+f00890_5 Follow f00890_4;
+f00890_6 Follow f00890_5;
+f00890_7 Follow f00890_6;
+f00890_8 Follow f00890_7;
+f00890_9 Follow f00890_8;
+in00891 FLAG;
+f00891_1 Follow in00891;
+f00891_2 Follow f00891_1;
+f00891_3 Follow f00891_2;
+f00891_4 Follow f00891_3;
+f00891_5 Follow f00891_4;
+f00891_6 Follow f00891_5;
+f00891_7 Follow f00891_6;
+f00891_8 Follow f00891_7;
+f00891_9 Follow f00891_8;
+in00892 FLAG;
+f00892_1 Follow in00892;
+f00892_2 Follow f00892_1;
+f00892_3 Follow f00892_2;
+f00892_4 Follow f00892_3;
+f00892_5 Follow f00892_4;
+f00892_6 Follow f00892_5;
+f00892_7 Follow f00892_6;
+f00892_8 Follow f00892_7;
+f00892_9 Follow f00892_8;
+in00893 FLAG;
+f00893_1 Follow in00893;
+f00893_2 Follow f00893_1;
+f00893_3 Follow f00893_2;
+f00893_4 Follow f00893_3;
+f00893_5 Follow f00893_4;
+f00893_6 Follow f00893_5;
+f00893_7 Follow f00893_6;
+f00893_8 Follow f00893_7;
+f00893_9 Follow f00893_8;
+in00894 FLAG;
+f00894_1 Follow in00894;
+f00894_2 Follow f00894_1;
+f00894_3 Follow f00894_2;
+f00894_4 Follow f00894_3;
+f00894_5 Follow f00894_4;
+f00894_6 Follow f00894_5;
+f00894_7 Follow f00894_6;
+f00894_8 Follow f00894_7;
+f00894_9 Follow f00894_8;
+in00895 FLAG;
+f00895_1 Follow in00895;
+f00895_2 Follow f00895_1;
+f00895_3 Follow f00895_2;
+f00895_4 Follow f00895_3;
+f00895_5 Follow f00895_4;
+f00895_6 Follow f00895_5;
+f00895_7 Follow f00895_6;
+f00895_8 Follow f00895_7;
+f00895_9 Follow f00895_8;
+in00896 FLAG;
+f00896_1 Follow in00896;
+f00896_2 Follow f00896_1;
+f00896_3 Follow f00896_2;
+f00896_4 Follow f00896_3;
+f00896_5 Follow f00896_4;
+f00896_6 Follow f00896_5;
+f00896_7 Follow f00896_6;
+f00896_8 Follow f00896_7;
+f00896_9 Follow f00896_8;
+in00897 FLAG;
+f00897_1 Follow in00897;
+f00897_2 Follow f00897_1;
+f00897_3 Follow f00897_2;
+f00897_4 Follow f00897_3;
+f00897_5 Follow f00897_4;
+f00897_6 Follow f00897_5;
+f00897_7 Follow f00897_6;
+f00897_8 Follow f00897_7;
+f00897_9 Follow f00897_8;
+in00898 FLAG;
+f00898_1 Follow in00898;
+f00898_2 Follow f00898_1;
+f00898_3 Follow f00898_2;
+f00898_4 Follow f00898_3;
+f00898_5 Follow f00898_4;
+f00898_6 Follow f00898_5;
+f00898_7 Follow f00898_6;
+f00898_8 Follow f00898_7;
+f00898_9 Follow f00898_8;
+in00899 FLAG;
+f00899_1 Follow in00899;
+f00899_2 Follow f00899_1;
+f00899_3 Follow f00899_2;
+f00899_4 Follow f00899_3;
+f00899_5 Follow f00899_4;
+f00899_6 Follow f00899_5;
+f00899_7 Follow f00899_6;
+f00899_8 Follow f00899_7;
+f00899_9 Follow f00899_8;
+in00900 FLAG;
+f00900_1 Follow in00900;
+f00900_2 Follow f00900_1;
+f00900_3 Follow f00900_2;
+f00900_4 Follow f00900_3;
+f00900_5 Follow f00900_4;
+f00900_6 Follow f00900_5;
+f00900_7 Follow f00900_6;
+f00900_8 Follow f00900_7;
+f00900_9 Follow f00900_8;
+in00901 FLAG;
+f00901_1 Follow in00901;
+f00901_2 Follow f00901_1;
+f00901_3 Follow f00901_2;
+f00901_4 Follow f00901_3;
+f00901_5 Follow f00901_4;
+f00901_6 Follow f00901_5;
+f00901_7 Follow f00901_6;
+f00901_8 Follow f00901_7;
+f00901_9 Follow f00901_8;
+in00902 FLAG;
+f00902_1 Follow in00902;
+f00902_2 Follow f00902_1;
+f00902_3 Follow f00902_2;
+f00902_4 Follow f00902_3;
+f00902_5 Follow f00902_4;
+f00902_6 Follow f00902_5;
+f00902_7 Follow f00902_6;
+f00902_8 Follow f00902_7;
+f00902_9 Follow f00902_8;
+in00903 FLAG;
+f00903_1 Follow in00903;
+f00903_2 Follow f00903_1;
+f00903_3 Follow f00903_2;
+f00903_4 Follow f00903_3;
+f00903_5 Follow f00903_4;
+f00903_6 Follow f00903_5;
+f00903_7 Follow f00903_6;
+f00903_8 Follow f00903_7;
+f00903_9 Follow f00903_8;
+in00904 FLAG;
+f00904_1 Follow in00904;
+f00904_2 Follow f00904_1;
+f00904_3 Follow f00904_2;
+f00904_4 Follow f00904_3;
+f00904_5 Follow f00904_4;
+f00904_6 Follow f00904_5;
+f00904_7 Follow f00904_6;
+f00904_8 Follow f00904_7;
+f00904_9 Follow f00904_8;
+in00905 FLAG;
+f00905_1 Follow in00905;
+f00905_2 Follow f00905_1;
+f00905_3 Follow f00905_2;
+f00905_4 Follow f00905_3;
+f00905_5 Follow f00905_4;
+f00905_6 Follow f00905_5;
+f00905_7 Follow f00905_6;
+f00905_8 Follow f00905_7;
+f00905_9 Follow f00905_8;
+in00906 FLAG;
+f00906_1 Follow in00906;
+f00906_2 Follow f00906_1;
+f00906_3 Follow f00906_2;
+f00906_4 Follow f00906_3;
+f00906_5 Follow f00906_4;
+f00906_6 Follow f00906_5;
+f00906_7 Follow f00906_6;
+f00906_8 Follow f00906_7;
+f00906_9 Follow f00906_8;
+in00907 FLAG;
+f00907_1 Follow in00907;
+f00907_2 Follow f00907_1;
+f00907_3 Follow f00907_2;
+f00907_4 Follow f00907_3;
+f00907_5 Follow f00907_4;
+f00907_6 Follow f00907_5;
+f00907_7 Follow f00907_6;
+f00907_8 Follow f00907_7;
+f00907_9 Follow f00907_8;
+in00908 FLAG;
+f00908_1 Follow in00908;
+f00908_2 Follow f00908_1;
+f00908_3 Follow f00908_2;
+f00908_4 Follow f00908_3;
+f00908_5 Follow f00908_4;
+f00908_6 Follow f00908_5;
+f00908_7 Follow f00908_6;
+f00908_8 Follow f00908_7;
+f00908_9 Follow f00908_8;
+in00909 FLAG;
+f00909_1 Follow in00909;
+f00909_2 Follow f00909_1;
+f00909_3 Follow f00909_2;
+f00909_4 Follow f00909_3;
+f00909_5 Follow f00909_4;
+f00909_6 Follow f00909_5;
+f00909_7 Follow f00909_6;
+f00909_8 Follow f00909_7;
+f00909_9 Follow f00909_8;
+in00910 FLAG;
+f00910_1 Follow in00910;
+f00910_2 Follow f00910_1;
+f00910_3 Follow f00910_2;
+f00910_4 Follow f00910_3;
+f00910_5 Follow f00910_4;
+f00910_6 Follow f00910_5;
+f00910_7 Follow f00910_6;
+f00910_8 Follow f00910_7;
+f00910_9 Follow f00910_8;
+in00911 FLAG;
+f00911_1 Follow in00911;
+f00911_2 Follow f00911_1;
+f00911_3 Follow f00911_2;
+f00911_4 Follow f00911_3;
+f00911_5 Follow f00911_4;
+f00911_6 Follow f00911_5;
+f00911_7 Follow f00911_6;
+f00911_8 Follow f00911_7;
+f00911_9 Follow f00911_8;
+in00912 FLAG;
+f00912_1 Follow in00912;
+f00912_2 Follow f00912_1;
+f00912_3 Follow f00912_2;
+f00912_4 Follow f00912_3;
+f00912_5 Follow f00912_4;
+f00912_6 Follow f00912_5;
+f00912_7 Follow f00912_6;
+f00912_8 Follow f00912_7;
+f00912_9 Follow f00912_8;
+in00913 FLAG;
+f00913_1 Follow in00913;
+f00913_2 Follow f00913_1;
+f00913_3 Follow f00913_2;
+f00913_4 Follow f00913_3;
+f00913_5 Follow f00913_4;
+f00913_6 Follow f00913_5;
+f00913_7 Follow f00913_6;
+f00913_8 Follow f00913_7;
+f00913_9 Follow f00913_8;
+in00914 FLAG;
+f00914_1 Follow in00914;
+f00914_2 Follow f00914_1;
+f00914_3 Follow f00914_2;
+f00914_4 Follow f00914_3;
+f00914_5 Follow f00914_4;
+f00914_6 Follow f00914_5;
+f00914_7 Follow f00914_6;
+f00914_8 Follow f00914_7;
+f00914_9 Follow f00914_8;
+in00915 FLAG;
+f00915_1 Follow in00915;
+f00915_2 Follow f00915_1;
+f00915_3 Follow f00915_2;
+f00915_4 Follow f00915_3;
+f00915_5 Follow f00915_4;
+f00915_6 Follow f00915_5;
+f00915_7 Follow f00915_6;
+f00915_8 Follow f00915_7;
+f00915_9 Follow f00915_8;
+in00916 FLAG;
+f00916_1 Follow in00916;
+f00916_2 Follow f00916_1;
+f00916_3 Follow f00916_2;
+f00916_4 Follow f00916_3;
+f00916_5 Follow f00916_4;
+f00916_6 Follow f00916_5;
+f00916_7 Follow f00916_6;
+f00916_8 Follow f00916_7;
+f00916_9 Follow f00916_8;
+in00917 FLAG;
+f00917_1 Follow in00917;
+f00917_2 Follow f00917_1;
+f00917_3 Follow f00917_2;
+f00917_4 Follow f00917_3;
+f00917_5 Follow f00917_4;
+f00917_6 Follow f00917_5;
+f00917_7 Follow f00917_6;
+f00917_8 Follow f00917_7;
+f00917_9 Follow f00917_8;
+in00918 FLAG;
+f00918_1 Follow in00918;
+f00918_2 Follow f00918_1;
+f00918_3 Follow f00918_2;
+f00918_4 Follow f00918_3;
+f00918_5 Follow f00918_4;
+f00918_6 Follow f00918_5;
+f00918_7 Follow f00918_6;
+f00918_8 Follow f00918_7;
+f00918_9 Follow f00918_8;
+in00919 FLAG;
+f00919_1 Follow in00919;
+f00919_2 Follow f00919_1;
+f00919_3 Follow f00919_2;
+f00919_4 Follow f00919_3;
+f00919_5 Follow f00919_4;
+f00919_6 Follow f00919_5;
+f00919_7 Follow f00919_6;
+f00919_8 Follow f00919_7;
+f00919_9 Follow f00919_8;
+in00920 FLAG;
+f00920_1 Follow in00920;
+f00920_2 Follow f00920_1;
+f00920_3 Follow f00920_2;
+f00920_4 Follow f00920_3;
+f00920_5 Follow f00920_4;
+f00920_6 Follow f00920_5;
+f00920_7 Follow f00920_6;
+f00920_8 Follow f00920_7;
+f00920_9 Follow f00920_8;
+in00921 FLAG;
+f00921_1 Follow in00921;
+f00921_2 Follow f00921_1;
+f00921_3 Follow f00921_2;
+f00921_4 Follow f00921_3;
+f00921_5 Follow f00921_4;
+f00921_6 Follow f00921_5;
+f00921_7 Follow f00921_6;
+f00921_8 Follow f00921_7;
+f00921_9 Follow f00921_8;
+in00922 FLAG;
+f00922_1 Follow in00922;
+f00922_2 Follow f00922_1;
+f00922_3 Follow f00922_2;
+f00922_4 Follow f00922_3;
+f00922_5 Follow f00922_4;
+f00922_6 Follow f00922_5;
+f00922_7 Follow f00922_6;
+f00922_8 Follow f00922_7;
+f00922_9 Follow f00922_8;
+in00923 FLAG;
+f00923_1 Follow in00923;
+f00923_2 Follow f00923_1;
+f00923_3 Follow f00923_2;
+f00923_4 Follow f00923_3;
+f00923_5 Follow f00923_4;
+f00923_6 Follow f00923_5;
+f00923_7 Follow f00923_6;
+f00923_8 Follow f00923_7;
+f00923_9 Follow f00923_8;
+in00924 FLAG;
+f00924_1 Follow in00924;
+f00924_2 Follow f00924_1;
+f00924_3 Follow f00924_2;
+f00924_4 Follow f00924_3;
+f00924_5 Follow f00924_4;
+f00924_6 Follow f00924_5;
+f00924_7 Follow f00924_6;
+f00924_8 Follow f00924_7;
+f00924_9 Follow f00924_8;
+in00925 FLAG;
+f00925_1 Follow in00925;
+f00925_2 Follow f00925_1;
+f00925_3 Follow f00925_2;
+f00925_4 Follow f00925_3;
+f00925_5 Follow f00925_4;
+f00925_6 Follow f00925_5;
+f00925_7 Follow f00925_6;
+f00925_8 Follow f00925_7;
+f00925_9 Follow f00925_8;
+in00926 FLAG;
+f00926_1 Follow in00926;
+f00926_2 Follow f00926_1;
+f00926_3 Follow f00926_2;
+f00926_4 Follow f00926_3;
+f00926_5 Follow f00926_4;
+f00926_6 Follow f00926_5;
+f00926_7 Follow f00926_6;
+f00926_8 Follow f00926_7;
+f00926_9 Follow f00926_8;
+in00927 FLAG;
+f00927_1 Follow in00927;
+f00927_2 Follow f00927_1;
+f00927_3 Follow f00927_2;
+f00927_4 Follow f00927_3;
+f00927_5 Follow f00927_4;
+f00927_6 Follow f00927_5;
+f00927_7 Follow f00927_6;
+f00927_8 Follow f00927_7;
+f00927_9 Follow f00927_8;
+in00928 FLAG;
+f00928_1 Follow in00928;
+f00928_2 Follow f00928_1;
+f00928_3 Follow f00928_2;
+f00928_4 Follow f00928_3;
+f00928_5 Follow f00928_4;
+f00928_6 Follow f00928_5;
+f00928_7 Follow f00928_6;
+f00928_8 Follow f00928_7;
+f00928_9 Follow f00928_8;
+in00929 FLAG;
+f00929_1 Follow in00929;
+f00929_2 Follow f00929_1;
+f00929_3 Follow f00929_2;
+f00929_4 Follow f00929_3;
+f00929_5 Follow f00929_4;
+f00929_6 Follow f00929_5;
+f00929_7 Follow f00929_6;
+f00929_8 Follow f00929_7;
+f00929_9 Follow f00929_8;
+in00930 FLAG;
+f00930_1 Follow in00930;
+f00930_2 Follow f00930_1;
+f00930_3 Follow f00930_2;
+f00930_4 Follow f00930_3;
+f00930_5 Follow f00930_4;
+f00930_6 Follow f00930_5;
+f00930_7 Follow f00930_6;
+f00930_8 Follow f00930_7;
+f00930_9 Follow f00930_8;
+in00931 FLAG;
+f00931_1 Follow in00931;
+f00931_2 Follow f00931_1;
+f00931_3 Follow f00931_2;
+f00931_4 Follow f00931_3;
+f00931_5 Follow f00931_4;
+f00931_6 Follow f00931_5;
+f00931_7 Follow f00931_6;
+f00931_8 Follow f00931_7;
+f00931_9 Follow f00931_8;
+in00932 FLAG;
+f00932_1 Follow in00932;
+f00932_2 Follow f00932_1;
+f00932_3 Follow f00932_2;
+f00932_4 Follow f00932_3;
+f00932_5 Follow f00932_4;
+f00932_6 Follow f00932_5;
+f00932_7 Follow f00932_6;
+f00932_8 Follow f00932_7;
+f00932_9 Follow f00932_8;
+in00933 FLAG;
+f00933_1 Follow in00933;
+f00933_2 Follow f00933_1;
+f00933_3 Follow f00933_2;
+f00933_4 Follow f00933_3;
+f00933_5 Follow f00933_4;
+f00933_6 Follow f00933_5;
+f00933_7 Follow f00933_6;
+f00933_8 Follow f00933_7;
+f00933_9 Follow f00933_8;
+in00934 FLAG;
+f00934_1 Follow in00934;
+f00934_2 Follow f00934_1;
+f00934_3 Follow f00934_2;
+f00934_4 Follow f00934_3;
+f00934_5 Follow f00934_4;
+f00934_6 Follow f00934_5;
+f00934_7 Follow f00934_6;
+f00934_8 Follow f00934_7;
+f00934_9 Follow f00934_8;
+in00935 FLAG;
+f00935_1 Follow in00935;
+f00935_2 Follow f00935_1;
+f00935_3 Follow f00935_2;
+f00935_4 Follow f00935_3;
+f00935_5 Follow f00935_4;
+f00935_6 Follow f00935_5;
+f00935_7 Follow f00935_6;
+f00935_8 Follow f00935_7;
+f00935_9 Follow f00935_8;
+in00936 FLAG;
+f00936_1 Follow in00936;
+f00936_2 Follow f00936_1;
+f00936_3 Follow f00936_2;
+f00936_4 Follow f00936_3;
+f00936_5 Follow f00936_4;
+f00936_6 Follow f00936_5;
+f00936_7 Follow f00936_6;
+f00936_8 Follow f00936_7;
+f00936_9 Follow f00936_8;
+in00937 FLAG;
+f00937_1 Follow in00937;
+f00937_2 Follow f00937_1;
+f00937_3 Follow f00937_2;
+f00937_4 Follow f00937_3;
+f00937_5 Follow f00937_4;
+f00937_6 Follow f00937_5;
+f00937_7 Follow f00937_6;
+f00937_8 Follow f00937_7;
+f00937_9 Follow f00937_8;
+in00938 FLAG;
+f00938_1 Follow in00938;
+f00938_2 Follow f00938_1;
+f00938_3 Follow f00938_2;
+f00938_4 Follow f00938_3;
+f00938_5 Follow f00938_4;
+f00938_6 Follow f00938_5;
+f00938_7 Follow f00938_6;
+f00938_8 Follow f00938_7;
+f00938_9 Follow f00938_8;
+in00939 FLAG;
+f00939_1 Follow in00939;
+f00939_2 Follow f00939_1;
+f00939_3 Follow f00939_2;
+f00939_4 Follow f00939_3;
+f00939_5 Follow f00939_4;
+f00939_6 Follow f00939_5;
+f00939_7 Follow f00939_6;
+f00939_8 Follow f00939_7;
+f00939_9 Follow f00939_8;
+in00940 FLAG;
+f00940_1 Follow in00940;
+f00940_2 Follow f00940_1;
+f00940_3 Follow f00940_2;
+f00940_4 Follow f00940_3;
+f00940_5 Follow f00940_4;
+f00940_6 Follow f00940_5;
+f00940_7 Follow f00940_6;
+f00940_8 Follow f00940_7;
+f00940_9 Follow f00940_8;
+in00941 FLAG;
+f00941_1 Follow in00941;
+f00941_2 Follow f00941_1;
+f00941_3 Follow f00941_2;
+f00941_4 Follow f00941_3;
+f00941_5 Follow f00941_4;
+f00941_6 Follow f00941_5;
+f00941_7 Follow f00941_6;
+f00941_8 Follow f00941_7;
+f00941_9 Follow f00941_8;
+in00942 FLAG;
+f00942_1 Follow in00942;
+f00942_2 Follow f00942_1;
+f00942_3 Follow f00942_2;
+f00942_4 Follow f00942_3;
+f00942_5 Follow f00942_4;
+f00942_6 Follow f00942_5;
+f00942_7 Follow f00942_6;
+f00942_8 Follow f00942_7;
+f00942_9 Follow f00942_8;
+in00943 FLAG;
+f00943_1 Follow in00943;
+f00943_2 Follow f00943_1;
+f00943_3 Follow f00943_2;
+f00943_4 Follow f00943_3;
+f00943_5 Follow f00943_4;
+f00943_6 Follow f00943_5;
+f00943_7 Follow f00943_6;
+f00943_8 Follow f00943_7;
+f00943_9 Follow f00943_8;
+in00944 FLAG;
+f00944_1 Follow in00944;
+f00944_2 Follow f00944_1;
+f00944_3 Follow f00944_2;
+f00944_4 Follow f00944_3;
+f00944_5 Follow f00944_4;
+f00944_6 Follow f00944_5;
+f00944_7 Follow f00944_6;
+f00944_8 Follow f00944_7;
+f00944_9 Follow f00944_8;
+in00945 FLAG;
+f00945_1 Follow in00945;
+f00945_2 Follow f00945_1;
+f00945_3 Follow f00945_2;
+f00945_4 Follow f00945_3;
+f00945_5 Follow f00945_4;
+f00945_6 Follow f00945_5;
+f00945_7 Follow f00945_6;
+f00945_8 Follow f00945_7;
+f00945_9 Follow f00945_8;
+in00946 FLAG;
+f00946_1 Follow in00946;
+f00946_2 Follow f00946_1;
+f00946_3 Follow f00946_2;
+f00946_4 Follow f00946_3;
+f00946_5 Follow f00946_4;
+f00946_6 Follow f00946_5;
+f00946_7 Follow f00946_6;
+f00946_8 Follow f00946_7;
+f00946_9 Follow f00946_8;
+in00947 FLAG;
+f00947_1 Follow in00947;
+f00947_2 Follow f00947_1;
+f00947_3 Follow f00947_2;
+f00947_4 Follow f00947_3;
+f00947_5 Follow f00947_4;
+f00947_6 Follow f00947_5;
+f00947_7 Follow f00947_6;
+f00947_8 Follow f00947_7;
+f00947_9 Follow f00947_8;
+in00948 FLAG;
+f00948_1 Follow in00948;
+f00948_2 Follow f00948_1;
+f00948_3 Follow f00948_2;
+f00948_4 Follow f00948_3;
+f00948_5 Follow f00948_4;
+f00948_6 Follow f00948_5;
+f00948_7 Follow f00948_6;
+f00948_8 Follow f00948_7;
+f00948_9 Follow f00948_8;
+in00949 FLAG;
+f00949_1 Follow in00949;
+f00949_2 Follow f00949_1;
+f00949_3 Follow f00949_2;
+f00949_4 Follow f00949_3;
+f00949_5 Follow f00949_4;
+f00949_6 Follow f00949_5;
+f00949_7 Follow f00949_6;
+f00949_8 Follow f00949_7;
+f00949_9 Follow f00949_8;
+in00950 FLAG;
+f00950_1 Follow in00950;
+f00950_2 Follow f00950_1;
+f00950_3 Follow f00950_2;
+f00950_4 Follow f00950_3;
+f00950_5 Follow f00950_4;
+f00950_6 Follow f00950_5;
+f00950_7 Follow f00950_6;
+f00950_8 Follow f00950_7;
+f00950_9 Follow f00950_8;
+in00951 FLAG;
+f00951_1 Follow in00951;
+f00951_2 Follow f00951_1;
+f00951_3 Follow f00951_2;
+f00951_4 Follow f00951_3;
+f00951_5 Follow f00951_4;
+f00951_6 Follow f00951_5;
+f00951_7 Follow f00951_6;
+f00951_8 Follow f00951_7;
+f00951_9 Follow f00951_8;
+in00952 FLAG;
+f00952_1 Follow in00952;
+f00952_2 Follow f00952_1;
+f00952_3 Follow f00952_2;
+f00952_4 Follow f00952_3;
+f00952_5 Follow f00952_4;
+f00952_6 Follow f00952_5;
+f00952_7 Follow f00952_6;
+f00952_8 Follow f00952_7;
+f00952_9 Follow f00952_8;
+in00953 FLAG;
+f00953_1 Follow in00953;
+f00953_2 Follow f00953_1;
+f00953_3 Follow f00953_2;
+f00953_4 Follow f00953_3;
+f00953_5 Follow f00953_4;
+f00953_6 Follow f00953_5;
+f00953_7 Follow f00953_6;
+f00953_8 Follow f00953_7;
+f00953_9 Follow f00953_8;
+in00954 FLAG;
+f00954_1 Follow in00954;
+f00954_2 Follow f00954_1;
+f00954_3 Follow f00954_2;
+f00954_4 Follow f00954_3;
+f00954_5 Follow f00954_4;
+f00954_6 Follow f00954_5;
+f00954_7 Follow f00954_6;
+f00954_8 Follow f00954_7;
+f00954_9 Follow f00954_8;
+in00955 FLAG;
+f00955_1 Follow in00955;
+f00955_2 Follow f00955_1;
+f00955_3 Follow f00955_2;
+f00955_4 Follow f00955_3;
+f00955_5 Follow f00955_4;
+f00955_6 Follow f00955_5;
+f00955_7 Follow f00955_6;
+f00955_8 Follow f00955_7;
+f00955_9 Follow f00955_8;
+in00956 FLAG;
+f00956_1 Follow in00956;
+f00956_2 Follow f00956_1;
+f00956_3 Follow f00956_2;
+f00956_4 Follow f00956_3;
+f00956_5 Follow f00956_4;
+f00956_6 Follow f00956_5;
+f00956_7 Follow f00956_6;
+f00956_8 Follow f00956_7;
+f00956_9 Follow f00956_8;
+in00957 FLAG;
+f00957_1 Follow in00957;
+f00957_2 Follow f00957_1;
+f00957_3 Follow f00957_2;
+f00957_4 Follow f00957_3;
+f00957_5 Follow f00957_4;
+f00957_6 Follow f00957_5;
+f00957_7 Follow f00957_6;
+f00957_8 Follow f00957_7;
+f00957_9 Follow f00957_8;
+in00958 FLAG;
+f00958_1 Follow in00958;
+f00958_2 Follow f00958_1;
+f00958_3 Follow f00958_2;
+f00958_4 Follow f00958_3;
+f00958_5 Follow f00958_4;
+f00958_6 Follow f00958_5;
+f00958_7 Follow f00958_6;
+f00958_8 Follow f00958_7;
+f00958_9 Follow f00958_8;
+in00959 FLAG;
+f00959_1 Follow in00959;
+f00959_2 Follow f00959_1;
+f00959_3 Follow f00959_2;
+f00959_4 Follow f00959_3;
+f00959_5 Follow f00959_4;
+f00959_6 Follow f00959_5;
+f00959_7 Follow f00959_6;
+f00959_8 Follow f00959_7;
+f00959_9 Follow f00959_8;
+in00960 FLAG;
+f00960_1 Follow in00960;
+f00960_2 Follow f00960_1;
+f00960_3 Follow f00960_2;
+f00960_4 Follow f00960_3;
+f00960_5 Follow f00960_4;
+f00960_6 Follow f00960_5;
+f00960_7 Follow f00960_6;
+f00960_8 Follow f00960_7;
+f00960_9 Follow f00960_8;
+in00961 FLAG;
+f00961_1 Follow in00961;
+f00961_2 Follow f00961_1;
+f00961_3 Follow f00961_2;
+f00961_4 Follow f00961_3;
+f00961_5 Follow f00961_4;
+f00961_6 Follow f00961_5;
+f00961_7 Follow f00961_6;
+f00961_8 Follow f00961_7;
+f00961_9 Follow f00961_8;
+in00962 FLAG;
+f00962_1 Follow in00962;
+f00962_2 Follow f00962_1;
+f00962_3 Follow f00962_2;
+f00962_4 Follow f00962_3;
+f00962_5 Follow f00962_4;
+f00962_6 Follow f00962_5;
+f00962_7 Follow f00962_6;
+f00962_8 Follow f00962_7;
+f00962_9 Follow f00962_8;
+in00963 FLAG;
+f00963_1 Follow in00963;
+f00963_2 Follow f00963_1;
+f00963_3 Follow f00963_2;
+f00963_4 Follow f00963_3;
+f00963_5 Follow f00963_4;
+f00963_6 Follow f00963_5;
+f00963_7 Follow f00963_6;
+f00963_8 Follow f00963_7;
+f00963_9 Follow f00963_8;
+in00964 FLAG;
+f00964_1 Follow in00964;
+f00964_2 Follow f00964_1;
+f00964_3 Follow f00964_2;
+f00964_4 Follow f00964_3;
+f00964_5 Follow f00964_4;
+f00964_6 Follow f00964_5;
+f00964_7 Follow f00964_6;
+f00964_8 Follow f00964_7;
+f00964_9 Follow f00964_8;
+in00965 FLAG;
+f00965_1 Follow in00965;
+f00965_2 Follow f00965_1;
+f00965_3 Follow f00965_2;
+f00965_4 Follow f00965_3;
+f00965_5 Follow f00965_4;
+f00965_6 Follow f00965_5;
+f00965_7 Follow f00965_6;
+f00965_8 Follow f00965_7;
+f00965_9 Follow f00965_8;
+in00966 FLAG;
+f00966_1 Follow in00966;
+f00966_2 Follow f00966_1;
+f00966_3 Follow f00966_2;
+f00966_4 Follow f00966_3;
+f00966_5 Follow f00966_4;
+f00966_6 Follow f00966_5;
+f00966_7 Follow f00966_6;
+f00966_8 Follow f00966_7;
+f00966_9 Follow f00966_8;
+in00967 FLAG;
+f00967_1 Follow in00967;
+f00967_2 Follow f00967_1;
+f00967_3 Follow f00967_2;
+f00967_4 Follow f00967_3;
+f00967_5 Follow f00967_4;
+f00967_6 Follow f00967_5;
+f00967_7 Follow f00967_6;
+f00967_8 Follow f00967_7;
+f00967_9 Follow f00967_8;
+in00968 FLAG;
+f00968_1 Follow in00968;
+f00968_2 Follow f00968_1;
+f00968_3 Follow f00968_2;
+f00968_4 Follow f00968_3;
+f00968_5 Follow f00968_4;
+f00968_6 Follow f00968_5;
+f00968_7 Follow f00968_6;
+f00968_8 Follow f00968_7;
+f00968_9 Follow f00968_8;
+in00969 FLAG;
+f00969_1 Follow in00969;
+f00969_2 Follow f00969_1;
+f00969_3 Follow f00969_2;
+f00969_4 Follow f00969_3;
+f00969_5 Follow f00969_4;
+f00969_6 Follow f00969_5;
+f00969_7 Follow f00969_6;
+f00969_8 Follow f00969_7;
+f00969_9 Follow f00969_8;
+in00970 FLAG;
+f00970_1 Follow in00970;
+f00970_2 Follow f00970_1;
+f00970_3 Follow f00970_2;
+f00970_4 Follow f00970_3;
+f00970_5 Follow f00970_4;
+f00970_6 Follow f00970_5;
+f00970_7 Follow f00970_6;
+f00970_8 Follow f00970_7;
+f00970_9 Follow f00970_8;
+in00971 FLAG;
+f00971_1 Follow in00971;
+f00971_2 Follow f00971_1;
+f00971_3 Follow f00971_2;
+f00971_4 Follow f00971_3;
+f00971_5 Follow f00971_4;
+f00971_6 Follow f00971_5;
+f00971_7 Follow f00971_6;
+f00971_8 Follow f00971_7;
+f00971_9 Follow f00971_8;
+in00972 FLAG;
+f00972_1 Follow in00972;
+f00972_2 Follow f00972_1;
+f00972_3 Follow f00972_2;
+f00972_4 Follow f00972_3;
+f00972_5 Follow f00972_4;
+f00972_6 Follow f00972_5;
+f00972_7 Follow f00972_6;
+f00972_8 Follow f00972_7;
+f00972_9 Follow f00972_8;
+in00973 FLAG;
+f00973_1 Follow in00973;
+f00973_2 Follow f00973_1;
+f00973_3 Follow f00973_2;
+f00973_4 Follow f00973_3;
+f00973_5 Follow f00973_4;
+f00973_6 Follow f00973_5;
+f00973_7 Follow f00973_6;
+f00973_8 Follow f00973_7;
+f00973_9 Follow f00973_8;
+in00974 FLAG;
+f00974_1 Follow in00974;
+f00974_2 Follow f00974_1;
+f00974_3 Follow f00974_2;
+f00974_4 Follow f00974_3;
+f00974_5 Follow f00974_4;
+f00974_6 Follow f00974_5;
+f00974_7 Follow f00974_6;
+f00974_8 Follow f00974_7;
+f00974_9 Follow f00974_8;
+in00975 FLAG;
+f00975_1 Follow in00975;
+f00975_2 Follow f00975_1;
+f00975_3 Follow f00975_2;
+f00975_4 Follow f00975_3;
+f00975_5 Follow f00975_4;
+f00975_6 Follow f00975_5;
+f00975_7 Follow f00975_6;
+f00975_8 Follow f00975_7;
+f00975_9 Follow f00975_8;
+in00976 FLAG;
+f00976_1 Follow in00976;
+f00976_2 Follow f00976_1;
+f00976_3 Follow f00976_2;
+f00976_4 Follow f00976_3;
+f00976_5 Follow f00976_4;
+f00976_6 Follow f00976_5;
+f00976_7 Follow f00976_6;
+f00976_8 Follow f00976_7;
+f00976_9 Follow f00976_8;
+in00977 FLAG;
+f00977_1 Follow in00977;
+f00977_2 Follow f00977_1;
+f00977_3 Follow f00977_2;
+f00977_4 Follow f00977_3;
+f00977_5 Follow f00977_4;
+f00977_6 Follow f00977_5;
+f00977_7 Follow f00977_6;
+f00977_8 Follow f00977_7;
+f00977_9 Follow f00977_8;
+in00978 FLAG;
+f00978_1 Follow in00978;
+f00978_2 Follow f00978_1;
+f00978_3 Follow f00978_2;
+f00978_4 Follow f00978_3;
+f00978_5 Follow f00978_4;
+f00978_6 Follow f00978_5;
+f00978_7 Follow f00978_6;
+f00978_8 Follow f00978_7;
+f00978_9 Follow f00978_8;
+in00979 FLAG;
+f00979_1 Follow in00979;
+f00979_2 Follow f00979_1;
+f00979_3 Follow f00979_2;
+f00979_4 Follow f00979_3;
+f00979_5 Follow f00979_4;
+f00979_6 Follow f00979_5;
+f00979_7 Follow f00979_6;
+f00979_8 Follow f00979_7;
+f00979_9 Follow f00979_8;
+in00980 FLAG;
+f00980_1 Follow in00980;
+f00980_2 Follow f00980_1;
+f00980_3 Follow f00980_2;
+f00980_4 Follow f00980_3;
+f00980_5 Follow f00980_4;
+f00980_6 Follow f00980_5;
+f00980_7 Follow f00980_6;
+f00980_8 Follow f00980_7;
+f00980_9 Follow f00980_8;
+in00981 FLAG;
+f00981_1 Follow in00981;
+f00981_2 Follow f00981_1;
+f00981_3 Follow f00981_2;
+f00981_4 Follow f00981_3;
+f00981_5 Follow f00981_4;
+f00981_6 Follow f00981_5;
+f00981_7 Follow f00981_6;
+f00981_8 Follow f00981_7;
+f00981_9 Follow f00981_8;
+in00982 FLAG;
+f00982_1 Follow in00982;
+f00982_2 Follow f00982_1;
+f00982_3 Follow f00982_2;
+f00982_4 Follow f00982_3;
+f00982_5 Follow f00982_4;
+f00982_6 Follow f00982_5;
+f00982_7 Follow f00982_6;
+f00982_8 Follow f00982_7;
+f00982_9 Follow f00982_8;
+in00983 FLAG;
+f00983_1 Follow in00983;
+f00983_2 Follow f00983_1;
+f00983_3 Follow f00983_2;
+f00983_4 Follow f00983_3;
+f00983_5 Follow f00983_4;
+f00983_6 Follow f00983_5;
+f00983_7 Follow f00983_6;
+f00983_8 Follow f00983_7;
+f00983_9 Follow f00983_8;
+in00984 FLAG;
+f00984_1 Follow in00984;
+f00984_2 Follow f00984_1;
+f00984_3 Follow f00984_2;
+f00984_4 Follow f00984_3;
+f00984_5 Follow f00984_4;
+f00984_6 Follow f00984_5;
+f00984_7 Follow f00984_6;
+f00984_8 Follow f00984_7;
+f00984_9 Follow f00984_8;
+in00985 FLAG;
+f00985_1 Follow in00985;
+f00985_2 Follow f00985_1;
+f00985_3 Follow f00985_2;
+f00985_4 Follow f00985_3;
+f00985_5 Follow f00985_4;
+f00985_6 Follow f00985_5;
+f00985_7 Follow f00985_6;
+f00985_8 Follow f00985_7;
+f00985_9 Follow f00985_8;
+in00986 FLAG;
+f00986_1 Follow in00986;
+f00986_2 Follow f00986_1;
+f00986_3 Follow f00986_2;
+f00986_4 Follow f00986_3;
+f00986_5 Follow f00986_4;
+f00986_6 Follow f00986_5;
+f00986_7 Follow f00986_6;
+f00986_8 Follow f00986_7;
+f00986_9 Follow f00986_8;
+in00987 FLAG;
+f00987_1 Follow in00987;
+f00987_2 Follow f00987_1;
+f00987_3 Follow f00987_2;
+f00987_4 Follow f00987_3;
+f00987_5 Follow f00987_4;
+f00987_6 Follow f00987_5;
+f00987_7 Follow f00987_6;
+f00987_8 Follow f00987_7;
+f00987_9 Follow f00987_8;
+in00988 FLAG;
+f00988_1 Follow in00988;
+f00988_2 Follow f00988_1;
+f00988_3 Follow f00988_2;
+f00988_4 Follow f00988_3;
+f00988_5 Follow f00988_4;
+f00988_6 Follow f00988_5;
+f00988_7 Follow f00988_6;
+f00988_8 Follow f00988_7;
+f00988_9 Follow f00988_8;
+in00989 FLAG;
+f00989_1 Follow in00989;
+f00989_2 Follow f00989_1;
+f00989_3 Follow f00989_2;
+f00989_4 Follow f00989_3;
+f00989_5 Follow f00989_4;
+f00989_6 Follow f00989_5;
+f00989_7 Follow f00989_6;
+f00989_8 Follow f00989_7;
+f00989_9 Follow f00989_8;
+in00990 FLAG;
+f00990_1 Follow in00990;
+f00990_2 Follow f00990_1;
+f00990_3 Follow f00990_2;
+f00990_4 Follow f00990_3;
+f00990_5 Follow f00990_4;
+f00990_6 Follow f00990_5;
+f00990_7 Follow f00990_6;
+f00990_8 Follow f00990_7;
+f00990_9 Follow f00990_8;
+in00991 FLAG;
+f00991_1 Follow in00991;
+f00991_2 Follow f00991_1;
+f00991_3 Follow f00991_2;
+f00991_4 Follow f00991_3;
+f00991_5 Follow f00991_4;
+f00991_6 Follow f00991_5;
+f00991_7 Follow f00991_6;
+f00991_8 Follow f00991_7;
+f00991_9 Follow f00991_8;
+in00992 FLAG;
+f00992_1 Follow in00992;
+f00992_2 Follow f00992_1;
+f00992_3 Follow f00992_2;
+f00992_4 Follow f00992_3;
+f00992_5 Follow f00992_4;
+f00992_6 Follow f00992_5;
+f00992_7 Follow f00992_6;
+f00992_8 Follow f00992_7;
+f00992_9 Follow f00992_8;
+in00993 FLAG;
+f00993_1 Follow in00993;
+f00993_2 Follow f00993_1;
+f00993_3 Follow f00993_2;
+f00993_4 Follow f00993_3;
+f00993_5 Follow f00993_4;
+f00993_6 Follow f00993_5;
+f00993_7 Follow f00993_6;
+f00993_8 Follow f00993_7;
+f00993_9 Follow f00993_8;
+in00994 FLAG;
+f00994_1 Follow in00994;
+f00994_2 Follow f00994_1;
+f00994_3 Follow f00994_2;
+f00994_4 Follow f00994_3;
+f00994_5 Follow f00994_4;
+f00994_6 Follow f00994_5;
+f00994_7 Follow f00994_6;
+f00994_8 Follow f00994_7;
+f00994_9 Follow f00994_8;
+in00995 FLAG;
+f00995_1 Follow in00995;
+f00995_2 Follow f00995_1;
+f00995_3 Follow f00995_2;
+f00995_4 Follow f00995_3;
+f00995_5 Follow f00995_4;
+f00995_6 Follow f00995_5;
+f00995_7 Follow f00995_6;
+f00995_8 Follow f00995_7;
+f00995_9 Follow f00995_8;
+in00996 FLAG;
+f00996_1 Follow in00996;
+f00996_2 Follow f00996_1;
+f00996_3 Follow f00996_2;
+f00996_4 Follow f00996_3;
+f00996_5 Follow f00996_4;
+f00996_6 Follow f00996_5;
+f00996_7 Follow f00996_6;
+f00996_8 Follow f00996_7;
+f00996_9 Follow f00996_8;
+in00997 FLAG;
+f00997_1 Follow in00997;
+f00997_2 Follow f00997_1;
+f00997_3 Follow f00997_2;
+f00997_4 Follow f00997_3;
+f00997_5 Follow f00997_4;
+f00997_6 Follow f00997_5;
+f00997_7 Follow f00997_6;
+f00997_8 Follow f00997_7;
+f00997_9 Follow f00997_8;
+in00998 FLAG;
+f00998_1 Follow in00998;
+f00998_2 Follow f00998_1;
+f00998_3 Follow f00998_2;
+f00998_4 Follow f00998_3;
+f00998_5 Follow f00998_4;
+f00998_6 Follow f00998_5;
+f00998_7 Follow f00998_6;
+f00998_8 Follow f00998_7;
+f00998_9 Follow f00998_8;
+in00999 FLAG;
+f00999_1 Follow in00999;
+f00999_2 Follow f00999_1;
+f00999_3 Follow f00999_2;
+f00999_4 Follow f00999_3;
+f00999_5 Follow f00999_4;
+f00999_6 Follow f00999_5;
+f00999_7 Follow f00999_6;
+f00999_8 Follow f00999_7;
+f00999_9 Follow f00999_8;
+
+group0 LIST in00000, in00001, in00002, in00003, in00004, in00005, in00006, in00007, in00008, in00009;
+watch0 Watch group0;
+
+group1 LIST in00010, in00011, in00012, in00013, in00014, in00015, in00016, in00017, in00018, in00019;
+watch1 Watch group1;
+
+group2 LIST in00020, in00021, in00022, in00023, in00024, in00025, in00026, in00027, in00028, in00029;
+watch2 Watch group2;
+
+group3 LIST in00030, in00031, in00032, in00033, in00034, in00035, in00036, in00037, in00038, in00039;
+watch3 Watch group3;
+
+group4 LIST in00040, in00041, in00042, in00043, in00044, in00045, in00046, in00047, in00048, in00049;
+watch4 Watch group4;
+
+group5 LIST in00050, in00051, in00052, in00053, in00054, in00055, in00056, in00057, in00058, in00059;
+watch5 Watch group5;
+
+group6 LIST in00060, in00061, in00062, in00063, in00064, in00065, in00066, in00067, in00068, in00069;
+watch6 Watch group6;
+
+group7 LIST in00070, in00071, in00072, in00073, in00074, in00075, in00076, in00077, in00078, in00079;
+watch7 Watch group7;
+
+group8 LIST in00080, in00081, in00082, in00083, in00084, in00085, in00086, in00087, in00088, in00089;
+watch8 Watch group8;
+
+group9 LIST in00090, in00091, in00092, in00093, in00094, in00095, in00096, in00097, in00098, in00099;
+watch9 Watch group9;
+
+group10 LIST in00100, in00101, in00102, in00103, in00104, in00105, in00106, in00107, in00108, in00109;
+watch10 Watch group10;
+
+group11 LIST in00110, in00111, in00112, in00113, in00114, in00115, in00116, in00117, in00118, in00119;
+watch11 Watch group11;
+
+group12 LIST in00120, in00121, in00122, in00123, in00124, in00125, in00126, in00127, in00128, in00129;
+watch12 Watch group12;
+
+group13 LIST in00130, in00131, in00132, in00133, in00134, in00135, in00136, in00137, in00138, in00139;
+watch13 Watch group13;
+
+group14 LIST in00140, in00141, in00142, in00143, in00144, in00145, in00146, in00147, in00148, in00149;
+watch14 Watch group14;
+
+group15 LIST in00150, in00151, in00152, in00153, in00154, in00155, in00156, in00157, in00158, in00159;
+watch15 Watch group15;
+
+group16 LIST in00160, in00161, in00162, in00163, in00164, in00165, in00166, in00167, in00168, in00169;
+watch16 Watch group16;
+
+group17 LIST in00170, in00171, in00172, in00173, in00174, in00175, in00176, in00177, in00178, in00179;
+watch17 Watch group17;
+
+group18 LIST in00180, in00181, in00182, in00183, in00184, in00185, in00186, in00187, in00188, in00189;
+watch18 Watch group18;
+
+group19 LIST in00190, in00191, in00192, in00193, in00194, in00195, in00196, in00197, in00198, in00199;
+watch19 Watch group19;
+
+group20 LIST in00200, in00201, in00202, in00203, in00204, in00205, in00206, in00207, in00208, in00209;
+watch20 Watch group20;
+
+group21 LIST in00210, in00211, in00212, in00213, in00214, in00215, in00216, in00217, in00218, in00219;
+watch21 Watch group21;
+
+group22 LIST in00220, in00221, in00222, in00223, in00224, in00225, in00226, in00227, in00228, in00229;
+watch22 Watch group22;
+
+group23 LIST in00230, in00231, in00232, in00233, in00234, in00235, in00236, in00237, in00238, in00239;
+watch23 Watch group23;
+
+group24 LIST in00240, in00241, in00242, in00243, in00244, in00245, in00246, in00247, in00248, in00249;
+watch24 Watch group24;
+
+group25 LIST in00250, in00251, in00252, in00253, in00254, in00255, in00256, in00257, in00258, in00259;
+watch25 Watch group25;
+
+group26 LIST in00260, in00261, in00262, in00263, in00264, in00265, in00266, in00267, in00268, in00269;
+watch26 Watch group26;
+
+group27 LIST in00270, in00271, in00272, in00273, in00274, in00275, in00276, in00277, in00278, in00279;
+watch27 Watch group27;
+
+group28 LIST in00280, in00281, in00282, in00283, in00284, in00285, in00286, in00287, in00288, in00289;
+watch28 Watch group28;
+
+group29 LIST in00290, in00291, in00292, in00293, in00294, in00295, in00296, in00297, in00298, in00299;
+watch29 Watch group29;
+
+group30 LIST in00300, in00301, in00302, in00303, in00304, in00305, in00306, in00307, in00308, in00309;
+watch30 Watch group30;
+
+group31 LIST in00310, in00311, in00312, in00313, in00314, in00315, in00316, in00317, in00318, in00319;
+watch31 Watch group31;
+
+group32 LIST in00320, in00321, in00322, in00323, in00324, in00325, in00326, in00327, in00328, in00329;
+watch32 Watch group32;
+
+group33 LIST in00330, in00331, in00332, in00333, in00334, in00335, in00336, in00337, in00338, in00339;
+watch33 Watch group33;
+
+group34 LIST in00340, in00341, in00342, in00343, in00344, in00345, in00346, in00347, in00348, in00349;
+watch34 Watch group34;
+
+group35 LIST in00350, in00351, in00352, in00353, in00354, in00355, in00356, in00357, in00358, in00359;
+watch35 Watch group35;
+
+group36 LIST in00360, in00361, in00362, in00363, in00364, in00365, in00366, in00367, in00368, in00369;
+watch36 Watch group36;
+
+group37 LIST in00370, in00371, in00372, in00373, in00374, in00375, in00376, in00377, in00378, in00379;
+watch37 Watch group37;
+
+group38 LIST in00380, in00381, in00382, in00383, in00384, in00385, in00386, in00387, in00388, in00389;
+watch38 Watch group38;
+
+group39 LIST in00390, in00391, in00392, in00393, in00394, in00395, in00396, in00397, in00398, in00399;
+watch39 Watch group39;
+
+group40 LIST in00400, in00401, in00402, in00403, in00404, in00405, in00406, in00407, in00408, in00409;
+watch40 Watch group40;
+
+group41 LIST in00410, in00411, in00412, in00413, in00414, in00415, in00416, in00417, in00418, in00419;
+watch41 Watch group41;
+
+group42 LIST in00420, in00421, in00422, in00423, in00424, in00425, in00426, in00427, in00428, in00429;
+watch42 Watch group42;
+
+group43 LIST in00430, in00431, in00432, in00433, in00434, in00435, in00436, in00437, in00438, in00439;
+watch43 Watch group43;
+
+group44 LIST in00440, in00441, in00442, in00443, in00444, in00445, in00446, in00447, in00448, in00449;
+watch44 Watch group44;
+
+group45 LIST in00450, in00451, in00452, in00453, in00454, in00455, in00456, in00457, in00458, in00459;
+watch45 Watch group45;
+
+group46 LIST in00460, in00461, in00462, in00463, in00464, in00465, in00466, in00467, in00468, in00469;
+watch46 Watch group46;
+
+group47 LIST in00470, in00471, in00472, in00473, in00474, in00475, in00476, in00477, in00478, in00479;
+watch47 Watch group47;
+
+group48 LIST in00480, in00481, in00482, in00483, in00484, in00485, in00486, in00487, in00488, in00489;
+watch48 Watch group48;
+
+group49 LIST in00490, in00491, in00492, in00493, in00494, in00495, in00496, in00497, in00498, in00499;
+watch49 Watch group49;
+
+group50 LIST in00500, in00501, in00502, in00503, in00504, in00505, in00506, in00507, in00508, in00509;
+watch50 Watch group50;
+
+group51 LIST in00510, in00511, in00512, in00513, in00514, in00515, in00516, in00517, in00518, in00519;
+watch51 Watch group51;
+
+group52 LIST in00520, in00521, in00522, in00523, in00524, in00525, in00526, in00527, in00528, in00529;
+watch52 Watch group52;
+
+group53 LIST in00530, in00531, in00532, in00533, in00534, in00535, in00536, in00537, in00538, in00539;
+watch53 Watch group53;
+
+group54 LIST in00540, in00541, in00542, in00543, in00544, in00545, in00546, in00547, in00548, in00549;
+watch54 Watch group54;
+
+group55 LIST in00550, in00551, in00552, in00553, in00554, in00555, in00556, in00557, in00558, in00559;
+watch55 Watch group55;
+
+group56 LIST in00560, in00561, in00562, in00563, in00564, in00565, in00566, in00567, in00568, in00569;
+watch56 Watch group56;
+
+group57 LIST in00570, in00571, in00572, in00573, in00574, in00575, in00576, in00577, in00578, in00579;
+watch57 Watch group57;
+
+group58 LIST in00580, in00581, in00582, in00583, in00584, in00585, in00586, in00587, in00588, in00589;
+watch58 Watch group58;
+
+group59 LIST in00590, in00591, in00592, in00593, in00594, in00595, in00596, in00597, in00598, in00599;
+watch59 Watch group59;
+
+group60 LIST in00600, in00601, in00602, in00603, in00604, in00605, in00606, in00607, in00608, in00609;
+watch60 Watch group60;
+
+group61 LIST in00610, in00611, in00612, in00613, in00614, in00615, in00616, in00617, in00618, in00619;
+watch61 Watch group61;
+
+group62 LIST in00620, in00621, in00622, in00623, in00624, in00625, in00626, in00627, in00628, in00629;
+watch62 Watch group62;
+
+group63 LIST in00630, in00631, in00632, in00633, in00634, in00635, in00636, in00637, in00638, in00639;
+watch63 Watch group63;
+
+group64 LIST in00640, in00641, in00642, in00643, in00644, in00645, in00646, in00647, in00648, in00649;
+watch64 Watch group64;
+
+group65 LIST in00650, in00651, in00652, in00653, in00654, in00655, in00656, in00657, in00658, in00659;
+watch65 Watch group65;
+
+group66 LIST in00660, in00661, in00662, in00663, in00664, in00665, in00666, in00667, in00668, in00669;
+watch66 Watch group66;
+
+group67 LIST in00670, in00671, in00672, in00673, in00674, in00675, in00676, in00677, in00678, in00679;
+watch67 Watch group67;
+
+group68 LIST in00680, in00681, in00682, in00683, in00684, in00685, in00686, in00687, in00688, in00689;
+watch68 Watch group68;
+
+group69 LIST in00690, in00691, in00692, in00693, in00694, in00695, in00696, in00697, in00698, in00699;
+watch69 Watch group69;
+
+group70 LIST in00700, in00701, in00702, in00703, in00704, in00705, in00706, in00707, in00708, in00709;
+watch70 Watch group70;
+
+group71 LIST in00710, in00711, in00712, in00713, in00714, in00715, in00716, in00717, in00718, in00719;
+watch71 Watch group71;
+
+group72 LIST in00720, in00721, in00722, in00723, in00724, in00725, in00726, in00727, in00728, in00729;
+watch72 Watch group72;
+
+group73 LIST in00730, in00731, in00732, in00733, in00734, in00735, in00736, in00737, in00738, in00739;
+watch73 Watch group73;
+
+group74 LIST in00740, in00741, in00742, in00743, in00744, in00745, in00746, in00747, in00748, in00749;
+watch74 Watch group74;
+
+group75 LIST in00750, in00751, in00752, in00753, in00754, in00755, in00756, in00757, in00758, in00759;
+watch75 Watch group75;
+
+group76 LIST in00760, in00761, in00762, in00763, in00764, in00765, in00766, in00767, in00768, in00769;
+watch76 Watch group76;
+
+group77 LIST in00770, in00771, in00772, in00773, in00774, in00775, in00776, in00777, in00778, in00779;
+watch77 Watch group77;
+
+group78 LIST in00780, in00781, in00782, in00783, in00784, in00785, in00786, in00787, in00788, in00789;
+watch78 Watch group78;
+
+group79 LIST in00790, in00791, in00792, in00793, in00794, in00795, in00796, in00797, in00798, in00799;
+watch79 Watch group79;
+
+group80 LIST in00800, in00801, in00802, in00803, in00804, in00805, in00806, in00807, in00808, in00809;
+watch80 Watch group80;
+
+group81 LIST in00810, in00811, in00812, in00813, in00814, in00815, in00816, in00817, in00818, in00819;
+watch81 Watch group81;
+
+group82 LIST in00820, in00821, in00822, in00823, in00824, in00825, in00826, in00827, in00828, in00829;
+watch82 Watch group82;
+
+group83 LIST in00830, in00831, in00832, in00833, in00834, in00835, in00836, in00837, in00838, in00839;
+watch83 Watch group83;
+
+group84 LIST in00840, in00841, in00842, in00843, in00844, in00845, in00846, in00847, in00848, in00849;
+watch84 Watch group84;
+
+group85 LIST in00850, in00851, in00852, in00853, in00854, in00855, in00856, in00857, in00858, in00859;
+watch85 Watch group85;
+
+group86 LIST in00860, in00861, in00862, in00863, in00864, in00865, in00866, in00867, in00868, in00869;
+watch86 Watch group86;
+
+group87 LIST in00870, in00871, in00872, in00873, in00874, in00875, in00876, in00877, in00878, in00879;
+watch87 Watch group87;
+
+group88 LIST in00880, in00881, in00882, in00883, in00884, in00885, in00886, in00887, in00888, in00889;
+watch88 Watch group88;
+
+group89 LIST in00890, in00891, in00892, in00893, in00894, in00895, in00896, in00897, in00898, in00899;
+watch89 Watch group89;
+
+group90 LIST in00900, in00901, in00902, in00903, in00904, in00905, in00906, in00907, in00908, in00909;
+watch90 Watch group90;
+
+group91 LIST in00910, in00911, in00912, in00913, in00914, in00915, in00916, in00917, in00918, in00919;
+watch91 Watch group91;
+
+group92 LIST in00920, in00921, in00922, in00923, in00924, in00925, in00926, in00927, in00928, in00929;
+watch92 Watch group92;
+
+group93 LIST in00930, in00931, in00932, in00933, in00934, in00935, in00936, in00937, in00938, in00939;
+watch93 Watch group93;
+
+group94 LIST in00940, in00941, in00942, in00943, in00944, in00945, in00946, in00947, in00948, in00949;
+watch94 Watch group94;
+
+group95 LIST in00950, in00951, in00952, in00953, in00954, in00955, in00956, in00957, in00958, in00959;
+watch95 Watch group95;
+
+group96 LIST in00960, in00961, in00962, in00963, in00964, in00965, in00966, in00967, in00968, in00969;
+watch96 Watch group96;
+
+group97 LIST in00970, in00971, in00972, in00973, in00974, in00975, in00976, in00977, in00978, in00979;
+watch97 Watch group97;
+
+group98 LIST in00980, in00981, in00982, in00983, in00984, in00985, in00986, in00987, in00988, in00989;
+watch98 Watch group98;
+
+group99 LIST in00990, in00991, in00992, in00993, in00994, in00995, in00996, in00997, in00998, in00999;
+watch99 Watch group99;